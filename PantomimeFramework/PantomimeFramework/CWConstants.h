@@ -458,6 +458,12 @@ extern NSString * _Nonnull const PantomimeFolderNameToIgnore;
  */
 extern NSString * _Nonnull const PantomimeIMAPDefaultDescriptors;
 
+/**
+ Key of the CWMessage property holding the digest (NSData) of the literal the message's
+ content was fetched from. See CWIMAPStore's literalDigestAlgorithm.
+ */
+extern NSString * _Nonnull const PantomimeMessageLiteralDigest;
+
 /**
  IMAP Descriptor for fetching whole body.
  */
@@ -0,0 +1,138 @@
+//
+//  CWDigest.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#ifndef _Pantomime_H_CWDigest
+#define _Pantomime_H_CWDigest
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*!
+  @typedef CWDigestAlgorithm
+  @abstract The message digest algorithms CWDigest supports.
+  @constant CWDigestAlgorithmNone No digest.
+  @constant CWDigestAlgorithmMD5 MD5 (RFC 1321).
+  @constant CWDigestAlgorithmSHA1 SHA-1 (FIPS 180-4).
+  @constant CWDigestAlgorithmSHA256 SHA-256 (FIPS 180-4).
+*/
+typedef NS_ENUM(NSInteger, CWDigestAlgorithm) {
+    CWDigestAlgorithmNone = 0,
+    CWDigestAlgorithmMD5,
+    CWDigestAlgorithmSHA1,
+    CWDigestAlgorithmSHA256
+};
+
+/*!
+  @class CWDigest
+  @abstract Incremental message digest.
+  @discussion This class computes a message digest over data handed to
+              it in any number of pieces, so large payloads can be
+              hashed while they are read. The system's crypto library
+              is used when available, otherwise MD5 falls back to the
+              implementation bundled with Pantomime and the other
+              algorithms are not available.
+*/
+@interface CWDigest : NSObject
+
+/*!
+  @method isAlgorithmAvailable:
+  @discussion This method is used to verify if an algorithm can be used
+              on this system.
+  @param theAlgorithm The algorithm.
+  @result YES if instances can be created for <i>theAlgorithm</i>.
+*/
++ (BOOL) isAlgorithmAvailable: (CWDigestAlgorithm) theAlgorithm;
+
+/*!
+  @method digestLengthForAlgorithm:
+  @discussion This method is used to obtain the length of the digests
+              computed by an algorithm.
+  @param theAlgorithm The algorithm.
+  @result The length in bytes, 0 for CWDigestAlgorithmNone.
+*/
++ (NSUInteger) digestLengthForAlgorithm: (CWDigestAlgorithm) theAlgorithm;
+
+/*!
+  @method digestWithAlgorithm:
+  @discussion See -initWithAlgorithm:.
+*/
++ (nullable instancetype) digestWithAlgorithm: (CWDigestAlgorithm) theAlgorithm;
+
+/*!
+  @method digestOfData:algorithm:
+  @discussion This method is used to compute the digest of a complete
+              NSData instance at once.
+  @param theData The data.
+  @param theAlgorithm The algorithm.
+  @result The digest, nil if <i>theAlgorithm</i> is not available.
+*/
++ (nullable NSData *) digestOfData: (NSData *) theData
+                         algorithm: (CWDigestAlgorithm) theAlgorithm;
+
+/*!
+  @method hexStringFromData:
+  @discussion This method is used to format a digest, or any data, as
+              lowercase hexadecimal digits.
+  @param theData The data.
+  @result The hexadecimal string.
+*/
++ (NSString *) hexStringFromData: (NSData *) theData;
+
+/*!
+  @method initWithAlgorithm:
+  @discussion This is the designated initializer for the CWDigest class.
+  @param theAlgorithm The algorithm to use.
+  @result An instance of CWDigest, nil if <i>theAlgorithm</i> is
+          not available.
+*/
+- (nullable instancetype) initWithAlgorithm: (CWDigestAlgorithm) theAlgorithm NS_DESIGNATED_INITIALIZER;
+
+- (instancetype) init NS_UNAVAILABLE;
+
+/*!
+  @method algorithm
+  @result The algorithm of the receiver.
+*/
+- (CWDigestAlgorithm) algorithm;
+
+/*!
+  @method updateWithBytes:length:
+  @discussion This method is used to hash the next piece of the message.
+              It has no effect once the digest has been finalized.
+  @param theBytes The bytes.
+  @param theLength The number of bytes.
+*/
+- (void) updateWithBytes: (const void *) theBytes
+                  length: (NSUInteger) theLength;
+
+/*!
+  @method updateWithData:
+  @discussion See -updateWithBytes:length:.
+*/
+- (void) updateWithData: (NSData *) theData;
+
+/*!
+  @method finalizeDigest
+  @discussion This method is used to end the message and obtain its
+              digest. Calling it again returns the same digest.
+  @result The digest.
+*/
+- (NSData *) finalizeDigest;
+
+/*!
+  @method digestAsString
+  @discussion See -finalizeDigest.
+  @result The digest as lowercase hexadecimal digits.
+*/
+- (NSString *) digestAsString;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif // _Pantomime_H_CWDigest
@@ -406,8 +406,8 @@ extern NSString * _Nonnull const PantomimeFolderSeparatorKey;
 	      use -appendMessageFromRawSource: flags: if you
 	      want the message to be saved to the underlying
 	      store. Generally, you should not use this
-	      method directly. If the folder was threaded,
-	      this method will NOT thread the appended message.
+	      method directly. If the folder is threaded,
+	      the message is added to its thread.
   @param theMessage The message to append to the folder.
 */
 - (void) appendMessage: (CWMessage * _Nonnull) theMessage;
@@ -420,7 +420,6 @@ extern NSString * _Nonnull const PantomimeFolderSeparatorKey;
 	      to the underlying store. This method will raise an
 	      exception if it's invoked on an instance of CWFolder or
 	      CWPOP3Folder instead of an instance of CWIMAPFolder and CWLocalFolder.
-	      If the folder was threaded, this method will NOT thread the appended message.
 	      Methods will be invoked on the delegate and notifications
 	      will be posted. See the PantomimeFolderDelegate informal
 	      protocol for more details.
@@ -438,6 +437,12 @@ extern NSString * _Nonnull const PantomimeFolderSeparatorKey;
 	      NO as the parameter and the the same for messages
 	      marked as read (see -setShowRead:). Note that the
 	      messages MIGHT NOT been all completely initialized.
+
+              The folder keeps the Seen, Deleted, Flagged and Answered
+              flags of its messages in bitmaps, kept up to date as
+              the CWFlags instances of the messages change. The array
+              is computed from them a word at a time and then updated
+              in place when a flag change shows or hides a message.
   @result An array of all visible messages.
 */
 - (NSArray * _Nonnull) allMessages;
@@ -513,8 +518,8 @@ extern NSString * _Nonnull const PantomimeFolderSeparatorKey;
                the folder. It is used when transferring message 
 	       between folders in order to update the view or 
 	       when expunge deletes messages from a view. If the
-	       folder is threaded, this method will rethread the
-	       folder before returning.
+	       folder is threaded, only the thread of the message
+	       is updated.
   @param theMessage The CWMessage instance to remove from the folder.
 */
 - (void) removeMessage: (CWMessage * _Nonnull) theMessage;
@@ -553,6 +558,43 @@ extern NSString * _Nonnull const PantomimeFolderSeparatorKey;
 */
 - (void) setShowRead: (BOOL) theBOOL;
 
+/*!
+  @method updateMessage:
+  @discussion This method is used to let the folder know that the headers
+              of one of its messages were parsed or changed. Messages are
+              usually appended to the folder before their headers are
+              fetched. The message is moved to the right thread, if the
+              folder is threaded, and to the right position in the
+              CWFolderView instances of the folder.
+  @param theMessage The message, which must belong to the folder.
+*/
+- (void) updateMessage: (CWMessage * _Nonnull) theMessage;
+
+/*!
+  @method thread
+  @discussion This method is used to thread all messages of the folder,
+              using the algorithm described at
+              <a href="http://www.jwz.org/doc/threading.html">message threading</a>.
+              Once threaded, the folder keeps its threads up to date as
+              messages are appended or removed, without threading the
+              whole folder again.
+*/
+- (void) thread;
+
+/*!
+  @method unthread
+  @discussion This method is used to release the threads of the folder.
+*/
+- (void) unthread;
+
+/*!
+  @method allContainers
+  @discussion This method is used to obtain the root containers of
+              all threads, see -thread.
+  @result The CWContainer instances, nil if the folder is not threaded.
+*/
+- (NSArray * _Nullable) allContainers;
+
 /*!
   @method numberOfDeletedMessages
   @discussion This method returns the number of messages in this
@@ -569,6 +611,17 @@ extern NSString * _Nonnull const PantomimeFolderSeparatorKey;
 */
 - (NSUInteger) numberOfUnreadMessages;
 
+/*!
+  @method numberOfMessagesWithFlag:
+  @discussion This method returns the number of messages in this
+              folder that have the specified flag set. It is
+              immediate for PantomimeFlagSeen, PantomimeFlagDeleted,
+              PantomimeFlagFlagged and PantomimeFlagAnswered.
+  @param theFlag The flag to count.
+  @result The number of messages, 0 if none.
+*/
+- (NSUInteger) numberOfMessagesWithFlag: (PantomimeFlag) theFlag;
+
 /*!
   @method size
   @discussion This method returns the size of the folder. That is,
@@ -581,9 +634,9 @@ extern NSString * _Nonnull const PantomimeFolderSeparatorKey;
 /*!
   @method updateCache
   @discussion This method is used to update our cache (_allVisibleMessages).
-              Applications can call this method if they set the PantomimeFlagDeleted flags to
-              messages inside this folder. If not called, the cache won't be updated
-              the messages having the flag PantomimeFlagDeleted will still be visible.
+              Flag changes of messages whose folder is the receiver are tracked
+              automatically. Applications must call this method if they change the flags
+              of messages that belong to another folder, like the ones of a CWVirtualFolder.
 */
 - (void) updateCache;
 
@@ -0,0 +1,164 @@
+//
+//  CWFolderView.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#ifndef _Pantomime_H_CWFolderView
+#define _Pantomime_H_CWFolderView
+
+#import <Foundation/Foundation.h>
+
+@class CWFolder;
+@class CWMessage;
+
+/*!
+  @typedef PantomimeSortCriterion
+  @abstract The keys a CWFolderView can sort on.
+  @discussion They match the comparators of the CWMessage (Comparing)
+              category. Ties are broken by message number.
+  @constant PantomimeSortByNumber Sort on the message number.
+  @constant PantomimeSortByDate Sort on the "Date" header value.
+  @constant PantomimeSortBySender Sort on the personal part of the "From"
+                                  header value, or its address if there is
+                                  no personal part. Case-insensitive.
+  @constant PantomimeSortBySubject Sort on the base subject. Case-insensitive.
+  @constant PantomimeSortBySize Sort on the message size.
+*/
+typedef enum
+{
+  PantomimeSortByNumber = 1,
+  PantomimeSortByDate = 2,
+  PantomimeSortBySender = 3,
+  PantomimeSortBySubject = 4,
+  PantomimeSortBySize = 5
+} PantomimeSortCriterion;
+
+/*!
+  @class CWFolderView
+  @discussion This class keeps the messages of a CWFolder sorted.
+
+              The sort key of each message is computed once, when the
+              message enters the view, and packed in a fixed-size record
+              (the date and size as integers, the sender and base subject
+              as case-folded byte strings). Comparisons never go back
+              to the message.
+
+              The view registers itself with its folder: messages appended
+              to or removed from the folder are inserted or removed by binary
+              search, without sorting the view again. Use -updateMessage:
+              (or CWFolder -updateMessage:) when the headers of a message
+              change.
+
+              All messages of the folder are part of the view, whatever the
+              -showRead and -showDeleted settings of the folder are.
+*/
+@interface CWFolderView : NSObject
+
+/*!
+  @method initWithFolder: criterion: reverse:
+  @discussion This method is the designated initializer for the
+              CWFolderView class. The messages of <i>theFolder</i>
+              are sorted right away.
+  @param theFolder The folder to sort. It is not retained.
+  @param theCriterion The sort key.
+  @param theBOOL YES to sort in descending order, NO otherwise.
+  @result The instance.
+*/
+- (instancetype _Nonnull) initWithFolder: (CWFolder * _Nonnull) theFolder
+                               criterion: (PantomimeSortCriterion) theCriterion
+                                 reverse: (BOOL) theBOOL;
+
+/*!
+  @method criterion
+  @discussion This method is used to obtain the current sort key.
+  @result The sort key.
+*/
+- (PantomimeSortCriterion) criterion;
+
+/*!
+  @method isReverse
+  @discussion This method is used to know if the view is sorted in descending order.
+  @result YES if it is, NO otherwise.
+*/
+- (BOOL) isReverse;
+
+/*!
+  @method setCriterion: reverse:
+  @discussion This method is used to sort the view on another key.
+  @param theCriterion The sort key.
+  @param theBOOL YES to sort in descending order, NO otherwise.
+*/
+- (void) setCriterion: (PantomimeSortCriterion) theCriterion
+              reverse: (BOOL) theBOOL;
+
+/*!
+  @method reload
+  @discussion This method is used to compute the keys of all messages of
+              the folder again and sort them.
+*/
+- (void) reload;
+
+/*!
+  @method count
+  @discussion This method returns the number of messages in the view.
+  @result The count.
+*/
+- (NSUInteger) count;
+
+/*!
+  @method messageAtIndex:
+  @discussion This method is used to obtain the message at the
+              specified (zero-based) position of the view.
+  @param theIndex The position.
+  @result The message, nil if the index is out of bounds.
+*/
+- (CWMessage * _Nullable) messageAtIndex: (NSUInteger) theIndex;
+
+/*!
+  @method indexOfMessage:
+  @discussion This method is used to obtain the position of a message,
+              by binary search.
+  @param theMessage The message.
+  @result The position, NSNotFound if the message is not part of the view.
+*/
+- (NSUInteger) indexOfMessage: (CWMessage * _Nonnull) theMessage;
+
+/*!
+  @method allMessages
+  @discussion This method is used to obtain all messages of the view,
+              in order. The array is cached until the view changes.
+  @result The sorted messages.
+*/
+- (NSArray * _Nonnull) allMessages;
+
+/*!
+  @method insertMessage:
+  @discussion This method is used to insert a message in the view.
+              It is invoked by the folder; you should not have to.
+  @param theMessage The message to insert.
+  @result The position of the message in the view.
+*/
+- (NSUInteger) insertMessage: (CWMessage * _Nonnull) theMessage;
+
+/*!
+  @method removeMessage:
+  @discussion This method is used to remove a message from the view.
+              It is invoked by the folder; you should not have to.
+  @param theMessage The message to remove.
+  @result The position the message had, NSNotFound if it was not part of the view.
+*/
+- (NSUInteger) removeMessage: (CWMessage * _Nonnull) theMessage;
+
+/*!
+  @method updateMessage:
+  @discussion This method is used to compute the key of a message again
+              and move it to its new position.
+  @param theMessage The message that changed.
+*/
+- (void) updateMessage: (CWMessage * _Nonnull) theMessage;
+
+@end
+
+#endif // _Pantomime_H_CWFolderView
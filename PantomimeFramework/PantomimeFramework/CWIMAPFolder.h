@@ -118,6 +118,24 @@ extern NSString * _Nonnull PantomimeMessageStoreFailed;
                              flags:(CWFlags * _Nullable)flags
                       internalDate:(NSDate * _Nullable)date;
 
+/*!
+  @method appendMessagesFromRawSources:flags:internalDates:
+  @discussion This method is used to append several messages to the
+              underlying store. If the server supports MULTIAPPEND
+	      (RFC 3502), the messages are sent in as few APPEND commands
+	      as possible and each of them appends its messages atomically.
+	      Every APPEND command posts a PantomimeFolderAppendCompleted or
+	      PantomimeFolderAppendFailed notification. Its "Messages" key
+	      holds the raw sources it appended, the "NSData" key is only
+	      set if it appended a single message.
+  @param rawSources The raw representations of the messages to append.
+  @param flags The flags of each message, nil if no flags need to be kept.
+  @param dates The INTERNALDATE of each message, or nil to use the current date.
+*/
+- (void)appendMessagesFromRawSources:(NSArray<NSData *> *)rawSources
+                               flags:(NSArray<CWFlags *> * _Nullable)flags
+                       internalDates:(NSArray<NSDate *> * _Nullable)dates;
+
 #pragma mark - UID COPY
 
 /**
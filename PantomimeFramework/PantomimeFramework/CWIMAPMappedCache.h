@@ -0,0 +1,70 @@
+//
+//  CWIMAPMappedCache.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#ifndef _Pantomime_H_CWIMAPMappedCache
+#define _Pantomime_H_CWIMAPMappedCache
+
+#import <Foundation/Foundation.h>
+
+#import <PantomimeFramework/CWIMAPCacheManager.h>
+
+@class CWFolder;
+
+/*!
+  @class CWIMAPMappedCache
+  @discussion This class provides a persistent, memory-mapped implementation
+              of the CWIMAPCache protocol.
+
+              Records are stored in a file of fixed-width entries, sorted
+              by UID and indexed by binary search. Variable-length fields
+              (From, Subject, References, ...) live in an append-only
+              string heap stored next to it (<i>path</i>.strings).
+
+              Opening a cache only maps both files; CWIMAPMessage instances
+              are materialized lazily from -messageWithUID: and kept for the
+              lifetime of the cache. -synchronize only flushes the pages
+              that were modified since the last call.
+*/
+@interface CWIMAPMappedCache : NSObject <CWIMAPCache>
+
+/*!
+  @method initWithPath: folder:
+  @discussion This method is the designated initializer for the
+              CWIMAPMappedCache class. Existing files at <i>thePath</i>
+              are mapped, otherwise they are created.
+  @param thePath The complete path of the record file.
+  @param theFolder The folder messages materialized from the cache belong to.
+  @result The instance, nil if the files could not be opened or are corrupted.
+*/
+- (instancetype _Nullable) initWithPath: (NSString * _Nonnull) thePath
+                                 folder: (CWFolder * _Nullable) theFolder;
+
+/*!
+  @method path
+  @discussion This method is used to obtain the path of the record file.
+  @result The path.
+*/
+- (NSString * _Nonnull) path;
+
+/*!
+  @method expunge
+  @discussion This method is used to drop the records removed with
+              -removeMessageWithUID: from the record file.
+*/
+- (void) expunge;
+
+/*!
+  @method writeRecord:message:
+  @discussion This method is used to write a cache record to disk.
+  @param theRecord The record to write.
+  @param theMessage The message associated to the record <i>theRecord</i>.
+*/
+- (void) writeRecord: (CWCacheRecord * _Nullable) theRecord  message: (id _Nonnull) theMessage;
+
+@end
+
+#endif // _Pantomime_H_CWIMAPMappedCache
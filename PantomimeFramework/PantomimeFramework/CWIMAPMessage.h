@@ -77,6 +77,73 @@
 */
 - (void) setFlags: (CWFlags * _Nonnull) theFlags;
 
+/*!
+  @method fetchContentOfPart:section:
+  @discussion This method is used to fetch the content of a single body
+              part of the message, like an attachment, without fetching
+	      the whole message. If the server supports BINARY (RFC 3516),
+	      it decodes the part and sends its bytes as is. Otherwise, the
+	      part is fetched in its Content-Transfer-Encoding, which must
+	      then be set on <i>thePart</i>, and decoded locally.
+	      Once the content is set on <i>thePart</i>, the IMAPStore posts
+	      PantomimePartFetchCompleted (and calls -partFetchCompleted: on
+	      the delegate, if any), PantomimePartFetchFailed otherwise.
+	      This method is fully asynchronous.
+  @param thePart The part receiving the content.
+  @param theSection The section of the part, like "2" or "1.3".
+*/
+- (void) fetchContentOfPart: (CWPart * _Nonnull) thePart
+                    section: (NSString * _Nonnull) theSection;
+
+/*!
+  @method fetchSizeOfPart:section:
+  @discussion This method is used to fetch the decoded size of a single
+              body part of the message, which is set on <i>thePart</i>.
+	      The IMAPStore posts PantomimePartFetchCompleted once done.
+	      This method is fully asynchronous.
+  @param thePart The part receiving the size.
+  @param theSection The section of the part, like "2" or "1.3".
+  @result NO if the server does not support BINARY, in which case nothing is sent.
+*/
+- (BOOL) fetchSizeOfPart: (CWPart * _Nonnull) thePart
+                 section: (NSString * _Nonnull) theSection;
+
+/*!
+  @method fetchContentOfPart:section:length:
+  @discussion This method is used to fetch only the first <i>theLength</i>
+              bytes of a body part, for instance to preview a large text
+	      part. It otherwise behaves like -fetchContentOfPart:section:.
+	      A content fetched in its Content-Transfer-Encoding is decoded
+	      as far as it goes.
+  @param thePart The part receiving the content.
+  @param theSection The section of the part, like "2" or "1.3".
+  @param theLength The number of bytes to fetch, 0 for the whole part.
+*/
+- (void) fetchContentOfPart: (CWPart * _Nonnull) thePart
+                    section: (NSString * _Nonnull) theSection
+                     length: (NSUInteger) theLength;
+
+/*!
+  @method fetchSection:toFile:window:
+  @discussion This method is used to download a section of the message, or
+              the whole message, into a spool file, <i>theWindow</i> bytes per
+	      command. Each window is written to the file once received, so
+	      a download interrupted by a lost connection goes on from the
+	      last complete window when the IMAPStore reconnects, and invoking
+	      this method again on the same file resumes it. The file must
+	      therefore only ever hold this section of this message.
+	      The IMAPStore posts PantomimePartFetchCompleted (and calls
+	      -partFetchCompleted: on the delegate, if any) once the file holds
+	      the whole section, with the file under the "Path" key of the
+	      user info. This method is fully asynchronous.
+  @param theSection The section, like "2" or "1.3", or the empty string for the whole message.
+  @param thePath The spool file, created if needed.
+  @param theWindow The number of bytes fetched per command, for instance 1 MB.
+*/
+- (void) fetchSection: (NSString * _Nonnull) theSection
+               toFile: (NSString * _Nonnull) thePath
+               window: (NSUInteger) theWindow;
+
 @end
 
 #endif // _Pantomime_H_CWIMAPMessage
@@ -24,6 +24,7 @@
 #define _Pantomime_H_CWIMAPStore
 
 #import <PantomimeFramework/CWConstants.h>
+#import <PantomimeFramework/CWDigest.h>
 #import <PantomimeFramework/CWService.h>
 #import <PantomimeFramework/CWStore.h>
 
@@ -39,6 +40,7 @@
   @constant IMAP_APPEND The IMAP APPEND command - see 6.3.11. APPEND Command of RFC 3501.
   @constant IMAP_AUTHENTICATE_CRAM_MD5 CRAM-MD5 authentication.
   @constant IMAP_AUTHENTICATE_LOGIN LOGIN authentication
+  @constant IMAP_AUTHENTICATE_PLAIN PLAIN authentication - see RFC 4616.
   @constant IMAP_AUTHORIZATION Special command so that we know we are in the authorization state.
   @constant IMAP_CAPABILITY The IMAP CAPABILITY command - see 6.1.1. CAPABILITY Command of RFC 3501.
   @constant IMAP_CLOSE The IMAP CLOSE command - see 6.4.2. CLOSE Command of RFC 3501.
@@ -71,6 +73,12 @@
   @constant IMAP_UID_STORE The IMAP STORE command - see 6.4.6. STORE Command of RFC 3501.
   @constant IMAP_UNSUBSCRIBE The IMAP UNSUBSCRIBE command - see 6.3.7. UNSUBSCRIBE Command of RFC 3501.
   @constant IMAP_EMPTY_QUEUE Special command to empty the command queue.
+  @constant IMAP_UID_FETCH_BINARY Fetches the decoded content of a body part - see RFC 3516.
+                                  Falls back to the FETCH command of RFC 3501 if the server
+                                  does not support BINARY.
+  @constant IMAP_UID_FETCH_BINARY_SIZE Fetches the decoded size of a body part - see RFC 3516.
+  @constant IMAP_UID_FETCH_PARTIAL Fetches a section window by window into a spool file, using
+                                   the partial FETCH of RFC 3501 (BODY.PEEK[section]<offset.length>).
 */
 typedef enum {
     IMAP_APPEND = 0x1,
@@ -113,6 +121,10 @@ typedef enum {
     IMAP_IDLE, //38
     IMAP_IDLE_DONE, //39
     IMAP_SEARCH_NEW_MAILS, //40
+    IMAP_UID_FETCH_BINARY, //41
+    IMAP_UID_FETCH_BINARY_SIZE, //42
+    IMAP_UID_FETCH_PARTIAL, //43
+    IMAP_AUTHENTICATE_PLAIN, //AUTH=PLAIN //44
 } IMAPCommand;
 
 /*!
@@ -192,6 +204,19 @@ extern NSString * _Nonnull const PantomimeIdleNewMessages;
  */
 extern NSString * _Nonnull const PantomimeIdleFinished;
 
+/*!
+ @const PantomimePartFetchCompleted
+ @discussion Posted once the content or the size of a body part has been fetched. The part is
+ found under the "Part" key of the user info, its section under "Section". For a section
+ fetched into a spool file, the "Path" key holds the file instead of "Part".
+ */
+extern NSString * _Nonnull const PantomimePartFetchCompleted;
+
+/*!
+ @const PantomimePartFetchFailed
+ */
+extern NSString * _Nonnull const PantomimePartFetchFailed;
+
 @class CWFlags;
 @class CWIMAPCacheManager;
 @class CWIMAPFolder;
@@ -213,6 +238,14 @@ extern NSString * _Nonnull const PantomimeIdleFinished;
  */
 @property (nonatomic) NSUInteger maxFetchCount;
 
+/**
+ Algorithm used to compute the digest of every literal while it is read from the server,
+ CWDigestAlgorithmNone (the default) for none. Digests cover the literal's octets as sent,
+ before line endings are converted. The digest of the literal a message's content was read from
+ (BODY[], BODY[TEXT] or RFC822) is set as the message's PantomimeMessageLiteralDigest property.
+ */
+@property (nonatomic) CWDigestAlgorithm literalDigestAlgorithm;
+
 /*!
  @method sendCommand:info:string: ...
  @discussion This method is used to send commands to the IMAP server.
@@ -0,0 +1,108 @@
+//
+//  CWLogging.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#ifndef _Pantomime_H_CWLogging
+#define _Pantomime_H_CWLogging
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*!
+  @typedef CWLogLevel
+  @abstract The severity of a log message. A level enables itself and all
+            levels below it.
+  @constant CWLogLevelNone Nothing is logged.
+  @constant CWLogLevelError Errors.
+  @constant CWLogLevelWarn Warnings.
+  @constant CWLogLevelInfo Informational messages, like every command sent.
+*/
+typedef NS_ENUM(NSInteger, CWLogLevel) {
+    CWLogLevelNone = 0,
+    CWLogLevelError,
+    CWLogLevelWarn,
+    CWLogLevelInfo
+};
+
+/*!
+  @typedef CWLogSink
+  @abstract A block receiving the messages logged by Pantomime.
+*/
+typedef void (^CWLogSink)(CWLogLevel theLevel, const char *theFilename,
+                          const char *theFunction, NSInteger theLine, NSString *theMessage);
+
+/*!
+  @class CWLogger
+  @discussion This class controls Pantomime's own logging.
+
+              Messages above the current level are not even formatted. Enabled
+              messages are put in a fixed-size lock-free buffer and handed to
+              the sink by a background writer, so logging never blocks the
+              thread it is called from. If the buffer is full, messages are
+              dropped and counted.
+*/
+@interface CWLogger : NSObject
+
+/*!
+  @method level
+  @discussion This method is used to obtain the current log level.
+              It is CWLogLevelInfo in DEBUG builds, CWLogLevelWarn otherwise.
+  @result The level.
+*/
++ (CWLogLevel) level;
+
+/*!
+  @method setLevel:
+  @discussion This method is used to set the current log level. Levels
+              compiled out with CW_LOG_LEVEL_MAX stay disabled.
+  @param theLevel The new level.
+*/
++ (void) setLevel: (CWLogLevel) theLevel;
+
+/*!
+  @method setSink:
+  @discussion This method is used to set where messages are written. It is
+              always invoked on the background writer.
+  @param theSink The new sink, nil to restore the default one.
+*/
++ (void) setSink: (CWLogSink _Nullable) theSink;
+
+/*!
+  @method flush
+  @discussion This method is used to wait until all messages logged so far
+              have been handed to the sink.
+*/
++ (void) flush;
+
+/*!
+  @method droppedMessages
+  @discussion This method is used to obtain the number of messages dropped
+              because the buffer was full.
+  @result The number of messages.
+*/
++ (NSUInteger) droppedMessages;
+
++ (void) logInfoFilename: (const char *) theFilename
+                function: (const char *) theFunction
+                    line: (NSInteger) theLine
+                 message: (NSString *) theMessage;
+
++ (void) logWarnFilename: (const char *) theFilename
+                function: (const char *) theFunction
+                    line: (NSInteger) theLine
+                 message: (NSString *) theMessage;
+
++ (void) logErrorFilename: (const char *) theFilename
+                 function: (const char *) theFunction
+                     line: (NSInteger) theLine
+                  message: (NSString *) theMessage;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif // _Pantomime_H_CWLogging
@@ -155,6 +155,17 @@
 */
 + (NSData *) plainTextContentFromPart: (CWPart *) thePart;
 
+/*!
+  @method plainTextUTF8ContentFromPart:
+  @discussion This method is used to obtain the text of a "text" part
+              encoded in UTF-8, like for quoting it in a reply, showing
+	      a preview or indexing it. HTML is converted to text in a
+	      single pass, with line breaks for its block-level elements.
+  @param thePart The Part instance from which to obtain the text.
+  @result The text in UTF-8.
+*/
++ (NSData *) plainTextUTF8ContentFromPart: (CWPart *) thePart;
+
 @end
 
 #endif // _Pantomime_H_CWMIMEUtility
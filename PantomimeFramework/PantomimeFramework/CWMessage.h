@@ -347,11 +347,13 @@ extern NSString * _Nonnull const PantomimeMessageUidMoveFailed;
 /*!
   @method setFlags:
   @discussion This method is used to set the flags of the receiver,
-              replacing any previous values set. Subclasses of
+              replacing any previous values set. The receiver keeps
+	      <i>theFlags</i> itself and observes it, so the instance
+	      must not be given to another message. Subclasses of
 	      CWMessage sometimes overwrite this method.
-  @param theFlags The new flags for the receiver.
+  @param theFlags The new flags for the receiver, nil to remove them all.
 */
-- (void) setFlags: (CWFlags * _Nonnull) theFlags;
+- (void) setFlags: (CWFlags * _Nullable) theFlags;
 
 /*!
   @method MIMEVersion
@@ -0,0 +1,83 @@
+//
+//  CWMessageArchive.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#ifndef _Pantomime_H_CWMessageArchive
+#define _Pantomime_H_CWMessageArchive
+
+#import <Foundation/Foundation.h>
+
+@class CWMessage;
+
+/*!
+  @class CWMessageArchive
+  @discussion This class reads and writes messages, with their whole
+              part tree, in a compact binary format. It is meant to
+              replace NSCoding archives when many parsed messages must be
+              saved and restored, as in offline caches.
+
+              The format is versioned and every record is prefixed by its
+              length. Header and parameter names are stored once per
+              archive and shared by all decoded parts. Headers, flags,
+              recipients, references and contents are kept, the
+              properties of messages are not.
+
+              Opening an archive only reads its index. Messages are decoded
+              by -messageAtIndex: and the parts of their multiparts when
+              they are first asked for. Decoded body contents point into
+              the bytes of the archive instead of copying them, so mapping
+              an archive file keeps restoring messages IO-bound.
+*/
+@interface CWMessageArchive : NSObject
+
+/*!
+  @method archivedDataWithMessages:
+  @discussion This method is used to archive messages. CWIMAPMessage
+              instances keep their UID.
+  @param theMessages The messages to archive.
+  @result The archive.
+*/
++ (NSData * _Nonnull) archivedDataWithMessages: (NSArray<CWMessage *> * _Nonnull) theMessages;
+
+/*!
+  @method initWithData:
+  @discussion This method is the designated initializer for the
+              CWMessageArchive class. The data is kept for the lifetime
+              of the receiver and of the messages decoded from it.
+  @param theData The archive, as returned by +archivedDataWithMessages:.
+  @result The instance, nil if the data is not an archive of a known version.
+*/
+- (instancetype _Nullable) initWithData: (NSData * _Nonnull) theData;
+
+/*!
+  @method initWithContentsOfFile:
+  @discussion This method maps the archive at <i>thePath</i>, if possible,
+              and initializes the receiver with it.
+  @param thePath The path of the archive.
+  @result The instance, nil if the file could not be read or is not an archive.
+*/
+- (instancetype _Nullable) initWithContentsOfFile: (NSString * _Nonnull) thePath;
+
+/*!
+  @method count
+  @discussion This method returns the number of messages in the archive.
+  @result The number of messages.
+*/
+- (NSUInteger) count;
+
+/*!
+  @method messageAtIndex:
+  @discussion This method decodes the message at the given index. Every
+              call returns a new instance.
+  @param theIndex The index of the message, in the order it was archived.
+  @result The message, nil if its record is corrupted. If the index is
+          out of bounds, an NSRangeException is raised.
+*/
+- (CWMessage * _Nullable) messageAtIndex: (NSUInteger) theIndex;
+
+@end
+
+#endif // _Pantomime_H_CWMessageArchive
@@ -0,0 +1,108 @@
+//
+//  CWReactor.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#ifndef _Pantomime_H_CWReactor
+#define _Pantomime_H_CWReactor
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*!
+  @class CWReactor
+  @discussion This class owns a small, fixed pool of event loop threads.
+              Each thread runs an NSRunLoop on which the non-blocking
+              streams of many connections are scheduled, so the number
+              of threads no longer grows with the number of connections.
+
+              A CWTCPConnection attaches itself to the least loaded thread
+              of the shared reactor when it connects, and detaches when it
+              is closed. Stream events are delivered to the CWService
+              through the usual -receivedEvent:type:extra:forMode: method,
+              on that thread.
+
+              Applications hosting many accounts can replace the shared
+              reactor with -setSharedReactor: before connecting.
+*/
+@interface CWReactor : NSObject
+
+/*!
+  @method sharedReactor
+  @discussion This method returns the reactor used by new connections.
+              It is created on first use, with one thread per active
+              processor, up to four.
+  @result The shared instance.
+*/
++ (CWReactor *) sharedReactor;
+
+/*!
+  @method setSharedReactor:
+  @discussion This method is used to replace the reactor used by new
+              connections. Established connections keep their thread.
+  @param theReactor The new shared reactor.
+*/
++ (void) setSharedReactor: (CWReactor *) theReactor;
+
+/*!
+  @method initWithNumberOfThreads:
+  @discussion This method is the designated initializer for the
+              CWReactor class. The threads are started right away
+              and live as long as the process.
+  @param theCount The number of event loop threads, at least 1.
+  @result The instance.
+*/
+- (instancetype) initWithNumberOfThreads: (NSUInteger) theCount;
+
+/*!
+  @method numberOfThreads
+  @discussion This method returns the size of the thread pool.
+  @result The number of threads.
+*/
+- (NSUInteger) numberOfThreads;
+
+/*!
+  @method attach
+  @discussion This method is used to pick the event loop thread a
+              connection will run on, the one with the fewest
+              connections attached.
+  @result The thread. Give it back with -detach:.
+*/
+- (NSThread *) attach;
+
+/*!
+  @method detach:
+  @discussion This method is used to tell the reactor that a connection
+              obtained with -attach no longer runs on <i>theThread</i>.
+  @param theThread The thread returned by -attach.
+*/
+- (void) detach: (NSThread *) theThread;
+
+/*!
+  @method numberOfConnectionsOnThread:
+  @discussion This method returns how many connections are attached
+              to one of the threads of the reactor.
+  @param theThread The thread.
+  @result The number of connections, 0 if the thread is not part of the pool.
+*/
+- (NSUInteger) numberOfConnectionsOnThread: (NSThread *) theThread;
+
+/*!
+  @method performBlock: onThread:
+  @discussion This method is used to run a block on one of the threads
+              of the reactor. The block runs right away if invoked from
+              that thread, and is queued on its run loop otherwise.
+  @param theBlock The block to run.
+  @param theThread The thread, as returned by -attach.
+*/
+- (void) performBlock: (dispatch_block_t) theBlock
+             onThread: (NSThread *) theThread;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif // _Pantomime_H_CWReactor
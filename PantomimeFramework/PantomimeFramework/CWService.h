@@ -41,8 +41,10 @@
 NS_ASSUME_NONNULL_BEGIN
 
 @class CWService;
+@class CWServiceMetrics;
 @class CWThreadSafeArray;
 @class CWThreadSafeData;
+@class CWWriteQueue;
 
 /*!
   @const PantomimeAuthenticationCompleted
@@ -196,7 +198,8 @@ extern NSString * _Nonnull PantomimeProtocolException;
 /*!
   @method service: sentData:
   @discussion Invoked when bytes have been sent using the underlying
-              CWService's connection. No notification is posted.
+              CWService's connection, if -setReportsSentData: was called
+	      with YES. No notification is posted.
   @param theService The CWService instance that generated network activity.
   @param theData The sent bytes.
 */
@@ -247,6 +250,10 @@ extern NSString * _Nonnull PantomimeProtocolException;
 
 - (void) messageFetchCompleted: (NSNotification * _Nullable) theNotification;
 
+- (void) partFetchCompleted: (NSNotification * _Nullable) theNotification;
+
+- (void) partFetchFailed: (NSNotification * _Nullable) theNotification;
+
 - (void) folderCreateFailed: (NSNotification * _Nullable) theNotification;
 
 - (void) folderDeleteFailed: (NSNotification * _Nullable) theNotification;
@@ -374,6 +381,32 @@ extern NSString * _Nonnull PantomimeProtocolException;
 */
 - (id _Nullable) delegate;
 
+/*!
+  @method setReportsSentData:
+  @discussion This method is used to make the CWService invoke
+              -service:sentData: on its delegate for every block of bytes
+              written. This is off by default, as it copies all outgoing bytes.
+  @param theBOOL YES to invoke -service:sentData:, NO otherwise.
+*/
+- (void) setReportsSentData: (BOOL) theBOOL;
+
+/*!
+  @method reportsSentData
+  @discussion This method is used to know if -service:sentData: is invoked
+              on the delegate.
+  @result YES if it is, NO otherwise.
+*/
+- (BOOL) reportsSentData;
+
+/*!
+  @method metrics
+  @discussion This method is used to obtain the protocol-level metrics
+              of the receiver: traffic, queue depth, per-command latencies
+              and so on. See CWServiceMetrics.
+  @result The metrics, collected for the lifetime of the receiver.
+*/
+- (CWServiceMetrics * _Nonnull) metrics;
+
 /*!
   @method port
   @discussion This method is used to obtain the server port.
@@ -0,0 +1,241 @@
+//
+//  CWServiceMetrics.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#ifndef _Pantomime_H_CWServiceMetrics
+#define _Pantomime_H_CWServiceMetrics
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*!
+  @class CWLatencyHistogram
+  @discussion This class is a snapshot of the latencies recorded for one
+              command. Latencies are counted in buckets of increasing
+              width: bucket <i>i</i> holds the ones below 2^<i>i</i>
+              milliseconds, the last bucket holds everything above
+              +upperBoundOfBucket: of the one before it.
+*/
+@interface CWLatencyHistogram : NSObject <NSCopying>
+
+/*!
+  @method numberOfBuckets
+  @discussion This method is used to obtain the number of buckets of all histograms.
+  @result The number of buckets.
+*/
++ (NSUInteger) numberOfBuckets;
+
+/*!
+  @method upperBoundOfBucket:
+  @discussion This method is used to obtain the (exclusive) upper bound of a bucket.
+  @param theIndex The index of the bucket.
+  @result The upper bound, in seconds. DBL_MAX for the last bucket.
+*/
++ (NSTimeInterval) upperBoundOfBucket: (NSUInteger) theIndex;
+
+/*!
+  @method count
+  @discussion This method is used to obtain the number of latencies recorded.
+  @result The number of latencies.
+*/
+- (NSUInteger) count;
+
+/*!
+  @method countInBucket:
+  @discussion This method is used to obtain the number of latencies in a bucket.
+  @param theIndex The index of the bucket.
+  @result The number of latencies, 0 if <i>theIndex</i> is out of bounds.
+*/
+- (NSUInteger) countInBucket: (NSUInteger) theIndex;
+
+/*!
+  @method totalTime
+  @discussion This method is used to obtain the sum of all latencies recorded.
+  @result The sum, in seconds.
+*/
+- (NSTimeInterval) totalTime;
+
+/*!
+  @method minimum
+  @discussion This method is used to obtain the lowest latency recorded.
+  @result The latency in seconds, 0 if none was recorded.
+*/
+- (NSTimeInterval) minimum;
+
+/*!
+  @method maximum
+  @discussion This method is used to obtain the highest latency recorded.
+  @result The latency in seconds, 0 if none was recorded.
+*/
+- (NSTimeInterval) maximum;
+
+/*!
+  @method percentile:
+  @discussion This method is used to estimate a percentile of the latencies
+              recorded. The result is the upper bound of the bucket the
+              percentile falls in, capped to -maximum.
+  @param thePercentile The percentile, between 0 and 100.
+  @result The latency in seconds, 0 if none was recorded.
+*/
+- (NSTimeInterval) percentile: (double) thePercentile;
+
+@end
+
+
+/*!
+  @class CWTraceSpan
+  @discussion This class describes one command, from the moment it was
+              written to the server to the moment its completion was parsed.
+*/
+@interface CWTraceSpan : NSObject
+
+/*! The command, an IMAPCommand or an SMTPCommand depending on the service. */
+@property (nonatomic, readonly) unsigned int command;
+
+/*! The time the command was written. */
+@property (nonatomic, readonly) NSDate *startDate;
+
+/*! The time from writing the command to parsing its completion, in seconds. */
+@property (nonatomic, readonly) NSTimeInterval duration;
+
+/*! The time from writing the command to receiving the first bytes of the response, in seconds. */
+@property (nonatomic, readonly) NSTimeInterval waitTime;
+
+/*! The time spent parsing responses while the command was running, in seconds. */
+@property (nonatomic, readonly) NSTimeInterval parseTime;
+
+/*! The number of bytes written while the command was running. */
+@property (nonatomic, readonly) NSUInteger bytesSent;
+
+/*! The number of bytes received while the command was running. */
+@property (nonatomic, readonly) NSUInteger bytesReceived;
+
+@end
+
+
+/*!
+  @class CWServiceMetrics
+  @discussion This class gathers protocol-level metrics of a CWService:
+              traffic, queue depth, literal sizes, parse and wait time,
+              reconnects and per-command latencies.
+
+              Metrics are always collected and cheap to read, they are
+              meant to be polled. Reading and resetting them is thread-safe.
+
+              The time between writing a command and receiving the first
+              bytes of its response (waitTime) is mostly network and server
+              latency, while parseTime is client CPU.
+*/
+@interface CWServiceMetrics : NSObject
+
+/*!
+  @property spanHandler
+  @discussion This block is invoked with a CWTraceSpan each time a command
+              completes. It is invoked on the thread reading from the
+              connection and must return quickly. nil by default.
+*/
+@property (atomic, copy, nullable) void (^spanHandler)(CWTraceSpan *theSpan);
+
+/*!
+  @method bytesReceived
+  @discussion This method is used to obtain the number of bytes read from the server.
+  @result The number of bytes.
+*/
+- (unsigned long long) bytesReceived;
+
+/*!
+  @method bytesSent
+  @discussion This method is used to obtain the number of bytes written to the server.
+  @result The number of bytes.
+*/
+- (unsigned long long) bytesSent;
+
+/*!
+  @method reconnects
+  @discussion This method is used to obtain the number of times the service reconnected.
+  @result The number of reconnects.
+*/
+- (NSUInteger) reconnects;
+
+/*!
+  @method queueDepth
+  @discussion This method is used to obtain the number of commands queued,
+              the running one included.
+  @result The number of commands.
+*/
+- (NSUInteger) queueDepth;
+
+/*!
+  @method maximumQueueDepth
+  @discussion This method is used to obtain the highest -queueDepth observed.
+  @result The number of commands.
+*/
+- (NSUInteger) maximumQueueDepth;
+
+/*!
+  @method literals
+  @discussion This method is used to obtain the number of literals received.
+  @result The number of literals.
+*/
+- (NSUInteger) literals;
+
+/*!
+  @method literalBytes
+  @discussion This method is used to obtain the total size of the literals received.
+  @result The number of bytes.
+*/
+- (unsigned long long) literalBytes;
+
+/*!
+  @method largestLiteral
+  @discussion This method is used to obtain the size of the largest literal received.
+  @result The number of bytes.
+*/
+- (NSUInteger) largestLiteral;
+
+/*!
+  @method parseTime
+  @discussion This method is used to obtain the time spent parsing responses.
+  @result The time, in seconds.
+*/
+- (NSTimeInterval) parseTime;
+
+/*!
+  @method waitTime
+  @discussion This method is used to obtain the time spent waiting for the
+              first bytes of responses to commands.
+  @result The time, in seconds.
+*/
+- (NSTimeInterval) waitTime;
+
+/*!
+  @method commands
+  @discussion This method is used to obtain the commands that completed at least once.
+  @result The commands, as NSNumbers holding IMAPCommand or SMTPCommand values.
+*/
+- (NSArray<NSNumber *> *) commands;
+
+/*!
+  @method latencyForCommand:
+  @discussion This method is used to obtain the latencies of a command.
+  @param theCommand The IMAPCommand or SMTPCommand.
+  @result A snapshot of the latencies, nil if the command never completed.
+*/
+- (CWLatencyHistogram * _Nullable) latencyForCommand: (unsigned int) theCommand;
+
+/*!
+  @method reset
+  @discussion This method is used to reset all metrics to zero. -queueDepth
+              and the running command are kept.
+*/
+- (void) reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif // _Pantomime_H_CWServiceMetrics
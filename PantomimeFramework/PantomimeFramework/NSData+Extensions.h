@@ -138,11 +138,23 @@
                   options: (NSUInteger) theOptions
 	            range: (NSRange) theRange;
 
+/*!
+  @method subdataNoCopyWithRange:
+  @discussion This method is used to obtain the subdata in <i>theRange</i>
+              of the receiver without copying its bytes. The returned
+	      instance retains the receiver, unless the receiver is mutable
+	      in which case the bytes are copied.
+  @param theRange The range of the subdata.
+  @result The subdata.
+*/
+- (NSData *) subdataNoCopyWithRange: (NSRange) theRange;
+
 /*!
   @method subdataFromIndex:
   @discussion This method is used to obtain the subdata from <i>theIndex</i>
               in the receiver. The byte at <i>theIndex</i> is part of the
-	      returned NSData instance.
+	      returned NSData instance, which shares the bytes of the
+	      receiver (see subdataNoCopyWithRange:).
   @param theIndex The index used to get the subdata from.
   @result The subdata.
 */
@@ -152,7 +164,8 @@
   @method subdataToIndex:
   @discussion This method is used to obtain the subdata to <i>theIndex</i>
               from the receiver. The byte at <i>theIndex</i> is not included in
-	      returned NSData instance.
+	      returned NSData instance, which shares the bytes of the
+	      receiver (see subdataNoCopyWithRange:).
   @param theIndex The index used to get the subdata to.
   @result The subdata.
 */
@@ -17,12 +17,17 @@ FOUNDATION_EXPORT const unsigned char PantomimeFrameworkVersionString[];
 // In this header, you should import all the public headers of your framework using statements like #import <PantomimeFramework/PublicHeader.h>
 
 #import <PantomimeFramework/CWFolder.h>
+#import <PantomimeFramework/CWFolderView.h>
 #import <PantomimeFramework/CWIMAPFolder.h>
 #import <PantomimeFramework/CWConstants.h>
 #import <PantomimeFramework/CWPart.h>
+#import <PantomimeFramework/CWDigest.h>
+#import <PantomimeFramework/CWLogging.h>
 #import <PantomimeFramework/CWService.h>
+#import <PantomimeFramework/CWServiceMetrics.h>
 #import <PantomimeFramework/CWStore.h>
 #import <PantomimeFramework/CWConnection.h>
+#import <PantomimeFramework/CWReactor.h>
 #import <PantomimeFramework/CWTransport.h>
 #import <PantomimeFramework/CWIMAPFolder.h>
 #import <PantomimeFramework/CWIMAPStore.h>
@@ -34,5 +39,7 @@ FOUNDATION_EXPORT const unsigned char PantomimeFrameworkVersionString[];
 #import <PantomimeFramework/CWCacheManager.h>
 #import <PantomimeFramework/NSData+Extensions.h>
 #import <PantomimeFramework/CWIMAPCacheManager.h>
+#import <PantomimeFramework/CWIMAPMappedCache.h>
+#import <PantomimeFramework/CWMessageArchive.h>
 #import <PantomimeFramework/CWMIMEMultipart.h>
 #import <PantomimeFramework/CWMIMEUtility.h>
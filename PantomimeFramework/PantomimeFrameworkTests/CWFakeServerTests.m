@@ -0,0 +1,388 @@
+//
+//  CWFakeServerTests.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import <arpa/inet.h>
+#import <netinet/in.h>
+#import <sys/socket.h>
+#import <unistd.h>
+
+#import "CWFakeIMAPServer.h"
+#import "CWFakeSMTPServer.h"
+#import "CWIMAPFolder.h"
+#import "CWIMAPMessage.h"
+#import "CWIMAPStore.h"
+#import "CWInternetAddress.h"
+#import "CWSMTP.h"
+
+/**
+ The delegate of the services connected to the fake servers. Fulfills the expectation set for
+ an event when the service reports it. Failures fulfill all expectations, so tests end early.
+ */
+@interface CWFakeServerClient : NSObject <CWServiceClient>
+@property (nonatomic, readonly) NSMutableArray<NSString *> *failures;
+@property (nonatomic, readonly) NSMutableArray<CWIMAPMessage *> *messages;
+- (void)expect:(XCTestExpectation *)expectation event:(SEL)event;
+@end
+
+@implementation CWFakeServerClient
+{
+    NSMutableDictionary<NSString *, XCTestExpectation *> *_expectations;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _expectations = [NSMutableDictionary new];
+        _failures = [NSMutableArray new];
+        _messages = [NSMutableArray new];
+    }
+    return self;
+}
+
+- (void)expect:(XCTestExpectation *)expectation event:(SEL)event
+{
+    @synchronized(self) {
+        _expectations[NSStringFromSelector(event)] = expectation;
+    }
+}
+
+- (void)received:(SEL)event
+{
+    XCTestExpectation *expectation;
+
+    @synchronized(self) {
+        expectation = _expectations[NSStringFromSelector(event)];
+        [_expectations removeObjectForKey:NSStringFromSelector(event)];
+    }
+    [expectation fulfill];
+}
+
+- (void)failed:(SEL)event
+{
+    NSArray<XCTestExpectation *> *expectations;
+
+    @synchronized(self) {
+        [_failures addObject:NSStringFromSelector(event)];
+        expectations = _expectations.allValues;
+        [_expectations removeAllObjects];
+    }
+    for (XCTestExpectation *expectation in expectations) {
+        [expectation fulfill];
+    }
+}
+
+- (void)connectionLost:(NSNotification *)notification { [self failed:_cmd]; }
+- (void)connectionTimedOut:(NSNotification *)notification { [self failed:_cmd]; }
+- (void)badResponse:(NSNotification *)notification { [self failed:_cmd]; }
+- (void)authenticationFailed:(NSNotification *)notification { [self failed:_cmd]; }
+- (void)folderOpenFailed:(NSNotification *)notification { [self failed:_cmd]; }
+- (void)messageNotSent:(NSNotification *)notification { [self failed:_cmd]; }
+
+- (void)serviceInitialized:(NSNotification *)notification { [self received:_cmd]; }
+- (void)authenticationCompleted:(NSNotification *)notification { [self received:_cmd]; }
+- (void)folderOpenCompleted:(NSNotification *)notification { [self received:_cmd]; }
+- (void)folderFetchCompleted:(NSNotification *)notification { [self received:_cmd]; }
+- (void)messageSent:(NSNotification *)notification { [self received:_cmd]; }
+
+- (void)messagePrefetchCompleted:(NSNotification *)notification
+{
+    @synchronized(self) {
+        [_messages addObject:notification.userInfo[@"Message"]];
+    }
+}
+
+@end
+
+@interface CWFakeServerTests : XCTestCase
+@property (nonatomic) CWFakeServer *server;
+@property (nonatomic) int client;
+@end
+
+@implementation CWFakeServerTests
+
+- (void)tearDown {
+    if (self.client > 0) {
+        close(self.client);
+    }
+    [self.server stop];
+    [super tearDown];
+}
+
+#pragma mark - Tests
+
+- (void)testIMAPFetchWithImpairments {
+    CWFakeIMAPServer *server = [[CWFakeIMAPServer alloc] initWithNumberOfMessages:3 messageSize:2000];
+    server.fragmentSize = 7;
+    server.splitsLiterals = YES;
+    [self connectTo:server];
+
+    XCTAssertTrue([[self readUntil:@"\r\n"] hasPrefix:@"* OK [CAPABILITY IMAP4rev1"]);
+    [self send:@"a LOGIN user {8}\r\n"];
+    XCTAssertTrue([[self readUntil:@"\r\n"] hasPrefix:@"+ "]);
+    [self send:@"password\r\n"];
+    XCTAssertTrue([[self readTagged:@"a"] containsString:@"a OK LOGIN completed"]);
+    [self send:@"b SELECT INBOX\r\n"];
+    XCTAssertTrue([[self readTagged:@"b"] containsString:@"* 3 EXISTS"]);
+
+    [self send:@"c UID FETCH 2:* (UID RFC822.SIZE BODY.PEEK[])\r\n"];
+    NSString *response = [self readTagged:@"c"];
+    NSString *message = [[NSString alloc] initWithData:[server messageWithUID:3]
+                                              encoding:NSASCIIStringEncoding];
+    XCTAssertEqual([server messageWithUID:3].length, 2000);
+    XCTAssertTrue([response containsString:@"* 2 FETCH (UID 2 RFC822.SIZE 2000 BODY[] {2000}\r\n"]);
+    XCTAssertTrue([response containsString:[NSString stringWithFormat:@"{2000}\r\n%@)\r\n", message]]);
+    XCTAssertFalse([response containsString:@"* 1 FETCH"]);
+
+    XCTAssertEqual([server countOfCommand:@"UID FETCH"], 1);
+    XCTAssertEqual([server countOfCommand:@"login"], 1);
+    XCTAssertEqual(server.numberOfConnections, 1);
+}
+
+- (void)testIMAPPartialFetch {
+    CWFakeIMAPServer *server = [[CWFakeIMAPServer alloc] initWithNumberOfMessages:1 messageSize:500];
+    [self connectTo:server];
+    [self readUntil:@"\r\n"];
+
+    [self send:@"a FETCH 1 (BODY.PEEK[]<10.20>)\r\n"];
+    NSString *response = [self readTagged:@"a"];
+    NSData *message = [server messageWithUID:1];
+    NSString *expected = [[NSString alloc] initWithData:[message subdataWithRange:NSMakeRange(10, 20)]
+                                               encoding:NSASCIIStringEncoding];
+    XCTAssertTrue([response containsString:[@"BODY[]<10> {20}\r\n" stringByAppendingString:expected]]);
+}
+
+- (void)testIMAPBinaryFetch {
+    CWFakeIMAPServer *server = [[CWFakeIMAPServer alloc] initWithNumberOfMessages:0 messageSize:0];
+    [self connectTo:server];
+    [self readUntil:@"\r\n"];
+
+    [self send:@"a APPEND INBOX {51+}\r\nContent-Transfer-Encoding: base64\r\n\r\nYQ1iCmMNCmQ=\r\n\r\n"];
+    [self readUntil:@"\r\n"];
+    [self send:@"b UID FETCH 1 (BINARY.PEEK[1] BINARY.SIZE[1])\r\n"];
+
+    XCTAssertTrue([[self readTagged:@"b"] containsString:
+                   @"* 1 FETCH (UID 1 BINARY[1] ~{7}\r\na\rb\nc\r\nd BINARY.SIZE[1] 7)\r\n"]);
+}
+
+- (void)testIMAPIdleReportsNewMessages {
+    CWFakeIMAPServer *server = [[CWFakeIMAPServer alloc] initWithNumberOfMessages:3 messageSize:0];
+    [self connectTo:server];
+    [self readUntil:@"\r\n"];
+
+    [self send:@"a SELECT INBOX\r\n"];
+    [self readTagged:@"a"];
+    [self send:@"b IDLE\r\n"];
+    XCTAssertEqualObjects([self readUntil:@"\r\n"], @"+ idling\r\n");
+
+    [server addMessages:2];
+    XCTAssertEqualObjects([self readUntil:@"\r\n"], @"* 5 EXISTS\r\n");
+
+    [self send:@"DONE\r\n"];
+    XCTAssertEqualObjects([self readUntil:@"\r\n"], @"b OK IDLE terminated\r\n");
+}
+
+- (void)testIMAPAppendWithNonSynchronizingLiteral {
+    CWFakeIMAPServer *server = [[CWFakeIMAPServer alloc] initWithNumberOfMessages:1 messageSize:0];
+    [self connectTo:server];
+    [self readUntil:@"\r\n"];
+
+    [self send:@"a APPEND INBOX (\\Seen) {7+}\r\nSubject\r\n"];
+    XCTAssertEqualObjects([self readUntil:@"\r\n"], @"a OK [APPENDUID 1 2] APPEND completed\r\n");
+    XCTAssertEqualObjects(server.appendedMessages,
+                          @[[@"Subject" dataUsingEncoding:NSASCIIStringEncoding]]);
+    XCTAssertEqual(server.numberOfMessages, 2);
+}
+
+- (void)testIMAPMultiAppend {
+    CWFakeIMAPServer *server = [[CWFakeIMAPServer alloc] initWithNumberOfMessages:1 messageSize:0];
+    [self connectTo:server];
+    [self readUntil:@"\r\n"];
+
+    [self send:@"a APPEND INBOX (\\Seen) {3}\r\n"];
+    XCTAssertTrue([[self readUntil:@"\r\n"] hasPrefix:@"+ "]);
+    [self send:@"one () {3+}\r\ntwo\r\n"];
+    XCTAssertEqualObjects([self readUntil:@"\r\n"], @"a OK [APPENDUID 1 2:3] APPEND completed\r\n");
+    XCTAssertEqualObjects(server.appendedMessages,
+                          (@[[@"one" dataUsingEncoding:NSASCIIStringEncoding],
+                             [@"two" dataUsingEncoding:NSASCIIStringEncoding]]));
+    XCTAssertEqual(server.numberOfMessages, 3);
+}
+
+- (void)testSMTPReceivesMessage {
+    CWFakeSMTPServer *server = [CWFakeSMTPServer new];
+    server.latency = 0.01;
+    [self connectTo:server];
+
+    XCTAssertTrue([[self readUntil:@"\r\n"] hasPrefix:@"220 "]);
+    [self send:@"EHLO client\r\n"];
+    XCTAssertTrue([[self readUntil:@"250 AUTH"] containsString:@"250-PIPELINING"]);
+    [self readUntil:@"\r\n"];
+    [self send:@"MAIL FROM:<a@example.com>\r\nRCPT TO:<b@example.com>\r\nDATA\r\n"];
+    [self readUntil:@"354 "];
+    [self readUntil:@"\r\n"];
+    [self send:@"Subject: x\r\n\r\n..dot\r\n.\r\n"];
+    XCTAssertTrue([[self readUntil:@"\r\n"] hasPrefix:@"250 "]);
+
+    XCTAssertEqualObjects(server.recipients, @[@"b@example.com"]);
+    XCTAssertEqualObjects(server.receivedMessages,
+                          @[[@"Subject: x\r\n\r\n.dot\r\n" dataUsingEncoding:NSASCIIStringEncoding]]);
+    XCTAssertEqual([server countOfCommand:@"RCPT"], 1);
+}
+
+#pragma mark - Services
+
+- (void)testIMAPStoreFetchesMessages {
+    CWFakeIMAPServer *server = [[CWFakeIMAPServer alloc] initWithNumberOfMessages:3 messageSize:2000];
+    server.fragmentSize = 64;
+    server.splitsLiterals = YES;
+    self.server = server;
+    XCTAssertTrue([server start]);
+
+    CWIMAPStore *store = [[CWIMAPStore alloc] initWithName:@"127.0.0.1"
+                                                      port:server.port
+                                                 transport:ConnectionTransportPlain
+                                         clientCertificate:nil];
+    CWFakeServerClient *client = [CWFakeServerClient new];
+    store.maxFetchCount = 10;
+    [store setDelegate:client];
+
+    [self waitFor:@selector(serviceInitialized:) of:client after:^{
+        [store connectInBackgroundAndNotify];
+    }];
+    [self waitFor:@selector(authenticationCompleted:) of:client after:^{
+        [store authenticate:@"user" password:@"password" mechanism:@"PLAIN"];
+    }];
+    __block CWIMAPFolder *folder;
+    [self waitFor:@selector(folderOpenCompleted:) of:client after:^{
+        folder = [store folderForName:@"INBOX" updateExistsCount:NO];
+    }];
+    XCTAssertEqual([folder existsCount], 3);
+    [self waitFor:@selector(folderFetchCompleted:) of:client after:^{
+        [folder fetch];
+    }];
+
+    XCTAssertEqual(client.messages.count, 3);
+    for (CWIMAPMessage *message in client.messages) {
+        XCTAssertEqualObjects([message rawSource], [server messageWithUID:[message UID]]);
+        XCTAssertEqualObjects([message subject],
+                              ([NSString stringWithFormat:@"Message %lu", (unsigned long)[message UID]]));
+    }
+    XCTAssertEqual([folder lastUID], 3);
+    XCTAssertEqual([server countOfCommand:@"AUTHENTICATE"], 1);
+    XCTAssertEqual([server countOfCommand:@"FETCH"], 1);
+    [store close];
+}
+
+- (void)testSMTPSendsMessage {
+    CWFakeSMTPServer *server = [CWFakeSMTPServer new];
+    server.fragmentSize = 16;
+    self.server = server;
+    XCTAssertTrue([server start]);
+
+    CWSMTP *smtp = [[CWSMTP alloc] initWithName:@"127.0.0.1"
+                                           port:server.port
+                                      transport:ConnectionTransportPlain
+                              clientCertificate:nil];
+    CWFakeServerClient *client = [CWFakeServerClient new];
+    [smtp setDelegate:client];
+    NSData *message = [@"From: Sender <sender@example.com>\r\n"
+                       "To: Recipient <recipient@example.com>\r\n"
+                       "Subject: Hello\r\n"
+                       "\r\n"
+                       "A line\r\n"
+                       ".starting with a dot" dataUsingEncoding:NSASCIIStringEncoding];
+
+    [self waitFor:@selector(serviceInitialized:) of:client after:^{
+        [smtp connectInBackgroundAndNotify];
+    }];
+    [self waitFor:@selector(authenticationCompleted:) of:client after:^{
+        [smtp authenticate:@"user" password:@"password" mechanism:@"PLAIN"];
+    }];
+    [self waitFor:@selector(messageSent:) of:client after:^{
+        [smtp setMessageData:message];
+        [smtp sendMessage];
+    }];
+
+    NSMutableData *expected = [message mutableCopy];
+    [expected appendBytes:"\r\n" length:2];
+    XCTAssertEqualObjects(server.recipients, @[@"recipient@example.com"]);
+    XCTAssertEqualObjects(server.receivedMessages, @[expected]);
+    XCTAssertEqual([server countOfCommand:@"AUTH"], 1);
+    [smtp close];
+}
+
+#pragma mark - Helpers
+
+/**
+ Runs action and waits until the service reports event to client.
+ */
+- (void)waitFor:(SEL)event of:(CWFakeServerClient *)client after:(void (^)(void))action {
+    [client expect:[self expectationWithDescription:NSStringFromSelector(event)] event:event];
+    action();
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertEqualObjects(client.failures, @[]);
+}
+
+- (void)connectTo:(CWFakeServer *)server {
+    self.server = server;
+    XCTAssertTrue([server start]);
+
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(server.port);
+
+    struct timeval timeout = { .tv_sec = 5 };
+    self.client = socket(AF_INET, SOCK_STREAM, 0);
+    setsockopt(self.client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    XCTAssertEqual(connect(self.client, (struct sockaddr *)&address, sizeof(address)), 0);
+}
+
+- (void)send:(NSString *)string {
+    NSData *data = [string dataUsingEncoding:NSUTF8StringEncoding];
+    XCTAssertEqual(send(self.client, data.bytes, data.length, 0), (ssize_t)data.length);
+}
+
+/**
+ Reads up to and including the line starting with tag.
+ */
+- (NSString *)readTagged:(NSString *)tag {
+    NSMutableString *response = [NSMutableString new];
+    NSString *line;
+
+    do {
+        line = [self readUntil:@"\r\n"];
+        [response appendString:line];
+    } while (line.length && ![line hasPrefix:[tag stringByAppendingString:@" "]]);
+    return response;
+}
+
+/**
+ Reads byte by byte up to and including marker, so nothing after it is consumed.
+ */
+- (NSString *)readUntil:(NSString *)marker {
+    NSMutableData *data = [NSMutableData new];
+    NSData *end = [marker dataUsingEncoding:NSUTF8StringEncoding];
+    char c;
+
+    while (data.length < end.length ||
+           memcmp((const char *)data.bytes + data.length - end.length, end.bytes, end.length) != 0) {
+        if (recv(self.client, &c, 1, 0) != 1) {
+            XCTFail(@"no %@ in %@", marker, [[NSString alloc] initWithData:data
+                                                                  encoding:NSUTF8StringEncoding]);
+            break;
+        }
+        [data appendBytes:&c length:1];
+    }
+    return [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+}
+
+@end
@@ -0,0 +1,66 @@
+//
+//  CWDateTest.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "CWDate.h"
+
+@interface CWDateTest : XCTestCase
+@end
+
+@implementation CWDateTest
+
+#pragma mark - Tests
+
+- (void)testCivilRoundTrip {
+    XCTAssertEqual(CWDaysFromCivil(1970, 1, 1), 0);
+    XCTAssertEqual(CWDaysFromCivil(2000, 3, 1), 11017);
+    XCTAssertEqual(CWDaysFromCivil(1969, 12, 31), -1);
+
+    for (int64_t days = -800000; days < 800000; days += 7) {
+        int64_t year;
+        unsigned int month, day;
+        CWCivilFromDays(days, &year, &month, &day);
+        XCTAssertEqual(CWDaysFromCivil(year, month, day), days);
+    }
+}
+
+- (void)testFormatRFC5322Date {
+    XCTAssertEqualObjects([self rfc5322:1009987639 offset:-7 * 3600],
+                          @"Wed, 02 Jan 2002 09:07:19 -0700");
+    XCTAssertEqualObjects([self rfc5322:1529603507 offset:5 * 3600 + 1800],
+                          @"Thu, 21 Jun 2018 23:21:47 +0530");
+    XCTAssertEqualObjects([self rfc5322:-1 offset:0],
+                          @"Wed, 31 Dec 1969 23:59:59 +0000");
+}
+
+- (void)testFormatIMAPDateTime {
+    char buffer[CW_DATE_BUFFER_SIZE];
+    NSUInteger length = CWFormatIMAPDateTime(1529603507, 0, buffer);
+    XCTAssertEqualObjects([[NSString alloc] initWithBytes:buffer
+                                                   length:length
+                                                 encoding:NSASCIIStringEncoding],
+                          @"21-Jun-2018 17:51:47 +0000");
+}
+
+- (void)testParseWhatWeFormat {
+    char buffer[CW_DATE_BUFFER_SIZE];
+    NSTimeInterval time = 0;
+    NSUInteger length = CWFormatRFC5322Date(1234567890, -3 * 3600 - 1800, buffer);
+    XCTAssertTrue(CWParseRFC5322Date((const unsigned char *)buffer, length, &time));
+    XCTAssertEqual(time, 1234567890);
+}
+
+#pragma mark - Helpers
+
+- (NSString *)rfc5322:(NSTimeInterval)time offset:(NSInteger)offset {
+    char buffer[CW_DATE_BUFFER_SIZE];
+    NSUInteger length = CWFormatRFC5322Date(time, offset, buffer);
+    return [[NSString alloc] initWithBytes:buffer length:length encoding:NSASCIIStringEncoding];
+}
+
+@end
@@ -0,0 +1,119 @@
+//
+//  CWDigestTest.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "CWDigest.h"
+#import "Pantomime/CWMD5.h"
+
+@interface CWDigestTest : XCTestCase
+@end
+
+@implementation CWDigestTest
+
+#pragma mark - Tests
+
+- (void)testKnownDigests {
+    NSData *abc = [self dataFromString:@"abc"];
+
+    XCTAssertEqualObjects([self hexDigestOfData:abc algorithm:CWDigestAlgorithmMD5],
+                          @"900150983cd24fb0d6963f7d28e17f72");
+    XCTAssertEqualObjects([self hexDigestOfData:[NSData data] algorithm:CWDigestAlgorithmMD5],
+                          @"d41d8cd98f00b204e9800998ecf8427e");
+
+    if ([CWDigest isAlgorithmAvailable:CWDigestAlgorithmSHA1]) {
+        XCTAssertEqualObjects([self hexDigestOfData:abc algorithm:CWDigestAlgorithmSHA1],
+                              @"a9993e364706816aba3e25717850c26c9cd0d89d");
+    }
+    if ([CWDigest isAlgorithmAvailable:CWDigestAlgorithmSHA256]) {
+        XCTAssertEqualObjects([self hexDigestOfData:abc algorithm:CWDigestAlgorithmSHA256],
+                              @"ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    }
+}
+
+- (void)testStreamingMatchesOneShot {
+    NSData *data = [self sampleData];
+
+    for (CWDigestAlgorithm algorithm = CWDigestAlgorithmMD5; algorithm <= CWDigestAlgorithmSHA256; algorithm++) {
+        if (![CWDigest isAlgorithmAvailable:algorithm]) {
+            continue;
+        }
+        CWDigest *digest = [CWDigest digestWithAlgorithm:algorithm];
+        NSUInteger offset = 0;
+        NSUInteger chunk = 1;
+
+        while (offset < data.length) {
+            NSUInteger length = MIN(chunk, data.length - offset);
+            [digest updateWithBytes:(const char *)data.bytes + offset length:length];
+            offset += length;
+            chunk = chunk * 3 + 1;
+        }
+
+        XCTAssertEqualObjects([digest finalizeDigest], [CWDigest digestOfData:data algorithm:algorithm]);
+        XCTAssertEqual([digest finalizeDigest].length, [CWDigest digestLengthForAlgorithm:algorithm]);
+    }
+}
+
+- (void)testFinalizeIsIdempotent {
+    CWDigest *digest = [CWDigest digestWithAlgorithm:CWDigestAlgorithmMD5];
+
+    [digest updateWithData:[self dataFromString:@"abc"]];
+    NSData *first = [digest finalizeDigest];
+    [digest updateWithData:[self dataFromString:@"more"]];
+
+    XCTAssertEqualObjects([digest finalizeDigest], first);
+    XCTAssertEqualObjects([digest digestAsString], @"900150983cd24fb0d6963f7d28e17f72");
+}
+
+- (void)testUnavailableAlgorithm {
+    XCTAssertFalse([CWDigest isAlgorithmAvailable:CWDigestAlgorithmNone]);
+    XCTAssertNil([CWDigest digestWithAlgorithm:CWDigestAlgorithmNone]);
+}
+
+- (void)testMD5StreamingMatchesInitWithData {
+    NSData *data = [self sampleData];
+    CWMD5 *oneShot = [[CWMD5 alloc] initWithData:data];
+    CWMD5 *streamed = [[CWMD5 alloc] init];
+
+    [streamed updateWithData:[data subdataWithRange:NSMakeRange(0, 100)]];
+    [streamed updateWithData:[data subdataWithRange:NSMakeRange(100, data.length - 100)]];
+    [oneShot computeDigest];
+
+    XCTAssertEqualObjects([streamed finalizeDigest], [oneShot digest]);
+    XCTAssertEqualObjects([streamed digestAsString], [oneShot digestAsString]);
+    XCTAssertEqualObjects([oneShot digestAsString],
+                          [self hexDigestOfData:data algorithm:CWDigestAlgorithmMD5]);
+}
+
+- (void)testHexString {
+    unsigned char bytes[] = {0x00, 0x0f, 0xa0, 0xff};
+
+    XCTAssertEqualObjects([CWDigest hexStringFromData:[NSData dataWithBytes:bytes length:4]], @"000fa0ff");
+    XCTAssertEqualObjects([CWDigest hexStringFromData:[NSData data]], @"");
+}
+
+#pragma mark - Helpers
+
+- (NSData *)dataFromString:(NSString *)string {
+    return [string dataUsingEncoding:NSASCIIStringEncoding];
+}
+
+- (NSData *)sampleData {
+    NSMutableData *data = [NSMutableData data];
+
+    for (NSUInteger i = 0; i < 10000; i++) {
+        unsigned char byte = (unsigned char)(i * 31 + 7);
+        [data appendBytes:&byte length:1];
+    }
+    return data;
+}
+
+- (NSString *)hexDigestOfData:(NSData *)data algorithm:(CWDigestAlgorithm)algorithm {
+    return [CWDigest hexStringFromData:[CWDigest digestOfData:data algorithm:algorithm]];
+}
+
+@end
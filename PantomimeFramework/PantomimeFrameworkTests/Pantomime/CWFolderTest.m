@@ -0,0 +1,150 @@
+//
+//  CWFolderTest.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "CWFlags.h"
+#import "CWFolder.h"
+#import "CWMessage.h"
+
+@interface CWFolderTest : XCTestCase
+@property (strong, nonatomic) CWFolder *testee;
+@property (strong, nonatomic) NSArray *messages;
+@end
+
+@implementation CWFolderTest
+
+- (void)setUp {
+    [super setUp];
+    self.testee = [[CWFolder alloc] initWithName:@"INBOX"];
+    NSMutableArray *messages = [NSMutableArray array];
+    // More than one bitmap word worth of messages.
+    for (NSUInteger i = 1; i <= 150; i++) {
+        CWMessage *message = [[CWMessage alloc] init];
+        [message setMessageNumber:i];
+        [message setFolder:self.testee];
+        if (i % 3 == 0) {
+            [[message flags] add:PantomimeFlagSeen];
+        }
+        if (i % 10 == 0) {
+            [[message flags] add:PantomimeFlagDeleted];
+        }
+        [self.testee appendMessage:message];
+        [messages addObject:message];
+    }
+    self.messages = messages;
+}
+
+#pragma mark - Tests
+
+- (void)testHideDeleted {
+    XCTAssertEqualObjects([self numbersOfFolder], [self expectedNumbers]);
+    XCTAssertEqual([self.testee numberOfDeletedMessages], 15);
+}
+
+- (void)testHideRead {
+    [self.testee setShowRead:NO];
+    XCTAssertEqualObjects([self numbersOfFolder], [self expectedNumbers]);
+    XCTAssertEqual([self.testee numberOfUnreadMessages], 100);
+
+    [self.testee setShowDeleted:YES];
+    XCTAssertEqualObjects([self numbersOfFolder], [self expectedNumbers]);
+}
+
+- (void)testFlagChangesAreApplied {
+    [self.testee setShowRead:NO];
+    [self.testee allMessages];
+
+    [[self.messages[0] flags] add:PantomimeFlagSeen];
+    [[self.messages[2] flags] remove:PantomimeFlagSeen];
+    [[self.messages[99] flags] removeAll];
+    [[self.messages[130] flags] add:PantomimeFlagDeleted];
+    [[self.messages[140] flags] replaceWithFlags:[[CWFlags alloc] initWithFlags:PantomimeFlagFlagged]];
+    XCTAssertEqualObjects([self numbersOfFolder], [self expectedNumbers]);
+    XCTAssertEqual([self.testee numberOfMessagesWithFlag:PantomimeFlagFlagged], 1);
+}
+
+- (void)testSetFlagsDoesNotShareInstance {
+    CWFlags *flags = [[CWFlags alloc] initWithFlags:PantomimeFlagDeleted];
+    [self.testee setFlags:flags messages:@[self.messages[0], self.messages[1]]];
+    [[self.messages[0] flags] remove:PantomimeFlagDeleted];
+
+    XCTAssertFalse([[self.messages[0] flags] contain:PantomimeFlagDeleted]);
+    XCTAssertTrue([[self.messages[1] flags] contain:PantomimeFlagDeleted]);
+    XCTAssertEqualObjects([self numbersOfFolder], [self expectedNumbers]);
+}
+
+- (void)testSetFlagsAdoptsInstance {
+    CWFlags *flags = [[CWFlags alloc] initWithFlags:PantomimeFlagDeleted];
+    [self.messages[0] setFlags:flags];
+    XCTAssertEqual([self.messages[0] flags], flags);
+    XCTAssertEqual([self.testee numberOfDeletedMessages], 16);
+
+    // The message observes the instance it adopted, not the one it had.
+    [flags remove:PantomimeFlagDeleted];
+    [flags add:PantomimeFlagSeen];
+    XCTAssertEqualObjects([self numbersOfFolder], [self expectedNumbers]);
+    XCTAssertEqual([self.testee numberOfDeletedMessages], 15);
+    XCTAssertEqual([self.testee numberOfUnreadMessages], 99);
+}
+
+- (void)testSetNilFlagsRemovesThem {
+    [self.messages[8] setFlags:nil];
+    [self.messages[9] setFlags:nil];
+
+    XCTAssertFalse([[self.messages[8] flags] contain:PantomimeFlagSeen]);
+    XCTAssertFalse([[self.messages[9] flags] contain:PantomimeFlagDeleted]);
+    XCTAssertEqualObjects([self numbersOfFolder], [self expectedNumbers]);
+    XCTAssertEqual([self.testee numberOfDeletedMessages], 14);
+    XCTAssertEqual([self.testee numberOfUnreadMessages], 101);
+}
+
+- (void)testRemoveMessages {
+    [self.testee setShowRead:NO];
+    [self.testee allMessages];
+
+    NSMutableArray *messages = [self.messages mutableCopy];
+    // Removing most messages compacts the bitmaps.
+    for (NSUInteger i = 0; i < 120; i++) {
+        CWMessage *message = messages[i % 2 ? 0 : messages.count - 1];
+        [self.testee removeMessage:message];
+        [messages removeObject:message];
+    }
+    self.messages = messages;
+    XCTAssertEqualObjects([self numbersOfFolder], [self expectedNumbers]);
+
+    [[self.messages[5] flags] add:PantomimeFlagSeen];
+    XCTAssertEqualObjects([self numbersOfFolder], [self expectedNumbers]);
+}
+
+#pragma mark - Helpers
+
+- (NSArray *)numbersOfFolder {
+    NSMutableArray *numbers = [NSMutableArray array];
+    for (CWMessage *message in [self.testee allMessages]) {
+        [numbers addObject:@([message messageNumber])];
+    }
+    return numbers;
+}
+
+- (NSArray *)expectedNumbers {
+    NSMutableArray *numbers = [NSMutableArray array];
+    for (CWMessage *message in self.messages) {
+        CWFlags *flags = [message flags];
+        if ([flags contain:PantomimeFlagDeleted]) {
+            if (![self.testee showDeleted]) {
+                continue;
+            }
+        } else if ([flags contain:PantomimeFlagSeen] && ![self.testee showRead]) {
+            continue;
+        }
+        [numbers addObject:@([message messageNumber])];
+    }
+    return numbers;
+}
+
+@end
@@ -0,0 +1,96 @@
+//
+//  CWFolderViewTest.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "CWFolder.h"
+#import "CWFolderView.h"
+#import "CWInternetAddress.h"
+#import "CWMessage.h"
+
+@interface CWFolderViewTest : XCTestCase
+@property (strong, nonatomic) CWFolder *folder;
+@end
+
+@implementation CWFolderViewTest
+
+- (void)setUp {
+    [super setUp];
+    self.folder = [[CWFolder alloc] initWithName:@"INBOX"];
+    [self.folder appendMessage:[self messageWithNumber:1 date:300 sender:@"bob" subject:@"Re: beta"]];
+    [self.folder appendMessage:[self messageWithNumber:2 date:100 sender:@"Alice" subject:@"gamma"]];
+    [self.folder appendMessage:[self messageWithNumber:3 date:200 sender:@"carol" subject:@"Alpha"]];
+}
+
+#pragma mark - Tests
+
+- (void)testSortByDate {
+    CWFolderView *testee = [[CWFolderView alloc] initWithFolder:self.folder
+                                                      criterion:PantomimeSortByDate
+                                                        reverse:NO];
+    XCTAssertEqualObjects([self numbersOfView:testee], (@[@2, @3, @1]));
+
+    [testee setCriterion:PantomimeSortByDate reverse:YES];
+    XCTAssertEqualObjects([self numbersOfView:testee], (@[@1, @3, @2]));
+}
+
+- (void)testSortBySenderIsCaseInsensitive {
+    CWFolderView *testee = [[CWFolderView alloc] initWithFolder:self.folder
+                                                      criterion:PantomimeSortBySender
+                                                        reverse:NO];
+    XCTAssertEqualObjects([self numbersOfView:testee], (@[@2, @1, @3]));
+}
+
+- (void)testSortByBaseSubject {
+    CWFolderView *testee = [[CWFolderView alloc] initWithFolder:self.folder
+                                                      criterion:PantomimeSortBySubject
+                                                        reverse:NO];
+    XCTAssertEqualObjects([self numbersOfView:testee], (@[@3, @1, @2]));
+}
+
+- (void)testFolderChangesAreApplied {
+    CWFolderView *testee = [[CWFolderView alloc] initWithFolder:self.folder
+                                                      criterion:PantomimeSortByDate
+                                                        reverse:NO];
+    CWMessage *newMessage = [self messageWithNumber:4 date:150 sender:@"dave" subject:@"delta"];
+    [self.folder appendMessage:newMessage];
+    XCTAssertEqualObjects([self numbersOfView:testee], (@[@2, @4, @3, @1]));
+    XCTAssertEqual([testee indexOfMessage:newMessage], 1);
+
+    [newMessage setOriginationDate:[NSDate dateWithTimeIntervalSince1970:400]];
+    [self.folder updateMessage:newMessage];
+    XCTAssertEqualObjects([self numbersOfView:testee], (@[@2, @3, @1, @4]));
+
+    [self.folder removeMessage:[testee messageAtIndex:0]];
+    XCTAssertEqualObjects([self numbersOfView:testee], (@[@3, @1, @4]));
+}
+
+#pragma mark - Helpers
+
+- (CWMessage *)messageWithNumber:(NSUInteger)number
+                            date:(NSTimeInterval)date
+                          sender:(NSString *)sender
+                         subject:(NSString *)subject
+{
+    CWMessage *message = [[CWMessage alloc] init];
+    [message setMessageNumber:number];
+    [message setOriginationDate:[NSDate dateWithTimeIntervalSince1970:date]];
+    [message setFrom:[[CWInternetAddress alloc] initWithPersonal:sender
+                                                         address:@"someone@pantomime.test"]];
+    [message setSubject:subject];
+    return message;
+}
+
+- (NSArray *)numbersOfView:(CWFolderView *)view {
+    NSMutableArray *numbers = [NSMutableArray array];
+    for (CWMessage *message in [view allMessages]) {
+        [numbers addObject:@([message messageNumber])];
+    }
+    return numbers;
+}
+
+@end
@@ -0,0 +1,163 @@
+//
+//  CWIMAPMappedCacheTest.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "CWIMAPMappedCache.h"
+#import "CWCacheRecord.h"
+#import "CWFlags.h"
+#import "CWIMAPMessage.h"
+#import "CWIMAPStore.h"
+
+@interface CWIMAPMappedCacheTest : XCTestCase
+@property (strong, nonatomic) NSString *path;
+@end
+
+@implementation CWIMAPMappedCacheTest
+
+- (void)setUp {
+    [super setUp];
+    self.path = [NSTemporaryDirectory() stringByAppendingPathComponent:
+                 [[NSUUID UUID] UUIDString]];
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] removeItemAtPath:self.path error:nil];
+    [[NSFileManager defaultManager]
+     removeItemAtPath:[self.path stringByAppendingPathExtension:@"strings"] error:nil];
+    [super tearDown];
+}
+
+#pragma mark - Tests
+
+- (void)testEmptyCache {
+    CWIMAPMappedCache *testee = [[CWIMAPMappedCache alloc] initWithPath:self.path folder:nil];
+    XCTAssertNotNil(testee);
+    XCTAssertEqual([testee count], 0);
+    XCTAssertNil([testee messageWithUID:1]);
+}
+
+- (void)testWriteAndReopen {
+    CWIMAPMappedCache *testee = [[CWIMAPMappedCache alloc] initWithPath:self.path folder:nil];
+    [testee setUIDValidity:42];
+    for (NSUInteger uid = 1; uid <= 3000; uid++) {
+        [self writeMessageWithUID:uid toCache:testee];
+    }
+    XCTAssertTrue([testee synchronize]);
+    testee = nil;
+
+    testee = [[CWIMAPMappedCache alloc] initWithPath:self.path folder:nil];
+    XCTAssertEqual([testee count], 3000);
+    XCTAssertEqual([testee UIDValidity], 42);
+
+    CWIMAPMessage *message = [testee messageWithUID:1234];
+    XCTAssertNotNil(message);
+    XCTAssertEqual([message UID], 1234);
+    XCTAssertEqualObjects([message subject], @"Subject 1234");
+    XCTAssertEqualObjects([message messageID], @"1234@pantomime.test");
+    XCTAssertTrue([[message flags] contain:PantomimeFlagSeen]);
+    XCTAssertEqual([[message originationDate] timeIntervalSince1970], 1000000 + 1234);
+    // Lazily materialized messages are returned as the same instance.
+    XCTAssertEqual(message, [testee messageWithUID:1234]);
+}
+
+- (void)testOutOfOrderInsertion {
+    CWIMAPMappedCache *testee = [[CWIMAPMappedCache alloc] initWithPath:self.path folder:nil];
+    [self writeMessageWithUID:30 toCache:testee];
+    [self writeMessageWithUID:10 toCache:testee];
+    [self writeMessageWithUID:20 toCache:testee];
+    [testee synchronize];
+    testee = [[CWIMAPMappedCache alloc] initWithPath:self.path folder:nil];
+
+    XCTAssertEqual([testee count], 3);
+    XCTAssertEqualObjects([[testee messageWithUID:10] subject], @"Subject 10");
+    XCTAssertEqualObjects([[testee messageWithUID:20] subject], @"Subject 20");
+    XCTAssertEqualObjects([[testee messageWithUID:30] subject], @"Subject 30");
+}
+
+- (void)testRemoveAndExpunge {
+    CWIMAPMappedCache *testee = [[CWIMAPMappedCache alloc] initWithPath:self.path folder:nil];
+    for (NSUInteger uid = 1; uid <= 10; uid++) {
+        [self writeMessageWithUID:uid toCache:testee];
+    }
+    [testee removeMessageWithUID:5];
+    XCTAssertEqual([testee count], 9);
+    XCTAssertNil([testee messageWithUID:5]);
+
+    [testee expunge];
+    [testee synchronize];
+    testee = [[CWIMAPMappedCache alloc] initWithPath:self.path folder:nil];
+    XCTAssertEqual([testee count], 9);
+    XCTAssertNil([testee messageWithUID:5]);
+    XCTAssertNotNil([testee messageWithUID:6]);
+}
+
+- (void)testFlagChangesAreSynchronized {
+    CWIMAPMappedCache *testee = [[CWIMAPMappedCache alloc] initWithPath:self.path folder:nil];
+    [self writeMessageWithUID:7 toCache:testee];
+    [[[testee messageWithUID:7] flags] add:PantomimeFlagFlagged];
+    [testee synchronize];
+    testee = [[CWIMAPMappedCache alloc] initWithPath:self.path folder:nil];
+
+    XCTAssertTrue([[[testee messageWithUID:7] flags] contain:PantomimeFlagFlagged]);
+}
+
+- (void)testInvalidate {
+    CWIMAPMappedCache *testee = [[CWIMAPMappedCache alloc] initWithPath:self.path folder:nil];
+    [self writeMessageWithUID:1 toCache:testee];
+    [testee invalidate];
+    XCTAssertEqual([testee count], 0);
+    XCTAssertNil([testee messageWithUID:1]);
+}
+
+- (void)testReopenWithTruncatedHeap {
+    CWIMAPMappedCache *testee = [[CWIMAPMappedCache alloc] initWithPath:self.path folder:nil];
+    [self writeMessageWithUID:1 toCache:testee];
+    [self writeMessageWithUID:2 toCache:testee];
+    XCTAssertTrue([testee synchronize]);
+    testee = nil;
+
+    // As if the last heap writes never reached the disk.
+    NSString *heapPath = [self.path stringByAppendingPathExtension:@"strings"];
+    NSFileHandle *heap = [NSFileHandle fileHandleForWritingAtPath:heapPath];
+    [heap truncateFileAtOffset:20];
+    [heap closeFile];
+
+    testee = [[CWIMAPMappedCache alloc] initWithPath:self.path folder:nil];
+    XCTAssertEqual([testee count], 2);
+    CWIMAPMessage *message = [testee messageWithUID:2];
+    XCTAssertNotNil(message);
+    XCTAssertNil([message subject]);
+    XCTAssertEqual([[message originationDate] timeIntervalSince1970], 1000000 + 2);
+
+    // Storing the fields again works as before.
+    [self writeMessageWithUID:2 toCache:testee];
+    XCTAssertTrue([testee synchronize]);
+    testee = [[CWIMAPMappedCache alloc] initWithPath:self.path folder:nil];
+    XCTAssertEqualObjects([[testee messageWithUID:2] subject], @"Subject 2");
+}
+
+#pragma mark - Helpers
+
+- (void)writeMessageWithUID:(NSUInteger)uid toCache:(CWIMAPMappedCache *)cache {
+    CWIMAPMessage *message = [[CWIMAPMessage alloc] init];
+    [message setUID:uid];
+    [[message flags] add:PantomimeFlagSeen];
+
+    CWCacheRecord *record = [[CWCacheRecord alloc] init];
+    record.date = 1000000 + uid;
+    record.size = 100;
+    record.subject = [[NSString stringWithFormat:@"Subject %lu", (unsigned long)uid]
+                      dataUsingEncoding:NSASCIIStringEncoding];
+    record.message_id = [[NSString stringWithFormat:@"<%lu@pantomime.test>", (unsigned long)uid]
+                         dataUsingEncoding:NSASCIIStringEncoding];
+    record.from = [@"Alice <alice@pantomime.test>" dataUsingEncoding:NSASCIIStringEncoding];
+
+    [cache writeRecord:record message:message messageUpdate:[CWMessageUpdate newComplete]];
+}
+
+@end
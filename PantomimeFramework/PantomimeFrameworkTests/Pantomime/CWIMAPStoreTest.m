@@ -35,6 +35,10 @@ static NSString *CRLF = @"\r\n";
 #pragma mark Test Store
 
 #import "CWIMAPStore+Protected.h"
+#import "CWIMAPFolder.h"
+#import "CWFolderView.h"
+#import "CWMessage.h"
+#import "CWPart.h"
 #import "CWThreadSafeData.h"
 @class TestableImapStore;
 
@@ -45,14 +49,34 @@ static NSString *CRLF = @"\r\n";
 @interface TestableImapStore:CWIMAPStore
 @property (weak, nonatomic) id<TestableImapStoreDelegate> testDelegate;
 @property (weak, nonatomic) CWIMAPQueueObject *currentQueueObject;
+@property (strong, nonatomic) NSMutableString *sentString;
 - (void)setReadBufferData:(NSData *)data;
+- (void)setLastCommand:(IMAPCommand)command;
+- (void)setSelectedFolder:(CWIMAPFolder *)folder;
 @end
 @implementation TestableImapStore
 @dynamic currentQueueObject;
+- (void)bulkWriteData:(NSArray<NSData *> *)bulkData
+{
+    if (!self.sentString) {
+        self.sentString = [NSMutableString new];
+    }
+    for (NSData *data in bulkData) {
+        [self.sentString appendString:[[NSString alloc] initWithData:data encoding:NSASCIIStringEncoding]];
+    }
+}
 - (void)setReadBufferData:(NSData *)data
 {
     _rbuf = [[CWThreadSafeData alloc] initWithData:data];
 }
+- (void)setLastCommand:(IMAPCommand)command
+{
+    _lastCommand = command;
+}
+- (void)setSelectedFolder:(CWIMAPFolder *)folder
+{
+    _selectedFolder = folder;
+}
 - (void) _parseBAD
 {
     [self.testDelegate testableImapStoreDidCallParseBad:self];
@@ -78,6 +102,19 @@ static NSString *CRLF = @"\r\n";
 }
 @end
 
+@interface FolderNameRecorder:NSObject
+@property (nonatomic, strong) NSMutableArray<NSDictionary *> *folders;
+@end
+@implementation FolderNameRecorder
+- (void)folderNameParsed:(NSNotification *)notification
+{
+    if (!self.folders) {
+        self.folders = [NSMutableArray new];
+    }
+    [self.folders addObject:notification.userInfo[PantomimeFolderInfo]];
+}
+@end
+
 #pragma mark - CWIMAPStoreTest
 
 @interface CWIMAPStoreTest : XCTestCase
@@ -222,6 +259,322 @@ static NSString *CRLF = @"\r\n";
     [self waitForExpectationsWithTimeout:5.0 handler:nil];
 }
 
+#pragma mark - SESSION ESTABLISHMENT
+
+- (void)testUpdateRead_GreetingCapabilitiesAreCachedPerServer {
+    TestableImapStore *store = [self storeReceivingGreeting:@"* OK [CAPABILITY IMAP4rev1 BINARY AUTH=PLAIN] ready"
+                                                     server:@"greeting.example.com"];
+
+    XCTAssertNil(store.sentString);
+    XCTAssertTrue([store.capabilities containsObject:@"AUTH=PLAIN"]);
+    XCTAssertTrue([store supportsBinary]);
+
+    store = [self storeReceivingGreeting:@"* OK ready" server:@"greeting.example.com"];
+    XCTAssertNil(store.sentString);
+    XCTAssertTrue([store.capabilities containsObject:@"AUTH=PLAIN"]);
+
+    store = [self storeReceivingGreeting:@"* OK ready" server:@"other.example.com"];
+    XCTAssertTrue([store.sentString hasSuffix:@" CAPABILITY\r\n"]);
+}
+
+- (void)testUpdateRead_GreetingCapabilitiesAreCachedPerTransport {
+    TestableImapStore *store = [self storeReceivingGreeting:@"* OK [CAPABILITY IMAP4rev1 AUTH=PLAIN] ready"
+                                                     server:@"transport.example.com"];
+    XCTAssertNil(store.sentString);
+
+    store = [self storeForServer:@"transport.example.com" transport:ConnectionTransportTLS];
+    [store setReadBufferData:[self dataOf:@"* OK ready\r\n"]];
+    [store updateRead];
+    XCTAssertTrue([store.sentString hasSuffix:@" CAPABILITY\r\n"]);
+}
+
+- (void)testUpdateRead_DisagreeingCapabilitiesDropCacheEntry {
+    [self storeReceivingGreeting:@"* OK [CAPABILITY IMAP4rev1 AUTH=PLAIN] ready"
+                          server:@"changed.example.com"];
+    TestableImapStore *store = [self storeReceivingGreeting:@"* OK ready" server:@"changed.example.com"];
+    XCTAssertNil(store.sentString);
+
+    // The server was reconfigured, and says so before we authenticate.
+    [store setReadBufferData:[self dataOf:@"* CAPABILITY IMAP4rev1 AUTH=LOGIN\r\n"]];
+    [store updateRead];
+    XCTAssertTrue([store.capabilities containsObject:@"AUTH=LOGIN"]);
+
+    store = [self storeReceivingGreeting:@"* OK ready" server:@"changed.example.com"];
+    XCTAssertTrue([store.sentString hasSuffix:@" CAPABILITY\r\n"]);
+}
+
+- (void)testUpdateRead_AuthenticatedCapabilitiesKeepCacheEntry {
+    TestableImapStore *store = [self storeReceivingGreeting:@"* OK [CAPABILITY IMAP4rev1 AUTH=PLAIN] ready"
+                                                     server:@"kept.example.com"];
+    [store authenticate:@"tim" password:@"tanstaaftanstaaf" mechanism:@"PLAIN"];
+    [store setReadBufferData:[self dataOf:@"+ \r\n"]];
+    [store updateRead];
+    [store setReadBufferData:[self dataOf:@"* CAPABILITY IMAP4rev1 MOVE\r\n0001 OK Logged in\r\n"]];
+    [store updateRead];
+    XCTAssertTrue([store.capabilities containsObject:@"MOVE"]);
+
+    store = [self storeReceivingGreeting:@"* OK ready" server:@"kept.example.com"];
+    XCTAssertNil(store.sentString);
+    XCTAssertTrue([store.capabilities containsObject:@"AUTH=PLAIN"]);
+}
+
+- (void)testAuthenticatePlainWithInitialResponse {
+    TestableImapStore *store = [self storeReceivingGreeting:@"* OK [CAPABILITY IMAP4rev1 SASL-IR AUTH=PLAIN] ready"
+                                                     server:@"sasl-ir.example.com"];
+
+    [store authenticate:@"tim" password:@"tanstaaftanstaaf" mechanism:@"PLAIN"];
+    XCTAssertTrue([store.sentString hasSuffix:@" AUTHENTICATE PLAIN AHRpbQB0YW5zdGFhZnRhbnN0YWFm\r\n"]);
+
+    // The capabilities in the tagged OK replace the ones of the greeting.
+    [store setReadBufferData:[@"0001 OK [CAPABILITY IMAP4rev1 BINARY MOVE] Logged in\r\n"
+                              dataUsingEncoding:NSASCIIStringEncoding]];
+    [store updateRead];
+    XCTAssertEqualObjects(store.capabilities, ([NSSet setWithObjects:@"IMAP4rev1", @"BINARY", @"MOVE", nil]));
+    XCTAssertTrue([store supportsBinary]);
+}
+
+- (void)testAuthenticatePlainWithoutSaslIR {
+    TestableImapStore *store = [self storeReceivingGreeting:@"* OK [CAPABILITY IMAP4rev1 AUTH=PLAIN] ready"
+                                                     server:@"no-sasl-ir.example.com"];
+
+    [store authenticate:@"tim" password:@"tanstaaftanstaaf" mechanism:@"PLAIN"];
+    XCTAssertTrue([store.sentString hasSuffix:@" AUTHENTICATE PLAIN\r\n"]);
+
+    [store setReadBufferData:[@"+ \r\n" dataUsingEncoding:NSASCIIStringEncoding]];
+    [store updateRead];
+    XCTAssertTrue([store.sentString hasSuffix:@"\r\nAHRpbQB0YW5zdGFhZnRhbnN0YWFm\r\n"]);
+}
+
+- (TestableImapStore *)storeReceivingGreeting:(NSString *)greeting server:(NSString *)server
+{
+    TestableImapStore *store = [self storeForServer:server];
+
+    [store setReadBufferData:[[greeting stringByAppendingString:CRLF] dataUsingEncoding:NSASCIIStringEncoding]];
+    [store updateRead];
+    return store;
+}
+
+#pragma mark - LIST
+
+- (void)testUpdateRead_ListUnquotedMailboxWithBrackets {
+    TestableImapStore *store = [self storeWithCommand:IMAP_LIST info:nil];
+    FolderNameRecorder *recorder = [FolderNameRecorder new];
+    [store setDelegate:recorder];
+
+    [store setReadBufferData:[self dataOf:@"* LIST (\\HasNoChildren \\Trash) \"/\" [Gmail]/Trash\r\n"
+                              "* LIST (\\HasChildren) \"/\" INBOX\r\n"]];
+    [store updateRead];
+
+    XCTAssertEqual(recorder.folders.count, 2);
+    XCTAssertEqualObjects(recorder.folders[0][PantomimeFolderNameKey], @"[Gmail]/Trash");
+    XCTAssertEqualObjects(recorder.folders[0][PantomimeFolderSpecialUseKey], @(PantomimeSpecialUseMailboxTrash));
+    XCTAssertEqualObjects(recorder.folders[1][PantomimeFolderNameKey], @"INBOX");
+}
+
+#pragma mark - APPEND
+
+- (void)testMultiAppendWithNonSynchronizingLiterals {
+    TestableImapStore *store = [self storeReceivingGreeting:@"* OK [CAPABILITY IMAP4rev1 MULTIAPPEND LITERAL+] ready"
+                                                     server:@"multiappend.example.com"];
+    CWIMAPFolder *folder = [self folderOfStore:store];
+
+    [folder appendMessagesFromRawSources:@[[self dataOf:@"one"], [self dataOf:@"two"]] flags:nil internalDates:nil];
+
+    XCTAssertTrue([store.sentString hasPrefix:@"0001 APPEND \"INBOX\" () \""]);
+    XCTAssertTrue([store.sentString containsString:@"\" {5+}\r\none\r\n () \""]);
+    XCTAssertTrue([store.sentString hasSuffix:@"\" {5+}\r\ntwo\r\n\r\n"]);
+}
+
+- (void)testMultiAppendWithSynchronizingLiterals {
+    TestableImapStore *store = [self storeReceivingGreeting:@"* OK [CAPABILITY IMAP4rev1 MULTIAPPEND] ready"
+                                                     server:@"synchronizing.example.com"];
+    CWIMAPFolder *folder = [self folderOfStore:store];
+
+    [folder appendMessagesFromRawSources:@[[self dataOf:@"one"], [self dataOf:@"two"]] flags:nil internalDates:nil];
+    XCTAssertTrue([store.sentString hasSuffix:@"\" {5}\r\n"]);
+    XCTAssertFalse([store.sentString containsString:@"one"]);
+
+    [store setReadBufferData:[self dataOf:@"+ Ready\r\n"]];
+    [store updateRead];
+    XCTAssertTrue([store.sentString containsString:@"\" {5}\r\none\r\n () \""]);
+    XCTAssertTrue([store.sentString hasSuffix:@"\" {5}\r\n"]);
+
+    [store setReadBufferData:[self dataOf:@"+ Ready\r\n"]];
+    [store updateRead];
+    XCTAssertTrue([store.sentString hasSuffix:@"\" {5}\r\ntwo\r\n\r\n"]);
+}
+
+- (CWIMAPFolder *)folderOfStore:(CWIMAPStore *)store
+{
+    CWIMAPFolder *folder = [[CWIMAPFolder alloc] initWithName:@"INBOX" mode:PantomimeReadWriteMode];
+
+    [folder setStore:store];
+    return folder;
+}
+
+- (NSData *)dataOf:(NSString *)string
+{
+    return [string dataUsingEncoding:NSASCIIStringEncoding];
+}
+
+#pragma mark - FETCH
+
+- (void)testUpdateRead_FetchMovesMessagesInViewSortedBySize {
+    NSString *response = @"* 1 FETCH (UID 10 RFC822.SIZE 500 FLAGS ())\r\n"
+    "* 2 FETCH (UID 11 RFC822.SIZE 100 FLAGS (\\Seen))\r\n"
+    "* 3 FETCH (UID 12 RFC822.SIZE 300 FLAGS ())\r\n";
+    TestableImapStore *store = [self storeWithCommand:IMAP_UID_FETCH_FLAGS info:@{}];
+    CWIMAPFolder *folder = [self selectedFolderOfStore:store];
+    CWFolderView *view = [[CWFolderView alloc] initWithFolder:folder
+                                                    criterion:PantomimeSortBySize
+                                                      reverse:NO];
+
+    [store setReadBufferData:[self dataOf:response]];
+    [store updateRead];
+
+    NSMutableArray *numbers = [NSMutableArray array];
+    for (CWMessage *message in [view allMessages]) {
+        [numbers addObject:@([message messageNumber])];
+    }
+    XCTAssertEqualObjects(numbers, (@[@2, @3, @1]));
+}
+
+// Before BINARY, a literal ending on a line boundary lost its final CRLF,
+// so the raw source was "Subject: a\r\n\r\nbody" (18 bytes of 20).
+- (void)testUpdateRead_FetchBodyLiteralKeepsItsFinalCrLf {
+    NSString *response = @"* 1 FETCH (UID 7 BODY[] {20}\r\nSubject: a\r\n\r\nbody\r\n)\r\n";
+    TestableImapStore *store = [self storeWithCommand:IMAP_UID_FETCH_RFC822 info:@{}];
+    CWIMAPFolder *folder = [self selectedFolderOfStore:store];
+
+    [store setReadBufferData:[self dataOf:response]];
+    [store updateRead];
+
+    XCTAssertEqualObjects([[folder.allMessages firstObject] rawSource],
+                          [self dataOf:@"Subject: a\r\n\r\nbody\r\n"]);
+}
+
+// Before BINARY, a literal ending inside a line kept as many bytes of the
+// line as followed the literal: the raw source ended with "xy UID ".
+- (void)testUpdateRead_FetchBodyLiteralEndingInsideLine {
+    NSString *response = @"* 1 FETCH (BODY[] {16}\r\nSubject: b\r\n\r\nxy UID 8)\r\n";
+    TestableImapStore *store = [self storeWithCommand:IMAP_UID_FETCH_RFC822 info:@{}];
+    CWIMAPFolder *folder = [self selectedFolderOfStore:store];
+
+    [store setReadBufferData:[self dataOf:response]];
+    [store updateRead];
+
+    CWMessage *message = [folder.allMessages firstObject];
+    XCTAssertEqualObjects([message rawSource], [self dataOf:@"Subject: b\r\n\r\nxy"]);
+    XCTAssertEqual([message UID], 8);
+}
+
+- (CWIMAPFolder *)selectedFolderOfStore:(TestableImapStore *)store
+{
+    CWIMAPFolder *folder = [self folderOfStore:store];
+
+    [folder setSelected:YES];
+    [store setSelectedFolder:folder];
+    return folder;
+}
+
+#pragma mark - BINARY
+
+- (void)testUpdateRead_FetchBinaryLiteral8 {
+    const char response[] = "* 12 FETCH (UID 54 BINARY[2] ~{9}\r\n\0\xff" "ab\r\ncd\r)\r\n"
+    "0003 OK UID FETCH completed\r\n";
+    CWPart *part = [CWPart new];
+    TestableImapStore *store = [self storeFetchingPart:part command:IMAP_UID_FETCH_BINARY];
+
+    [store setReadBufferData:[NSData dataWithBytes:response length:sizeof(response) - 1]];
+    [store updateRead];
+
+    XCTAssertEqualObjects(part.content, [NSData dataWithBytes:"\0\xff" "ab\r\ncd\r" length:9]);
+    XCTAssertEqual(part.size, 9);
+}
+
+- (void)testUpdateRead_FetchBodyPartWithoutBinary {
+    NSString *response = @"* 12 FETCH (UID 54 BODY[2] {10}\r\nAP9hYg0K\r\n)\r\n";
+    CWPart *part = [CWPart new];
+    [part setContentTransferEncoding:PantomimeEncodingBase64];
+    TestableImapStore *store = [self storeFetchingPart:part command:IMAP_UID_FETCH_BINARY];
+
+    [store setReadBufferData:[response dataUsingEncoding:NSASCIIStringEncoding]];
+    [store updateRead];
+
+    XCTAssertEqualObjects(part.content, [NSData dataWithBytes:"\0\xff" "ab\r\n" length:6]);
+}
+
+- (void)testUpdateRead_FetchBinarySize {
+    NSString *response = @"* 12 FETCH (UID 54 BINARY.SIZE[2] 3456)\r\n";
+    CWPart *part = [CWPart new];
+    TestableImapStore *store = [self storeFetchingPart:part command:IMAP_UID_FETCH_BINARY_SIZE];
+
+    [store setReadBufferData:[response dataUsingEncoding:NSASCIIStringEncoding]];
+    [store updateRead];
+
+    XCTAssertEqual(part.size, 3456);
+}
+
+- (void)testUpdateRead_FetchPreviewOfPart {
+    NSString *response = @"* 12 FETCH (UID 54 BINARY[2]<0> {4}\r\nabcd)\r\n";
+    CWPart *part = [CWPart new];
+    TestableImapStore *store = [self storeWithCommand:IMAP_UID_FETCH_BINARY
+                                                 info:@{@"Part": part, @"Section": @"2", @"UID": @54,
+                                                        @"Length": @4}];
+
+    [store setReadBufferData:[response dataUsingEncoding:NSASCIIStringEncoding]];
+    [store updateRead];
+
+    XCTAssertEqualObjects(part.content, [@"abcd" dataUsingEncoding:NSASCIIStringEncoding]);
+}
+
+- (void)testUpdateRead_FetchPartialWindowIntoSpoolFile {
+    NSString *response = @"* 12 FETCH (UID 54 BODY[]<10> {6}\r\nab\r\ncd)\r\n";
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString];
+    // The first window, and the start of a second one interrupted by a reconnection.
+    [[@"0123456789xx" dataUsingEncoding:NSASCIIStringEncoding] writeToFile:path atomically:NO];
+    TestableImapStore *store = [self storeWithCommand:IMAP_UID_FETCH_PARTIAL
+                                                 info:@{@"Section": @"", @"UID": @54, @"Path": path,
+                                                        @"Offset": @10, @"Window": @10}];
+
+    [store setReadBufferData:[response dataUsingEncoding:NSASCIIStringEncoding]];
+    [store updateRead];
+
+    XCTAssertEqualObjects([NSData dataWithContentsOfFile:path],
+                          [@"0123456789ab\r\ncd" dataUsingEncoding:NSASCIIStringEncoding]);
+    XCTAssertEqualObjects(store.currentQueueObject.info[@"Received"], @6);
+    [[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+}
+
+- (TestableImapStore *)storeFetchingPart:(CWPart *)part command:(IMAPCommand)command
+{
+    return [self storeWithCommand:command info:@{@"Part": part, @"Section": @"2", @"UID": @54}];
+}
+
+- (TestableImapStore *)storeWithCommand:(IMAPCommand)command info:(NSDictionary *)info
+{
+    TestableImapStore *store = [self storeForServer:@"localhost"];
+
+    store.currentQueueObject = [[CWIMAPQueueObject alloc] initWithCommand:command
+                                                                arguments:@"UID FETCH 54"
+                                                                      tag:[store nextTag]
+                                                                     info:info];
+    [store setLastCommand:command];
+    return store;
+}
+
+- (TestableImapStore *)storeForServer:(NSString *)server
+{
+    return [self storeForServer:server transport:ConnectionTransportPlain];
+}
+
+- (TestableImapStore *)storeForServer:(NSString *)server transport:(ConnectionTransport)transport
+{
+    return [[TestableImapStore alloc] initWithName:server port:143
+                                         transport:transport
+                                 clientCertificate:nil];
+}
+
 #pragma mark - UID PARSING
 
 #pragma mark _uniqueIdentifiersFromSearchResponseData
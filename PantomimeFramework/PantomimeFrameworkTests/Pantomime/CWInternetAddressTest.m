@@ -9,6 +9,7 @@
 #import <XCTest/XCTest.h>
 
 #import "CWInternetAddress.h"
+#import "CWInternetAddress+Parsing.h"
 
 @interface CWInternetAddressTest : XCTestCase
 
@@ -104,4 +105,65 @@
     XCTAssertNil(testee.personal);
 }
 
+#pragma mark - initWithString
+
+- (void)testInitWithString
+{
+    CWInternetAddress *testee = [[CWInternetAddress alloc]
+                                 initWithString:@"\"Marcotte, Ludovic\" <ludovic@Sophos.ca>"];
+    XCTAssertEqualObjects(testee.address, @"ludovic@Sophos.ca");
+    XCTAssertEqualObjects(testee.personal, @"\"Marcotte, Ludovic\"");
+
+    testee = [[CWInternetAddress alloc] initWithString:@"\"Joe\" User <joe@acme.com>"];
+    XCTAssertEqualObjects(testee.address, @"joe@acme.com");
+    XCTAssertEqualObjects(testee.personal, @"\"Joe\" User\"");
+
+    testee = [[CWInternetAddress alloc] initWithString:@"joe@acme.com (Joe User)"];
+    XCTAssertEqualObjects(testee.address, @"joe@acme.com");
+    XCTAssertEqualObjects(testee.personal, @"\"Joe User\"");
+
+    testee = [[CWInternetAddress alloc] initWithString:@"<ludovic@Sophos.ca>"];
+    XCTAssertEqualObjects(testee.address, @"ludovic@Sophos.ca");
+    XCTAssertNil(testee.personal);
+
+    XCTAssertNil([[CWInternetAddress alloc] initWithString:@"Nobody <>"]);
+}
+
+#pragma mark - addressesFromBytes
+
+- (void)testAddressesFromBytes
+{
+    NSArray *testee = [self addressesFromString:
+                       @"\"Marcotte, Ludovic\" <l@sophos.ca>, undisclosed-recipients:;,"
+                       "Friends: a@b.ch (A), =?utf-8?Q?J=C3=B6rg?= <j@x.ch>;, <@relay:r@x.ch>"];
+    XCTAssertEqual(testee.count, 4);
+    XCTAssertEqualObjects([testee[0] address], @"l@sophos.ca");
+    XCTAssertEqualObjects([testee[0] personal], @"\"Marcotte, Ludovic\"");
+    XCTAssertEqualObjects([testee[1] address], @"a@b.ch");
+    XCTAssertEqualObjects([testee[1] personal], @"\"A\"");
+    XCTAssertEqualObjects([testee[2] address], @"j@x.ch");
+    XCTAssertEqualObjects([testee[2] personal], @"\"J\u00f6rg\"");
+    XCTAssertEqualObjects([testee[3] address], @"r@x.ch");
+}
+
+- (void)testAddressesFromBytes_manyRecipients
+{
+    NSMutableString *line = [NSMutableString string];
+    for (NSUInteger i = 0; i < 5000; i++) {
+        [line appendFormat:@"%@\"User %lu\" <user%lu@pantomime.test>", i ? @", " : @"",
+         (unsigned long)i, (unsigned long)i];
+    }
+    NSArray *testee = [self addressesFromString:line];
+    XCTAssertEqual(testee.count, 5000);
+    XCTAssertEqualObjects([testee.lastObject address], @"user4999@pantomime.test");
+}
+
+#pragma mark - Helpers
+
+- (NSArray *)addressesFromString:(NSString *)string
+{
+    NSData *data = [string dataUsingEncoding:NSUTF8StringEncoding];
+    return [CWInternetAddress addressesFromBytes:data.bytes length:data.length charset:nil];
+}
+
 @end
@@ -0,0 +1,108 @@
+//
+//  CWLoggerTest.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "CWLogger.h"
+
+@interface CWLoggerTest : XCTestCase
+@property (nonatomic) CWLogLevel previousLevel;
+@property (strong, nonatomic) NSMutableArray<NSString *> *messages;
+@property (nonatomic) NSUInteger evaluations;
+@end
+
+@implementation CWLoggerTest
+
+- (void)setUp {
+    [super setUp];
+    self.previousLevel = [CWLogger level];
+    self.messages = [NSMutableArray new];
+
+    NSMutableArray *messages = self.messages;
+    [CWLogger setSink:^(CWLogLevel level, const char *filename, const char *function,
+                        NSInteger line, NSString *message) {
+        @synchronized (messages) {
+            [messages addObject:message];
+        }
+    }];
+}
+
+- (void)tearDown {
+    [CWLogger flush];
+    [CWLogger setSink:nil];
+    [CWLogger setLevel:self.previousLevel];
+    [super tearDown];
+}
+
+#pragma mark - Tests
+
+- (void)testDisabledLevelDoesNotEvaluateArguments {
+    [CWLogger setLevel:CWLogLevelWarn];
+
+    LogInfo(@"info %@", [self expensiveArgument]);
+    LogWarn(@"warn %@", [self expensiveArgument]);
+    [CWLogger flush];
+
+    XCTAssertEqual(self.evaluations, 1);
+    XCTAssertEqualObjects(self.messages, @[@"warn argument"]);
+}
+
+- (void)testNoneDisablesEverything {
+    [CWLogger setLevel:CWLogLevelNone];
+
+    LogError(@"error %@", [self expensiveArgument]);
+    [CWLogger flush];
+
+    XCTAssertEqual(self.evaluations, 0);
+    XCTAssertEqual(self.messages.count, 0);
+}
+
+- (void)testMessagesKeepOrderAcrossThreads {
+    [CWLogger setLevel:CWLogLevelInfo];
+    NSUInteger dropped = [CWLogger droppedMessages];
+
+    dispatch_apply(4, dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^(size_t thread) {
+        for (NSUInteger i = 0; i < 100; i++) {
+            LogInfo(@"%zu %lu", thread, (unsigned long)i);
+        }
+    });
+    [CWLogger flush];
+
+    XCTAssertEqual(self.messages.count + [CWLogger droppedMessages] - dropped, 400);
+    for (size_t thread = 0; thread < 4; thread++) {
+        NSString *prefix = [NSString stringWithFormat:@"%zu ", thread];
+        NSInteger last = -1;
+        for (NSString *message in self.messages) {
+            if ([message hasPrefix:prefix]) {
+                NSInteger i = [[message substringFromIndex:prefix.length] integerValue];
+                XCTAssertGreaterThan(i, last);
+                last = i;
+            }
+        }
+    }
+}
+
+- (void)testMacroIsASingleStatement {
+    [CWLogger setLevel:CWLogLevelInfo];
+
+    if (self.evaluations == 0)
+        LogInfo(@"then");
+    else
+        LogInfo(@"else");
+    [CWLogger flush];
+
+    XCTAssertEqualObjects(self.messages, @[@"then"]);
+}
+
+#pragma mark - Helpers
+
+- (NSString *)expensiveArgument {
+    self.evaluations++;
+    return @"argument";
+}
+
+@end
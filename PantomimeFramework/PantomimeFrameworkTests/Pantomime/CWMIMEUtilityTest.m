@@ -42,4 +42,39 @@
     XCTAssertTrue([expected isEqualToString:testee]);
 }
 
+- (void)testDecodeHeader_plainASCII {
+    NSData *data = [@"Re: Meeting = tomorrow? 10:00"
+                    dataUsingEncoding:NSASCIIStringEncoding];
+    XCTAssertEqualObjects([CWMIMEUtility decodeHeader:data charset:nil],
+                          @"Re: Meeting = tomorrow? 10:00");
+    XCTAssertEqualObjects([CWMIMEUtility decodeHeader:data charset:@"iso-8859-1"],
+                          @"Re: Meeting = tomorrow? 10:00");
+}
+
+- (void)testDecodeHeader_textAroundWords {
+    NSData *data = [@"Re: =?utf-8?q?caf=C3=A9?= au =?ISO-8859-1?Q?lait_=E0?= 10h"
+                    dataUsingEncoding:NSASCIIStringEncoding];
+    XCTAssertEqualObjects([CWMIMEUtility decodeHeader:data charset:nil],
+                          @"Re: café au lait à 10h");
+}
+
+- (void)testDecodeHeader_characterSplitOverWords {
+    NSData *data = [@"=?UTF-8?B?w6nDqQ==?= =?utf-8?Q?t=C3?=\r\n =?UTF-8?Q?=A9_?="
+                    dataUsingEncoding:NSASCIIStringEncoding];
+    XCTAssertEqualObjects([CWMIMEUtility decodeHeader:data charset:nil], @"éété ");
+}
+
+- (void)testDecodeHeader_charsetChangesBetweenWords {
+    NSData *data = [@"=?ISO-8859-1?Q?=E8?= =?UTF-8?Q?=C3=A9?= =?ISO-8859-1?Q?=E8?="
+                    dataUsingEncoding:NSASCIIStringEncoding];
+    XCTAssertEqualObjects([CWMIMEUtility decodeHeader:data charset:nil], @"èéè");
+}
+
+- (void)testDecodeHeader_undecodableWordIsKept {
+    NSData *data = [@"a =?x-no-such-charset?Q?b?= c"
+                    dataUsingEncoding:NSASCIIStringEncoding];
+    XCTAssertEqualObjects([CWMIMEUtility decodeHeader:data charset:nil],
+                          @"a =?x-no-such-charset?Q?b?= c");
+}
+
 @end
@@ -0,0 +1,186 @@
+//
+//  CWMessageArchiveTest.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "CWMessageArchive.h"
+#import "CWFlags.h"
+#import "CWIMAPMessage.h"
+#import "CWInternetAddress.h"
+#import "CWMIMEMultipart.h"
+
+@interface CWMessageArchiveTest : XCTestCase
+@end
+
+@implementation CWMessageArchiveTest
+
+#pragma mark - Tests
+
+- (void)testRoundTrip {
+    NSData *data = [CWMessageArchive archivedDataWithMessages:@[[self messageWithUID:7], [self messageWithUID:8]]];
+    CWMessageArchive *testee = [[CWMessageArchive alloc] initWithData:data];
+    XCTAssertEqual([testee count], 2);
+
+    CWIMAPMessage *message = (CWIMAPMessage *)[testee messageAtIndex:1];
+    XCTAssertTrue([message isKindOfClass:[CWIMAPMessage class]]);
+    XCTAssertEqual([message UID], 8);
+    XCTAssertEqual([message messageNumber], 3);
+    XCTAssertEqualObjects([message subject], @"Subject 8");
+    XCTAssertEqualObjects([[message from] address], @"alice@pantomime.test");
+    XCTAssertEqualObjects([[message from] personal], @"\"Alice\"");
+    XCTAssertEqual([[message recipients] count], 1);
+    XCTAssertEqual([[[message recipients] firstObject] type], PantomimeCcRecipient);
+    XCTAssertEqualObjects([message allReferences], (@[@"<1@pantomime.test>", @"<2@pantomime.test>"]));
+    XCTAssertEqual([[message originationDate] timeIntervalSince1970], 1000000.5);
+    XCTAssertTrue([[message flags] contain:PantomimeFlagSeen]);
+    XCTAssertTrue([[message flags] contain:PantomimeFlagFlagged]);
+    XCTAssertTrue([message isInitialized]);
+
+    CWMIMEMultipart *multipart = (CWMIMEMultipart *)[message content];
+    XCTAssertEqual([multipart count], 2);
+    CWPart *part = [multipart partAtIndex:1];
+    XCTAssertEqualObjects([part contentType], @"application/octet-stream");
+    XCTAssertEqualObjects([part filename], @"a.bin");
+    XCTAssertEqual([part contentTransferEncoding], PantomimeEncodingBase64);
+    XCTAssertEqualObjects([part content], [self bodyOfSize:3000]);
+    // Lazily decoded parts are returned as the same instance.
+    XCTAssertEqual(part, [multipart partAtIndex:1]);
+}
+
+- (void)testBodiesPointIntoTheArchive {
+    NSData *data = [CWMessageArchive archivedDataWithMessages:@[[self messageWithUID:1]]];
+    CWMessageArchive *testee = [[CWMessageArchive alloc] initWithData:data];
+
+    NSData *body = (NSData *)[[(CWMIMEMultipart *)[[testee messageAtIndex:0] content] partAtIndex:1] content];
+    const char *bytes = body.bytes;
+    XCTAssertTrue(bytes > (const char *)data.bytes && bytes + body.length <= (const char *)data.bytes + data.length);
+}
+
+- (void)testHeaderNamesAreShared {
+    NSData *data = [CWMessageArchive archivedDataWithMessages:@[[self messageWithUID:1], [self messageWithUID:2]]];
+    CWMessageArchive *testee = [[CWMessageArchive alloc] initWithData:data];
+
+    NSString *first = [self keyEqualTo:@"Subject" in:[[testee messageAtIndex:0] allHeaders]];
+    NSString *second = [self keyEqualTo:@"Subject" in:[[testee messageAtIndex:1] allHeaders]];
+    XCTAssertNotNil(first);
+    XCTAssertEqual(first, second);
+}
+
+- (void)testChangingDecodedMultipart {
+    NSData *data = [CWMessageArchive archivedDataWithMessages:@[[self messageWithUID:1]]];
+    CWMessageArchive *testee = [[CWMessageArchive alloc] initWithData:data];
+    CWMIMEMultipart *multipart = (CWMIMEMultipart *)[[testee messageAtIndex:0] content];
+
+    [multipart removePart:[multipart partAtIndex:0]];
+    XCTAssertEqual([multipart count], 1);
+    XCTAssertEqualObjects([[multipart partAtIndex:0] filename], @"a.bin");
+}
+
+- (void)testOtherHeaderValues {
+    CWIMAPMessage *message = [self messageWithUID:1];
+    [message setHeaders:@{@"X-Dictionary": @{@"a": @[@1, @"b"]}, @"X-Object": [NSObject new]}];
+    NSData *data = [CWMessageArchive archivedDataWithMessages:@[message]];
+
+    CWMessage *decoded = [[[CWMessageArchive alloc] initWithData:data] messageAtIndex:0];
+    XCTAssertEqualObjects([decoded headerValueForName:@"X-Dictionary"], (@{@"a": @[@1, @"b"]}));
+    // Values that do not support secure coding are not archived.
+    XCTAssertNil([decoded headerValueForName:@"X-Object"]);
+    XCTAssertEqualObjects([decoded subject], @"Subject 1");
+}
+
+- (void)testRejectsOtherData {
+    NSMutableData *data = [[CWMessageArchive archivedDataWithMessages:@[]] mutableCopy];
+    XCTAssertEqual([[[CWMessageArchive alloc] initWithData:data] count], 0);
+
+    // A later version
+    ((uint8_t *)data.mutableBytes)[4] = 2;
+    XCTAssertNil([[CWMessageArchive alloc] initWithData:data]);
+    XCTAssertNil([[CWMessageArchive alloc] initWithData:[@"From: a\r\n" dataUsingEncoding:NSASCIIStringEncoding]]);
+}
+
+- (void)testTruncatedRecord {
+    NSData *data = [CWMessageArchive archivedDataWithMessages:@[[self messageWithUID:1]]];
+    NSMutableData *truncated = [data mutableCopy];
+    // We keep the index, but cut the message record short.
+    uint64_t indexOffset;
+    memcpy(&indexOffset, (const uint8_t *)data.bytes + 8, 8);
+    [truncated replaceBytesInRange:NSMakeRange(20, indexOffset - 20) withBytes:NULL length:0];
+    uint64_t newOffset = 20;
+    [truncated replaceBytesInRange:NSMakeRange(8, 8) withBytes:&newOffset];
+
+    CWMessageArchive *testee = [[CWMessageArchive alloc] initWithData:truncated];
+    XCTAssertEqual([testee count], 1);
+    XCTAssertNil([testee messageAtIndex:0]);
+    XCTAssertThrowsSpecificNamed([testee messageAtIndex:1], NSException, NSRangeException);
+}
+
+- (void)testFileIsMapped {
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]];
+    [[CWMessageArchive archivedDataWithMessages:@[[self messageWithUID:5]]] writeToFile:path atomically:NO];
+
+    CWMessageArchive *testee = [[CWMessageArchive alloc] initWithContentsOfFile:path];
+    XCTAssertEqual([(CWIMAPMessage *)[testee messageAtIndex:0] UID], 5);
+    XCTAssertNil([[CWMessageArchive alloc] initWithContentsOfFile:[path stringByAppendingString:@"-none"]]);
+    [[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+}
+
+#pragma mark - Helpers
+
+- (CWIMAPMessage *)messageWithUID:(NSUInteger)uid {
+    CWIMAPMessage *message = [CWIMAPMessage new];
+    [message setUID:uid];
+    [message setMessageNumber:uid - 5];
+    [message setSubject:[NSString stringWithFormat:@"Subject %lu", (unsigned long)uid]];
+    [message setFrom:[[CWInternetAddress alloc] initWithPersonal:@"Alice" address:@"alice@pantomime.test"]];
+    [message addRecipient:[[CWInternetAddress alloc] initWithPersonal:nil
+                                                              address:@"bob@pantomime.test"
+                                                                 type:PantomimeCcRecipient]];
+    [message setReferences:@[@"<1@pantomime.test>", @"<2@pantomime.test>"]];
+    [message setOriginationDate:[NSDate dateWithTimeIntervalSince1970:1000000.5]];
+    // -setFlags: of a CWIMAPMessage goes to its folder, it has none.
+    [[message flags] replaceWithFlags:[[CWFlags alloc] initWithFlags:PantomimeFlagSeen | PantomimeFlagFlagged]];
+    [message setContentType:@"multipart/mixed"];
+    [message setBoundary:[@"boundary" dataUsingEncoding:NSASCIIStringEncoding]];
+
+    CWPart *text = [CWPart new];
+    [text setContentType:@"text/plain"];
+    [text setCharset:@"utf-8"];
+    [text setContent:[@"Hello" dataUsingEncoding:NSASCIIStringEncoding]];
+
+    CWPart *attachment = [CWPart new];
+    [attachment setContentType:@"application/octet-stream"];
+    [attachment setFilename:@"a.bin"];
+    [attachment setContentTransferEncoding:PantomimeEncodingBase64];
+    [attachment setContent:[self bodyOfSize:3000]];
+
+    CWMIMEMultipart *multipart = [CWMIMEMultipart new];
+    [multipart addPart:text];
+    [multipart addPart:attachment];
+    [message setContent:multipart];
+    [message setInitialized:YES];
+
+    return message;
+}
+
+- (NSData *)bodyOfSize:(NSUInteger)size {
+    NSMutableData *data = [NSMutableData dataWithLength:size];
+    for (NSUInteger i = 0; i < size; i++) {
+        ((uint8_t *)data.mutableBytes)[i] = (uint8_t)(i * 7);
+    }
+    return data;
+}
+
+- (NSString *)keyEqualTo:(NSString *)name in:(NSDictionary *)dictionary {
+    for (NSString *key in dictionary) {
+        if ([key isEqualToString:name]) {
+            return key;
+        }
+    }
+    return nil;
+}
+
+@end
@@ -10,6 +10,7 @@
 
 #import "CWParser.h"
 #import "CWPart.h"
+#import "CWMessage.h"
 #import "NSString+PantomimeTestHelper.h"
 
 @interface CWParserTest : XCTestCase
@@ -316,8 +317,38 @@
     [self assertFileNameCanBeParsedWithLine: testee mustSucceed:YES];
 }
 
+#pragma mark - parseDate
+
+- (void)testParseDate {
+    [self assertDateLine:@"Date: Wed, 02 Jan 2002 09:07:19 -0700" parsesTo:1009987639];
+    [self assertDateLine:@"Date: 02 Jan 2002 19:57:49 +0000" parsesTo:1010001469];
+    [self assertDateLine:@"Date: Thu, 03 Jan 2002 16:40:30 GMT" parsesTo:1010076030];
+    [self assertDateLine:@"Date: Wed, 2 Jan 2002 08:56:18 -0700 (MST)" parsesTo:1009986978];
+    [self assertDateLine:@"Date: Sat, 29 Feb 2020 23:59:59 +0530" parsesTo:1583000999];
+}
+
+- (void)testParseDate_obsoleteSyntax {
+    [self assertDateLine:@"Date: Mon, 1 Mar 99 12:00 EST" parsesTo:920307600];
+    [self assertDateLine:@"Date: Wed Jan  2 09:07:19 2002" parsesTo:1009962439];
+    [self assertDateLine:@"Date: Thu, 17 Jan 2002 11:54:11 -0900<br>" parsesTo:1011300851];
+}
+
+- (void)testParseDate_invalid {
+    CWMessage *message = [CWMessage new];
+    [CWParser parseDate:[@"Date: __Smtpdate" dataUsingEncoding:NSASCIIStringEncoding]
+              inMessage:message];
+    XCTAssertNil([message originationDate]);
+}
+
 #pragma mark Helper
 
+- (void)assertDateLine:(NSString *)line parsesTo:(NSTimeInterval)time
+{
+    CWMessage *message = [CWMessage new];
+    [CWParser parseDate:[line dataUsingEncoding:NSASCIIStringEncoding] inMessage:message];
+    XCTAssertEqual([[message originationDate] timeIntervalSince1970], time, @"%@", line);
+}
+
 - (void)assertContentTypeCanBeParsedWithLine:(NSString *)line
 {
     CWPart *part = [CWPart new];
@@ -0,0 +1,52 @@
+//
+//  CWReactorTest.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "CWReactor.h"
+
+@interface CWReactorTest : XCTestCase
+@property (strong, nonatomic) CWReactor *testee;
+@end
+
+@implementation CWReactorTest
+
+- (void)setUp {
+    [super setUp];
+    self.testee = [[CWReactor alloc] initWithNumberOfThreads:2];
+}
+
+#pragma mark - Tests
+
+- (void)testAttachBalancesThreads {
+    XCTAssertEqual([self.testee numberOfThreads], 2);
+
+    NSThread *first = [self.testee attach];
+    NSThread *second = [self.testee attach];
+    XCTAssertNotEqual(first, second);
+
+    NSThread *third = [self.testee attach];
+    XCTAssertEqual([self.testee numberOfConnectionsOnThread:third], 2);
+
+    [self.testee detach:first];
+    [self.testee detach:third];
+    XCTAssertEqual([self.testee attach], first);
+}
+
+- (void)testPerformBlockRunsOnThread {
+    NSThread *thread = [self.testee attach];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"block"];
+
+    [self.testee performBlock:^{
+        XCTAssertEqual([NSThread currentThread], thread);
+        [expectation fulfill];
+    } onThread:thread];
+
+    [self waitForExpectations:@[expectation] timeout:5];
+}
+
+@end
@@ -0,0 +1,80 @@
+//
+//  CWRegExTest.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "Pantomime/CWRegEx.h"
+
+@interface CWRegExTest : XCTestCase
+@end
+
+@implementation CWRegExTest
+
+#pragma mark - Tests
+
+- (void)testMatchStringFindsAllMatches {
+    CWRegEx *regex = [CWRegEx regexWithPattern:@"[[:space:]]+" flags:REG_EXTENDED];
+    NSArray *matches = [regex matchString:@"a  b\t\tc d"];
+
+    XCTAssertEqualObjects(matches, (@[[NSValue valueWithRange:NSMakeRange(1, 2)],
+                                      [NSValue valueWithRange:NSMakeRange(4, 2)],
+                                      [NSValue valueWithRange:NSMakeRange(7, 1)]]));
+}
+
+- (void)testMatchIsLeftmostLongest {
+    NSArray *matches = [CWRegEx matchString:@"xRe: re:y"
+                                withPattern:@"(re|re:)( re:)*"
+                            isCaseSensitive:NO];
+
+    XCTAssertEqualObjects(matches, @[[NSValue valueWithRange:NSMakeRange(1, 7)]]);
+}
+
+- (void)testAnchorsOnlyMatchAtTheEnds {
+    NSArray *matches = [CWRegEx matchString:@"aaa" withPattern:@"^a" isCaseSensitive:YES];
+    XCTAssertEqualObjects(matches, @[[NSValue valueWithRange:NSMakeRange(0, 1)]]);
+
+    matches = [CWRegEx matchString:@"Re: x (fwd)" withPattern:@"((\\(fwd\\))| )*$" isCaseSensitive:NO];
+    XCTAssertEqualObjects(matches, (@[[NSValue valueWithRange:NSMakeRange(5, 6)],
+                                      [NSValue valueWithRange:NSMakeRange(11, 0)]]));
+}
+
+- (void)testPatternsOutsideTheSubsetStillMatch {
+    NSArray *matches = [CWRegEx matchString:@"abaab" withPattern:@"a{2}" isCaseSensitive:YES];
+    XCTAssertEqualObjects(matches, @[[NSValue valueWithRange:NSMakeRange(2, 2)]]);
+}
+
+- (void)testMatchDataFillsBuffer {
+    CWRegEx *regex = [CWRegEx regexWithPattern:@"b+" flags:REG_EXTENDED];
+    NSData *data = [@"abbcbdbbb" dataUsingEncoding:NSASCIIStringEncoding];
+    NSRange ranges[2];
+
+    XCTAssertEqual([regex matchData:data range:NSMakeRange(0, data.length) ranges:ranges count:2], 2);
+    XCTAssertTrue(NSEqualRanges(ranges[0], NSMakeRange(1, 2)));
+    XCTAssertTrue(NSEqualRanges(ranges[1], NSMakeRange(4, 1)));
+}
+
+- (void)testMatchDataTreatsRangeAsString {
+    CWRegEx *regex = [CWRegEx regexWithPattern:@"^b[^\n]*$" flags:REG_EXTENDED];
+    NSData *data = [@"ab\nbcd\nb" dataUsingEncoding:NSASCIIStringEncoding];
+    NSRange range;
+
+    XCTAssertEqual([regex matchData:data range:NSMakeRange(3, 3) ranges:&range count:1], 1);
+    XCTAssertTrue(NSEqualRanges(range, NSMakeRange(3, 3)));
+    XCTAssertEqual([regex matchData:data range:NSMakeRange(0, 3) ranges:&range count:1], 0);
+    XCTAssertEqual([regex matchData:data range:NSMakeRange(4, 10) ranges:&range count:1], 0);
+}
+
+- (void)testCompiledPatternsAreCached {
+    CWRegEx *regex = [CWRegEx regexWithPattern:@"cached" flags:REG_EXTENDED];
+
+    XCTAssertEqual(regex, [CWRegEx regexWithPattern:@"cached" flags:REG_EXTENDED]);
+    XCTAssertNotEqual(regex, [CWRegEx regexWithPattern:@"cached" flags:REG_EXTENDED|REG_ICASE]);
+    XCTAssertNil([CWRegEx regexWithPattern:@"(" flags:REG_EXTENDED]);
+    XCTAssertNil([CWRegEx regexWithPattern:@"(" flags:REG_EXTENDED]);
+}
+
+@end
@@ -0,0 +1,149 @@
+//
+//  CWServiceMetricsTest.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "CWIMAPStore.h"
+#import "CWServiceMetrics+Protected.h"
+
+@interface CWServiceMetricsTest : XCTestCase
+@property (strong, nonatomic) CWServiceMetrics *testee;
+@end
+
+@implementation CWServiceMetricsTest
+
+- (void)setUp {
+    [super setUp];
+    self.testee = [CWServiceMetrics new];
+}
+
+#pragma mark - Tests
+
+- (void)testSpanCoversOneCommand {
+    NSMutableArray<CWTraceSpan *> *spans = [NSMutableArray new];
+    self.testee.spanHandler = ^(CWTraceSpan *span) {
+        [spans addObject:span];
+    };
+
+    [self.testee setQueueDepth:2];
+    [self.testee commandStarted:IMAP_UID_FETCH_BODY_TEXT];
+    [self.testee sentBytes:30];
+    [self.testee receivedBytes:100];
+    [self.testee parsingStarted];
+    [self.testee receivedLiteralOfLength:80];
+    [self.testee commandCompleted];
+    [self.testee parsingEnded];
+    [self.testee setQueueDepth:1];
+
+    XCTAssertEqual(spans.count, 1);
+    CWTraceSpan *span = spans.firstObject;
+    XCTAssertEqual(span.command, IMAP_UID_FETCH_BODY_TEXT);
+    XCTAssertEqual(span.bytesSent, 30);
+    XCTAssertEqual(span.bytesReceived, 100);
+    XCTAssertGreaterThanOrEqual(span.duration, span.waitTime + span.parseTime);
+    XCTAssertNotNil(span.startDate);
+
+    XCTAssertEqual(self.testee.bytesSent, 30);
+    XCTAssertEqual(self.testee.bytesReceived, 100);
+    XCTAssertEqual(self.testee.literals, 1);
+    XCTAssertEqual(self.testee.literalBytes, 80);
+    XCTAssertEqual(self.testee.largestLiteral, 80);
+    XCTAssertEqual(self.testee.queueDepth, 1);
+    XCTAssertEqual(self.testee.maximumQueueDepth, 2);
+    XCTAssertEqualObjects(self.testee.commands, @[@(IMAP_UID_FETCH_BODY_TEXT)]);
+    XCTAssertEqual([self.testee latencyForCommand:IMAP_UID_FETCH_BODY_TEXT].count, 1);
+    XCTAssertNil([self.testee latencyForCommand:IMAP_NOOP]);
+}
+
+- (void)testCompletionWithoutCommandIsIgnored {
+    __block NSUInteger calls = 0;
+    self.testee.spanHandler = ^(CWTraceSpan *span) {
+        calls++;
+    };
+
+    [self.testee commandCompleted];
+    [self.testee commandStarted:IMAP_NOOP];
+    [self.testee reconnected];
+    [self.testee commandCompleted];
+
+    XCTAssertEqual(calls, 0);
+    XCTAssertEqual(self.testee.reconnects, 1);
+    XCTAssertEqualObjects(self.testee.commands, @[]);
+}
+
+- (void)testWaitTimeIsTimeToFirstByte {
+    [self.testee commandStarted:IMAP_NOOP];
+    [NSThread sleepForTimeInterval:0.02];
+    [self.testee receivedBytes:10];
+    [NSThread sleepForTimeInterval:0.02];
+    [self.testee receivedBytes:10];
+    [self.testee commandCompleted];
+
+    XCTAssertGreaterThanOrEqual(self.testee.waitTime, 0.02);
+    XCTAssertLessThan(self.testee.waitTime, [self.testee latencyForCommand:IMAP_NOOP].maximum);
+}
+
+- (void)testHistogramBucketsAndPercentiles {
+    for (NSUInteger i = 0; i < 3; i++) {
+        [self.testee commandStarted:IMAP_NOOP];
+        [self.testee commandCompleted];
+    }
+    [self.testee commandStarted:IMAP_NOOP];
+    [NSThread sleepForTimeInterval:0.01];
+    [self.testee commandCompleted];
+
+    CWLatencyHistogram *histogram = [self.testee latencyForCommand:IMAP_NOOP];
+    XCTAssertEqual(histogram.count, 4);
+    XCTAssertEqual([histogram countInBucket:0], 3);
+    XCTAssertLessThanOrEqual([histogram percentile:50], 0.001);
+    XCTAssertEqual([histogram percentile:100], histogram.maximum);
+    XCTAssertGreaterThanOrEqual(histogram.maximum, 0.01);
+    XCTAssertLessThanOrEqual(histogram.minimum, histogram.maximum);
+
+    NSUInteger total = 0;
+    for (NSUInteger i = 0; i < [CWLatencyHistogram numberOfBuckets]; i++) {
+        total += [histogram countInBucket:i];
+    }
+    XCTAssertEqual(total, 4);
+}
+
+- (void)testHistogramIsSnapshot {
+    [self.testee commandStarted:IMAP_NOOP];
+    [self.testee commandCompleted];
+    CWLatencyHistogram *histogram = [self.testee latencyForCommand:IMAP_NOOP];
+
+    [self.testee commandStarted:IMAP_NOOP];
+    [self.testee commandCompleted];
+
+    XCTAssertEqual(histogram.count, 1);
+    XCTAssertEqual([self.testee latencyForCommand:IMAP_NOOP].count, 2);
+}
+
+- (void)testResetKeepsQueueDepth {
+    [self.testee setQueueDepth:3];
+    [self.testee sentBytes:10];
+    [self.testee commandStarted:IMAP_NOOP];
+    [self.testee commandCompleted];
+    [self.testee setQueueDepth:1];
+
+    [self.testee reset];
+
+    XCTAssertEqual(self.testee.bytesSent, 0);
+    XCTAssertEqualObjects(self.testee.commands, @[]);
+    XCTAssertEqual(self.testee.queueDepth, 1);
+    XCTAssertEqual(self.testee.maximumQueueDepth, 1);
+}
+
+- (void)testServiceHasMetrics {
+    CWIMAPStore *store = [[CWIMAPStore alloc] initWithName:@"localhost" port:143
+                                                 transport:ConnectionTransportPlain
+                                         clientCertificate:nil];
+    XCTAssertNotNil(store.metrics);
+    XCTAssertEqual(store.metrics, store.metrics);
+}
+
+@end
@@ -0,0 +1,159 @@
+//
+//  CWThreaderTest.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "CWThreader.h"
+#import "CWContainer.h"
+#import "CWMessage.h"
+
+@interface CWThreaderTest : XCTestCase
+@property (strong, nonatomic) CWThreader *testee;
+@end
+
+@implementation CWThreaderTest
+
+- (void)setUp {
+    [super setUp];
+    self.testee = [[CWThreader alloc] init];
+}
+
+#pragma mark - Tests
+
+- (void)testReplyIsChildOfParent {
+    CWMessage *parent = [self messageWithID:@"a@x" subject:@"Hello" references:nil];
+    CWMessage *reply = [self messageWithID:@"b@x" subject:@"Re: Hello" references:@[@"a@x"]];
+    [self.testee addMessage:parent];
+    [self.testee addMessage:reply];
+
+    XCTAssertEqual([self.testee rootContainers].count, 1);
+    CWContainer *root = [self.testee containerForMessage:parent];
+    XCTAssertEqual(root->child, [self.testee containerForMessage:reply]);
+}
+
+- (void)testReplyBeforeParentUsesPlaceholder {
+    CWMessage *reply = [self messageWithID:@"b@x" subject:@"Re: Hello" references:@[@"a@x"]];
+    [self.testee addMessage:reply];
+
+    NSArray *roots = [self.testee rootContainers];
+    XCTAssertEqual(roots.count, 1);
+    CWContainer *placeholder = roots.firstObject;
+    XCTAssertNil(placeholder->message);
+
+    CWMessage *parent = [self messageWithID:@"a@x" subject:@"Hello" references:nil];
+    [self.testee addMessage:parent];
+    XCTAssertEqual([self.testee containerForMessage:parent], placeholder);
+    XCTAssertEqual([self.testee rootContainers].count, 1);
+}
+
+- (void)testRemovingParentKeepsThread {
+    CWMessage *parent = [self messageWithID:@"a@x" subject:@"Hello" references:nil];
+    CWMessage *reply1 = [self messageWithID:@"b@x" subject:@"Re: Hello" references:@[@"a@x"]];
+    CWMessage *reply2 = [self messageWithID:@"c@x" subject:@"Re: Hello" references:@[@"a@x"]];
+    [self.testee addMessages:@[parent, reply1, reply2]];
+
+    [self.testee removeMessage:parent];
+    NSArray *roots = [self.testee rootContainers];
+    XCTAssertEqual(roots.count, 1);
+    XCTAssertEqual([roots.firstObject count], 2);
+
+    [self.testee removeMessage:reply1];
+    [self.testee removeMessage:reply2];
+    XCTAssertEqual([self.testee rootContainers].count, 0);
+}
+
+- (void)testSubjectGrouping {
+    CWMessage *original = [self messageWithID:@"a@x" subject:@"Lunch" references:nil];
+    CWMessage *reply = [self messageWithID:@"b@x" subject:@"Re: Lunch" references:nil];
+    [self.testee addMessage:reply];
+    [self.testee addMessage:original];
+
+    XCTAssertEqual([self.testee rootContainers].count, 1);
+    XCTAssertEqual([self.testee containerForMessage:reply]->parent,
+                   [self.testee containerForMessage:original]);
+}
+
+- (void)testReferencesOverrideSubjectGrouping {
+    CWMessage *first = [self messageWithID:@"a@x" subject:@"Status" references:nil];
+    CWMessage *second = [self messageWithID:@"b@x" subject:@"Re: Status" references:nil];
+    [self.testee addMessages:@[first, second]];
+    XCTAssertEqual([self.testee containerForMessage:second]->parent,
+                   [self.testee containerForMessage:first]);
+
+    CWMessage *other = [self messageWithID:@"c@x" subject:@"Other" references:nil];
+    CWMessage *reply = [self messageWithID:@"d@x" subject:@"Re: Status"
+                                references:@[@"c@x", @"b@x"]];
+    [self.testee addMessages:@[other, reply]];
+    XCTAssertEqual([self.testee containerForMessage:second]->parent,
+                   [self.testee containerForMessage:other]);
+}
+
+- (void)testRemovingMiddleOfSubjectGroup {
+    CWMessage *a = [self messageWithID:@"a@x" subject:@"Minutes" references:nil];
+    CWMessage *b = [self messageWithID:@"b@x" subject:@"Minutes" references:nil];
+    CWMessage *c = [self messageWithID:@"c@x" subject:@"Minutes" references:nil];
+    [self.testee addMessages:@[a, b, c]];
+
+    NSArray *roots = [self.testee rootContainers];
+    XCTAssertEqual(roots.count, 1);
+    CWContainer *placeholder = roots.firstObject;
+    XCTAssertEqual([placeholder count], 3);
+
+    CWContainer *middle = [placeholder childAtIndex:1];
+    CWMessage *removed = middle->message;
+    [self.testee removeMessage:removed];
+    XCTAssertEqual([placeholder count], 2);
+    XCTAssertEqual([placeholder childAtIndex:1]->prev, placeholder->child);
+    XCTAssertNil(middle->prev);
+    XCTAssertNil(middle->next);
+
+    [self.testee addMessage:removed];
+    XCTAssertEqual([self.testee rootContainers].count, 1);
+    XCTAssertEqual([placeholder count], 3);
+}
+
+- (void)testUpdateMessageMovesItToItsThread {
+    CWMessage *parent = [self messageWithID:@"a@x" subject:@"Hello" references:nil];
+    CWMessage *reply = [self messageWithID:@"b@x" subject:@"Unrelated" references:nil];
+    [self.testee addMessages:@[parent, reply]];
+    XCTAssertEqual([self.testee rootContainers].count, 2);
+
+    [reply setReferences:@[@"a@x"]];
+    [reply setInReplyTo:@"a@x"];
+    [self.testee updateMessage:reply];
+    XCTAssertEqual([self.testee rootContainers].count, 1);
+    XCTAssertEqual([self.testee containerForMessage:reply]->parent,
+                   [self.testee containerForMessage:parent]);
+}
+
+- (void)testNoLoops {
+    CWMessage *a = [self messageWithID:@"a@x" subject:@"A" references:@[@"b@x"]];
+    CWMessage *b = [self messageWithID:@"b@x" subject:@"B" references:@[@"a@x"]];
+    [self.testee addMessages:@[a, b]];
+
+    CWContainer *container = [self.testee containerForMessage:a];
+    XCTAssertFalse([container->parent isDescendantOf:container]);
+    XCTAssertEqual([self.testee rootContainers].count, 1);
+}
+
+#pragma mark - Helpers
+
+- (CWMessage *)messageWithID:(NSString *)messageID
+                     subject:(NSString *)subject
+                  references:(NSArray *)references
+{
+    CWMessage *message = [[CWMessage alloc] init];
+    [message setMessageID:messageID];
+    [message setSubject:subject];
+    if (references) {
+        [message setReferences:references];
+        [message setInReplyTo:references.lastObject];
+    }
+    return message;
+}
+
+@end
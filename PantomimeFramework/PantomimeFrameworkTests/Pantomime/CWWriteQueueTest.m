@@ -0,0 +1,118 @@
+//
+//  CWWriteQueueTest.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "CWWriteQueue.h"
+
+@interface CWWriteQueueTest : XCTestCase
+@property (strong, nonatomic) CWWriteQueue *testee;
+@end
+
+@implementation CWWriteQueueTest
+
+- (void)setUp {
+    [super setUp];
+    self.testee = [CWWriteQueue new];
+}
+
+#pragma mark - Tests
+
+- (void)testSmallSegmentsAreGathered {
+    [self.testee appendData:[@"5 APPEND " dataUsingEncoding:NSASCIIStringEncoding]];
+    [self.testee appendData:[@"INBOX" dataUsingEncoding:NSASCIIStringEncoding]];
+    [self.testee appendData:[@"\r\n" dataUsingEncoding:NSASCIIStringEncoding]];
+    XCTAssertEqual([self.testee length], 16);
+
+    NSUInteger calls = 0;
+    NSData *written = [self drainWithMaxLength:1024 chunk:1024 calls:&calls];
+    XCTAssertEqualObjects(written, [@"5 APPEND INBOX\r\n" dataUsingEncoding:NSASCIIStringEncoding]);
+    XCTAssertEqual(calls, 1);
+    XCTAssertEqual([self.testee length], 0);
+}
+
+- (void)testLargeSegmentIsWrittenInPlace {
+    NSData *payload = [[self payloadOfLength:1 << 20] copy];
+    [self.testee appendData:payload];
+
+    [self.testee writeWithMaxLength:NSUIntegerMax
+                             writer:^NSInteger(const unsigned char *bytes, NSUInteger length) {
+        XCTAssertEqual(bytes, (const unsigned char *)payload.bytes);
+        XCTAssertEqual(length, payload.length);
+        return 1000;
+    }];
+    [self.testee writeWithMaxLength:NSUIntegerMax
+                             writer:^NSInteger(const unsigned char *bytes, NSUInteger length) {
+        XCTAssertEqual(bytes, (const unsigned char *)payload.bytes + 1000);
+        return 0;
+    }];
+    XCTAssertEqual([self.testee length], payload.length - 1000);
+}
+
+- (void)testPartialWritesKeepOrder {
+    NSMutableData *expected = [NSMutableData data];
+    for (NSUInteger length = 1; length < 20000; length *= 3) {
+        NSData *data = [self payloadOfLength:length];
+        [expected appendData:data];
+        [self.testee appendData:data];
+    }
+
+    NSUInteger calls = 0;
+    XCTAssertEqualObjects([self drainWithMaxLength:5000 chunk:777 calls:&calls], expected);
+}
+
+- (void)testMutableDataIsCopied {
+    NSMutableData *data = [[@"abc" dataUsingEncoding:NSASCIIStringEncoding] mutableCopy];
+    [self.testee appendData:data];
+    [data setLength:0];
+
+    NSUInteger calls = 0;
+    XCTAssertEqualObjects([self drainWithMaxLength:10 chunk:10 calls:&calls],
+                          [@"abc" dataUsingEncoding:NSASCIIStringEncoding]);
+}
+
+- (void)testReset {
+    [self.testee appendData:[self payloadOfLength:10]];
+    [self.testee reset];
+    XCTAssertEqual([self.testee length], 0);
+    XCTAssertEqual([self.testee writeWithMaxLength:10
+                                            writer:^NSInteger(const unsigned char *bytes,
+                                                              NSUInteger length) {
+        XCTFail(@"nothing to write");
+        return 0;
+    }], 0);
+}
+
+#pragma mark - Helpers
+
+- (NSData *)drainWithMaxLength:(NSUInteger)maxLength
+                         chunk:(NSUInteger)chunk
+                         calls:(NSUInteger *)calls {
+    NSMutableData *written = [NSMutableData data];
+    while ([self.testee length]) {
+        [self.testee writeWithMaxLength:maxLength
+                                 writer:^NSInteger(const unsigned char *bytes, NSUInteger length) {
+            XCTAssertLessThanOrEqual(length, maxLength);
+            NSUInteger count = MIN(length, chunk);
+            [written appendBytes:bytes length:count];
+            return count;
+        }];
+        (*calls)++;
+    }
+    return written;
+}
+
+- (NSData *)payloadOfLength:(NSUInteger)length {
+    NSMutableData *data = [NSMutableData dataWithLength:length];
+    unsigned char *bytes = data.mutableBytes;
+    for (NSUInteger i = 0; i < length; i++) {
+        bytes[i] = (unsigned char)(i * 31 + length);
+    }
+    return data;
+}
+
+@end
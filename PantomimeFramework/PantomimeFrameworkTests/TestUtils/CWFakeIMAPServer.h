@@ -0,0 +1,59 @@
+//
+//  CWFakeIMAPServer.h
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWFakeServer.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ An IMAP4rev1 server with a single mailbox, INBOX, holding synthetic messages.
+
+ Any credentials are accepted. UIDs are the message sequence numbers, as nothing is ever
+ expunged. Supported: CAPABILITY, NOOP, CHECK, LOGIN, AUTHENTICATE (PLAIN, LOGIN, CRAM-MD5,
+ XOAUTH2), LIST, LSUB, SELECT, EXAMINE, STATUS, [UID] FETCH (UID, FLAGS, RFC822.SIZE,
+ INTERNALDATE, RFC822, RFC822.HEADER, BODY[section]<partial> and BODY.PEEK, BINARY[section]
+ and BINARY.PEEK, BINARY.SIZE), [UID] SEARCH, [UID] STORE, APPEND and MULTIAPPEND, EXPUNGE,
+ CLOSE, IDLE and LOGOUT. Literals, synchronizing or not, are accepted in all commands. BINARY is answered
+ whether it is announced in the capabilities or not.
+ */
+@interface CWFakeIMAPServer : CWFakeServer
+
+/** Sent in the greeting and in response to CAPABILITY. */
+@property (atomic, copy) NSArray<NSString *> *capabilities;
+
+/** If YES, literals in responses are written in two parts, apart in time. NO by default. */
+@property (atomic) BOOL splitsLiterals;
+
+/**
+ @param count The number of messages in INBOX.
+ @param size The size of each message, in bytes. Messages are at least as long as their headers.
+ */
+- (instancetype)initWithNumberOfMessages:(NSUInteger)count messageSize:(NSUInteger)size;
+
+/**
+ @return The number of messages in INBOX, appended ones included.
+ */
+- (NSUInteger)numberOfMessages;
+
+/**
+ Adds synthetic messages to INBOX, like new mail arriving. Clients in IDLE are told right away.
+ */
+- (void)addMessages:(NSUInteger)count;
+
+/**
+ @return The message with the given UID (1 being the first), nil if there is none.
+ */
+- (NSData * _Nullable)messageWithUID:(NSUInteger)uid;
+
+/**
+ @return The messages clients appended, in order.
+ */
+- (NSArray<NSData *> *)appendedMessages;
+
+@end
+
+NS_ASSUME_NONNULL_END
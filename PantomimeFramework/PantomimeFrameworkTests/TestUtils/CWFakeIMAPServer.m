@@ -0,0 +1,574 @@
+//
+//  CWFakeIMAPServer.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWFakeIMAPServer.h"
+
+/** How often a client in IDLE is checked for new messages. */
+static const NSTimeInterval kIdlePollInterval = 0.05;
+
+/** Pause between the two parts of a split literal. */
+static const NSTimeInterval kLiteralSplitPause = 0.01;
+
+static NSString * const kInternalDate = @"\"01-Jan-2024 00:00:00 +0000\"";
+
+@interface CWFakeIMAPServer ()
+{
+    NSUInteger _messageSize;
+    NSUInteger _numberOfMessages;
+    NSMutableDictionary<NSNumber *, NSData *> *_appended;
+}
+@end
+
+/** A command, with the bytes of its literals apart. */
+@interface CWFakeIMAPCommand : NSObject
+@property (nonatomic) NSString *tag;
+@property (nonatomic) NSString *name;
+/** The arguments, literals replaced by {n}. */
+@property (nonatomic) NSString *arguments;
+@property (nonatomic) NSMutableArray<NSData *> *literals;
+@end
+
+@implementation CWFakeIMAPCommand
+@end
+
+@implementation CWFakeIMAPServer
+
+- (instancetype)init
+{
+    return [self initWithNumberOfMessages:0 messageSize:0];
+}
+
+- (instancetype)initWithNumberOfMessages:(NSUInteger)count messageSize:(NSUInteger)size
+{
+    self = [super init];
+    if (self) {
+        _numberOfMessages = count;
+        _messageSize = size;
+        _appended = [NSMutableDictionary new];
+        _capabilities = @[@"IMAP4rev1", @"LITERAL+", @"IDLE", @"UIDPLUS",
+                          @"MULTIAPPEND", @"AUTH=PLAIN", @"AUTH=LOGIN"];
+    }
+    return self;
+}
+
+- (NSUInteger)numberOfMessages
+{
+    @synchronized(self) {
+        return _numberOfMessages;
+    }
+}
+
+- (void)addMessages:(NSUInteger)count
+{
+    @synchronized(self) {
+        _numberOfMessages += count;
+    }
+}
+
+- (NSData *)messageWithUID:(NSUInteger)uid
+{
+    @synchronized(self) {
+        if (uid == 0 || uid > _numberOfMessages) {
+            return nil;
+        }
+        NSData *appended = _appended[@(uid)];
+        if (appended) {
+            return appended;
+        }
+    }
+    return [self syntheticMessageWithUID:uid];
+}
+
+- (NSArray<NSData *> *)appendedMessages
+{
+    @synchronized(self) {
+        NSArray *uids = [_appended.allKeys sortedArrayUsingSelector:@selector(compare:)];
+        return [_appended objectsForKeys:uids notFoundMarker:[NSData data]];
+    }
+}
+
+#pragma mark - CWFakeServer
+
+- (void)serveConnection:(CWFakeServerConnection *)connection
+{
+    NSUInteger reported = 0;
+    BOOL selected = NO;
+
+    [connection writeString:[NSString stringWithFormat:@"* OK [CAPABILITY %@] CWFakeIMAPServer ready\r\n",
+                             [self.capabilities componentsJoinedByString:@" "]]];
+
+    while (YES) {
+        @autoreleasepool {
+            CWFakeIMAPCommand *command = [self readCommand:connection];
+            if (!command) {
+                return;
+            }
+
+            NSString *tag = command.tag;
+            NSString *name = command.name;
+            NSString *arguments = command.arguments;
+            NSMutableString *response = [NSMutableString new];
+            BOOL isUID = NO;
+
+            if ([name isEqualToString:@"UID"]) {
+                NSRange space = [arguments rangeOfString:@" "];
+                isUID = YES;
+                name = (space.location == NSNotFound ? arguments : [arguments substringToIndex:space.location]).uppercaseString;
+                arguments = (space.location == NSNotFound ? @"" : [arguments substringFromIndex:space.location + 1]);
+            }
+            [self recordCommand:(isUID ? [@"UID " stringByAppendingString:name] : name)];
+
+            if (selected && self.numberOfMessages > reported &&
+                ([name isEqualToString:@"NOOP"] || [name isEqualToString:@"CHECK"] ||
+                 [name isEqualToString:@"FETCH"] || [name isEqualToString:@"SEARCH"])) {
+                reported = self.numberOfMessages;
+                [response appendFormat:@"* %lu EXISTS\r\n", (unsigned long)reported];
+            }
+
+            if ([name isEqualToString:@"CAPABILITY"]) {
+                [response appendFormat:@"* CAPABILITY %@\r\n", [self.capabilities componentsJoinedByString:@" "]];
+                [response appendFormat:@"%@ OK CAPABILITY completed\r\n", tag];
+            } else if ([name isEqualToString:@"NOOP"] || [name isEqualToString:@"CHECK"] ||
+                       [name isEqualToString:@"LOGIN"] || [name isEqualToString:@"EXPUNGE"] ||
+                       [name isEqualToString:@"SUBSCRIBE"] || [name isEqualToString:@"UNSUBSCRIBE"]) {
+                [response appendFormat:@"%@ OK %@ completed\r\n", tag, name];
+            } else if ([name isEqualToString:@"AUTHENTICATE"]) {
+                if (![self authenticate:arguments connection:connection]) {
+                    return;
+                }
+                [response appendFormat:@"%@ OK AUTHENTICATE completed\r\n", tag];
+            } else if ([name isEqualToString:@"LIST"] || [name isEqualToString:@"LSUB"]) {
+                [response appendFormat:@"* %@ (\\HasNoChildren) \"/\" \"INBOX\"\r\n", name];
+                [response appendFormat:@"%@ OK %@ completed\r\n", tag, name];
+            } else if ([name isEqualToString:@"SELECT"] || [name isEqualToString:@"EXAMINE"]) {
+                NSUInteger count = self.numberOfMessages;
+                selected = YES;
+                reported = count;
+                [response appendFormat:@"* FLAGS (\\Answered \\Flagged \\Deleted \\Seen \\Draft)\r\n"
+                                        "* %lu EXISTS\r\n* 0 RECENT\r\n"
+                                        "* OK [UIDVALIDITY 1] UIDs valid\r\n"
+                                        "* OK [UIDNEXT %lu] Predicted next UID\r\n"
+                                        "%@ OK [%@] %@ completed\r\n",
+                                        (unsigned long)count, (unsigned long)count + 1, tag,
+                                        ([name isEqualToString:@"SELECT"] ? @"READ-WRITE" : @"READ-ONLY"), name];
+            } else if ([name isEqualToString:@"STATUS"]) {
+                NSUInteger count = self.numberOfMessages;
+                [response appendFormat:@"* STATUS \"INBOX\" (MESSAGES %lu UIDNEXT %lu UIDVALIDITY 1 UNSEEN 0)\r\n"
+                                        "%@ OK STATUS completed\r\n",
+                                        (unsigned long)count, (unsigned long)count + 1, tag];
+            } else if ([name isEqualToString:@"FETCH"]) {
+                [self fetch:arguments isUID:isUID tag:tag prefix:response connection:connection];
+                continue;
+            } else if ([name isEqualToString:@"SEARCH"]) {
+                [response appendString:@"* SEARCH"];
+                for (NSUInteger uid = 1; uid <= self.numberOfMessages; uid++) {
+                    [response appendFormat:@" %lu", (unsigned long)uid];
+                }
+                [response appendFormat:@"\r\n%@ OK SEARCH completed\r\n", tag];
+            } else if ([name isEqualToString:@"STORE"]) {
+                [response appendFormat:@"%@ OK STORE completed\r\n", tag];
+            } else if ([name isEqualToString:@"APPEND"] && command.literals.count) {
+                // One message per literal, several with MULTIAPPEND (RFC 3502).
+                NSUInteger first, last;
+                @synchronized(self) {
+                    first = _numberOfMessages + 1;
+                    for (NSData *literal in command.literals) {
+                        _appended[@(++_numberOfMessages)] = literal;
+                    }
+                    last = _numberOfMessages;
+                }
+                if (first == last) {
+                    [response appendFormat:@"%@ OK [APPENDUID 1 %lu] APPEND completed\r\n", tag, (unsigned long)first];
+                } else {
+                    [response appendFormat:@"%@ OK [APPENDUID 1 %lu:%lu] APPEND completed\r\n", tag,
+                     (unsigned long)first, (unsigned long)last];
+                }
+            } else if ([name isEqualToString:@"CLOSE"]) {
+                selected = NO;
+                [response appendFormat:@"%@ OK CLOSE completed\r\n", tag];
+            } else if ([name isEqualToString:@"IDLE"]) {
+                if (![self idle:connection tag:tag selected:selected reported:&reported]) {
+                    return;
+                }
+                continue;
+            } else if ([name isEqualToString:@"LOGOUT"]) {
+                [connection writeString:[NSString stringWithFormat:@"* BYE Logging out\r\n%@ OK LOGOUT completed\r\n", tag]];
+                return;
+            } else {
+                [response appendFormat:@"%@ BAD Unknown command\r\n", tag];
+            }
+
+            [connection writeString:response];
+        }
+    }
+}
+
+#pragma mark - Commands
+
+- (CWFakeIMAPCommand *)readCommand:(CWFakeServerConnection *)connection
+{
+    CWFakeIMAPCommand *command = [CWFakeIMAPCommand new];
+    NSMutableString *text = [NSMutableString new];
+
+    command.literals = [NSMutableArray new];
+
+    while (YES) {
+        NSData *line = [connection readLine];
+        if (!line) {
+            return nil;
+        }
+
+        NSString *string = [[NSString alloc] initWithData:line encoding:NSUTF8StringEncoding];
+        if (!string) {
+            string = [[NSString alloc] initWithData:line encoding:NSISOLatin1StringEncoding];
+        }
+        [text appendString:string];
+
+        // A line ending with {n} or {n+} is followed by n bytes of literal.
+        if (![string hasSuffix:@"}"]) {
+            break;
+        }
+        NSRange brace = [string rangeOfString:@"{" options:NSBackwardsSearch];
+        if (brace.location == NSNotFound) {
+            break;
+        }
+        NSString *size = [string substringWithRange:NSMakeRange(brace.location + 1, string.length - brace.location - 2)];
+        BOOL isNonSynchronizing = [size hasSuffix:@"+"];
+        if (!isNonSynchronizing) {
+            [connection writeString:@"+ Ready for literal data\r\n"];
+        }
+
+        NSData *literal = [connection readDataOfLength:(NSUInteger)size.integerValue];
+        if (!literal) {
+            return nil;
+        }
+        [command.literals addObject:literal];
+    }
+
+    NSArray *words = [text componentsSeparatedByString:@" "];
+    if (words.count < 2) {
+        command.tag = (words.count ? words[0] : @"*");
+        command.name = @"";
+        command.arguments = @"";
+        return command;
+    }
+    command.tag = words[0];
+    command.name = [words[1] uppercaseString];
+    command.arguments = (words.count > 2 ?
+                         [[words subarrayWithRange:NSMakeRange(2, words.count - 2)] componentsJoinedByString:@" "] :
+                         @"");
+    return command;
+}
+
+- (BOOL)authenticate:(NSString *)arguments connection:(CWFakeServerConnection *)connection
+{
+    NSArray *words = [arguments componentsSeparatedByString:@" "];
+    NSString *mechanism = [words[0] uppercaseString];
+    NSUInteger steps = 0;
+
+    if ([mechanism isEqualToString:@"LOGIN"]) {
+        steps = 2;
+    } else if ([mechanism isEqualToString:@"CRAM-MD5"]) {
+        steps = 1;
+    } else if (words.count < 2) {
+        // PLAIN and XOAUTH2, without an initial response.
+        steps = 1;
+    }
+
+    for (NSUInteger i = 0; i < steps; i++) {
+        [connection writeString:@"+ \r\n"];
+        if (![connection readLine]) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+- (BOOL)idle:(CWFakeServerConnection *)connection
+         tag:(NSString *)tag
+    selected:(BOOL)selected
+    reported:(NSUInteger *)reported
+{
+    [connection writeString:@"+ idling\r\n"];
+
+    while (YES) {
+        if ([connection waitForDataWithTimeout:kIdlePollInterval]) {
+            NSData *line = [connection readLine];
+            if (!line) {
+                return NO;
+            }
+            [self recordCommand:[[NSString alloc] initWithData:line encoding:NSUTF8StringEncoding]];
+            [connection writeString:[NSString stringWithFormat:@"%@ OK IDLE terminated\r\n", tag]];
+            return YES;
+        }
+
+        NSUInteger count = self.numberOfMessages;
+        if (selected && count > *reported) {
+            *reported = count;
+            [connection writeString:[NSString stringWithFormat:@"* %lu EXISTS\r\n", (unsigned long)count]];
+        }
+    }
+}
+
+- (void)fetch:(NSString *)arguments
+        isUID:(BOOL)isUID
+          tag:(NSString *)tag
+       prefix:(NSString *)prefix
+   connection:(CWFakeServerConnection *)connection
+{
+    NSRange space = [arguments rangeOfString:@" "];
+    if (space.location == NSNotFound) {
+        [connection writeString:[NSString stringWithFormat:@"%@%@ BAD Missing items\r\n", prefix, tag]];
+        return;
+    }
+
+    NSUInteger count = self.numberOfMessages;
+    NSIndexSet *set = [self indexesOfSequenceSet:[arguments substringToIndex:space.location] count:count];
+    NSArray *items = [self fetchItems:[arguments substringFromIndex:space.location + 1]];
+    NSMutableData *response = [[prefix dataUsingEncoding:NSUTF8StringEncoding] mutableCopy];
+    __block NSUInteger split = NSNotFound;
+
+    [set enumerateIndexesUsingBlock:^(NSUInteger msn, BOOL *stop) {
+        NSData *message = [self messageWithUID:msn];
+        NSMutableArray *attributes = [NSMutableArray new];
+        NSMutableArray *literals = [NSMutableArray new];
+
+        if (isUID && ![items containsObject:@"UID"]) {
+            [attributes addObject:[NSString stringWithFormat:@"UID %lu", (unsigned long)msn]];
+        }
+        for (NSString *item in items) {
+            NSString *upper = item.uppercaseString;
+            NSData *literal = nil;
+            NSString *attributeName = nil;
+            NSString *literalPrefix = @"";
+
+            if ([upper isEqualToString:@"UID"]) {
+                [attributes addObject:[NSString stringWithFormat:@"UID %lu", (unsigned long)msn]];
+            } else if ([upper isEqualToString:@"FLAGS"]) {
+                [attributes addObject:@"FLAGS ()"];
+            } else if ([upper isEqualToString:@"RFC822.SIZE"]) {
+                [attributes addObject:[NSString stringWithFormat:@"RFC822.SIZE %lu", (unsigned long)message.length]];
+            } else if ([upper isEqualToString:@"INTERNALDATE"]) {
+                [attributes addObject:[@"INTERNALDATE " stringByAppendingString:kInternalDate]];
+            } else if ([upper isEqualToString:@"RFC822"]) {
+                attributeName = @"RFC822";
+                literal = message;
+            } else if ([upper isEqualToString:@"RFC822.HEADER"]) {
+                attributeName = @"RFC822.HEADER";
+                literal = [self headerOfMessage:message];
+            } else if ([upper hasPrefix:@"BINARY.SIZE"]) {
+                NSString *binaryName;
+                NSData *data = [self binarySection:item ofMessage:message name:&binaryName];
+                if (data) {
+                    [attributes addObject:[NSString stringWithFormat:@"BINARY.SIZE%@ %lu",
+                                           [binaryName substringFromIndex:6], (unsigned long)data.length]];
+                }
+            } else if ([upper hasPrefix:@"BINARY"]) {
+                literal = [self binarySection:item ofMessage:message name:&attributeName];
+                literalPrefix = @"~";
+            } else if ([upper hasPrefix:@"BODY"]) {
+                literal = [self section:item ofMessage:message name:&attributeName];
+            }
+
+            if (literal) {
+                [attributes addObject:[NSString stringWithFormat:@"%@ %@{%lu}\r\n", attributeName,
+                                       literalPrefix, (unsigned long)literal.length]];
+                [literals addObject:@[@(attributes.count - 1), literal]];
+            }
+        }
+
+        [response appendData:[[NSString stringWithFormat:@"* %lu FETCH (", (unsigned long)msn]
+                              dataUsingEncoding:NSUTF8StringEncoding]];
+        for (NSUInteger i = 0; i < attributes.count; i++) {
+            if (i) {
+                [response appendBytes:" " length:1];
+            }
+            [response appendData:[attributes[i] dataUsingEncoding:NSUTF8StringEncoding]];
+            for (NSArray *literal in literals) {
+                if ([literal[0] unsignedIntegerValue] == i) {
+                    NSData *bytes = literal[1];
+                    if (split == NSNotFound && bytes.length > 1) {
+                        split = response.length + bytes.length / 2;
+                    }
+                    [response appendData:bytes];
+                }
+            }
+        }
+        [response appendBytes:")\r\n" length:3];
+    }];
+
+    [response appendData:[[NSString stringWithFormat:@"%@ OK FETCH completed\r\n", tag]
+                          dataUsingEncoding:NSUTF8StringEncoding]];
+
+    if (self.splitsLiterals && split != NSNotFound) {
+        [connection writeData:[response subdataWithRange:NSMakeRange(0, split)]];
+        [NSThread sleepForTimeInterval:kLiteralSplitPause];
+        [connection writeDataWithoutLatency:[response subdataWithRange:NSMakeRange(split, response.length - split)]];
+    } else {
+        [connection writeData:response];
+    }
+}
+
+#pragma mark - Fetch Helpers
+
+- (NSIndexSet *)indexesOfSequenceSet:(NSString *)sequenceSet count:(NSUInteger)count
+{
+    NSMutableIndexSet *set = [NSMutableIndexSet new];
+
+    if (count == 0) {
+        return set;
+    }
+    for (NSString *range in [sequenceSet componentsSeparatedByString:@","]) {
+        NSArray *bounds = [range componentsSeparatedByString:@":"];
+        NSUInteger first = ([bounds[0] isEqualToString:@"*"] ? count : (NSUInteger)[bounds[0] integerValue]);
+        NSUInteger last = (bounds.count < 2 ? first :
+                           ([bounds[1] isEqualToString:@"*"] ? count : (NSUInteger)[bounds[1] integerValue]));
+        NSUInteger low = MAX(MIN(first, last), 1);
+        NSUInteger high = MIN(MAX(first, last), count);
+
+        if (low <= high) {
+            [set addIndexesInRange:NSMakeRange(low, high - low + 1)];
+        } else if ([range containsString:@"*"]) {
+            // n:* always matches the last message.
+            [set addIndex:count];
+        }
+    }
+    return set;
+}
+
+/**
+ Splits "(UID BODY.PEEK[HEADER.FIELDS (From To)] FLAGS)" into its items.
+ */
+- (NSArray<NSString *> *)fetchItems:(NSString *)string
+{
+    NSMutableArray *items = [NSMutableArray new];
+    NSUInteger depth = 0, start = 0;
+
+    if ([string hasPrefix:@"("] && [string hasSuffix:@")"]) {
+        string = [string substringWithRange:NSMakeRange(1, string.length - 2)];
+    }
+    for (NSUInteger i = 0; i <= string.length; i++) {
+        unichar c = (i < string.length ? [string characterAtIndex:i] : ' ');
+        if (c == '[' || c == '(') {
+            depth++;
+        } else if ((c == ']' || c == ')') && depth) {
+            depth--;
+        } else if (c == ' ' && depth == 0) {
+            if (i > start) {
+                [items addObject:[string substringWithRange:NSMakeRange(start, i - start)]];
+            }
+            start = i + 1;
+        }
+    }
+    return items;
+}
+
+/**
+ The bytes of a BODY[section]<partial> item, and the name it has in the response.
+ */
+- (NSData *)section:(NSString *)item ofMessage:(NSData *)message name:(NSString **)name
+{
+    NSRange open = [item rangeOfString:@"["];
+    NSRange close = [item rangeOfString:@"]" options:NSBackwardsSearch];
+    if (open.location == NSNotFound || close.location == NSNotFound) {
+        return nil;
+    }
+
+    NSString *section = [item substringWithRange:NSMakeRange(open.location + 1, close.location - open.location - 1)];
+    NSString *upper = section.uppercaseString;
+    NSData *header = [self headerOfMessage:message];
+    NSData *data;
+
+    if (upper.length == 0) {
+        data = message;
+    } else if ([upper hasPrefix:@"HEADER"]) {
+        data = header;
+    } else if ([upper isEqualToString:@"TEXT"] || [upper isEqualToString:@"1"]) {
+        data = [message subdataWithRange:NSMakeRange(header.length, message.length - header.length)];
+    } else {
+        data = [NSData data];
+    }
+
+    NSString *partial = @"";
+    NSString *rest = [item substringFromIndex:close.location + 1];
+    if ([rest hasPrefix:@"<"] && [rest hasSuffix:@">"]) {
+        NSArray *numbers = [[rest substringWithRange:NSMakeRange(1, rest.length - 2)] componentsSeparatedByString:@"."];
+        NSUInteger offset = MIN((NSUInteger)[numbers[0] integerValue], data.length);
+        NSUInteger length = data.length - offset;
+        if (numbers.count > 1) {
+            length = MIN(length, (NSUInteger)[numbers[1] integerValue]);
+        }
+        data = [data subdataWithRange:NSMakeRange(offset, length)];
+        partial = [NSString stringWithFormat:@"<%lu>", (unsigned long)offset];
+    }
+
+    *name = [NSString stringWithFormat:@"BODY[%@]%@", section, partial];
+    return data;
+}
+
+/**
+ The bytes of a BINARY[section]<partial> item, and the name it has in the response. The body of
+ a message with "Content-Transfer-Encoding: base64" is decoded, other sections are sent as is.
+ */
+- (NSData *)binarySection:(NSString *)item ofMessage:(NSData *)message name:(NSString **)name
+{
+    NSString *bodyName;
+    NSData *data = [self section:item ofMessage:message name:&bodyName];
+    NSString *header = [[NSString alloc] initWithData:[self headerOfMessage:message]
+                                             encoding:NSISOLatin1StringEncoding];
+
+    if (!data) {
+        return nil;
+    }
+    if (([bodyName hasPrefix:@"BODY[1]"] || [bodyName hasPrefix:@"BODY[TEXT]"]) &&
+        [header.lowercaseString containsString:@"content-transfer-encoding: base64"]) {
+        data = [[NSData alloc] initWithBase64EncodedData:data
+                                                 options:NSDataBase64DecodingIgnoreUnknownCharacters];
+    }
+    *name = [@"BINARY" stringByAppendingString:[bodyName substringFromIndex:4]];
+    return data;
+}
+
+- (NSData *)headerOfMessage:(NSData *)message
+{
+    NSRange end = [message rangeOfData:[NSData dataWithBytes:"\r\n\r\n" length:4]
+                               options:0
+                                 range:NSMakeRange(0, message.length)];
+    if (end.location == NSNotFound) {
+        return message;
+    }
+    return [message subdataWithRange:NSMakeRange(0, NSMaxRange(end))];
+}
+
+#pragma mark - Messages
+
+- (NSData *)syntheticMessageWithUID:(NSUInteger)uid
+{
+    static const char line[] = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod te\r\n";
+    NSString *header = [NSString stringWithFormat:
+                        @"From: Sender <sender@example.com>\r\n"
+                        "To: Recipient <recipient@example.com>\r\n"
+                        "Subject: Message %lu\r\n"
+                        "Date: Mon, 01 Jan 2024 00:00:00 +0000\r\n"
+                        "Message-ID: <%lu@fakeimapserver.example.com>\r\n"
+                        "MIME-Version: 1.0\r\n"
+                        "Content-Type: text/plain; charset=us-ascii\r\n"
+                        "\r\n", (unsigned long)uid, (unsigned long)uid];
+    NSMutableData *message = [[header dataUsingEncoding:NSASCIIStringEncoding] mutableCopy];
+
+    while (message.length + sizeof(line) - 1 <= _messageSize) {
+        [message appendBytes:line length:sizeof(line) - 1];
+    }
+    if (message.length + 2 <= _messageSize) {
+        NSUInteger length = _messageSize - message.length - 2;
+        [message appendBytes:line length:length];
+        [message appendBytes:"\r\n" length:2];
+    }
+    return message;
+}
+
+@end
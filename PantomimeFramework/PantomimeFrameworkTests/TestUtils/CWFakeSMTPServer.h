@@ -0,0 +1,34 @@
+//
+//  CWFakeSMTPServer.h
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWFakeServer.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ An ESMTP server that accepts any credentials, sender and recipients, and keeps the messages
+ it receives. Supported: EHLO, HELO, AUTH (PLAIN, LOGIN, CRAM-MD5, XOAUTH2), MAIL, RCPT, DATA,
+ RSET, NOOP and QUIT. STARTTLS is refused.
+ */
+@interface CWFakeSMTPServer : CWFakeServer
+
+/** The extensions announced in response to EHLO. */
+@property (atomic, copy) NSArray<NSString *> *extensions;
+
+/**
+ @return The messages received with DATA, dot-unstuffed, in order.
+ */
+- (NSArray<NSData *> *)receivedMessages;
+
+/**
+ @return The addresses of all RCPT commands received.
+ */
+- (NSArray<NSString *> *)recipients;
+
+@end
+
+NS_ASSUME_NONNULL_END
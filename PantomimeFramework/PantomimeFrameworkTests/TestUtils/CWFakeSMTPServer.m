@@ -0,0 +1,169 @@
+//
+//  CWFakeSMTPServer.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWFakeSMTPServer.h"
+
+@interface CWFakeSMTPServer ()
+{
+    NSMutableArray<NSData *> *_receivedMessages;
+    NSMutableArray<NSString *> *_recipients;
+}
+@end
+
+@implementation CWFakeSMTPServer
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _receivedMessages = [NSMutableArray new];
+        _recipients = [NSMutableArray new];
+        _extensions = @[@"PIPELINING", @"8BITMIME", @"SIZE 52428800", @"AUTH PLAIN LOGIN CRAM-MD5"];
+    }
+    return self;
+}
+
+- (NSArray<NSData *> *)receivedMessages
+{
+    @synchronized(self) {
+        return [_receivedMessages copy];
+    }
+}
+
+- (NSArray<NSString *> *)recipients
+{
+    @synchronized(self) {
+        return [_recipients copy];
+    }
+}
+
+#pragma mark - CWFakeServer
+
+- (void)serveConnection:(CWFakeServerConnection *)connection
+{
+    [connection writeString:@"220 localhost ESMTP CWFakeSMTPServer\r\n"];
+
+    while (YES) {
+        @autoreleasepool {
+            NSData *line = [connection readLine];
+            if (!line) {
+                return;
+            }
+
+            NSString *string = [[NSString alloc] initWithData:line encoding:NSUTF8StringEncoding];
+            NSRange space = [string rangeOfString:@" "];
+            NSString *name = (space.location == NSNotFound ? string : [string substringToIndex:space.location]).uppercaseString;
+            NSString *arguments = (space.location == NSNotFound ? @"" : [string substringFromIndex:space.location + 1]);
+
+            [self recordCommand:name];
+
+            if ([name isEqualToString:@"EHLO"]) {
+                NSMutableString *response = [NSMutableString stringWithString:@"250-localhost\r\n"];
+                NSArray *extensions = self.extensions;
+                for (NSUInteger i = 0; i < extensions.count; i++) {
+                    [response appendFormat:@"250%@%@\r\n", (i + 1 < extensions.count ? @"-" : @" "), extensions[i]];
+                }
+                if (!extensions.count) {
+                    response = [NSMutableString stringWithString:@"250 localhost\r\n"];
+                }
+                [connection writeString:response];
+            } else if ([name isEqualToString:@"HELO"]) {
+                [connection writeString:@"250 localhost\r\n"];
+            } else if ([name isEqualToString:@"AUTH"]) {
+                if (![self authenticate:arguments connection:connection]) {
+                    return;
+                }
+                [connection writeString:@"235 2.7.0 Authentication successful\r\n"];
+            } else if ([name isEqualToString:@"MAIL"] || [name isEqualToString:@"RSET"] ||
+                       [name isEqualToString:@"NOOP"]) {
+                [connection writeString:@"250 2.0.0 OK\r\n"];
+            } else if ([name isEqualToString:@"RCPT"]) {
+                @synchronized(self) {
+                    [_recipients addObject:[self addressOf:arguments]];
+                }
+                [connection writeString:@"250 2.1.5 OK\r\n"];
+            } else if ([name isEqualToString:@"DATA"]) {
+                [connection writeString:@"354 End data with <CR><LF>.<CR><LF>\r\n"];
+                NSData *message = [self readMessage:connection];
+                if (!message) {
+                    return;
+                }
+                @synchronized(self) {
+                    [_receivedMessages addObject:message];
+                }
+                [connection writeString:@"250 2.0.0 Message accepted\r\n"];
+            } else if ([name isEqualToString:@"STARTTLS"]) {
+                [connection writeString:@"454 4.7.0 TLS not available\r\n"];
+            } else if ([name isEqualToString:@"QUIT"]) {
+                [connection writeString:@"221 2.0.0 Bye\r\n"];
+                return;
+            } else {
+                [connection writeString:@"502 5.5.2 Command not recognized\r\n"];
+            }
+        }
+    }
+}
+
+#pragma mark - Private
+
+- (BOOL)authenticate:(NSString *)arguments connection:(CWFakeServerConnection *)connection
+{
+    NSArray *words = [arguments componentsSeparatedByString:@" "];
+    NSString *mechanism = [words[0] uppercaseString];
+    NSUInteger steps = 0;
+
+    if ([mechanism isEqualToString:@"LOGIN"]) {
+        steps = 2;
+    } else if ([mechanism isEqualToString:@"CRAM-MD5"]) {
+        steps = 1;
+    } else if (words.count < 2) {
+        steps = 1;
+    }
+
+    for (NSUInteger i = 0; i < steps; i++) {
+        [connection writeString:@"334 \r\n"];
+        if (![connection readLine]) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+- (NSData *)readMessage:(CWFakeServerConnection *)connection
+{
+    NSMutableData *message = [NSMutableData new];
+
+    while (YES) {
+        NSData *line = [connection readLine];
+        if (!line) {
+            return nil;
+        }
+
+        const char *bytes = line.bytes;
+        if (line.length == 1 && bytes[0] == '.') {
+            return message;
+        }
+        if (line.length && bytes[0] == '.') {
+            [message appendBytes:bytes + 1 length:line.length - 1];
+        } else {
+            [message appendData:line];
+        }
+        [message appendBytes:"\r\n" length:2];
+    }
+}
+
+- (NSString *)addressOf:(NSString *)arguments
+{
+    NSRange open = [arguments rangeOfString:@"<"];
+    NSRange close = [arguments rangeOfString:@">" options:NSBackwardsSearch];
+    if (open.location == NSNotFound || close.location == NSNotFound || close.location < open.location) {
+        return arguments;
+    }
+    return [arguments substringWithRange:NSMakeRange(open.location + 1, close.location - open.location - 1)];
+}
+
+@end
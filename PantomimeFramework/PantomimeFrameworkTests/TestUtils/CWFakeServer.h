@@ -0,0 +1,123 @@
+//
+//  CWFakeServer.h
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class CWFakeServerConnection;
+
+/**
+ A server on 127.0.0.1 that the services can connect to in tests, without network.
+
+ Each client connection is served on its own thread by -serveConnection:, which subclasses
+ implement for their protocol (see CWFakeIMAPServer and CWFakeSMTPServer). Everything the server
+ writes goes through the impairments set on it, so tests can measure the services against slow
+ or fragmenting peers.
+ */
+@interface CWFakeServer : NSObject
+
+/** Delay before every response. 0 by default. */
+@property (atomic) NSTimeInterval latency;
+
+/** Bytes per second written to a client, 0 (the default) for no limit. */
+@property (atomic) NSUInteger bytesPerSecond;
+
+/**
+ If not 0, responses are written in writes of at most that many bytes, apart in time, so the
+ client gets them in fragments. 0 by default.
+ */
+@property (atomic) NSUInteger fragmentSize;
+
+/** The port the server listens on, 0 until started. */
+@property (atomic, readonly) uint16_t port;
+
+/**
+ Listens on an ephemeral port of 127.0.0.1.
+
+ @return NO if the socket could not be set up.
+ */
+- (BOOL)start;
+
+/**
+ Stops listening and closes all connections. The server is retained by its threads until then.
+ */
+- (void)stop;
+
+/**
+ @return How many times the command was received, over all connections.
+ */
+- (NSUInteger)countOfCommand:(NSString *)command;
+
+/**
+ @return All received commands, with how many times each was received.
+ */
+- (NSDictionary<NSString *, NSNumber *> *)commandCounts;
+
+/**
+ @return The number of connections accepted since the server was started.
+ */
+- (NSUInteger)numberOfConnections;
+
+#pragma mark - Subclasses
+
+/**
+ Serves a client until it disconnects. Runs on a thread of its own. The default implementation
+ closes the connection.
+ */
+- (void)serveConnection:(CWFakeServerConnection *)connection;
+
+/**
+ Counts a received command. Thread safe.
+ */
+- (void)recordCommand:(NSString *)command;
+
+@end
+
+/**
+ A client connection of a CWFakeServer. Reads block the serving thread.
+ */
+@interface CWFakeServerConnection : NSObject
+
+@property (nonatomic, weak, readonly) CWFakeServer *server;
+
+/**
+ @return The next line, without its CRLF, nil once the client disconnected.
+ */
+- (NSData * _Nullable)readLine;
+
+/**
+ @return Exactly length bytes, nil once the client disconnected.
+ */
+- (NSData * _Nullable)readDataOfLength:(NSUInteger)length;
+
+/**
+ @return YES if there is something to read before timeout passes.
+ */
+- (BOOL)waitForDataWithTimeout:(NSTimeInterval)timeout;
+
+/**
+ Writes data to the client, applying the latency, bandwidth and fragmentation of the server.
+ */
+- (void)writeData:(NSData *)data;
+
+/**
+ Writes a string as UTF-8, see -writeData:.
+ */
+- (void)writeString:(NSString *)string;
+
+/**
+ Writes data right away, only applying the bandwidth and fragmentation of the server.
+ Used to write a response in parts.
+ */
+- (void)writeDataWithoutLatency:(NSData *)data;
+
+- (void)close;
+
+@end
+
+NS_ASSUME_NONNULL_END
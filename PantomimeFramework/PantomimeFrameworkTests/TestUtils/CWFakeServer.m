@@ -0,0 +1,370 @@
+//
+//  CWFakeServer.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWFakeServer.h"
+
+#import <arpa/inet.h>
+#import <netinet/in.h>
+#import <netinet/tcp.h>
+#import <poll.h>
+#import <sys/socket.h>
+#import <unistd.h>
+
+#ifdef MSG_NOSIGNAL
+#define SEND_FLAGS MSG_NOSIGNAL
+#else
+#define SEND_FLAGS 0
+#endif
+
+/** Pause between the fragments of a response, so they are not coalesced again. */
+static const useconds_t kFragmentPause = 2000;
+
+@interface CWFakeServerConnection ()
+- (instancetype)initWithServer:(CWFakeServer *)server socket:(int)fd;
+@end
+
+@interface CWFakeServer ()
+{
+    int _listener;
+    NSMutableArray<CWFakeServerConnection *> *_connections;
+    NSCountedSet<NSString *> *_commands;
+    NSUInteger _numberOfConnections;
+}
+@property (atomic, readwrite) uint16_t port;
+@end
+
+@implementation CWFakeServer
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _listener = -1;
+        _connections = [NSMutableArray new];
+        _commands = [NSCountedSet new];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    [self stop];
+}
+
+- (BOOL)start
+{
+    struct sockaddr_in address;
+    socklen_t length = sizeof(address);
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    int yes = 1;
+
+    if (fd < 0) {
+        return NO;
+    }
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+
+    if (bind(fd, (struct sockaddr *)&address, sizeof(address)) != 0 ||
+        listen(fd, 16) != 0 ||
+        getsockname(fd, (struct sockaddr *)&address, &length) != 0) {
+        close(fd);
+        return NO;
+    }
+
+    @synchronized(self) {
+        _listener = fd;
+    }
+    self.port = ntohs(address.sin_port);
+
+    NSThread *thread = [[NSThread alloc] initWithTarget:self
+                                               selector:@selector(acceptConnections:)
+                                                 object:@(fd)];
+    thread.name = @"CWFakeServer accept";
+    [thread start];
+    return YES;
+}
+
+- (void)stop
+{
+    NSArray *connections;
+
+    @synchronized(self) {
+        if (_listener >= 0) {
+            // Wakes up accept() on Linux, where closing the socket alone does not.
+            shutdown(_listener, SHUT_RDWR);
+            close(_listener);
+            _listener = -1;
+        }
+        connections = [_connections copy];
+        [_connections removeAllObjects];
+    }
+    for (CWFakeServerConnection *connection in connections) {
+        [connection close];
+    }
+}
+
+- (NSUInteger)countOfCommand:(NSString *)command
+{
+    @synchronized(self) {
+        return [_commands countForObject:command.uppercaseString];
+    }
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)commandCounts
+{
+    NSMutableDictionary *counts = [NSMutableDictionary new];
+    @synchronized(self) {
+        for (NSString *command in _commands) {
+            counts[command] = @([_commands countForObject:command]);
+        }
+    }
+    return counts;
+}
+
+- (NSUInteger)numberOfConnections
+{
+    @synchronized(self) {
+        return _numberOfConnections;
+    }
+}
+
+- (void)serveConnection:(CWFakeServerConnection *)connection
+{
+    [connection close];
+}
+
+- (void)recordCommand:(NSString *)command
+{
+    @synchronized(self) {
+        [_commands addObject:command.uppercaseString];
+    }
+}
+
+#pragma mark - Private
+
+- (void)acceptConnections:(NSNumber *)listener
+{
+    while (YES) {
+        int fd = accept(listener.intValue, NULL, NULL);
+        if (fd < 0) {
+            return;
+        }
+
+        int yes = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+#ifdef SO_NOSIGPIPE
+        setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &yes, sizeof(yes));
+#endif
+
+        CWFakeServerConnection *connection = [[CWFakeServerConnection alloc] initWithServer:self
+                                                                                     socket:fd];
+        @synchronized(self) {
+            if (_listener != listener.intValue) {
+                [connection close];
+                return;
+            }
+            [_connections addObject:connection];
+            _numberOfConnections++;
+        }
+
+        NSThread *thread = [[NSThread alloc] initWithTarget:self
+                                                   selector:@selector(serve:)
+                                                     object:connection];
+        thread.name = @"CWFakeServer connection";
+        [thread start];
+    }
+}
+
+- (void)serve:(CWFakeServerConnection *)connection
+{
+    @autoreleasepool {
+        [self serveConnection:connection];
+        [connection close];
+        @synchronized(self) {
+            [_connections removeObject:connection];
+        }
+    }
+}
+
+@end
+
+#pragma mark -
+
+@interface CWFakeServerConnection ()
+{
+    int _fd;
+    NSMutableData *_buffer;
+    NSUInteger _offset;
+}
+@property (nonatomic, weak, readwrite) CWFakeServer *server;
+@end
+
+@implementation CWFakeServerConnection
+
+- (instancetype)initWithServer:(CWFakeServer *)server socket:(int)fd
+{
+    self = [super init];
+    if (self) {
+        _server = server;
+        _fd = fd;
+        _buffer = [NSMutableData new];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    [self close];
+}
+
+- (NSData *)readLine
+{
+    while (YES) {
+        const char *bytes = (const char *)_buffer.bytes + _offset;
+        NSUInteger length = _buffer.length - _offset;
+        const char *lf = memchr(bytes, '\n', length);
+
+        if (lf) {
+            NSUInteger end = lf - bytes;
+            NSUInteger lineLength = (end > 0 && bytes[end - 1] == '\r' ? end - 1 : end);
+            NSData *line = [NSData dataWithBytes:bytes length:lineLength];
+            [self consume:end + 1];
+            return line;
+        }
+        if (![self fill]) {
+            return nil;
+        }
+    }
+}
+
+- (NSData *)readDataOfLength:(NSUInteger)length
+{
+    while (_buffer.length - _offset < length) {
+        if (![self fill]) {
+            return nil;
+        }
+    }
+    NSData *data = [NSData dataWithBytes:(const char *)_buffer.bytes + _offset length:length];
+    [self consume:length];
+    return data;
+}
+
+- (BOOL)waitForDataWithTimeout:(NSTimeInterval)timeout
+{
+    if (_buffer.length > _offset) {
+        return YES;
+    }
+
+    int fd;
+    @synchronized(self) {
+        fd = _fd;
+    }
+    if (fd < 0) {
+        return YES; // The next read reports the disconnection.
+    }
+
+    struct pollfd pfd = { .fd = fd, .events = POLLIN };
+    return poll(&pfd, 1, (int)(timeout * 1000)) != 0;
+}
+
+- (void)writeData:(NSData *)data
+{
+    NSTimeInterval latency = self.server.latency;
+    if (latency > 0) {
+        [NSThread sleepForTimeInterval:latency];
+    }
+    [self writeDataWithoutLatency:data];
+}
+
+- (void)writeString:(NSString *)string
+{
+    [self writeData:[string dataUsingEncoding:NSUTF8StringEncoding]];
+}
+
+- (void)writeDataWithoutLatency:(NSData *)data
+{
+    CWFakeServer *server = self.server;
+    NSUInteger fragmentSize = server.fragmentSize;
+    NSUInteger bytesPerSecond = server.bytesPerSecond;
+    NSUInteger chunk = (fragmentSize ? fragmentSize : (bytesPerSecond ? MAX(bytesPerSecond / 20, 1) : data.length));
+    const char *bytes = data.bytes;
+    NSUInteger written = 0;
+
+    while (written < data.length) {
+        NSUInteger length = MIN(chunk, data.length - written);
+        int fd;
+
+        @synchronized(self) {
+            fd = _fd;
+        }
+        if (fd < 0) {
+            return;
+        }
+
+        ssize_t count = send(fd, bytes + written, length, SEND_FLAGS);
+        if (count <= 0) {
+            return;
+        }
+        written += count;
+
+        if (written < data.length) {
+            if (bytesPerSecond) {
+                [NSThread sleepForTimeInterval:(double)count / bytesPerSecond];
+            } else if (fragmentSize) {
+                usleep(kFragmentPause);
+            }
+        }
+    }
+}
+
+- (void)close
+{
+    @synchronized(self) {
+        if (_fd >= 0) {
+            shutdown(_fd, SHUT_RDWR);
+            close(_fd);
+            _fd = -1;
+        }
+    }
+}
+
+#pragma mark - Private
+
+- (BOOL)fill
+{
+    char bytes[4096];
+    int fd;
+
+    @synchronized(self) {
+        fd = _fd;
+    }
+    if (fd < 0) {
+        return NO;
+    }
+
+    ssize_t count = recv(fd, bytes, sizeof(bytes), 0);
+    if (count <= 0) {
+        return NO;
+    }
+    [_buffer appendBytes:bytes length:count];
+    return YES;
+}
+
+- (void)consume:(NSUInteger)length
+{
+    _offset += length;
+    if (_offset == _buffer.length) {
+        _buffer.length = 0;
+        _offset = 0;
+    }
+}
+
+@end
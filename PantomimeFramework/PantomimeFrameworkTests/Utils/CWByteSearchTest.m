@@ -0,0 +1,127 @@
+//
+//  CWByteSearchTest.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "CWByteSearch.h"
+#import "NSData+Extensions.h"
+
+@interface CWByteSearchTest : XCTestCase
+@end
+
+@implementation CWByteSearchTest
+
+#pragma mark - Tests
+
+- (void)testSearch {
+    XCTAssertEqual([self search:"--boundary" in:"a\r\n--bound\r\n--boundary--" ignoreCase:NO], 12);
+    XCTAssertEqual([self search:"--BOUNDARY" in:"a\r\n--boundary" ignoreCase:NO], NSNotFound);
+    XCTAssertEqual([self search:"--BOUNDARY" in:"a\r\n--boundary" ignoreCase:YES], 3);
+    XCTAssertEqual([self search:"a" in:"xyzA" ignoreCase:YES], 3);
+    XCTAssertEqual([self search:"" in:"abc" ignoreCase:NO], 0);
+    XCTAssertEqual([self search:"abcd" in:"abc" ignoreCase:NO], NSNotFound);
+}
+
+- (void)testSearchMatchesNaiveSearch {
+    const char *alphabet = "aAb\r\n";
+    unsigned char haystack[512];
+    unsigned char needle[12];
+
+    srandom(42);
+    for (NSUInteger run = 0; run < 5000; run++) {
+        NSUInteger length = random() % sizeof(haystack);
+        NSUInteger needleLength = 1 + random() % sizeof(needle);
+        BOOL ignoreCase = random() % 2;
+
+        for (NSUInteger i = 0; i < length; i++) {
+            haystack[i] = alphabet[random() % 5];
+        }
+        for (NSUInteger i = 0; i < needleLength; i++) {
+            needle[i] = alphabet[random() % 3];
+        }
+
+        XCTAssertEqual(cw_byte_search(haystack, length, needle, needleLength, ignoreCase),
+                       [self naiveSearch:needle length:needleLength in:haystack length:length
+                              ignoreCase:ignoreCase]);
+    }
+}
+
+- (void)testSearchIsLinearOnRepetitiveInput {
+    NSMutableData *haystack = [NSMutableData dataWithLength:4 * 1024 * 1024];
+    memset(haystack.mutableBytes, 'a', haystack.length);
+    ((unsigned char *)haystack.mutableBytes)[haystack.length - 1] = 'b';
+    unsigned char needle[256];
+    memset(needle, 'a', sizeof(needle));
+    needle[sizeof(needle) - 1] = 'b';
+
+    // Verifying every candidate would take about a billion comparisons.
+    XCTAssertEqual(cw_byte_search(haystack.bytes, haystack.length, needle, sizeof(needle), NO),
+                   haystack.length - sizeof(needle));
+    XCTAssertEqual(cw_byte_search(haystack.bytes, haystack.length, needle, sizeof(needle), YES),
+                   haystack.length - sizeof(needle));
+}
+
+- (void)testSearchAny {
+    const unsigned char *bytes = (const unsigned char *)"text/plain; charset=\"utf-8\"\r\n";
+    NSUInteger length = strlen((const char *)bytes);
+
+    XCTAssertEqual(cw_byte_search_any(bytes, length, ";\n"), 10);
+    XCTAssertEqual(cw_byte_search_any(bytes + 11, length - 11, ";\n\""), 9);
+    XCTAssertEqual(cw_byte_search_any(bytes, length, "\n"), length - 1);
+    XCTAssertEqual(cw_byte_search_any(bytes, length, "#!"), NSNotFound);
+    XCTAssertEqual(cw_byte_search_any(bytes, length, "xyzuvwt"), 0);
+    XCTAssertEqual(cw_byte_search_any(bytes, length, ""), NSNotFound);
+}
+
+- (void)testSearchAnyPastVectorWidth {
+    NSMutableData *data = [NSMutableData dataWithLength:100];
+    memset(data.mutableBytes, 'x', data.length);
+
+    for (NSUInteger i = 0; i < data.length; i++) {
+        ((unsigned char *)data.mutableBytes)[i] = ';';
+        XCTAssertEqual(cw_byte_search_any(data.bytes, data.length, "\n;"), i);
+        ((unsigned char *)data.mutableBytes)[i] = 'x';
+    }
+}
+
+- (void)testCaseEqual {
+    XCTAssertTrue(cw_byte_case_equal((const unsigned char *)"Content-Type", (const unsigned char *)"content-type", 12));
+    XCTAssertFalse(cw_byte_case_equal((const unsigned char *)"@", (const unsigned char *)"`", 1));
+    XCTAssertFalse(cw_byte_case_equal((const unsigned char *)"\xc4", (const unsigned char *)"\xe4", 1));
+}
+
+- (void)testRangeOfCStringInRange {
+    NSData *data = [@"From: a\r\nfrom: b" dataUsingEncoding:NSASCIIStringEncoding];
+
+    XCTAssertEqual([data rangeOfCString:"from" options:0 range:NSMakeRange(0, 100)].location, 9);
+    XCTAssertEqual([data rangeOfCString:"from" options:NSCaseInsensitiveSearch range:NSMakeRange(1, 100)].location, 9);
+    XCTAssertEqual([data rangeOfCString:"from" options:NSCaseInsensitiveSearch range:NSMakeRange(0, 3)].location, NSNotFound);
+    XCTAssertEqual([data rangeOfCString:"b" options:0 range:NSMakeRange(100, 1)].location, NSNotFound);
+    XCTAssertEqual([data indexOfCharacter:'\n'], 8);
+    XCTAssertEqual([data indexOfCharacter:'#'], -1);
+}
+
+#pragma mark - Helpers
+
+- (NSUInteger)search:(const char *)needle in:(const char *)haystack ignoreCase:(BOOL)ignoreCase {
+    return cw_byte_search((const unsigned char *)haystack, strlen(haystack),
+                          (const unsigned char *)needle, strlen(needle), ignoreCase);
+}
+
+- (NSUInteger)naiveSearch:(const unsigned char *)needle length:(NSUInteger)needleLength
+                       in:(const unsigned char *)haystack length:(NSUInteger)length
+               ignoreCase:(BOOL)ignoreCase {
+    for (NSUInteger i = 0; i + needleLength <= length; i++) {
+        if (ignoreCase ? strncasecmp((const char *)haystack + i, (const char *)needle, needleLength) == 0
+                       : memcmp(haystack + i, needle, needleLength) == 0) {
+            return i;
+        }
+    }
+    return NSNotFound;
+}
+
+@end
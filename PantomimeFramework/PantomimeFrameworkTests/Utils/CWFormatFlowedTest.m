@@ -0,0 +1,75 @@
+//
+//  CWFormatFlowedTest.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "NSData+Extensions.h"
+
+@interface CWFormatFlowedTest : XCTestCase
+@end
+
+@implementation CWFormatFlowedTest
+
+#pragma mark - Tests
+
+- (void)testWrap {
+    NSData *text = [self dataFromString:@"The quick brown fox jumps over the lazy dog\nFrom here\n"
+                    ">quoted text that is long enough\n-- \nsig  "];
+
+    XCTAssertEqualObjects([self stringFromData:[text wrapWithLimit:20]],
+                          @"The quick brown \nfox jumps over the \nlazy dog\n From here\n"
+                          "> quoted text that \n> is long enough\n-- \nsig");
+    XCTAssertEqualObjects([[NSData data] wrapWithLimit:20], [NSData data]);
+}
+
+- (void)testWrapKeepsLongWords {
+    NSData *text = [self dataFromString:@"a verylongwordthatdoesnotfit b"];
+
+    XCTAssertEqualObjects([self stringFromData:[text wrapWithLimit:10]],
+                          @"a \nverylongwordthatdoesnotfit \nb");
+}
+
+- (void)testQuote {
+    NSData *text = [self dataFromString:@"Hello world, this is a reply\n> earlier\n"];
+
+    XCTAssertEqualObjects([self stringFromData:[text quoteWithLevel:1 wrappingLimit:20]],
+                          @"> Hello world, this \n> is a reply\n>> earlier\n> ");
+    XCTAssertEqualObjects([text quoteWithLevel:21 wrappingLimit:20], [NSData data]);
+}
+
+- (void)testUnwrap {
+    NSData *text = [self dataFromString:@"The quick brown \nfox jumps.\n> quoted \n> para.\n>> deeper\n -- \nend "];
+
+    XCTAssertEqualObjects([self stringFromData:[text unwrapWithLimit:78]],
+                          @"The quick brown fox jumps.\n> quoted para.\n>> deeper\n-- \nend \n");
+}
+
+- (void)testUnwrapParagraphEndedByOtherQuoteDepth {
+    NSData *text = [self dataFromString:@"> one \n> two \n>> three\n"];
+
+    XCTAssertEqualObjects([self stringFromData:[text unwrapWithLimit:78]], @"> one two\n>> three\n");
+}
+
+- (void)testUnwrapThenQuoteForReply {
+    NSData *text = [self dataFromString:@"The quick brown \nfox jumps.\n> quoted \n> para.\n>> deeper\n"];
+    NSData *reply = [[text unwrapWithLimit:78] quoteWithLevel:1 wrappingLimit:80];
+
+    XCTAssertEqualObjects([self stringFromData:reply],
+                          @"> The quick brown fox jumps.\n>> quoted para.\n>>> deeper\n> ");
+}
+
+#pragma mark - Helpers
+
+- (NSData *)dataFromString:(NSString *)string {
+    return [string dataUsingEncoding:NSASCIIStringEncoding];
+}
+
+- (NSString *)stringFromData:(NSData *)data {
+    return [[NSString alloc] initWithData:data encoding:NSASCIIStringEncoding];
+}
+
+@end
@@ -0,0 +1,92 @@
+//
+//  CWHTMLTextTest.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "CWHTMLText.h"
+
+@interface CWHTMLTextTest : XCTestCase
+@end
+
+@implementation CWHTMLTextTest
+
+#pragma mark - Tests
+
+- (void)testBlocksAndSkippedElements {
+    NSString *html = @"<html><head><title>T</title><style>p{}</style></head><body>"
+    "<p>Hello <b>World</b></p><p>Second\n   line<br>third</p>"
+    "<ul><li>one</li><li>two</li></ul><table><tr><td>a</td><td>b</td></tr></table>"
+    "<script>if (a<b) x();</script></body></html>";
+
+    XCTAssertEqualObjects([self textFromHTML:html encoding:NSUTF8StringEncoding],
+                          @"Hello World\n\nSecond line\nthird\n\none\ntwo\n\na b");
+}
+
+- (void)testCharacterReferences {
+    NSString *html = @"&amp; &lt;a&gt; &copy;2026 &copy2026 &#8364; &#x1F600; &#150; &bogus; a < b &NotEqualTilde;";
+
+    XCTAssertEqualObjects([self textFromHTML:html encoding:NSUTF8StringEncoding],
+                          @"& <a> ©2026 ©2026 € \U0001F600 – &bogus; a < b ≂̸");
+}
+
+- (void)testUnknownReferencesStartingWithLegacyOnes {
+    NSString *html = @"&notit; &notin; &ampx; &copyright &hellip &lta";
+
+    XCTAssertEqualObjects([self textFromHTML:html encoding:NSUTF8StringEncoding],
+                          @"¬it; ∉ &x; ©right &hellip <a");
+}
+
+- (void)testPre {
+    XCTAssertEqualObjects([self textFromHTML:@"<pre>  a\r\n   b</pre>after" encoding:NSUTF8StringEncoding],
+                          @"  a\n   b\n\nafter");
+}
+
+- (void)testCommentsDeclarationsAndAttributes {
+    NSString *html = @"<!DOCTYPE html><!-- c <p> --> x <a href=\"x>y\" title='>'>link</a>";
+
+    XCTAssertEqualObjects([self textFromHTML:html encoding:NSUTF8StringEncoding], @"x link");
+}
+
+- (void)testSingleByteCharsets {
+    const unsigned char latin1[] = "caf\xe9 &eacute;";
+    const unsigned char windows1252[] = "\x80 \x93quoted\x94";
+
+    XCTAssertEqualObjects([self textFromBytes:latin1 length:sizeof(latin1) - 1 encoding:NSISOLatin1StringEncoding],
+                          @"café é");
+    XCTAssertEqualObjects([self textFromBytes:windows1252 length:sizeof(windows1252) - 1
+                                     encoding:NSWindowsCP1252StringEncoding],
+                          @"€ “quoted”");
+}
+
+- (void)testOtherCharsets {
+    NSData *data = [@"<p>über</p>" dataUsingEncoding:NSUTF16StringEncoding];
+
+    XCTAssertEqualObjects([self textFromBytes:data.bytes length:data.length encoding:NSUTF16StringEncoding],
+                          @"über");
+}
+
+- (void)testUnterminatedMarkup {
+    XCTAssertEqualObjects([self textFromHTML:@"a<script>b" encoding:NSUTF8StringEncoding], @"a");
+    XCTAssertEqualObjects([self textFromHTML:@"a<!-- b" encoding:NSUTF8StringEncoding], @"a");
+    XCTAssertEqualObjects([self textFromHTML:@"a &#" encoding:NSUTF8StringEncoding], @"a &#");
+    XCTAssertEqualObjects([self textFromHTML:@"" encoding:NSUTF8StringEncoding], @"");
+}
+
+#pragma mark - Helpers
+
+- (NSString *)textFromHTML:(NSString *)html encoding:(NSStringEncoding)encoding {
+    NSData *data = [html dataUsingEncoding:encoding];
+    return [self textFromBytes:data.bytes length:data.length encoding:encoding];
+}
+
+- (NSString *)textFromBytes:(const unsigned char *)bytes length:(NSUInteger)length
+                   encoding:(NSStringEncoding)encoding {
+    return [[NSString alloc] initWithData:cw_html_to_text(bytes, length, encoding)
+                                 encoding:NSUTF8StringEncoding];
+}
+
+@end
@@ -0,0 +1,136 @@
+//
+//  CWIMAPLexerTest.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "CWIMAPLexer.h"
+
+@interface CWIMAPLexerTest : XCTestCase
+@end
+
+@implementation CWIMAPLexerTest
+{
+    cw_imap_lexer _lexer;
+    NSMutableArray<NSData *> *_lines;
+}
+
+- (void)setUp {
+    [super setUp];
+    cw_imap_lexer_init(&_lexer);
+    _lines = [NSMutableArray new];
+}
+
+- (void)tearDown {
+    cw_imap_lexer_free(&_lexer);
+    [super tearDown];
+}
+
+#pragma mark - Tests
+
+- (void)testFetchResponseContinuedAfterLiteral {
+    [self addLine:@"* 418 FETCH (FLAGS (\\Seen) RFC822.SIZE 4491 BODY[HEADER.FIELDS (From To)] {337}\r\n"];
+    [self addLine:@" UID 614348)"];
+
+    XCTAssertEqualObjects([self tokens], (@[@"*", @"418", @"FETCH", @"(", @"FLAGS", @"(", @"\\Seen", @")",
+                                            @"RFC822.SIZE", @"4491", @"BODY[HEADER.FIELDS (From To)]",
+                                            @"{337}", @"UID", @"614348", @")"]));
+    XCTAssertEqual(_lexer.tokens[11].type, CWIMAPTokenLiteral);
+    XCTAssertEqual(_lexer.tokens[11].value, 337);
+    XCTAssertEqual(_lexer.tokens[3].value, 14);
+    XCTAssertEqual(cw_imap_lexer_next(&_lexer, 3), 15);
+    XCTAssertEqual(cw_imap_lexer_next(&_lexer, 5), 8);
+
+    NSUInteger uid;
+    XCTAssertTrue(cw_imap_token_number(&_lexer.tokens[13], &uid));
+    XCTAssertEqual(uid, 614348);
+    XCTAssertFalse(cw_imap_token_number(&_lexer.tokens[8], &uid));
+}
+
+- (void)testLiteral8 {
+    [self addLine:@"* 7 FETCH (UID 12 BINARY[2] ~{6}"];
+    [self addLine:@")"];
+
+    XCTAssertEqual(_lexer.count, 9);
+    XCTAssertTrue(cw_imap_token_is(&_lexer.tokens[6], "BINARY[2]"));
+    XCTAssertEqual(_lexer.tokens[7].type, CWIMAPTokenLiteral);
+    XCTAssertEqual(_lexer.tokens[7].bytes[0], '~');
+    XCTAssertEqual(_lexer.tokens[7].value, 6);
+    XCTAssertEqual(_lexer.tokens[3].value, 8);
+}
+
+- (void)testQuotedStringsAndNIL {
+    [self addLine:@"* LIST (\\Noselect) nil \"a \\\"b\\\\\""];
+
+    XCTAssertEqual(_lexer.count, 7);
+    XCTAssertEqual(_lexer.tokens[5].type, CWIMAPTokenNIL);
+    XCTAssertEqual(_lexer.tokens[6].type, CWIMAPTokenQuoted);
+    XCTAssertEqualObjects(cw_imap_token_string(&_lexer.tokens[6], NSASCIIStringEncoding), @"a \"b\\");
+    XCTAssertTrue(cw_imap_token_is(&_lexer.tokens[1], "list"));
+    XCTAssertFalse(cw_imap_token_is(&_lexer.tokens[1], "LIS"));
+}
+
+- (void)testResponseCodes {
+    [self addLine:@"* OK [UIDVALIDITY 1052146864] UIDs valid"];
+
+    XCTAssertEqual(_lexer.tokens[2].type, CWIMAPTokenCodeBegin);
+    XCTAssertEqual(_lexer.tokens[2].value, 5);
+    XCTAssertTrue(cw_imap_token_is(&_lexer.tokens[3], "UIDVALIDITY"));
+    XCTAssertEqual(_lexer.tokens[5].type, CWIMAPTokenCodeEnd);
+}
+
+- (void)testBracketsOutsideOfResponseCodes {
+    [self addLine:@"* LIST (\\HasNoChildren) \"/\" [Gmail]/Trash"];
+
+    XCTAssertEqualObjects([self tokens], (@[@"*", @"LIST", @"(", @"\\HasNoChildren", @")", @"/", @"[Gmail]/Trash"]));
+    XCTAssertEqual(_lexer.tokens[6].type, CWIMAPTokenAtom);
+
+    cw_imap_lexer_reset(&_lexer);
+    [self addLine:@"a1 no [TRYCREATE] [Gmail]/Trash does not exist"];
+    XCTAssertEqual(_lexer.tokens[2].type, CWIMAPTokenCodeBegin);
+    XCTAssertEqual(_lexer.tokens[2].value, 4);
+    XCTAssertTrue(cw_imap_token_is(&_lexer.tokens[5], "[Gmail]/Trash"));
+}
+
+- (void)testUnterminatedListsAndBracesInText {
+    [self addLine:@"* OK [ALERT] a ( b {x} c"];
+
+    XCTAssertEqual(_lexer.tokens[6].type, CWIMAPTokenListBegin);
+    XCTAssertEqual(_lexer.tokens[6].value, NSNotFound);
+    XCTAssertEqual(cw_imap_lexer_next(&_lexer, 6), _lexer.count);
+    XCTAssertEqual(_lexer.tokens[8].type, CWIMAPTokenAtom);
+}
+
+- (void)testManyTokensGrowStorage {
+    NSMutableString *line = [NSMutableString stringWithString:@"* 1 FETCH ("];
+    for (NSUInteger i = 0; i < 500; i++) {
+        [line appendFormat:@"(%lu ", (unsigned long)i];
+    }
+    [self addLine:line];
+
+    XCTAssertEqual(_lexer.count, 1004);
+    XCTAssertEqual(cw_imap_lexer_next(&_lexer, 3), _lexer.count);
+}
+
+#pragma mark - Helpers
+
+- (void)addLine:(NSString *)line {
+    NSData *data = [line dataUsingEncoding:NSUTF8StringEncoding];
+    [_lines addObject:data];
+    cw_imap_lexer_add_line(&_lexer, data.bytes, data.length);
+}
+
+- (NSArray<NSString *> *)tokens {
+    NSMutableArray *tokens = [NSMutableArray array];
+    for (NSUInteger i = 0; i < _lexer.count; i++) {
+        [tokens addObject:[[NSString alloc] initWithBytes:_lexer.tokens[i].bytes
+                                                   length:_lexer.tokens[i].length
+                                                 encoding:NSUTF8StringEncoding]];
+    }
+    return tokens;
+}
+
+@end
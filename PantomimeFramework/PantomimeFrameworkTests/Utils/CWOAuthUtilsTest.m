@@ -36,4 +36,11 @@
     XCTAssertEqualObjects(testee, expected);
 }
 
+- (void)testBase64EncodedPlainResponseForUser {
+    // base64("\0tim\0tanstaaftanstaaf"), see RFC 4616, 4.
+    NSString *expected = @"AHRpbQB0YW5zdGFhZnRhbnN0YWFm";
+    NSString *testee = [CWOAuthUtils base64EncodedPlainResponseForUser:@"tim" password:@"tanstaaftanstaaf"];
+    XCTAssertEqualObjects(testee, expected);
+}
+
 @end
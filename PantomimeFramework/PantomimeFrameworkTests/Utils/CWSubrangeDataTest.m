@@ -0,0 +1,90 @@
+//
+//  CWSubrangeDataTest.m
+//  PantomimeTests
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "CWSubrangeData.h"
+#import "NSData+Extensions.h"
+
+@interface CWSubrangeDataTest : XCTestCase
+@end
+
+@implementation CWSubrangeDataTest
+
+#pragma mark - Tests
+
+- (void)testSliceSharesParentBytes {
+    NSData *parent = [self dataFromString:@"Subject: test\r\n\r\nbody"];
+    NSData *slice = [parent subdataNoCopyWithRange:NSMakeRange(9, 4)];
+
+    XCTAssertEqualObjects(slice, [self dataFromString:@"test"]);
+    XCTAssertEqual(slice.bytes, (const char *)parent.bytes + 9);
+    XCTAssertEqual([slice copy], slice);
+}
+
+- (void)testSliceOfSliceFlattens {
+    NSData *parent = [self dataFromString:@"0123456789"];
+    NSData *slice = [[parent subdataFromIndex:2] subdataToIndex:5];
+    NSData *inner = [slice subdataNoCopyWithRange:NSMakeRange(1, 2)];
+
+    XCTAssertEqualObjects(slice, [self dataFromString:@"23456"]);
+    XCTAssertEqualObjects(inner, [self dataFromString:@"34"]);
+    XCTAssertEqual(inner.bytes, (const char *)parent.bytes + 3);
+}
+
+- (void)testEmptyAndFullRanges {
+    NSData *parent = [self dataFromString:@"abc"];
+
+    XCTAssertEqual([parent subdataNoCopyWithRange:NSMakeRange(0, 3)], parent);
+    XCTAssertEqual([parent subdataNoCopyWithRange:NSMakeRange(3, 0)].length, 0);
+    XCTAssertThrowsSpecificNamed([parent subdataNoCopyWithRange:NSMakeRange(2, 2)],
+                                 NSException, NSRangeException);
+}
+
+- (void)testMutableParentIsCopied {
+    NSMutableData *parent = [[self dataFromString:@"abcdef"] mutableCopy];
+    NSData *slice = [parent subdataNoCopyWithRange:NSMakeRange(1, 3)];
+
+    [parent replaceBytesInRange:NSMakeRange(0, 6) withBytes:"xxxxxx"];
+
+    XCTAssertEqualObjects(slice, [self dataFromString:@"bcd"]);
+}
+
+- (void)testSubdataWithRangeCopies {
+    NSData *parent = [self dataFromString:@"0123456789"];
+    NSData *slice = [parent subdataFromIndex:4];
+    NSData *copy = [slice subdataWithRange:NSMakeRange(1, 3)];
+
+    XCTAssertEqualObjects(copy, [self dataFromString:@"567"]);
+    XCTAssertFalse([copy isKindOfClass:[CWSubrangeData class]]);
+}
+
+- (void)testComponentsShareReceiver {
+    NSData *parent = [self dataFromString:@"a\r\nbc\r\n\r\nd"];
+    NSArray *components = [parent componentsSeparatedByCString:"\r\n"];
+
+    XCTAssertEqualObjects(components, (@[[self dataFromString:@"a"], [self dataFromString:@"bc"],
+                                         [NSData data], [self dataFromString:@"d"]]));
+    XCTAssertEqual([components[1] bytes], (const char *)parent.bytes + 3);
+}
+
+- (void)testComponentsOfMutableReceiver {
+    NSMutableData *parent = [[self dataFromString:@"a,b"] mutableCopy];
+    NSArray *components = [parent componentsSeparatedByCString:","];
+
+    [parent setLength:0];
+
+    XCTAssertEqualObjects(components, (@[[self dataFromString:@"a"], [self dataFromString:@"b"]]));
+}
+
+#pragma mark - Helpers
+
+- (NSData *)dataFromString:(NSString *)string {
+    return [string dataUsingEncoding:NSASCIIStringEncoding];
+}
+
+@end
@@ -35,12 +35,14 @@
 	      child and next CWContainer instances. For a full description of the implemented
 	      algorithm, see <a href="http://www.jwz.org/doc/threading.html">message threading</a>.
 	      Instance variables of this class must be accessed directly (ie., without
-	      an accessor) - for performance reasons.
+	      an accessor) - for performance reasons. A container retains its
+	      children and next sibling, but not its parent and previous sibling.
 */
 @interface CWContainer : NSObject
 {
   @public
-    CWContainer *parent, *child, *next;
+    __weak CWContainer *parent, *prev;
+    CWContainer *child, *next;
     CWMessage *message;
 }
 
@@ -60,6 +62,36 @@
 */
 - (void) setChild: (CWContainer *) theChild;
 
+/*!
+  @method addChild:
+  @discussion This method is used to make the specified container the
+              first child of the receiver, in constant time. Unlike
+              -setChild:, it does not check for duplicates or loops;
+              the caller must make sure <i>theChild</i> has no parent
+              and is not an ancestor of the receiver.
+  @param theChild The child to add.
+*/
+- (void) addChild: (CWContainer *) theChild;
+
+/*!
+  @method removeChild:
+  @discussion This method is used to unlink the specified container from
+              the list of children of the receiver, in constant time. Its
+              parent and sibling containers are reset.
+  @param theChild The child to remove.
+*/
+- (void) removeChild: (CWContainer *) theChild;
+
+/*!
+  @method isDescendantOf:
+  @discussion This method is used to check if the receiver is
+              <i>theContainer</i> or one of its descendants. It walks
+              up the parents of the receiver only.
+  @param theContainer The possible ancestor.
+  @result YES if it is, NO otherwise.
+*/
+- (BOOL) isDescendantOf: (CWContainer *) theContainer;
+
 /*!
   @method childAtIndex:
   @discussion This method is used to get the child at the specified index.
@@ -40,6 +40,7 @@
   parent = nil;
   child = nil;
   next = nil;
+  prev = nil;
 
   return self;
 }
@@ -113,6 +114,7 @@
       if (!child)
 	{
 	  child = theChild;
+	  theChild->prev = nil;
 	}
       else
 	{	  
@@ -125,6 +127,7 @@
 	      if (aChild->next == aChild)
 		{
 		  aChild->next = theChild;
+		  theChild->prev = aChild;
 		  return;
 		}
 
@@ -138,6 +141,7 @@
 	    }
 
 	  aChild->next = theChild;
+	  theChild->prev = aChild;
 	}
    
     }
@@ -148,6 +152,72 @@
 }
 
 
+//
+//
+//
+- (void) addChild: (CWContainer *) theChild
+{
+  theChild->parent = self;
+  theChild->prev = nil;
+  theChild->next = child;
+
+  if (child)
+    {
+      child->prev = theChild;
+    }
+
+  child = theChild;
+}
+
+
+//
+//
+//
+- (void) removeChild: (CWContainer *) theChild
+{
+  if (child == theChild)
+    {
+      child = theChild->next;
+    }
+  else if (theChild->parent == self && theChild->prev)
+    {
+      theChild->prev->next = theChild->next;
+    }
+  else
+    {
+      return;
+    }
+
+  if (theChild->next)
+    {
+      theChild->next->prev = theChild->prev;
+    }
+
+  theChild->parent = nil;
+  theChild->prev = nil;
+  theChild->next = nil;
+}
+
+
+//
+//
+//
+- (BOOL) isDescendantOf: (CWContainer *) theContainer
+{
+  CWContainer *aContainer;
+
+  for (aContainer = self; aContainer; aContainer = aContainer->parent)
+    {
+      if (aContainer == theContainer)
+	{
+	  return YES;
+	}
+    }
+
+  return NO;
+}
+
+
 //
 //
 //
@@ -205,9 +275,15 @@
 //
 - (void) setNext: (CWContainer *) theNext
 {
+  if (next && next->prev == self)
+    {
+      next->prev = nil;
+    }
+
   if (theNext)
     {
       ASSIGN(next, theNext);
+      theNext->prev = self;
     }
   else
     {
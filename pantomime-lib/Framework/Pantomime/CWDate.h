@@ -0,0 +1,56 @@
+//
+//  CWDate.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#ifndef _Pantomime_H_CWDate
+#define _Pantomime_H_CWDate
+
+#import <Foundation/Foundation.h>
+
+//
+// Date parsing and formatting without NSCalendar or NSDateFormatter.
+// Civil dates are converted to days since 1970-01-01 with plain integer
+// arithmetic (proleptic Gregorian calendar), so nothing is allocated.
+//
+
+/** Length of the buffers passed to the formatting functions, terminating NUL included. */
+#define CW_DATE_BUFFER_SIZE 32
+
+/**
+ The number of days from 1970-01-01 to the given date. theMonth is 1-12.
+ */
+int64_t CWDaysFromCivil(int64_t theYear, unsigned int theMonth, unsigned int theDay);
+
+/**
+ The inverse of CWDaysFromCivil().
+ */
+void CWCivilFromDays(int64_t theDays, int64_t *theYear, unsigned int *theMonth, unsigned int *theDay);
+
+/**
+ Parses the value of a Date header (RFC 5322 date-time), including the obsolete syntax of
+ RFC 822: optional day name, 2 or 3-digit years, missing seconds, alphabetic and military
+ zones, comments. A missing zone is taken as UTC.
+
+ @return YES and the time in theTime, NO if the value is not a date.
+ */
+BOOL CWParseRFC5322Date(const unsigned char *theBytes, NSUInteger theLength, NSTimeInterval *theTime);
+
+/**
+ Formats theTime as "Wed, 02 Jan 2002 09:07:19 -0700", in the zone theOffset seconds east of UTC.
+
+ @return The length written to theBuffer, which gets NUL-terminated.
+ */
+NSUInteger CWFormatRFC5322Date(NSTimeInterval theTime, NSInteger theOffset, char theBuffer[CW_DATE_BUFFER_SIZE]);
+
+/**
+ Formats theTime as an IMAP date-time, "02-Jan-2002 09:07:19 -0700", in the zone theOffset
+ seconds east of UTC.
+
+ @return The length written to theBuffer, which gets NUL-terminated.
+ */
+NSUInteger CWFormatIMAPDateTime(NSTimeInterval theTime, NSInteger theOffset, char theBuffer[CW_DATE_BUFFER_SIZE]);
+
+#endif // _Pantomime_H_CWDate
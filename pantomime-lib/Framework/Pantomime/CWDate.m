@@ -0,0 +1,518 @@
+//
+//  CWDate.m
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWDate.h"
+
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define SECONDS_PER_DAY 86400
+
+static const char *month_names = "janfebmaraprmayjunjulaugsepoctnovdec";
+static const char *month_abbreviations = "JanFebMarAprMayJunJulAugSepOctNovDec";
+static const char *day_abbreviations = "SunMonTueWedThuFriSat";
+
+//
+// The obsolete zones of RFC 822 and the ones commonly seen in the wild.
+// Offsets are in seconds, EAST of UTC. Military zones other than "z" are
+// taken as UTC, as RFC 5322 recommends, since they were often inverted.
+//
+static const struct
+{
+  const char *name;
+  int offset;
+} zone_table[] = {
+  { "ut", 0 }, { "utc", 0 }, { "gmt", 0 }, { "z", 0 },
+  { "est", -5*3600 }, { "edt", -4*3600 },
+  { "cst", -6*3600 }, { "cdt", -5*3600 },
+  { "mst", -7*3600 }, { "mdt", -6*3600 },
+  { "pst", -8*3600 }, { "pdt", -7*3600 },
+  { "wet", 0 }, { "met", 1*3600 }, { "cet", 1*3600 }, { "cest", 2*3600 },
+  { "eet", 2*3600 }, { "bst", 1*3600 },
+  { "ast", -4*3600 }, { "adt", -3*3600 },
+  { "nst", -(3*3600+1800) }, { "ndt", -(2*3600+1800) },
+  { "yst", -9*3600 }, { "ydt", -8*3600 },
+  { "hst", -10*3600 },
+  { "jst", 9*3600 }, { "sst", 8*3600 },
+  { "nzst", 12*3600 }, { "nzdt", 13*3600 },
+  { "wst", 8*3600 }, { "wdt", 9*3600 }
+};
+
+typedef struct
+{
+  const unsigned char *p;
+  const unsigned char *end;
+} cw_cursor;
+
+//
+// Skips white space, commas and (nested) comments.
+//
+static void skip_cfws(cw_cursor *c)
+{
+  int depth;
+
+  depth = 0;
+
+  while (c->p < c->end)
+    {
+      unsigned char ch;
+
+      ch = *c->p;
+
+      if (depth)
+	{
+	  if (ch == '\\' && c->p + 1 < c->end) c->p++;
+	  else if (ch == '(') depth++;
+	  else if (ch == ')') depth--;
+	}
+      else if (ch == '(')
+	{
+	  depth++;
+	}
+      else if (!(ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n' || ch == ','))
+	{
+	  break;
+	}
+
+      c->p++;
+    }
+}
+
+
+//
+// Reads up to theMax digits. Returns the number of digits read.
+//
+static int read_number(cw_cursor *c, int theMax, int *theValue)
+{
+  int count, value;
+
+  count = value = 0;
+
+  while (c->p < c->end && isdigit(*c->p))
+    {
+      // We consume extra digits but ignore them.
+      if (count < theMax)
+	{
+	  value = value * 10 + (*c->p - '0');
+	}
+
+      count++;
+      c->p++;
+    }
+
+  *theValue = value;
+
+  return count;
+}
+
+
+//
+// Reads a word made of letters, lowercased and NUL-terminated in theBuffer
+// (truncated to theSize-1 characters). Returns the full length of the word.
+//
+static NSUInteger read_word(cw_cursor *c, char *theBuffer, NSUInteger theSize)
+{
+  NSUInteger len;
+
+  len = 0;
+
+  while (c->p < c->end && isalpha(*c->p))
+    {
+      if (len < theSize - 1)
+	{
+	  theBuffer[len] = (char)tolower(*c->p);
+	}
+
+      len++;
+      c->p++;
+    }
+
+  theBuffer[len < theSize ? len : theSize - 1] = '\0';
+
+  return len;
+}
+
+
+//
+// Returns 1-12, or 0 if theWord is not a month name.
+//
+static unsigned int month_from_word(const char *theWord, NSUInteger theLength)
+{
+  unsigned int i;
+
+  if (theLength < 3)
+    {
+      return 0;
+    }
+
+  for (i = 0; i < 12; i++)
+    {
+      if (strncmp(theWord, month_names + 3*i, 3) == 0)
+	{
+	  return i + 1;
+	}
+    }
+
+  return 0;
+}
+
+
+//
+// hour ":" minute [ ":" second ]
+//
+static BOOL read_time(cw_cursor *c, int *theHours, int *theMinutes, int *theSeconds)
+{
+  if (read_number(c, 2, theHours) == 0 || c->p >= c->end || *c->p != ':')
+    {
+      return NO;
+    }
+
+  c->p++;
+
+  if (read_number(c, 2, theMinutes) == 0)
+    {
+      return NO;
+    }
+
+  *theSeconds = 0;
+
+  if (c->p < c->end && *c->p == ':')
+    {
+      c->p++;
+      read_number(c, 2, theSeconds);
+    }
+
+  return (*theHours <= 24 && *theMinutes <= 59 && *theSeconds <= 60);
+}
+
+
+//
+// zone = ( "+" / "-" ) 4DIGIT / obs-zone, optionally followed
+// by a "dst" modifier. Returns NO if there is no zone.
+//
+static BOOL read_zone(cw_cursor *c, int *theOffset)
+{
+  char aWord[8];
+  NSUInteger len, i;
+
+  if (c->p >= c->end)
+    {
+      return NO;
+    }
+
+  if (*c->p == '+' || *c->p == '-')
+    {
+      int sign, value, count;
+
+      sign = (*c->p == '-' ? -1 : 1);
+      c->p++;
+      count = read_number(c, 4, &value);
+
+      if (count == 4)
+	{
+	  *theOffset = sign * ((value / 100) * 3600 + (value % 100) * 60);
+	}
+      else if (count == 2 || count == 1)
+	{
+	  *theOffset = sign * value * 3600;
+	}
+      else
+	{
+	  return NO;
+	}
+
+      return YES;
+    }
+
+  len = read_word(c, aWord, sizeof(aWord));
+
+  if (len == 0 || len >= sizeof(aWord))
+    {
+      return NO;
+    }
+
+  *theOffset = 0;
+
+  for (i = 0; i < sizeof(zone_table)/sizeof(zone_table[0]); i++)
+    {
+      if (strcmp(aWord, zone_table[i].name) == 0)
+	{
+	  *theOffset = zone_table[i].offset;
+	  break;
+	}
+    }
+
+  // "met dst"
+  skip_cfws(c);
+
+  if (c->end - c->p >= 3 && strncasecmp((const char *)c->p, "dst", 3) == 0)
+    {
+      *theOffset += 3600;
+      c->p += 3;
+    }
+
+  return YES;
+}
+
+
+//
+//
+//
+static int64_t full_year(int theYear, int theDigits)
+{
+  // RFC 5322, 4.3: obs-year
+  if (theDigits == 2)
+    {
+      return theYear + (theYear < 50 ? 2000 : 1900);
+    }
+  else if (theDigits == 3)
+    {
+      return theYear + 1900;
+    }
+
+  return theYear;
+}
+
+
+//
+//
+//
+static char *put_digits(char *p, int64_t theValue, int theWidth)
+{
+  char *q;
+
+  q = p + theWidth;
+
+  while (q > p)
+    {
+      *--q = (char)('0' + theValue % 10);
+      theValue /= 10;
+    }
+
+  return p + theWidth;
+}
+
+
+//
+// Writes the date, time and zone parts shared by both formats.
+//
+static NSUInteger format_date(NSTimeInterval theTime, NSInteger theOffset, BOOL theIMAPFormat, char *theBuffer)
+{
+  int64_t local, days, secs, year;
+  unsigned int month, day;
+  NSInteger offset;
+  char *p;
+
+  local = (int64_t)floor(theTime) + theOffset;
+  days = local / SECONDS_PER_DAY;
+  secs = local % SECONDS_PER_DAY;
+
+  if (secs < 0)
+    {
+      secs += SECONDS_PER_DAY;
+      days--;
+    }
+
+  CWCivilFromDays(days, &year, &month, &day);
+
+  if (year < 0 || year > 9999)
+    {
+      // Not a date anyone will ever send, we don't bother.
+      year = (year < 0 ? 0 : 9999);
+    }
+
+  p = theBuffer;
+
+  if (!theIMAPFormat)
+    {
+      memcpy(p, day_abbreviations + 3*(((days % 7) + 11) % 7), 3);
+      p += 3;
+      *p++ = ',';
+      *p++ = ' ';
+    }
+
+  p = put_digits(p, day, 2);
+  *p++ = (theIMAPFormat ? '-' : ' ');
+  memcpy(p, month_abbreviations + 3*(month - 1), 3);
+  p += 3;
+  *p++ = (theIMAPFormat ? '-' : ' ');
+  p = put_digits(p, year, 4);
+  *p++ = ' ';
+  p = put_digits(p, secs / 3600, 2);
+  *p++ = ':';
+  p = put_digits(p, (secs / 60) % 60, 2);
+  *p++ = ':';
+  p = put_digits(p, secs % 60, 2);
+  *p++ = ' ';
+
+  offset = theOffset / 60;
+  *p++ = (offset < 0 ? '-' : '+');
+  offset = (offset < 0 ? -offset : offset);
+  p = put_digits(p, (offset / 60) % 100, 2);
+  p = put_digits(p, offset % 60, 2);
+  *p = '\0';
+
+  return p - theBuffer;
+}
+
+//
+// Public functions
+//
+int64_t CWDaysFromCivil(int64_t theYear, unsigned int theMonth, unsigned int theDay)
+{
+  int64_t era;
+  unsigned int yoe, doy, doe;
+
+  // Years start in March, so that the leap day is the last day of the year.
+  theYear -= (theMonth <= 2);
+  era = (theYear >= 0 ? theYear : theYear - 399) / 400;
+  yoe = (unsigned int)(theYear - era * 400);
+  doy = (153 * (theMonth > 2 ? theMonth - 3 : theMonth + 9) + 2) / 5 + theDay - 1;
+  doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+  return era * 146097 + (int64_t)doe - 719468;
+}
+
+
+//
+//
+//
+void CWCivilFromDays(int64_t theDays, int64_t *theYear, unsigned int *theMonth, unsigned int *theDay)
+{
+  int64_t era;
+  unsigned int doe, yoe, doy, mp;
+
+  theDays += 719468;
+  era = (theDays >= 0 ? theDays : theDays - 146096) / 146097;
+  doe = (unsigned int)(theDays - era * 146097);
+  yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  mp = (5 * doy + 2) / 153;
+
+  *theDay = doy - (153 * mp + 2) / 5 + 1;
+  *theMonth = (mp < 10 ? mp + 3 : mp - 9);
+  *theYear = (int64_t)yoe + era * 400 + (*theMonth <= 2);
+}
+
+
+//
+// date-time = [ day-of-week "," ] date time [CFWS]
+//
+// We also accept "11-Jan-02" style dates and the asctime() layout,
+// "Wed Jan  2 09:07:19 [zone] 2002".
+//
+BOOL CWParseRFC5322Date(const unsigned char *theBytes, NSUInteger theLength, NSTimeInterval *theTime)
+{
+  int day, year, yearDigits, hours, minutes, seconds, offset;
+  unsigned int month;
+  char aWord[16];
+  NSUInteger len;
+  cw_cursor c;
+
+  c.p = theBytes;
+  c.end = theBytes + theLength;
+  month = 0;
+  offset = hours = minutes = seconds = 0;
+  day = year = yearDigits = -1;
+
+  skip_cfws(&c);
+
+  if (c.p < c.end && isalpha(*c.p))
+    {
+      // We skip the day name, we don't need it.
+      read_word(&c, aWord, sizeof(aWord));
+      skip_cfws(&c);
+    }
+
+  if (c.p < c.end && isalpha(*c.p))
+    {
+      // asctime(): month day time [zone] year
+      len = read_word(&c, aWord, sizeof(aWord));
+      month = month_from_word(aWord, len);
+      skip_cfws(&c);
+
+      if (!month || read_number(&c, 2, &day) == 0)
+	{
+	  return NO;
+	}
+
+      skip_cfws(&c);
+
+      if (!read_time(&c, &hours, &minutes, &seconds))
+	{
+	  return NO;
+	}
+
+      skip_cfws(&c);
+
+      if (c.p < c.end && !isdigit(*c.p))
+	{
+	  read_zone(&c, &offset);
+	  skip_cfws(&c);
+	}
+
+      yearDigits = read_number(&c, 4, &year);
+    }
+  else
+    {
+      // day month year time [zone]
+      if (read_number(&c, 2, &day) == 0)
+	{
+	  return NO;
+	}
+
+      skip_cfws(&c);
+      if (c.p < c.end && *c.p == '-') c.p++;
+
+      len = read_word(&c, aWord, sizeof(aWord));
+      month = month_from_word(aWord, len);
+
+      skip_cfws(&c);
+      if (c.p < c.end && *c.p == '-') c.p++;
+
+      yearDigits = read_number(&c, 4, &year);
+      skip_cfws(&c);
+
+      if (!month || yearDigits < 2 || !read_time(&c, &hours, &minutes, &seconds))
+	{
+	  return NO;
+	}
+
+      skip_cfws(&c);
+      read_zone(&c, &offset);
+    }
+
+  if (!month || yearDigits < 2 || day < 1 || day > 31)
+    {
+      return NO;
+    }
+
+  *theTime = (NSTimeInterval)(CWDaysFromCivil(full_year(year, yearDigits), month, day) * SECONDS_PER_DAY
+			      + hours * 3600 + minutes * 60 + seconds - offset);
+
+  return YES;
+}
+
+
+//
+//
+//
+NSUInteger CWFormatRFC5322Date(NSTimeInterval theTime, NSInteger theOffset, char theBuffer[CW_DATE_BUFFER_SIZE])
+{
+  return format_date(theTime, theOffset, NO, theBuffer);
+}
+
+
+//
+//
+//
+NSUInteger CWFormatIMAPDateTime(NSTimeInterval theTime, NSInteger theOffset, char theBuffer[CW_DATE_BUFFER_SIZE])
+{
+  return format_date(theTime, theOffset, YES, theBuffer);
+}
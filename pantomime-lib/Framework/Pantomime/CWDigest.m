@@ -0,0 +1,256 @@
+//
+//  CWDigest.m
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWDigest.h"
+#import "CWConstants.h"
+#import "CWMD5.h"
+
+#ifdef MACOSX
+#include <CommonCrypto/CommonDigest.h>
+#endif
+
+//
+// The running state of every backend we may use.
+//
+typedef union
+{
+#ifdef MACOSX
+    CC_MD5_CTX md5;
+    CC_SHA1_CTX sha1;
+    CC_SHA256_CTX sha256;
+#else
+    struct MD5Context md5;
+#endif
+} digest_context;
+
+static const char hex_digits[] = "0123456789abcdef";
+
+//
+//
+//
+@implementation CWDigest
+{
+    CWDigestAlgorithm _algorithm;
+    digest_context _context;
+    NSData *_digest;
+}
+
++ (BOOL) isAlgorithmAvailable: (CWDigestAlgorithm) theAlgorithm
+{
+    switch (theAlgorithm)
+    {
+        case CWDigestAlgorithmMD5:
+            return YES;
+#ifdef MACOSX
+        case CWDigestAlgorithmSHA1:
+        case CWDigestAlgorithmSHA256:
+            return YES;
+#endif
+        default:
+            return NO;
+    }
+}
+
++ (NSUInteger) digestLengthForAlgorithm: (CWDigestAlgorithm) theAlgorithm
+{
+    switch (theAlgorithm)
+    {
+        case CWDigestAlgorithmMD5:
+            return 16;
+        case CWDigestAlgorithmSHA1:
+            return 20;
+        case CWDigestAlgorithmSHA256:
+            return 32;
+        default:
+            return 0;
+    }
+}
+
++ (instancetype) digestWithAlgorithm: (CWDigestAlgorithm) theAlgorithm
+{
+    return AUTORELEASE([[self alloc] initWithAlgorithm: theAlgorithm]);
+}
+
++ (NSData *) digestOfData: (NSData *) theData
+                algorithm: (CWDigestAlgorithm) theAlgorithm
+{
+    CWDigest *aDigest = [self digestWithAlgorithm: theAlgorithm];
+
+    [aDigest updateWithData: theData];
+    return [aDigest finalizeDigest];
+}
+
++ (NSString *) hexStringFromData: (NSData *) theData
+{
+    const unsigned char *bytes = [theData bytes];
+    NSUInteger i, len = [theData length];
+    char *s;
+
+    if (len == 0)
+    {
+        return @"";
+    }
+
+    s = malloc(len * 2);
+
+    for (i = 0; i < len; i++)
+    {
+        s[2*i] = hex_digits[bytes[i] >> 4];
+        s[2*i+1] = hex_digits[bytes[i] & 0x0f];
+    }
+
+    return AUTORELEASE([[NSString alloc] initWithBytesNoCopy: s
+                                                      length: len * 2
+                                                    encoding: NSASCIIStringEncoding
+                                                freeWhenDone: YES]);
+}
+
+- (instancetype) initWithAlgorithm: (CWDigestAlgorithm) theAlgorithm
+{
+    if (![CWDigest isAlgorithmAvailable: theAlgorithm])
+    {
+        return nil;
+    }
+
+    self = [super init];
+
+    if (self)
+    {
+        _algorithm = theAlgorithm;
+
+        switch (_algorithm)
+        {
+#ifdef MACOSX
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+            // MD5 is deprecated for cryptographic use, we only use it as a checksum.
+            case CWDigestAlgorithmMD5:
+                CC_MD5_Init(&_context.md5);
+                break;
+#pragma clang diagnostic pop
+            case CWDigestAlgorithmSHA1:
+                CC_SHA1_Init(&_context.sha1);
+                break;
+            case CWDigestAlgorithmSHA256:
+                CC_SHA256_Init(&_context.sha256);
+                break;
+#else
+            case CWDigestAlgorithmMD5:
+                MD5Init(&_context.md5);
+                break;
+#endif
+            default:
+                break;
+        }
+    }
+
+    return self;
+}
+
+- (void) dealloc
+{
+    RELEASE(_digest);
+    //[super dealloc];
+}
+
+- (CWDigestAlgorithm) algorithm
+{
+    return _algorithm;
+}
+
+- (void) updateWithBytes: (const void *) theBytes
+                  length: (NSUInteger) theLength
+{
+    const unsigned char *bytes = theBytes;
+
+    if (_digest)
+    {
+        return;
+    }
+
+#ifdef MACOSX
+    // The CommonCrypto functions take 32-bit lengths.
+    while (theLength > 0)
+    {
+        CC_LONG len = (CC_LONG) MIN(theLength, (NSUInteger) UINT32_MAX);
+
+        switch (_algorithm)
+        {
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+            case CWDigestAlgorithmMD5:
+                CC_MD5_Update(&_context.md5, bytes, len);
+                break;
+#pragma clang diagnostic pop
+            case CWDigestAlgorithmSHA1:
+                CC_SHA1_Update(&_context.sha1, bytes, len);
+                break;
+            case CWDigestAlgorithmSHA256:
+                CC_SHA256_Update(&_context.sha256, bytes, len);
+                break;
+            default:
+                break;
+        }
+
+        bytes += len;
+        theLength -= len;
+    }
+#else
+    MD5Update(&_context.md5, bytes, theLength);
+#endif
+}
+
+- (void) updateWithData: (NSData *) theData
+{
+    [self updateWithBytes: [theData bytes]  length: [theData length]];
+}
+
+- (NSData *) finalizeDigest
+{
+    unsigned char aDigest[32];
+
+    if (_digest)
+    {
+        return _digest;
+    }
+
+    switch (_algorithm)
+    {
+#ifdef MACOSX
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+        case CWDigestAlgorithmMD5:
+            CC_MD5_Final(aDigest, &_context.md5);
+            break;
+#pragma clang diagnostic pop
+        case CWDigestAlgorithmSHA1:
+            CC_SHA1_Final(aDigest, &_context.sha1);
+            break;
+        case CWDigestAlgorithmSHA256:
+            CC_SHA256_Final(aDigest, &_context.sha256);
+            break;
+#else
+        case CWDigestAlgorithmMD5:
+            MD5Final(aDigest, &_context.md5);
+            break;
+#endif
+        default:
+            break;
+    }
+
+    _digest = [[NSData alloc] initWithBytes: aDigest
+                                     length: [CWDigest digestLengthForAlgorithm: _algorithm]];
+
+    return _digest;
+}
+
+- (NSString *) digestAsString
+{
+    return [CWDigest hexStringFromData: [self finalizeDigest]];
+}
+
+@end
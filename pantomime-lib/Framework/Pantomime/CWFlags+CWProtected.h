@@ -0,0 +1,28 @@
+//
+//  CWFlags+CWProtected.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWFlags.h"
+
+/**
+ Gets told about every change made through the CWFlags mutators.
+ */
+@protocol CWFlagsObserver <NSObject>
+
+- (void) flags: (CWFlags *) theFlags  didChangeFrom: (PantomimeFlag) theOldFlags;
+
+@end
+
+@interface CWFlags (CWProtected)
+
+/**
+ The object told about changes, not retained. A CWMessage observes its own flags so that
+ its folder can keep its flag bitmaps up to date. Copies are not observed.
+ */
+- (id<CWFlagsObserver>) observer;
+- (void) setObserver: (id<CWFlagsObserver>) theObserver;
+
+@end
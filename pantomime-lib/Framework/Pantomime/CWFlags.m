@@ -21,6 +21,7 @@
 */
 
 #import "CWFlags.h"
+#import "CWFlags+CWProtected.h"
 
 #import "NSData+Extensions.h"
 #import "Pantomime/NSString+Extensions.h"
@@ -29,6 +30,18 @@
   theRange = [theData rangeOfCString: c]; \
   if (theRange.length) { [self add: value]; }
 
+//
+// Tells the observer, if any, that the flags changed from theOldFlags.
+//
+#define NOTIFY_CHANGE(theOldFlags) \
+  if (flags != theOldFlags) { [_observer flags: self  didChangeFrom: theOldFlags]; }
+
+@interface CWFlags ()
+{
+  __weak id<CWFlagsObserver> _observer;
+}
+@end
+
 //
 //
 //
@@ -141,7 +154,11 @@
 //
 - (void) add: (PantomimeFlag) theFlag
 {
+  PantomimeFlag oldFlags;
+
+  oldFlags = flags;
   flags = flags|theFlag;
+  NOTIFY_CHANGE(oldFlags);
 }
 
 
@@ -195,7 +212,11 @@
 //
 - (void) replaceWithFlags: (CWFlags *) theFlags
 {
+  PantomimeFlag oldFlags;
+
+  oldFlags = flags;
   flags = theFlags->flags;
+  NOTIFY_CHANGE(oldFlags);
 }
 
 //
@@ -203,7 +224,11 @@
 //
 - (void) remove: (PantomimeFlag) theFlag
 {
+  PantomimeFlag oldFlags;
+
+  oldFlags = flags;
   flags = flags&(flags^theFlag);
+  NOTIFY_CHANGE(oldFlags);
 }
 
 
@@ -212,7 +237,11 @@
 //
 - (void) removeAll
 {
+  PantomimeFlag oldFlags;
+
+  oldFlags = flags;
   flags = 0;
+  NOTIFY_CHANGE(oldFlags);
 }
 
 
@@ -309,3 +338,20 @@
 }
 
 @end
+
+//
+//
+//
+@implementation CWFlags (CWProtected)
+
+- (id<CWFlagsObserver>) observer
+{
+  return _observer;
+}
+
+- (void) setObserver: (id<CWFlagsObserver>) theObserver
+{
+  _observer = theObserver;
+}
+
+@end
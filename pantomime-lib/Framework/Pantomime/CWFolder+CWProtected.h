@@ -0,0 +1,36 @@
+//
+//  CWFolder+CWProtected.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWFolder.h"
+
+@class CWFolderView;
+
+@interface CWFolder (CWProtected)
+
+/**
+ All messages of the folder, including the ones -allMessages hides.
+ */
+- (NSArray *) allMessagesIncludingHidden;
+
+/**
+ Registers a view to be kept up to date when messages are appended, removed or updated.
+ Views are not retained.
+ */
+- (void) addView: (CWFolderView *) theView;
+
+/**
+ Stops updating a view registered with addView:.
+ */
+- (void) removeView: (CWFolderView *) theView;
+
+/**
+ Invoked by a message of the folder when its flags change, to keep the flag bitmaps and
+ -allMessages up to date.
+ */
+- (void) message: (CWMessage *) theMessage  didChangeFlagsFrom: (PantomimeFlag) theOldFlags;
+
+@end
@@ -22,23 +22,105 @@
 */
 
 #import "CWFolder.h"
+#import "CWFolder+CWProtected.h"
 
 #import <Foundation/Foundation.h>
 
 #import "CWConstants.h"
 #import "Pantomime/CWContainer.h"
 #import "CWFlags.h"
+#import "CWFolderView.h"
 #import <PantomimeFramework/CWMessage.h>
 #import "Pantomime/NSString+Extensions.h"
+#import "Pantomime/CWThreader.h"
 
 #if __APPLE__
 #include "TargetConditionals.h"
 #endif
 
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Every message of the folder gets a slot, in the order of _allMessages, and
+// one bit per slot in each of the bitmaps below. The bits are kept in sync by
+// -message:didChangeFlagsFrom:, so visibility is computed a word at a time.
+//
+enum
+{
+  CW_PRESENT = 0,
+  CW_SEEN,
+  CW_DELETED,
+  CW_FLAGGED,
+  CW_ANSWERED,
+  CW_BITMAP_COUNT
+};
+
+#define CW_WORD_BITS (sizeof(NSUInteger) * 8)
+#define CW_WORD(slot) ((slot) / CW_WORD_BITS)
+#define CW_BIT(slot) ((NSUInteger)1 << ((slot) % CW_WORD_BITS))
+
+typedef struct
+{
+  NSUInteger *bits;   // CW_BITMAP_COUNT bitmaps of 'words' words each
+  NSUInteger words;
+  NSUInteger slots;   // slots handed out, freed ones included
+  NSUInteger live;
+} cw_flag_bitmap;
+
+static inline NSUInteger *cw_bitmap(cw_flag_bitmap *theBitmap, NSUInteger theKind)
+{
+  return theBitmap->bits + theKind * theBitmap->words;
+}
+
+static void cw_bitmap_reset(cw_flag_bitmap *theBitmap);
+static void cw_bitmap_grow(cw_flag_bitmap *theBitmap);
+static void cw_bitmap_set(cw_flag_bitmap *theBitmap, NSUInteger theSlot, PantomimeFlag theFlags);
+static void cw_bitmap_clear(cw_flag_bitmap *theBitmap, NSUInteger theSlot);
+static NSUInteger cw_bitmap_visible(cw_flag_bitmap *theBitmap, NSUInteger theWord, BOOL showDeleted, BOOL showRead);
+static BOOL cw_bitmap_is_visible(cw_flag_bitmap *theBitmap, NSUInteger theSlot, BOOL showDeleted, BOOL showRead);
+static NSUInteger cw_bitmap_rank(cw_flag_bitmap *theBitmap, NSUInteger theSlot, BOOL showDeleted, BOOL showRead);
+static NSUInteger cw_bitmap_count(cw_flag_bitmap *theBitmap, NSUInteger theKind);
+
+static inline BOOL cw_is_visible(PantomimeFlag theFlags, BOOL showDeleted, BOOL showRead)
+{
+  if (theFlags & PantomimeFlagDeleted)
+    {
+      return showDeleted;
+    }
+
+  return (showRead || !(theFlags & PantomimeFlagSeen));
+}
+
 @interface CWFolder ()
+{
+  cw_flag_bitmap _bitmap;
+
+  // CWMessage -> slot + 1, and slot -> CWMessage (NSNull once freed)
+  NSMapTable *_slotTable;
+  NSMutableArray *_slotMessages;
+}
 
 @property (nonatomic) NSMutableArray *allMessages;
 
+/** Set while the folder is threaded, see -thread. */
+@property (nonatomic) CWThreader *threader;
+
+/** The CWFolderView instances to keep up to date, not retained. */
+@property (nonatomic) NSHashTable *views;
+
+@end
+
+//
+// Private methods
+//
+@interface CWFolder (Private)
+
+- (NSUInteger) _slotOfMessage: (CWMessage *) theMessage;
+- (void) _addSlotForMessage: (CWMessage *) theMessage;
+- (NSUInteger) _removeSlotOfMessage: (CWMessage *) theMessage;
+- (void) _rebuildSlots;
+
 @end
 
 //
@@ -54,6 +136,11 @@
   _allVisibleMessages = nil;
   
   _allMessages = [[NSMutableArray alloc] init];
+  _views = [NSHashTable weakObjectsHashTable];
+
+  memset(&_bitmap, 0, sizeof(cw_flag_bitmap));
+  _slotTable = NSCreateMapTable(NSNonOwnedPointerMapKeyCallBacks, NSIntegerMapValueCallBacks, 128);
+  _slotMessages = [[NSMutableArray alloc] init];
   
   _cacheManager = nil;
   _mode = PantomimeUnknownMode;
@@ -85,6 +172,8 @@
   TEST_RELEASE(_allVisibleMessages);
   TEST_RELEASE(_cacheManager);
 
+  free(_bitmap.bits);
+
   //[super dealloc];
 }
 
@@ -124,11 +213,20 @@
   if (theMessage)
     {
       [_allMessages addObject: theMessage];
+      [self _addSlotForMessage: theMessage];
       
-      if (_allVisibleMessages)
+      if (_allVisibleMessages &&
+	  cw_is_visible([[theMessage flags] rawFlags], _show_deleted, _show_read))
 	{
 	  [_allVisibleMessages addObject: theMessage];
 	}
+
+      [_threader addMessage: theMessage];
+
+      for (CWFolderView *aView in _views)
+	{
+	  [aView insertMessage: theMessage];
+	}
     }
 }
 
@@ -150,63 +248,29 @@
 { 
   if (_allVisibleMessages == nil)
     {
-      NSUInteger i, count;
+      NSUInteger w, count;
 
       count = [_allMessages count];
-      _allVisibleMessages = [[NSMutableArray alloc] initWithCapacity: count];
 
       // quick
       if (_show_deleted && _show_read)
 	{
-	  [_allVisibleMessages addObjectsFromArray: _allMessages];
+	  _allVisibleMessages = [[NSMutableArray alloc] initWithArray: _allMessages];
 	  return _allVisibleMessages;
 	}
 
-      for (i = 0; i < count; i++)
+      _allVisibleMessages = [[NSMutableArray alloc] initWithCapacity: count];
+
+      for (w = 0; w < _bitmap.words; w++)
 	{
-	  CWMessage *aMessage;
-	  
-	  aMessage = [_allMessages objectAtIndex: i];
-      
-	  // We show or hide deleted messages
-	  if (_show_deleted)
-	    {
-	      [_allVisibleMessages addObject: aMessage];
-	    }
-	  else
-	    {
-	      if ([[aMessage flags] contain: PantomimeFlagDeleted])
-		{
-		  // Do nothing
-		  continue;
-		}
-	      else
-		{
-		  [_allVisibleMessages addObject: aMessage];
-		}
-	    }
+	  NSUInteger aWord;
 
-	  // We show or hide read messages
-	  if (_show_read)
-	    {
-	      if (![_allVisibleMessages containsObject: aMessage])
-		{
-		  [_allVisibleMessages addObject: aMessage];
-		}
-	    }
-	  else
+	  aWord = cw_bitmap_visible(&_bitmap, w, _show_deleted, _show_read);
+
+	  while (aWord)
 	    {
-	      if ([[aMessage flags] contain: PantomimeFlagSeen])
-		{
-		  if (![[aMessage flags] contain: PantomimeFlagDeleted])
-		    {
-		      [_allVisibleMessages removeObject: aMessage];
-		    }
-		}
-	      else if (![_allVisibleMessages containsObject: aMessage])
-		{
-		  [_allVisibleMessages addObject: aMessage];
-		}
+	      [_allVisibleMessages addObject: [_slotMessages objectAtIndex: w * CW_WORD_BITS + __builtin_ctzl(aWord)]];
+	      aWord &= aWord - 1;
 	    }
 	}
     }
@@ -231,6 +295,15 @@
     }
 
   DESTROY(_allVisibleMessages);
+  [self _rebuildSlots];
+
+  if (_threader)
+    {
+      [_threader removeAllMessages];
+      [_threader addMessages: _allMessages];
+    }
+
+  [[_views allObjects] makeObjectsPerformSelector: @selector(reload)];
 }
 
 
@@ -302,12 +375,33 @@
 {
   if (theMessage)
     {
+      NSUInteger aSlot;
+
       [_allMessages removeObject: theMessage];
-      
-      if (_allVisibleMessages)
+
+      aSlot = [self _slotOfMessage: theMessage];
+
+      if (_allVisibleMessages && aSlot != NSNotFound)
+	{
+	  // We must find the position before the bits of the slot are cleared.
+	  if (cw_bitmap_is_visible(&_bitmap, aSlot, _show_deleted, _show_read))
+	    {
+	      [_allVisibleMessages removeObjectAtIndex: cw_bitmap_rank(&_bitmap, aSlot, _show_deleted, _show_read)];
+	    }
+	}
+      else if (_allVisibleMessages)
 	{
 	  [_allVisibleMessages removeObject: theMessage];
 	}
+
+      [self _removeSlotOfMessage: theMessage];
+
+      [_threader removeMessage: theMessage];
+
+      for (CWFolderView *aView in _views)
+	{
+	  [aView removeMessage: theMessage];
+	}
     }
 }
 
@@ -359,22 +453,54 @@
 //
 //
 //
-- (NSUInteger) numberOfDeletedMessages
+- (void) thread
 {
-  NSUInteger c, i, count;
-  
-  c = [self count];
-  count = 0;
+  if (!_threader)
+    {
+      _threader = [[CWThreader alloc] init];
+      [_threader addMessages: _allMessages];
+    }
+}
 
-  for (i = 0; i < c; i++)
+
+//
+//
+//
+- (void) updateMessage: (CWMessage *) theMessage
+{
+  [_threader updateMessage: theMessage];
+
+  for (CWFolderView *aView in _views)
     {
-      if ([[(CWMessage *) [_allMessages objectAtIndex: i] flags] contain: PantomimeFlagDeleted])
-	{
-	  count++;
-	}
+      [aView updateMessage: theMessage];
     }
+}
 
-  return count;
+
+//
+//
+//
+- (void) unthread
+{
+  DESTROY(_threader);
+}
+
+
+//
+//
+//
+- (NSArray *) allContainers
+{
+  return [_threader rootContainers];
+}
+
+
+//
+//
+//
+- (NSUInteger) numberOfDeletedMessages
+{
+  return [self numberOfMessagesWithFlag: PantomimeFlagDeleted];
 }
 
 
@@ -383,14 +509,37 @@
 //
 - (NSUInteger) numberOfUnreadMessages
 {
-  NSUInteger i, c, count;
-  
-  c = [self count];
+  return _bitmap.live - [self numberOfMessagesWithFlag: PantomimeFlagSeen];
+}
+
+
+//
+//
+//
+- (NSUInteger) numberOfMessagesWithFlag: (PantomimeFlag) theFlag
+{
+  NSUInteger c, i, count;
+
+  switch (theFlag)
+    {
+    case PantomimeFlagSeen:
+      return cw_bitmap_count(&_bitmap, CW_SEEN);
+    case PantomimeFlagDeleted:
+      return cw_bitmap_count(&_bitmap, CW_DELETED);
+    case PantomimeFlagFlagged:
+      return cw_bitmap_count(&_bitmap, CW_FLAGGED);
+    case PantomimeFlagAnswered:
+      return cw_bitmap_count(&_bitmap, CW_ANSWERED);
+    default:
+      break;
+    }
+
+  c = [_allMessages count];
   count = 0;
-  
+
   for (i = 0; i < c; i++)
     {
-      if (![[(CWMessage *) [_allMessages objectAtIndex: i] flags] contain: PantomimeFlagSeen])
+      if ([[(CWMessage *) [_allMessages objectAtIndex: i] flags] contain: theFlag])
 	{
 	  count++;
 	}
@@ -426,6 +575,24 @@
 //
 - (void) updateCache
 {
+  NSUInteger c, i;
+
+  // Flags of messages whose -folder is another folder (see CWVirtualFolder)
+  // are not observed by us, so we read them all again.
+  c = [_slotMessages count];
+
+  for (i = 0; i < c; i++)
+    {
+      id aMessage;
+
+      aMessage = [_slotMessages objectAtIndex: i];
+
+      if (aMessage != [NSNull null])
+	{
+	  cw_bitmap_set(&_bitmap, i, [[aMessage flags] rawFlags]);
+	}
+    }
+
   DESTROY(_allVisibleMessages);
 }
 
@@ -480,10 +647,13 @@
 {
   NSUInteger c, i;
 
+  //
+  // A message keeps the instance it is given, so each one gets its own.
+  //
   c = [theMessages count];
   for (i = 0; i < c; i++)
     {
-      [(CWMessage *) [theMessages objectAtIndex: i] setFlags: theFlags];
+      [(CWMessage *) [theMessages objectAtIndex: i] setFlags: AUTORELEASE([theFlags copy])];
     }
 }
 
@@ -514,3 +684,317 @@
 }
 
 @end
+
+//
+//
+//
+@implementation CWFolder (CWProtected)
+
+- (NSArray *) allMessagesIncludingHidden
+{
+  return _allMessages;
+}
+
+
+//
+//
+//
+- (void) addView: (CWFolderView *) theView
+{
+  [_views addObject: theView];
+}
+
+
+//
+//
+//
+- (void) removeView: (CWFolderView *) theView
+{
+  [_views removeObject: theView];
+}
+
+
+//
+//
+//
+- (void) message: (CWMessage *) theMessage  didChangeFlagsFrom: (PantomimeFlag) theOldFlags
+{
+  NSUInteger aSlot;
+  BOOL wasVisible, isVisible;
+
+  aSlot = [self _slotOfMessage: theMessage];
+
+  if (aSlot == NSNotFound)
+    {
+      return;
+    }
+
+  wasVisible = cw_bitmap_is_visible(&_bitmap, aSlot, _show_deleted, _show_read);
+  cw_bitmap_set(&_bitmap, aSlot, [[theMessage flags] rawFlags]);
+  isVisible = cw_bitmap_is_visible(&_bitmap, aSlot, _show_deleted, _show_read);
+
+  if (_allVisibleMessages && wasVisible != isVisible)
+    {
+      NSUInteger aRank;
+
+      aRank = cw_bitmap_rank(&_bitmap, aSlot, _show_deleted, _show_read);
+
+      if (isVisible)
+	{
+	  [_allVisibleMessages insertObject: theMessage  atIndex: aRank];
+	}
+      else
+	{
+	  [_allVisibleMessages removeObjectAtIndex: aRank];
+	}
+    }
+}
+
+@end
+
+//
+//
+//
+@implementation CWFolder (Private)
+
+- (NSUInteger) _slotOfMessage: (CWMessage *) theMessage
+{
+  NSUInteger aValue;
+
+  aValue = (NSUInteger)NSMapGet(_slotTable, (__bridge const void *)theMessage);
+
+  return (aValue ? aValue - 1 : NSNotFound);
+}
+
+
+//
+//
+//
+- (void) _addSlotForMessage: (CWMessage *) theMessage
+{
+  NSUInteger aSlot;
+
+  // The same message appended twice keeps its first slot.
+  if ([self _slotOfMessage: theMessage] != NSNotFound)
+    {
+      return;
+    }
+
+  if (_bitmap.slots == _bitmap.words * CW_WORD_BITS)
+    {
+      cw_bitmap_grow(&_bitmap);
+    }
+
+  aSlot = _bitmap.slots++;
+  _bitmap.live++;
+
+  NSMapInsert(_slotTable, (__bridge const void *)theMessage, (const void *)(aSlot + 1));
+  [_slotMessages addObject: theMessage];
+  cw_bitmap_set(&_bitmap, aSlot, [[theMessage flags] rawFlags]);
+}
+
+
+//
+// Frees the slot of a message, and compacts the slots once most of them are free.
+//
+- (NSUInteger) _removeSlotOfMessage: (CWMessage *) theMessage
+{
+  NSUInteger aSlot;
+
+  aSlot = [self _slotOfMessage: theMessage];
+
+  if (aSlot == NSNotFound)
+    {
+      return NSNotFound;
+    }
+
+  NSMapRemove(_slotTable, (__bridge const void *)theMessage);
+  [_slotMessages replaceObjectAtIndex: aSlot  withObject: [NSNull null]];
+  cw_bitmap_clear(&_bitmap, aSlot);
+  _bitmap.live--;
+
+  if (_bitmap.slots > CW_WORD_BITS && _bitmap.live < _bitmap.slots / 2)
+    {
+      [self _rebuildSlots];
+    }
+
+  return aSlot;
+}
+
+
+//
+// Slots are handed out in the order of _allMessages, which is what
+// -allMessages relies on.
+//
+- (void) _rebuildSlots
+{
+  NSUInteger c, i;
+
+  cw_bitmap_reset(&_bitmap);
+  NSResetMapTable(_slotTable);
+  [_slotMessages removeAllObjects];
+
+  c = [_allMessages count];
+
+  for (i = 0; i < c; i++)
+    {
+      [self _addSlotForMessage: [_allMessages objectAtIndex: i]];
+    }
+}
+
+@end
+
+//
+// C functions
+//
+static void cw_bitmap_reset(cw_flag_bitmap *theBitmap)
+{
+  if (theBitmap->bits)
+    {
+      memset(theBitmap->bits, 0, CW_BITMAP_COUNT * theBitmap->words * sizeof(NSUInteger));
+    }
+
+  theBitmap->slots = 0;
+  theBitmap->live = 0;
+}
+
+
+//
+// Doubles the number of words of every bitmap.
+//
+static void cw_bitmap_grow(cw_flag_bitmap *theBitmap)
+{
+  NSUInteger *bits, words, i;
+
+  words = (theBitmap->words ? theBitmap->words * 2 : 4);
+  bits = calloc(CW_BITMAP_COUNT * words, sizeof(NSUInteger));
+
+  if (!bits)
+    {
+      [NSException raise: NSMallocException  format: @"Unable to grow the flag bitmaps of the folder."];
+    }
+
+  for (i = 0; i < CW_BITMAP_COUNT && theBitmap->bits; i++)
+    {
+      memcpy(bits + i * words, cw_bitmap(theBitmap, i), theBitmap->words * sizeof(NSUInteger));
+    }
+
+  free(theBitmap->bits);
+  theBitmap->bits = bits;
+  theBitmap->words = words;
+}
+
+
+//
+//
+//
+static void cw_bitmap_set(cw_flag_bitmap *theBitmap, NSUInteger theSlot, PantomimeFlag theFlags)
+{
+  NSUInteger w, bit;
+
+  w = CW_WORD(theSlot);
+  bit = CW_BIT(theSlot);
+
+  cw_bitmap(theBitmap, CW_PRESENT)[w] |= bit;
+
+#define CW_SET_BIT(kind, flag) \
+  if (theFlags & flag) { cw_bitmap(theBitmap, kind)[w] |= bit; } \
+  else { cw_bitmap(theBitmap, kind)[w] &= ~bit; }
+
+  CW_SET_BIT(CW_SEEN, PantomimeFlagSeen);
+  CW_SET_BIT(CW_DELETED, PantomimeFlagDeleted);
+  CW_SET_BIT(CW_FLAGGED, PantomimeFlagFlagged);
+  CW_SET_BIT(CW_ANSWERED, PantomimeFlagAnswered);
+
+#undef CW_SET_BIT
+}
+
+
+//
+//
+//
+static void cw_bitmap_clear(cw_flag_bitmap *theBitmap, NSUInteger theSlot)
+{
+  NSUInteger i, w, bit;
+
+  w = CW_WORD(theSlot);
+  bit = CW_BIT(theSlot);
+
+  for (i = 0; i < CW_BITMAP_COUNT; i++)
+    {
+      cw_bitmap(theBitmap, i)[w] &= ~bit;
+    }
+}
+
+
+//
+// The visible slots of a word: deleted messages are hidden unless showDeleted
+// is set, read ones unless showRead is set. Deleted messages are only subject
+// to the first rule.
+//
+static NSUInteger cw_bitmap_visible(cw_flag_bitmap *theBitmap, NSUInteger theWord, BOOL showDeleted, BOOL showRead)
+{
+  NSUInteger aWord, deleted;
+
+  aWord = cw_bitmap(theBitmap, CW_PRESENT)[theWord];
+  deleted = cw_bitmap(theBitmap, CW_DELETED)[theWord];
+
+  if (!showDeleted)
+    {
+      aWord &= ~deleted;
+    }
+
+  if (!showRead)
+    {
+      aWord &= ~(cw_bitmap(theBitmap, CW_SEEN)[theWord] & ~deleted);
+    }
+
+  return aWord;
+}
+
+
+//
+//
+//
+static BOOL cw_bitmap_is_visible(cw_flag_bitmap *theBitmap, NSUInteger theSlot, BOOL showDeleted, BOOL showRead)
+{
+  return ((cw_bitmap_visible(theBitmap, CW_WORD(theSlot), showDeleted, showRead) & CW_BIT(theSlot)) != 0);
+}
+
+
+//
+// The number of visible slots before theSlot, that is the position
+// of theSlot in -allMessages.
+//
+static NSUInteger cw_bitmap_rank(cw_flag_bitmap *theBitmap, NSUInteger theSlot, BOOL showDeleted, BOOL showRead)
+{
+  NSUInteger w, rank;
+
+  rank = 0;
+
+  for (w = 0; w < CW_WORD(theSlot); w++)
+    {
+      rank += __builtin_popcountl(cw_bitmap_visible(theBitmap, w, showDeleted, showRead));
+    }
+
+  return rank + __builtin_popcountl(cw_bitmap_visible(theBitmap, w, showDeleted, showRead) & (CW_BIT(theSlot) - 1));
+}
+
+
+//
+//
+//
+static NSUInteger cw_bitmap_count(cw_flag_bitmap *theBitmap, NSUInteger theKind)
+{
+  NSUInteger *bits, w, count;
+
+  bits = cw_bitmap(theBitmap, theKind);
+  count = 0;
+
+  for (w = 0; w < theBitmap->words; w++)
+    {
+      count += __builtin_popcountl(bits[w]);
+    }
+
+  return count;
+}
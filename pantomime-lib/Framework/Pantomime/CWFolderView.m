@@ -0,0 +1,638 @@
+//
+//  CWFolderView.m
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWFolderView.h"
+
+#import "CWConstants.h"
+#import "CWFolder.h"
+#import "CWFolder+CWProtected.h"
+#import "CWInternetAddress.h"
+#import <PantomimeFramework/CWMessage.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+//
+// The packed sort key of a message. Records have a stable address;
+// the view sorts pointers to them.
+//
+typedef struct
+{
+  __unsafe_unretained CWMessage *message;
+  int64_t value;          // date, size or number
+  uint64_t prefix;        // first 8 bytes of key, big endian
+  NSUInteger number;      // tie breaker
+  NSUInteger length;
+  unsigned char *key;     // case-folded UTF-8, NULL if empty
+} cw_sort_record;
+
+typedef int (*cw_sort_compare)(const cw_sort_record *, const cw_sort_record *);
+
+
+//
+//
+//
+static inline int compare_number(const cw_sort_record *a, const cw_sort_record *b)
+{
+  return (a->number < b->number ? -1 : (a->number > b->number ? 1 : 0));
+}
+
+static int compare_value(const cw_sort_record *a, const cw_sort_record *b)
+{
+  if (a->value != b->value)
+    {
+      return (a->value < b->value ? -1 : 1);
+    }
+
+  return compare_number(a, b);
+}
+
+static int compare_key(const cw_sort_record *a, const cw_sort_record *b)
+{
+  int r;
+
+  if (a->prefix != b->prefix)
+    {
+      return (a->prefix < b->prefix ? -1 : 1);
+    }
+
+  if (a->length > 8 && b->length > 8)
+    {
+      r = memcmp(a->key + 8, b->key + 8, MIN(a->length, b->length) - 8);
+
+      if (r)
+	{
+	  return r;
+	}
+    }
+
+  if (a->length != b->length)
+    {
+      return (a->length < b->length ? -1 : 1);
+    }
+
+  return compare_number(a, b);
+}
+
+static int reverse_compare_value(const cw_sort_record *a, const cw_sort_record *b)
+{
+  return compare_value(b, a);
+}
+
+static int reverse_compare_key(const cw_sort_record *a, const cw_sort_record *b)
+{
+  return compare_key(b, a);
+}
+
+
+//
+// Bottom-up merge sort of the record pointers. Stable, O(n log n)
+// comparisons and no Objective-C messaging.
+//
+static void merge_sort(cw_sort_record **theRecords, NSUInteger theCount, cw_sort_compare theCompare)
+{
+  cw_sort_record **src, **dst, **tmp;
+  NSUInteger width, i;
+
+  if (theCount < 2)
+    {
+      return;
+    }
+
+  tmp = malloc(theCount * sizeof(cw_sort_record *));
+
+  if (!tmp)
+    {
+      [NSException raise: NSMallocException  format: @"Unable to sort the messages of the view."];
+    }
+
+  src = theRecords;
+  dst = tmp;
+
+  for (width = 1; width < theCount; width *= 2)
+    {
+      for (i = 0; i < theCount; i += 2*width)
+	{
+	  NSUInteger lo = i, mid = MIN(i+width, theCount), hi = MIN(i+2*width, theCount);
+	  NSUInteger a = lo, b = mid, k = lo;
+
+	  while (a < mid && b < hi)
+	    {
+	      dst[k++] = (theCompare(src[b], src[a]) < 0 ? src[b++] : src[a++]);
+	    }
+	  while (a < mid) dst[k++] = src[a++];
+	  while (b < hi) dst[k++] = src[b++];
+	}
+
+      tmp = src;
+      src = dst;
+      dst = tmp;
+    }
+
+  if (src != theRecords)
+    {
+      memcpy(theRecords, src, theCount * sizeof(cw_sort_record *));
+      free(src);
+    }
+  else
+    {
+      free(dst);
+    }
+}
+
+
+//
+//
+//
+@interface CWFolderView ()
+{
+  __weak CWFolder *_folder;
+  PantomimeSortCriterion _criterion;
+  BOOL _reverse;
+  cw_sort_compare _compare;
+
+  // message -> cw_sort_record *, messages are retained
+  NSMapTable *_records;
+
+  cw_sort_record **_sorted;
+  NSUInteger _count;
+  NSUInteger _capacity;
+
+  NSArray *_allMessages;
+}
+@end
+
+@interface CWFolderView (Private)
+
+- (void) _fillRecord: (cw_sort_record *) theRecord  message: (CWMessage *) theMessage;
+- (NSUInteger) _positionOfRecord: (cw_sort_record *) theRecord;
+- (NSUInteger) _indexOfRecord: (cw_sort_record *) theRecord;
+- (cw_sort_record *) _newRecord;
+- (void) _insertRecord: (cw_sort_record *) theRecord  atIndex: (NSUInteger) theIndex;
+- (void) _removeAllRecords;
+
+@end
+
+
+//
+//
+//
+@implementation CWFolderView
+
+- (instancetype) initWithFolder: (CWFolder *) theFolder
+                      criterion: (PantomimeSortCriterion) theCriterion
+                        reverse: (BOOL) theBOOL
+{
+  self = [super init];
+
+  if (self)
+    {
+      _folder = theFolder;
+      _records = NSCreateMapTable(NSObjectMapKeyCallBacks, NSNonOwnedPointerMapValueCallBacks, 128);
+      _criterion = theCriterion;
+      _reverse = theBOOL;
+
+      [theFolder addView: self];
+      [self setCriterion: theCriterion  reverse: theBOOL];
+    }
+
+  return self;
+}
+
+
+//
+//
+//
+- (void) dealloc
+{
+  [self _removeAllRecords];
+  free(_sorted);
+}
+
+
+//
+//
+//
+- (PantomimeSortCriterion) criterion
+{
+  return _criterion;
+}
+
+- (BOOL) isReverse
+{
+  return _reverse;
+}
+
+
+//
+// Only a change of criterion needs new keys. Reversing the order
+// only needs a new comparison function.
+//
+- (void) setCriterion: (PantomimeSortCriterion) theCriterion
+              reverse: (BOOL) theBOOL
+{
+  BOOL stringKey;
+
+  stringKey = (theCriterion == PantomimeSortBySender || theCriterion == PantomimeSortBySubject);
+
+  if (stringKey)
+    {
+      _compare = (theBOOL ? reverse_compare_key : compare_key);
+    }
+  else
+    {
+      _compare = (theBOOL ? reverse_compare_value : compare_value);
+    }
+
+  _reverse = theBOOL;
+
+  if (theCriterion != _criterion || !_sorted)
+    {
+      _criterion = theCriterion;
+      [self reload];
+      return;
+    }
+
+  merge_sort(_sorted, _count, _compare);
+  DESTROY(_allMessages);
+}
+
+
+//
+//
+//
+- (void) reload
+{
+  NSArray *allMessages;
+  NSUInteger i, count;
+
+  [self _removeAllRecords];
+
+  allMessages = [_folder allMessagesIncludingHidden];
+  count = [allMessages count];
+
+  if (count > _capacity || !_sorted)
+    {
+      free(_sorted);
+      _capacity = MAX(count, 64);
+      _sorted = malloc(_capacity * sizeof(cw_sort_record *));
+
+      if (!_sorted)
+	{
+	  _capacity = 0;
+	  [NSException raise: NSMallocException  format: @"Unable to allocate the records of the view."];
+	}
+    }
+
+  for (i = 0; i < count; i++)
+    {
+      CWMessage *aMessage = [allMessages objectAtIndex: i];
+      cw_sort_record *aRecord;
+
+      if (NSMapGet(_records, (__bridge const void *)aMessage))
+	{
+	  continue;
+	}
+
+      aRecord = [self _newRecord];
+      [self _fillRecord: aRecord  message: aMessage];
+      NSMapInsert(_records, (__bridge const void *)aMessage, aRecord);
+      _sorted[_count++] = aRecord;
+    }
+
+  merge_sort(_sorted, _count, _compare);
+  DESTROY(_allMessages);
+}
+
+
+//
+//
+//
+- (NSUInteger) count
+{
+  return _count;
+}
+
+
+//
+//
+//
+- (CWMessage *) messageAtIndex: (NSUInteger) theIndex
+{
+  if (theIndex >= _count)
+    {
+      return nil;
+    }
+
+  return _sorted[theIndex]->message;
+}
+
+
+//
+//
+//
+- (NSUInteger) indexOfMessage: (CWMessage *) theMessage
+{
+  cw_sort_record *aRecord;
+
+  aRecord = NSMapGet(_records, (__bridge const void *)theMessage);
+
+  if (!aRecord)
+    {
+      return NSNotFound;
+    }
+
+  return [self _indexOfRecord: aRecord];
+}
+
+
+//
+//
+//
+- (NSArray *) allMessages
+{
+  if (!_allMessages)
+    {
+      NSMutableArray *aMutableArray;
+      NSUInteger i;
+
+      aMutableArray = [[NSMutableArray alloc] initWithCapacity: _count];
+
+      for (i = 0; i < _count; i++)
+	{
+	  [aMutableArray addObject: _sorted[i]->message];
+	}
+
+      _allMessages = aMutableArray;
+    }
+
+  return _allMessages;
+}
+
+
+//
+//
+//
+- (NSUInteger) insertMessage: (CWMessage *) theMessage
+{
+  cw_sort_record *aRecord;
+  NSUInteger index;
+
+  aRecord = NSMapGet(_records, (__bridge const void *)theMessage);
+
+  if (aRecord)
+    {
+      return [self _indexOfRecord: aRecord];
+    }
+
+  aRecord = [self _newRecord];
+  [self _fillRecord: aRecord  message: theMessage];
+
+  index = [self _positionOfRecord: aRecord];
+  [self _insertRecord: aRecord  atIndex: index];
+  NSMapInsert(_records, (__bridge const void *)theMessage, aRecord);
+
+  return index;
+}
+
+
+//
+//
+//
+- (NSUInteger) removeMessage: (CWMessage *) theMessage
+{
+  cw_sort_record *aRecord;
+  NSUInteger index;
+
+  aRecord = NSMapGet(_records, (__bridge const void *)theMessage);
+
+  if (!aRecord)
+    {
+      return NSNotFound;
+    }
+
+  index = [self _indexOfRecord: aRecord];
+
+  if (index != NSNotFound)
+    {
+      memmove(&_sorted[index], &_sorted[index+1], (_count - index - 1) * sizeof(cw_sort_record *));
+      _count--;
+    }
+
+  NSMapRemove(_records, (__bridge const void *)theMessage);
+  free(aRecord->key);
+  free(aRecord);
+  DESTROY(_allMessages);
+
+  return index;
+}
+
+
+//
+//
+//
+- (void) updateMessage: (CWMessage *) theMessage
+{
+  if ([self removeMessage: theMessage] != NSNotFound)
+    {
+      [self insertMessage: theMessage];
+    }
+}
+
+@end
+
+
+//
+// Private methods
+//
+@implementation CWFolderView (Private)
+
+- (void) _fillRecord: (cw_sort_record *) theRecord  message: (CWMessage *) theMessage
+{
+  NSString *aString;
+
+  free(theRecord->key);
+  memset(theRecord, 0, sizeof(cw_sort_record));
+
+  theRecord->message = theMessage;
+  theRecord->number = [theMessage messageNumber];
+  aString = nil;
+
+  switch (_criterion)
+    {
+    case PantomimeSortByDate:
+      theRecord->value = ([theMessage originationDate] ? (int64_t)[[theMessage originationDate] timeIntervalSince1970] : INT64_MIN);
+      break;
+
+    case PantomimeSortBySize:
+      theRecord->value = [theMessage size];
+      break;
+
+    case PantomimeSortBySender:
+      aString = [[theMessage from] personal];
+
+      if (![aString length])
+	{
+	  aString = [[theMessage from] address];
+	}
+      break;
+
+    case PantomimeSortBySubject:
+      aString = [theMessage baseSubject];
+      break;
+
+    case PantomimeSortByNumber:
+    default:
+      theRecord->value = (int64_t)theRecord->number;
+      break;
+    }
+
+  if ([aString length])
+    {
+      const char *bytes;
+      NSUInteger i;
+
+      aString = [aString stringByFoldingWithOptions: NSCaseInsensitiveSearch  locale: nil];
+      bytes = [aString UTF8String];
+      theRecord->length = strlen(bytes);
+      theRecord->key = malloc(theRecord->length);
+
+      if (!theRecord->key)
+	{
+	  theRecord->length = 0;
+	  [NSException raise: NSMallocException  format: @"Unable to allocate the sort key of a message."];
+	}
+
+      memcpy(theRecord->key, bytes, theRecord->length);
+
+      for (i = 0; i < 8; i++)
+	{
+	  theRecord->prefix = (theRecord->prefix << 8) | (i < theRecord->length ? theRecord->key[i] : 0);
+	}
+    }
+}
+
+
+//
+// Upper bound: equal records keep their insertion order.
+//
+- (NSUInteger) _positionOfRecord: (cw_sort_record *) theRecord
+{
+  NSUInteger lo, hi;
+
+  lo = 0;
+  hi = _count;
+
+  while (lo < hi)
+    {
+      NSUInteger mid = lo + (hi - lo) / 2;
+
+      if (_compare(theRecord, _sorted[mid]) < 0)
+	{
+	  hi = mid;
+	}
+      else
+	{
+	  lo = mid + 1;
+	}
+    }
+
+  return lo;
+}
+
+
+//
+// Records are only compared by their stored keys, so the one we look
+// for sits right before its upper bound, next to the ones equal to it.
+//
+- (NSUInteger) _indexOfRecord: (cw_sort_record *) theRecord
+{
+  NSUInteger index;
+
+  index = [self _positionOfRecord: theRecord];
+
+  while (index > 0 && _compare(theRecord, _sorted[index-1]) == 0)
+    {
+      if (_sorted[--index] == theRecord)
+	{
+	  return index;
+	}
+    }
+
+  return NSNotFound;
+}
+
+
+//
+//
+//
+- (cw_sort_record *) _newRecord
+{
+  cw_sort_record *aRecord;
+
+  aRecord = calloc(1, sizeof(cw_sort_record));
+
+  if (!aRecord)
+    {
+      [NSException raise: NSMallocException  format: @"Unable to allocate the records of the view."];
+    }
+
+  return aRecord;
+}
+
+
+//
+//
+//
+- (void) _insertRecord: (cw_sort_record *) theRecord  atIndex: (NSUInteger) theIndex
+{
+  if (_count == _capacity)
+    {
+      cw_sort_record **aBuffer;
+
+      aBuffer = realloc(_sorted, (_capacity ? _capacity * 2 : 64) * sizeof(cw_sort_record *));
+
+      //
+      // The record is not in _records yet, so we only have to free it.
+      //
+      if (!aBuffer)
+	{
+	  free(theRecord->key);
+	  free(theRecord);
+	  [NSException raise: NSMallocException  format: @"Unable to grow the records of the view."];
+	}
+
+      _sorted = aBuffer;
+      _capacity = (_capacity ? _capacity * 2 : 64);
+    }
+
+  memmove(&_sorted[theIndex+1], &_sorted[theIndex], (_count - theIndex) * sizeof(cw_sort_record *));
+  _sorted[theIndex] = theRecord;
+  _count++;
+  DESTROY(_allMessages);
+}
+
+
+//
+//
+//
+- (void) _removeAllRecords
+{
+  NSUInteger i;
+
+  for (i = 0; i < _count; i++)
+    {
+      free(_sorted[i]->key);
+      free(_sorted[i]);
+    }
+
+  _count = 0;
+  NSResetMapTable(_records);
+  DESTROY(_allMessages);
+}
+
+@end
@@ -27,12 +27,17 @@
 #import "CWFlags.h"
 #import "CWIMAPStore+Protected.h"
 #import "CWIMAPMessage.h"
-#import <PlanckToolboxForExtensions/PEPLogger.h>
+#import "CWLogger.h"
 #import "NSData+Extensions.h"
 #import "Pantomime/NSString+Extensions.h"
 
 #import "NSDate+StringRepresentation.h"
 
+//
+// The most messages, and about the most bytes, sent in one MULTIAPPEND.
+//
+#define MULTIAPPEND_MAX_MESSAGES 100
+#define MULTIAPPEND_MAX_SIZE (8 * 1024 * 1024)
 
 
 @interface CWIMAPFolder ()
@@ -60,6 +65,10 @@
 
 - (NSData *) _removeInvalidHeadersFromMessage: (NSData *) theMessage;
 
+- (void) _appendMessagesFromRawSources: (NSArray *) theRawSources
+                                 flags: (NSArray *) theFlags
+                         internalDates: (NSArray *) theDates;
+
 @end
 
 
@@ -109,37 +118,52 @@
                              flags:(CWFlags * _Nullable)flags
                       internalDate:(NSDate * _Nullable)date;
 {
-    NSString *flagsAsString = @"";
-    if (flags) {
-        flagsAsString = [flags asString];
-    }
+    [self _appendMessagesFromRawSources: @[rawSource]
+                                  flags: (flags ? @[flags] : nil)
+                          internalDates: (date ? @[date] : nil)];
+}
 
-    // We remove any invalid headers from our message
-    NSData *dataToAppend = [self _removeInvalidHeadersFromMessage: rawSource];
+- (void)appendMessagesFromRawSources:(NSArray<NSData *> *)rawSources
+                               flags:(NSArray<CWFlags *> * _Nullable)flags
+                       internalDates:(NSArray<NSDate *> * _Nullable)dates
+{
+    NSUInteger i, start, size, count;
 
-    NSDictionary *aDictionary;
-    if (flags) {
-        aDictionary = @{@"NSDataToAppend":dataToAppend,
-                        @"NSData":rawSource,
-                        @"Folder":self,
-                        PantomimeFlagsKey:flags};
-    } else {
-        aDictionary = @{@"NSDataToAppend":dataToAppend,
-                        @"NSData":rawSource,
-                        @"Folder":self};
-    }
-    if (!date) {
-        date = [NSDate new];
+    NSParameterAssert(!flags || [flags count] == [rawSources count]);
+    NSParameterAssert(!dates || [dates count] == [rawSources count]);
+
+    count = [rawSources count];
+
+    if (![_store supportsMultiAppend])
+    {
+        for (i = 0; i < count; i++)
+        {
+            [self appendMessageFromRawSource: [rawSources objectAtIndex: i]
+                                       flags: [flags objectAtIndex: i]
+                                internalDate: [dates objectAtIndex: i]];
+        }
+        return;
     }
-    NSAssert(date, @"Must not be nil");
 
-    [_store sendCommand: IMAP_APPEND
-                   info: aDictionary
-              arguments: @"APPEND \"%@\" (%@) \"%@\" {%d}", // IMAP command
-     [_name modifiedUTF7String],                            // folder name
-     flagsAsString,                                         // flags
-     [date dateTimeString],                                 // Internal date
-     [dataToAppend length]];                                // length of the data to write
+    //
+    // A MULTIAPPEND is atomic, the server keeps all of its messages or none.
+    // We bound what a failure costs, and what the server must buffer.
+    //
+    for (i = start = size = 0; i < count; i++)
+    {
+        size += [[rawSources objectAtIndex: i] length];
+
+        if (i + 1 == count || i + 1 - start == MULTIAPPEND_MAX_MESSAGES || size >= MULTIAPPEND_MAX_SIZE)
+        {
+            NSRange aRange = NSMakeRange(start, i + 1 - start);
+
+            [self _appendMessagesFromRawSources: [rawSources subarrayWithRange: aRange]
+                                          flags: [flags subarrayWithRange: aRange]
+                                  internalDates: [dates subarrayWithRange: aRange]];
+            start = i + 1;
+            size = 0;
+        }
+    }
 }
 
 #pragma mark - UID COPY
@@ -768,6 +792,98 @@
 }
 
 
+//
+// Sends one APPEND for the messages, a MULTIAPPEND (RFC 3502) if there
+// are several:
+//
+// APPEND "INBOX" (\Seen) "19-Oct-2026 10:15:27 +0000" {310}
+// <310 bytes> (\Seen) "19-Oct-2026 10:15:27 +0000" {1205}
+// <1205 bytes>
+//
+// The literals are non-synchronizing ({310+}) if the server allows all
+// of them to be. The store then sends them along with the command and
+// the APPEND costs a single round trip. Otherwise, the store sends each
+// literal once the server asks for it.
+//
+- (void) _appendMessagesFromRawSources: (NSArray *) theRawSources
+                                 flags: (NSArray *) theFlags
+                         internalDates: (NSArray *) theDates
+{
+    NSMutableArray *allLiterals, *allContinuations;
+    NSMutableDictionary *aDictionary;
+    NSMutableString *aCommand;
+    NSUInteger i, count;
+    BOOL nonSynchronizing;
+
+    count = [theRawSources count];
+    allLiterals = [NSMutableArray arrayWithCapacity: count];
+    allContinuations = [NSMutableArray arrayWithCapacity: count];
+    aCommand = [NSMutableString stringWithFormat: @"APPEND \"%@\"", [_name modifiedUTF7String]];
+    nonSynchronizing = YES;
+
+    for (i = 0; i < count; i++)
+    {
+        // We remove any invalid headers from our message
+        NSData *dataToAppend = [self _removeInvalidHeadersFromMessage: [theRawSources objectAtIndex: i]];
+
+        nonSynchronizing = nonSynchronizing && [_store supportsNonSynchronizingLiteralOfLength: [dataToAppend length]];
+        [allLiterals addObject: dataToAppend];
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        CWFlags *aFlags = [theFlags objectAtIndex: i];
+        NSDate *aDate = [theDates objectAtIndex: i];
+        NSString *aString;
+
+        if (!aDate)
+        {
+            aDate = [NSDate new];
+        }
+
+        aString = [NSString stringWithFormat: @" (%@) \"%@\" {%lu%@}",
+                   (aFlags ? [aFlags asString] : @""),           // flags
+                   [aDate dateTimeString],                         // Internal date
+                   (unsigned long) [[allLiterals objectAtIndex: i] length],
+                   (nonSynchronizing ? @"+" : @"")];
+
+        if (i == 0)
+        {
+            [aCommand appendString: aString];
+        }
+        else
+        {
+            [allContinuations addObject: aString];
+        }
+    }
+
+    [allContinuations addObject: @""];
+
+    aDictionary = [NSMutableDictionary dictionaryWithObjectsAndKeys:
+                   self, @"Folder",
+                   allLiterals, @"Literals",
+                   allContinuations, @"Continuations",
+                   [NSNumber numberWithBool: nonSynchronizing], @"NonSynchronizing", nil];
+
+    if (count == 1)
+    {
+        [aDictionary setObject: [allLiterals lastObject]  forKey: @"NSDataToAppend"];
+        [aDictionary setObject: [theRawSources lastObject]  forKey: @"NSData"];
+
+        if ([theFlags lastObject])
+        {
+            [aDictionary setObject: [theFlags lastObject]  forKey: PantomimeFlagsKey];
+        }
+    }
+    else
+    {
+        [aDictionary setObject: theRawSources  forKey: @"Messages"];
+    }
+
+    [_store sendCommand: IMAP_APPEND  info: aDictionary  arguments: @"%@", aCommand];
+}
+
+
 //
 //
 //
@@ -0,0 +1,888 @@
+//
+//  CWIMAPMappedCache.m
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWIMAPMappedCache.h"
+
+#import "CWCacheRecord.h"
+#import "CWConstants.h"
+#import "CWFlags.h"
+#import "CWFolder.h"
+#import "CWIMAPMessage.h"
+#import "CWIMAPStore.h"
+#import "CWParser.h"
+
+#import "CWLogger.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define CACHE_MAGIC "PCM1"
+#define CACHE_VERSION 1
+#define CACHE_INITIAL_CAPACITY 1024
+
+// Set in cw_cache_entry.flags for records removed but not expunged yet.
+#define CACHE_TOMBSTONE 0x80000000u
+
+//
+// The string fields of a record, in the order they are stored.
+//
+enum {
+  CACHE_FROM = 0,
+  CACHE_IN_REPLY_TO,
+  CACHE_MESSAGE_ID,
+  CACHE_REFERENCES,
+  CACHE_SUBJECT,
+  CACHE_TO,
+  CACHE_CC,
+  CACHE_STRING_COUNT
+};
+
+//
+// On-disk layout. Both structures are naturally aligned, so their size
+// does not depend on the compiler packing rules. All values are stored
+// in host byte order; the cache is never shared between hosts.
+//
+typedef struct
+{
+  char magic[4];
+  uint32_t version;
+  uint32_t record_size;
+  uint32_t uid_validity;
+  uint64_t capacity;     // slots available in the file
+  uint64_t count;        // slots in use, tombstones included
+  uint64_t live;         // slots in use, tombstones excluded
+  uint64_t heap_length;  // valid bytes in the string heap
+  uint8_t reserved[16];
+} cw_cache_header;
+
+typedef struct
+{
+  uint32_t uid;
+  uint32_t flags;
+  int64_t date;
+  uint64_t size;
+  uint64_t offset[CACHE_STRING_COUNT];
+  uint32_t length[CACHE_STRING_COUNT];
+  uint32_t reserved;
+} cw_cache_entry;
+
+_Static_assert(sizeof(cw_cache_header) == 64, "cw_cache_header must be 64 bytes");
+_Static_assert(sizeof(cw_cache_entry) == 112, "cw_cache_entry must be 112 bytes");
+
+
+//
+//
+//
+@interface CWIMAPMappedCache ()
+{
+  NSString *_path;
+  __weak CWFolder *_folder;
+
+  // Messages materialized so far, by UID
+  NSMutableDictionary<NSNumber *, CWIMAPMessage *> *_messages;
+
+  int _fd;
+  size_t _map_length;
+  cw_cache_header *_header;
+  cw_cache_entry *_entries;
+
+  int _heap_fd;
+  size_t _heap_map_length;
+  const char *_heap;
+
+  // Range of entries modified since the last -synchronize
+  NSUInteger _dirty_lo;
+  NSUInteger _dirty_hi;
+}
+@end
+
+
+//
+//
+//
+@interface CWIMAPMappedCache (Private)
+
+- (BOOL) _mapWithCapacity: (uint64_t) theCapacity;
+- (NSUInteger) _indexOfUID: (NSUInteger) theUID;
+- (NSUInteger) _insertionIndexOfUID: (NSUInteger) theUID;
+- (void) _markDirty: (NSUInteger) theIndex;
+- (void) _compact;
+- (void) _writeBackFlags;
+- (BOOL) _appendToHeap: (NSData *) theData  offset: (uint64_t *) theOffset;
+- (void) _validateEntries;
+- (const char *) _bytesAtOffset: (uint64_t) theOffset  length: (uint32_t) theLength;
+- (NSData *) _dataForField: (int) theField  entry: (cw_cache_entry *) theEntry;
+- (CWIMAPMessage *) _messageFromEntry: (cw_cache_entry *) theEntry;
+
+@end
+
+
+//
+//
+//
+@implementation CWIMAPMappedCache
+
+- (instancetype) initWithPath: (NSString *) thePath
+                       folder: (CWFolder *) theFolder
+{
+  struct stat st;
+
+  self = [super init];
+  if (!self)
+    {
+      return nil;
+    }
+
+  _path = [thePath copy];
+  _folder = theFolder;
+  _messages = [[NSMutableDictionary alloc] init];
+  _fd = _heap_fd = -1;
+  _dirty_lo = NSNotFound;
+  _dirty_hi = 0;
+
+  _fd = open([_path fileSystemRepresentation], O_RDWR|O_CREAT, 0600);
+  _heap_fd = open([[_path stringByAppendingPathExtension: @"strings"] fileSystemRepresentation], O_RDWR|O_CREAT, 0600);
+
+  if (_fd < 0 || _heap_fd < 0 || fstat(_fd, &st) < 0)
+    {
+      LogError(@"CWIMAPMappedCache: unable to open %@ (%s)", _path, strerror(errno));
+      return nil;
+    }
+
+  if (st.st_size > 0)
+    {
+      cw_cache_header h;
+
+      if (pread(_fd, &h, sizeof(h), 0) == sizeof(h) &&
+          memcmp(h.magic, CACHE_MAGIC, 4) == 0 &&
+          h.version == CACHE_VERSION &&
+          h.record_size == sizeof(cw_cache_entry) &&
+          h.count <= h.capacity &&
+          h.live <= h.count &&
+          (off_t)(sizeof(cw_cache_header) + h.capacity * sizeof(cw_cache_entry)) <= st.st_size)
+        {
+          if (![self _mapWithCapacity: h.capacity])
+            {
+              return nil;
+            }
+
+          // Drop whatever was appended to the heap after the last successful synchronize.
+          [self _validateEntries];
+          ftruncate(_heap_fd, (off_t)_header->heap_length);
+
+          return self;
+        }
+
+      LogWarn(@"CWIMAPMappedCache: discarding corrupted cache at %@", _path);
+      ftruncate(_fd, 0);
+    }
+
+  if (![self _mapWithCapacity: CACHE_INITIAL_CAPACITY])
+    {
+      return nil;
+    }
+
+  memcpy(_header->magic, CACHE_MAGIC, 4);
+  _header->version = CACHE_VERSION;
+  _header->record_size = sizeof(cw_cache_entry);
+  ftruncate(_heap_fd, 0);
+
+  return self;
+}
+
+
+//
+//
+//
+- (void) dealloc
+{
+  if (_header)
+    {
+      [self synchronize];
+      munmap(_header, _map_length);
+    }
+
+  if (_heap) munmap((void *)_heap, _heap_map_length);
+  if (_fd >= 0) close(_fd);
+  if (_heap_fd >= 0) close(_heap_fd);
+}
+
+
+//
+//
+//
+- (NSString *) path
+{
+  return _path;
+}
+
+
+//
+// CWCache protocol
+//
+- (NSUInteger) count
+{
+  @synchronized(self)
+    {
+      return (NSUInteger)_header->live;
+    }
+}
+
+
+//
+//
+//
+- (void) invalidate
+{
+  @synchronized(self)
+    {
+      [_messages removeAllObjects];
+
+      if (_heap)
+        {
+          munmap((void *)_heap, _heap_map_length);
+          _heap = NULL;
+          _heap_map_length = 0;
+        }
+      ftruncate(_heap_fd, 0);
+
+      _header->count = 0;
+      _header->live = 0;
+      _header->heap_length = 0;
+      _dirty_lo = NSNotFound;
+      _dirty_hi = 0;
+      msync(_header, sizeof(cw_cache_header), MS_SYNC);
+    }
+}
+
+
+//
+// Only the pages holding modified entries are written back. The heap is
+// append-only and written with pwrite(), so an fsync() is enough for it
+// and is done before the entries referencing it reach the disk.
+//
+- (BOOL) synchronize
+{
+  @synchronized(self)
+    {
+      BOOL ok = YES;
+
+      [self _writeBackFlags];
+
+      if (_header->count - _header->live > _header->count / 4)
+        {
+          [self _compact];
+        }
+
+      if (_dirty_lo != NSNotFound)
+        {
+          size_t page = (size_t)getpagesize();
+          size_t start = sizeof(cw_cache_header) + _dirty_lo * sizeof(cw_cache_entry);
+          size_t end = sizeof(cw_cache_header) + _dirty_hi * sizeof(cw_cache_entry);
+
+          start -= start % page;
+          if (end > _map_length) end = _map_length;
+
+          if (fsync(_heap_fd) < 0 ||
+              msync((char *)_header + start, end - start, MS_SYNC) < 0)
+            {
+              ok = NO;
+            }
+
+          _dirty_lo = NSNotFound;
+          _dirty_hi = 0;
+        }
+
+      if (msync(_header, sizeof(cw_cache_header), MS_SYNC) < 0)
+        {
+          ok = NO;
+        }
+
+      if (!ok)
+        {
+          LogError(@"CWIMAPMappedCache: unable to synchronize %@ (%s)", _path, strerror(errno));
+        }
+
+      return ok;
+    }
+}
+
+
+//
+// CWIMAPCache protocol
+//
+- (CWIMAPMessage *) messageWithUID: (NSUInteger) theUID
+{
+  @synchronized(self)
+    {
+      CWIMAPMessage *aMessage;
+      NSUInteger index;
+
+      aMessage = [_messages objectForKey: [NSNumber numberWithUnsignedInteger: theUID]];
+
+      if (aMessage)
+        {
+          return aMessage;
+        }
+
+      index = [self _indexOfUID: theUID];
+
+      if (index == NSNotFound || (_entries[index].flags & CACHE_TOMBSTONE))
+        {
+          return nil;
+        }
+
+      aMessage = [self _messageFromEntry: &_entries[index]];
+      [_messages setObject: aMessage  forKey: [NSNumber numberWithUnsignedInteger: theUID]];
+
+      return aMessage;
+    }
+}
+
+
+//
+//
+//
+- (void) removeMessageWithUID: (NSUInteger) theUID
+{
+  @synchronized(self)
+    {
+      NSUInteger index;
+
+      [_messages removeObjectForKey: [NSNumber numberWithUnsignedInteger: theUID]];
+
+      index = [self _indexOfUID: theUID];
+
+      if (index != NSNotFound && !(_entries[index].flags & CACHE_TOMBSTONE))
+        {
+          _entries[index].flags |= CACHE_TOMBSTONE;
+          _header->live--;
+          [self _markDirty: index];
+        }
+    }
+}
+
+
+//
+//
+//
+- (void) expunge
+{
+  @synchronized(self)
+    {
+      if (_header->live != _header->count)
+        {
+          [self _compact];
+        }
+    }
+}
+
+
+//
+//
+//
+- (NSUInteger) UIDValidity
+{
+  // _header moves when the file is grown or compacted.
+  @synchronized(self)
+    {
+      return _header->uid_validity;
+    }
+}
+
+- (void) setUIDValidity: (NSUInteger) theUIDValidity
+{
+  @synchronized(self)
+    {
+      _header->uid_validity = (uint32_t)theUIDValidity;
+    }
+}
+
+
+//
+//
+//
+- (void) writeRecord: (CWCacheRecord *) theRecord  message: (id) theMessage
+{
+  [self writeRecord: theRecord  message: theMessage  messageUpdate: [CWMessageUpdate newComplete]];
+}
+
+
+//
+// Nil or zero values in theRecord leave the stored ones untouched, since
+// records built for flags-only FETCH responses carry nothing else.
+//
+- (void) writeRecord: (CWCacheRecord *) theRecord
+             message: (CWIMAPMessage *) theMessage
+       messageUpdate: (CWMessageUpdate *) theMessageUpdate
+{
+  @synchronized(self)
+    {
+      cw_cache_entry *entry;
+      NSUInteger index, uid;
+      NSData *allStrings[CACHE_STRING_COUNT];
+      int i;
+
+      uid = [theMessage UID];
+
+      if (uid == 0 || [theMessageUpdate isMsnOnly])
+        {
+          return;
+        }
+
+      [_messages setObject: theMessage  forKey: [NSNumber numberWithUnsignedInteger: uid]];
+
+      index = [self _insertionIndexOfUID: uid];
+
+      if (index == NSNotFound)
+        {
+          return;
+        }
+
+      entry = &_entries[index];
+      entry->flags = [[theMessage flags] rawFlags];
+
+      if (!theRecord)
+        {
+          [self _markDirty: index];
+          return;
+        }
+
+      if (theRecord.date) entry->date = (int64_t)theRecord.date;
+      if (theRecord.size) entry->size = theRecord.size;
+
+      allStrings[CACHE_FROM] = theRecord.from;
+      allStrings[CACHE_IN_REPLY_TO] = theRecord.in_reply_to;
+      allStrings[CACHE_MESSAGE_ID] = theRecord.message_id;
+      allStrings[CACHE_REFERENCES] = theRecord.references;
+      allStrings[CACHE_SUBJECT] = theRecord.subject;
+      allStrings[CACHE_TO] = theRecord.to;
+      allStrings[CACHE_CC] = theRecord.cc;
+
+      for (i = 0; i < CACHE_STRING_COUNT; i++)
+        {
+          NSData *aData = allStrings[i];
+
+          if (!aData)
+            {
+              continue;
+            }
+
+          // Re-fetching unchanged headers must not grow the heap.
+          if (entry->length[i] == [aData length])
+            {
+              const char *bytes = [self _bytesAtOffset: entry->offset[i]  length: entry->length[i]];
+
+              if (bytes && memcmp(bytes, [aData bytes], entry->length[i]) == 0)
+                {
+                  continue;
+                }
+            }
+
+          // A field we could not store is left empty rather than pointing at bytes that are not there.
+          if (![self _appendToHeap: aData  offset: &entry->offset[i]])
+            {
+              entry->offset[i] = 0;
+              entry->length[i] = 0;
+              continue;
+            }
+
+          entry->length[i] = (uint32_t)[aData length];
+        }
+
+      [self _markDirty: index];
+    }
+}
+
+@end
+
+
+//
+// Private methods
+//
+@implementation CWIMAPMappedCache (Private)
+
+- (BOOL) _mapWithCapacity: (uint64_t) theCapacity
+{
+  size_t length = sizeof(cw_cache_header) + theCapacity * sizeof(cw_cache_entry);
+  void *p;
+
+  if (_header)
+    {
+      munmap(_header, _map_length);
+      _header = NULL;
+      _entries = NULL;
+    }
+
+  if (ftruncate(_fd, length) < 0)
+    {
+      LogError(@"CWIMAPMappedCache: unable to grow %@ (%s)", _path, strerror(errno));
+      return NO;
+    }
+
+  p = mmap(NULL, length, PROT_READ|PROT_WRITE, MAP_SHARED, _fd, 0);
+
+  if (p == MAP_FAILED)
+    {
+      LogError(@"CWIMAPMappedCache: unable to map %@ (%s)", _path, strerror(errno));
+      return NO;
+    }
+
+  _map_length = length;
+  _header = (cw_cache_header *)p;
+  _entries = (cw_cache_entry *)((char *)p + sizeof(cw_cache_header));
+  _header->capacity = theCapacity;
+
+  return YES;
+}
+
+
+//
+// Binary search over the sorted entries, tombstones included.
+//
+- (NSUInteger) _indexOfUID: (NSUInteger) theUID
+{
+  NSUInteger lo, hi;
+
+  lo = 0;
+  hi = (NSUInteger)_header->count;
+
+  while (lo < hi)
+    {
+      NSUInteger mid = lo + (hi - lo) / 2;
+
+      if (_entries[mid].uid < theUID)
+        {
+          lo = mid + 1;
+        }
+      else
+        {
+          hi = mid;
+        }
+    }
+
+  if (lo < _header->count && _entries[lo].uid == theUID)
+    {
+      return lo;
+    }
+
+  return NSNotFound;
+}
+
+
+//
+// Returns the index of the entry for theUID, creating it if needed. New
+// mail arrives in ascending UID order, so appending is the common case;
+// anything else shifts the tail of the file.
+//
+- (NSUInteger) _insertionIndexOfUID: (NSUInteger) theUID
+{
+  NSUInteger index, count;
+
+  count = (NSUInteger)_header->count;
+
+  if (count == 0 || _entries[count-1].uid < theUID)
+    {
+      index = count;
+    }
+  else
+    {
+      NSUInteger lo = 0, hi = count;
+
+      while (lo < hi)
+        {
+          NSUInteger mid = lo + (hi - lo) / 2;
+
+          if (_entries[mid].uid < theUID) lo = mid + 1; else hi = mid;
+        }
+
+      index = lo;
+
+      if (_entries[index].uid == theUID)
+        {
+          if (_entries[index].flags & CACHE_TOMBSTONE)
+            {
+              memset(&_entries[index], 0, sizeof(cw_cache_entry));
+              _entries[index].uid = (uint32_t)theUID;
+              _header->live++;
+            }
+          return index;
+        }
+    }
+
+  if (count == _header->capacity && ![self _mapWithCapacity: _header->capacity * 2])
+    {
+      return NSNotFound;
+    }
+
+  if (index < count)
+    {
+      memmove(&_entries[index+1], &_entries[index], (count - index) * sizeof(cw_cache_entry));
+      [self _markDirty: count];
+    }
+
+  memset(&_entries[index], 0, sizeof(cw_cache_entry));
+  _entries[index].uid = (uint32_t)theUID;
+  _header->count++;
+  _header->live++;
+
+  return index;
+}
+
+
+//
+//
+//
+- (void) _markDirty: (NSUInteger) theIndex
+{
+  if (_dirty_lo == NSNotFound || theIndex < _dirty_lo) _dirty_lo = theIndex;
+  if (theIndex + 1 > _dirty_hi) _dirty_hi = theIndex + 1;
+}
+
+
+//
+// Drops tombstones in place. Heap space used by removed entries is
+// not reclaimed; -invalidate is the only way to shrink the heap.
+//
+- (void) _compact
+{
+  NSUInteger i, j, count;
+
+  count = (NSUInteger)_header->count;
+
+  for (i = 0; i < count && !(_entries[i].flags & CACHE_TOMBSTONE); i++);
+
+  if (i == count)
+    {
+      return;
+    }
+
+  [self _markDirty: i];
+  [self _markDirty: count - 1];
+
+  for (j = i; i < count; i++)
+    {
+      if (!(_entries[i].flags & CACHE_TOMBSTONE))
+        {
+          _entries[j++] = _entries[i];
+        }
+    }
+
+  _header->count = j;
+  _header->live = j;
+}
+
+
+//
+// CWFlags are mutated directly by CWIMAPStore when FETCH and SEARCH
+// responses come in, so we pick the current values up before flushing.
+//
+- (void) _writeBackFlags
+{
+  NSEnumerator *theEnumerator;
+  CWIMAPMessage *aMessage;
+
+  theEnumerator = [_messages objectEnumerator];
+
+  while ((aMessage = [theEnumerator nextObject]))
+    {
+      NSUInteger index = [self _indexOfUID: [aMessage UID]];
+      uint32_t flags;
+
+      if (index == NSNotFound || (_entries[index].flags & CACHE_TOMBSTONE))
+        {
+          continue;
+        }
+
+      flags = (uint32_t)[[aMessage flags] rawFlags];
+
+      if (_entries[index].flags != flags)
+        {
+          _entries[index].flags = flags;
+          [self _markDirty: index];
+        }
+    }
+}
+
+
+//
+// On failure, the heap is cut back to its previous length.
+//
+- (BOOL) _appendToHeap: (NSData *) theData  offset: (uint64_t *) theOffset
+{
+  uint64_t offset = _header->heap_length;
+  const char *bytes = [theData bytes];
+  size_t length = [theData length];
+
+  while (length)
+    {
+      ssize_t n = pwrite(_heap_fd, bytes, length, (off_t)(offset + ([theData length] - length)));
+
+      if (n < 0)
+        {
+          if (errno == EINTR) continue;
+          LogError(@"CWIMAPMappedCache: unable to write to the heap of %@ (%s)", _path, strerror(errno));
+          ftruncate(_heap_fd, (off_t)offset);
+          return NO;
+        }
+
+      bytes += n;
+      length -= n;
+    }
+
+  _header->heap_length += [theData length];
+  *theOffset = offset;
+
+  return YES;
+}
+
+
+//
+// The heap may be shorter than recorded if it was not written back
+// entirely before a crash. Fields pointing past its end are emptied.
+//
+- (void) _validateEntries
+{
+  struct stat st;
+  NSUInteger i, count;
+  int j;
+
+  if (fstat(_heap_fd, &st) < 0 || (uint64_t)st.st_size < _header->heap_length)
+    {
+      LogWarn(@"CWIMAPMappedCache: the heap of %@ is shorter than recorded", _path);
+      _header->heap_length = (st.st_size > 0 ? (uint64_t)st.st_size : 0);
+    }
+
+  count = (NSUInteger)_header->count;
+
+  for (i = 0; i < count; i++)
+    {
+      for (j = 0; j < CACHE_STRING_COUNT; j++)
+        {
+          if (_entries[i].length[j] > _header->heap_length ||
+              _entries[i].offset[j] > _header->heap_length - _entries[i].length[j])
+            {
+              _entries[i].offset[j] = 0;
+              _entries[i].length[j] = 0;
+              [self _markDirty: i];
+            }
+        }
+    }
+}
+
+
+//
+// The heap mapping is extended lazily, only when a read needs bytes
+// beyond it. Writes go through pwrite(), which is coherent with the
+// shared mapping. Returns NULL if the range is not within the heap.
+//
+- (const char *) _bytesAtOffset: (uint64_t) theOffset  length: (uint32_t) theLength
+{
+  if (theLength > _header->heap_length || theOffset > _header->heap_length - theLength)
+    {
+      return NULL;
+    }
+
+  if (theLength == 0)
+    {
+      return "";
+    }
+
+  if (theOffset + theLength > _heap_map_length)
+    {
+      size_t length = (size_t)_header->heap_length;
+      void *p;
+
+      if (_heap) munmap((void *)_heap, _heap_map_length);
+
+      p = mmap(NULL, length, PROT_READ, MAP_SHARED, _heap_fd, 0);
+
+      if (p == MAP_FAILED)
+        {
+          _heap = NULL;
+          _heap_map_length = 0;
+          return NULL;
+        }
+
+      _heap = p;
+      _heap_map_length = length;
+    }
+
+  return _heap + theOffset;
+}
+
+
+//
+//
+//
+- (NSData *) _dataForField: (int) theField  entry: (cw_cache_entry *) theEntry
+{
+  const char *bytes;
+
+  if (theEntry->length[theField] == 0)
+    {
+      return nil;
+    }
+
+  bytes = [self _bytesAtOffset: theEntry->offset[theField]  length: theEntry->length[theField]];
+
+  if (!bytes)
+    {
+      return nil;
+    }
+
+  return [NSData dataWithBytes: bytes  length: theEntry->length[theField]];
+}
+
+
+//
+// Mirrors what CWIMAPStore restores from a CWCacheRecord: the stored
+// values are the raw header values, hence the quick: parsing.
+//
+- (CWIMAPMessage *) _messageFromEntry: (cw_cache_entry *) theEntry
+{
+  CWIMAPMessage *aMessage;
+  NSData *aData;
+
+  aMessage = [[CWIMAPMessage alloc] init];
+  [aMessage setUID: theEntry->uid];
+  [[aMessage flags] replaceWithFlags: AUTORELEASE([[CWFlags alloc] initWithFlags: (theEntry->flags & ~CACHE_TOMBSTONE)])];
+  [aMessage setSize: (NSInteger)theEntry->size];
+
+  if (theEntry->date)
+    {
+      [aMessage setOriginationDate: [NSDate dateWithTimeIntervalSince1970: theEntry->date]];
+    }
+
+  if ((aData = [self _dataForField: CACHE_FROM  entry: theEntry]))
+    [CWParser parseFrom: aData  inMessage: aMessage  quick: YES];
+  if ((aData = [self _dataForField: CACHE_IN_REPLY_TO  entry: theEntry]))
+    [CWParser parseInReplyTo: aData  inMessage: aMessage  quick: YES];
+  if ((aData = [self _dataForField: CACHE_MESSAGE_ID  entry: theEntry]))
+    [CWParser parseMessageID: aData  inMessage: aMessage  quick: YES];
+  if ((aData = [self _dataForField: CACHE_REFERENCES  entry: theEntry]))
+    [CWParser parseReferences: aData  inMessage: aMessage  quick: YES];
+  if ((aData = [self _dataForField: CACHE_SUBJECT  entry: theEntry]))
+    [CWParser parseSubject: aData  inMessage: aMessage  quick: YES];
+  if ((aData = [self _dataForField: CACHE_TO  entry: theEntry]))
+    [CWParser parseDestination: aData  forType: PantomimeToRecipient  inMessage: aMessage  quick: YES];
+  if ((aData = [self _dataForField: CACHE_CC  entry: theEntry]))
+    [CWParser parseDestination: aData  forType: PantomimeCcRecipient  inMessage: aMessage  quick: YES];
+
+  if (_folder)
+    {
+      [aMessage setFolder: _folder];
+    }
+
+  return aMessage;
+}
+
+@end
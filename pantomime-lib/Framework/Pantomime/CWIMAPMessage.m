@@ -121,6 +121,85 @@
 }
 
 
+//
+//
+//
+- (void) fetchContentOfPart: (CWPart *) thePart
+                    section: (NSString *) theSection
+{
+    [self fetchContentOfPart: thePart  section: theSection  length: 0];
+}
+
+
+//
+//
+//
+- (void) fetchContentOfPart: (CWPart *) thePart
+                    section: (NSString *) theSection
+                     length: (NSUInteger) theLength
+{
+    CWIMAPStore *aStore = (CWIMAPStore *)[[self folder] store];
+
+    if (![(CWIMAPFolder *)[self folder] selected]) {
+        [NSException raise: PantomimeProtocolException
+                    format: @"Unable to fetch part data from unselected mailbox."];
+        return;
+    }
+
+    [aStore fetchPart: thePart  section: theSection  UID: _UID  binary: [aStore supportsBinary]
+               length: theLength];
+}
+
+
+//
+//
+//
+- (void) fetchSection: (NSString *) theSection
+               toFile: (NSString *) thePath
+               window: (NSUInteger) theWindow
+{
+    CWIMAPStore *aStore = (CWIMAPStore *)[[self folder] store];
+
+    if (![(CWIMAPFolder *)[self folder] selected]) {
+        [NSException raise: PantomimeProtocolException
+                    format: @"Unable to fetch part data from unselected mailbox."];
+        return;
+    }
+
+    if (!theWindow) {
+        [NSException raise: NSInvalidArgumentException
+                    format: @"The window of a partial fetch must not be empty."];
+        return;
+    }
+
+    [aStore fetchSection: theSection  UID: _UID  toFile: thePath  window: theWindow];
+}
+
+
+//
+//
+//
+- (BOOL) fetchSizeOfPart: (CWPart *) thePart
+                 section: (NSString *) theSection
+{
+    CWIMAPStore *aStore = (CWIMAPStore *)[[self folder] store];
+
+    if (![(CWIMAPFolder *)[self folder] selected]) {
+        [NSException raise: PantomimeProtocolException
+                    format: @"Unable to fetch part data from unselected mailbox."];
+        return NO;
+    }
+
+    if (![aStore supportsBinary]) {
+        return NO;
+    }
+
+    [aStore fetchSizeOfPart: thePart  section: theSection  UID: _UID];
+
+    return YES;
+}
+
+
 //
 //
 //
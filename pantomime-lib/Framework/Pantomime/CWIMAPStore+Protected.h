@@ -9,6 +9,8 @@
 #import "CWIMAPStore.h"
 #import "CWService+Protected.h"
 
+@class CWPart;
+
 NS_ASSUME_NONNULL_BEGIN
 
 /**
@@ -30,6 +32,8 @@ NS_ASSUME_NONNULL_BEGIN
     __block int _tag;
 
     __block CWIMAPQueueObject *_currentQueueObject;
+    __block BOOL _supportsBinary;
+    __block BOOL _authenticated;
     
 }
 
@@ -99,6 +103,99 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSDictionary * _Nullable) folderStatus: (NSArray * _Nullable) theArray;
 
+/*!
+ @method hasCapability:
+ @result YES if the server announced <i>theCapability</i>, compared case-insensitively.
+ */
+- (BOOL) hasCapability: (NSString *) theCapability;
+
+/*!
+ @method supportsMultiAppend
+ @result YES if the server takes several messages in one APPEND (RFC 3502).
+ */
+- (BOOL) supportsMultiAppend;
+
+/*!
+ @method supportsNonSynchronizingLiteralOfLength:
+ @discussion Non-synchronizing literals ({n+}, RFC 7888) are sent right
+ after the command, without waiting for the server's continuation request.
+ LITERAL+ allows them of any length, LITERAL- up to 4096 bytes.
+ @param theLength The length of the literal.
+ @result YES if a literal of <i>theLength</i> bytes may be non-synchronizing.
+ */
+- (BOOL) supportsNonSynchronizingLiteralOfLength: (NSUInteger) theLength;
+
+/*!
+ @method supportsBinary
+ @result YES if the server announced the BINARY extension (RFC 3516) in its capabilities.
+ */
+- (BOOL) supportsBinary;
+
+/*!
+ @method fetchPart:section:UID:binary:
+ @discussion This method is used to fetch the content of a body part of the message
+ with the given UID in the selected folder, as BINARY.PEEK[section] if <i>theBOOL</i>
+ is YES and as BODY.PEEK[section] otherwise. The content is set on <i>thePart</i>
+ and PantomimePartFetchCompleted is posted.
+ @param thePart The part receiving the content.
+ @param theSection The section of the part, like "2" or "1.3".
+ @param theUID The UID of the message.
+ @param theBOOL YES to let the server decode the part.
+ */
+- (void) fetchPart: (CWPart *) thePart
+           section: (NSString *) theSection
+               UID: (NSUInteger) theUID
+            binary: (BOOL) theBOOL;
+
+/*!
+ @method fetchPart:section:UID:binary:length:
+ @discussion Like -fetchPart:section:UID:binary: but only fetches the first
+ <i>theLength</i> bytes of the part (<0.length> partial FETCH), for previews.
+ A length of 0 fetches the whole part.
+ @param thePart The part receiving the content.
+ @param theSection The section of the part, like "2" or "1.3".
+ @param theUID The UID of the message.
+ @param theBOOL YES to let the server decode the part.
+ @param theLength The number of bytes to fetch.
+ */
+- (void) fetchPart: (CWPart *) thePart
+           section: (NSString *) theSection
+               UID: (NSUInteger) theUID
+            binary: (BOOL) theBOOL
+            length: (NSUInteger) theLength;
+
+/*!
+ @method fetchSection:UID:toFile:window:
+ @discussion This method is used to download a section of the message with the
+ given UID, as sent by the server, into the file at <i>thePath</i>. The section is
+ fetched <i>theWindow</i> bytes at a time and each window is written to the file
+ once received, so the length of the file is the checkpoint of the download: it
+ starts at the end of an existing file and a window interrupted by a reconnection
+ is fetched again. PantomimePartFetchCompleted is posted once a window comes back
+ short, PantomimePartFetchFailed if the server has no such section.
+ @param theSection The section, like "1.3", or the empty string for the whole message.
+ @param theUID The UID of the message.
+ @param thePath The spool file, created if needed.
+ @param theWindow The number of bytes fetched per command. Must not be 0.
+ */
+- (void) fetchSection: (NSString *) theSection
+                  UID: (NSUInteger) theUID
+               toFile: (NSString *) thePath
+               window: (NSUInteger) theWindow;
+
+/*!
+ @method fetchSizeOfPart:section:UID:
+ @discussion This method is used to fetch the decoded size of a body part
+ (BINARY.SIZE[section]). The size is set on <i>thePart</i> and
+ PantomimePartFetchCompleted is posted. The server must support BINARY.
+ @param thePart The part receiving the size.
+ @param theSection The section of the part, like "2" or "1.3".
+ @param theUID The UID of the message.
+ */
+- (void) fetchSizeOfPart: (CWPart *) thePart
+                 section: (NSString *) theSection
+                     UID: (NSUInteger) theUID;
+
 /*!
  @method sendCommand:info:arguments: ...
  @discussion This method is used to send commands to the IMAP server.
@@ -9,10 +9,11 @@
 #import "CWIMAPStore+Protected.h"
 
 #import "CWIMAPFolder.h"
+#import "CWServiceMetrics+Protected.h"
 #import "Pantomime/NSString+Extensions.h"
 #import "CWThreadSafeArray.h"
 
-#import <PlanckToolboxForExtensions/PEPLogger.h>
+#import "CWLogger.h"
 
 @implementation CWIMAPStore (Protected)
 
@@ -114,6 +115,136 @@
 }
 
 
+//
+//
+//
+- (BOOL) hasCapability: (NSString *) theCapability
+{
+    for (NSString *aString in _capabilities)
+    {
+        if ([aString caseInsensitiveCompare: theCapability] == NSOrderedSame)
+        {
+            return YES;
+        }
+    }
+
+    return NO;
+}
+
+
+//
+//
+//
+- (BOOL) supportsMultiAppend
+{
+    return [self hasCapability: @"MULTIAPPEND"];
+}
+
+
+//
+//
+//
+- (BOOL) supportsNonSynchronizingLiteralOfLength: (NSUInteger) theLength
+{
+    return ([self hasCapability: @"LITERAL+"] ||
+            (theLength <= 4096 && [self hasCapability: @"LITERAL-"]));
+}
+
+
+//
+//
+//
+- (BOOL) supportsBinary
+{
+    return _supportsBinary;
+}
+
+
+//
+// The part's content is read in the FETCH response, see -_parseFETCH_BINARY:.
+//
+- (void) fetchPart: (CWPart *) thePart
+           section: (NSString *) theSection
+               UID: (NSUInteger) theUID
+            binary: (BOOL) theBOOL
+{
+    [self fetchPart: thePart  section: theSection  UID: theUID  binary: theBOOL  length: 0];
+}
+
+
+//
+// A partial FETCH answers with the origin in the data item name, like
+// BODY[2]<0>. See -_parseFETCH_BINARY:.
+//
+- (void) fetchPart: (CWPart *) thePart
+           section: (NSString *) theSection
+               UID: (NSUInteger) theUID
+            binary: (BOOL) theBOOL
+            length: (NSUInteger) theLength
+{
+    NSString *aCommand = (theBOOL ? @"BINARY.PEEK" : @"BODY.PEEK");
+
+    if (theLength)
+    {
+        NSDictionary *info = @{@"Part": thePart, @"Section": theSection, @"UID": @(theUID),
+                               @"Length": @(theLength)};
+
+        [self sendCommand: IMAP_UID_FETCH_BINARY  info: info
+                arguments: @"UID FETCH %lu (%@[%@]<0.%lu>)", (unsigned long) theUID,
+                           aCommand, theSection, (unsigned long) theLength];
+    }
+    else
+    {
+        NSDictionary *info = @{@"Part": thePart, @"Section": theSection, @"UID": @(theUID)};
+
+        [self sendCommand: IMAP_UID_FETCH_BINARY  info: info
+                arguments: @"UID FETCH %lu (%@[%@])", (unsigned long) theUID, aCommand, theSection];
+    }
+}
+
+
+//
+// Each window is written at its offset and the file truncated after it,
+// so fetching a window again after a reconnection does no harm.
+//
+- (void) fetchSection: (NSString *) theSection
+                  UID: (NSUInteger) theUID
+               toFile: (NSString *) thePath
+               window: (NSUInteger) theWindow
+{
+    NSFileManager *aFileManager = [NSFileManager defaultManager];
+    unsigned long long offset;
+    NSDictionary *info;
+
+    if (![aFileManager fileExistsAtPath: thePath])
+    {
+        [aFileManager createFileAtPath: thePath  contents: nil  attributes: nil];
+    }
+
+    offset = [[aFileManager attributesOfItemAtPath: thePath  error: NULL] fileSize];
+    info = @{@"Section": theSection, @"UID": @(theUID), @"Path": thePath,
+             @"Offset": @(offset), @"Window": @(theWindow)};
+
+    [self sendCommand: IMAP_UID_FETCH_PARTIAL  info: info
+            arguments: @"UID FETCH %lu (BODY.PEEK[%@]<%llu.%lu>)", (unsigned long) theUID,
+                       theSection, offset, (unsigned long) theWindow];
+}
+
+
+//
+//
+//
+- (void) fetchSizeOfPart: (CWPart *) thePart
+                 section: (NSString *) theSection
+                     UID: (NSUInteger) theUID
+{
+    NSDictionary *info = @{@"Part": thePart, @"Section": theSection, @"UID": @(theUID)};
+
+    [self sendCommand: IMAP_UID_FETCH_BINARY_SIZE  info: info
+            arguments: @"UID FETCH %lu (BINARY.SIZE[%@])", (unsigned long) theUID, theSection];
+}
+
+
 //
 //
 //
@@ -175,6 +306,7 @@
                                                tag: [self nextTag]  info: theInfo];
             
             [_queue insertObject: aQueueObject  atIndex: 0];
+            [_metrics setQueueDepth: [_queue count]];
             RELEASE(aQueueObject);
             
             LogInfo(@"%p queue size = %lul", self, (unsigned long) [_queue count]);
@@ -191,7 +323,9 @@
         }
         
         BOOL isPrivate = NO;
-        if (self.currentQueueObject.command == IMAP_LOGIN) {
+        if (self.currentQueueObject.command == IMAP_LOGIN ||
+            self.currentQueueObject.command == IMAP_AUTHENTICATE_PLAIN ||
+            self.currentQueueObject.command == IMAP_AUTHENTICATE_XOAUTH2) {
             isPrivate = YES;
         }
         
@@ -202,11 +336,35 @@
         }
         
         _lastCommand = self.currentQueueObject.command;
+        [_metrics commandStarted: _lastCommand];
         
-        [self bulkWriteData:@[self.currentQueueObject.tag,
-                              [NSData dataWithBytes: " "  length: 1],
-                              [self.currentQueueObject.arguments dataUsingEncoding: _defaultStringEncoding],
-                              _crlf]];
+        NSMutableArray *allData = [NSMutableArray arrayWithObjects: self.currentQueueObject.tag,
+                                   [NSData dataWithBytes: " "  length: 1],
+                                   [self.currentQueueObject.arguments dataUsingEncoding: _defaultStringEncoding],
+                                   _crlf, nil];
+
+        //
+        // Non-synchronizing literals (RFC 7888) follow the command right away,
+        // each one with the rest of the command line up to the next literal.
+        //
+        if ([[self.currentQueueObject.info objectForKey: @"NonSynchronizing"] boolValue])
+        {
+            NSArray *allLiterals = [self.currentQueueObject.info objectForKey: @"Literals"];
+            NSArray *allContinuations = [self.currentQueueObject.info objectForKey: @"Continuations"];
+            NSUInteger i;
+
+            for (i = 0; i < [allLiterals count]; i++)
+            {
+                [allData addObject: [allLiterals objectAtIndex: i]];
+                [allData addObject: [[allContinuations objectAtIndex: i] dataUsingEncoding: _defaultStringEncoding]];
+                [allData addObject: _crlf];
+            }
+
+            [self.currentQueueObject.info setObject: [NSNumber numberWithUnsignedInteger: [allLiterals count]]
+                                             forKey: @"NextLiteral"];
+        }
+
+        [self bulkWriteData: allData];
 
         PERFORM_SELECTOR_2(_delegate, @selector(commandSent:), @"PantomimeCommandSent", [NSNumber numberWithInt: _lastCommand], @"Command");
     }
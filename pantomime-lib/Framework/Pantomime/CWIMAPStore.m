@@ -22,7 +22,7 @@
 
 #import "CWIMAPStore+Protected.h"
 
-#import <PlanckToolboxForExtensions/PEPLogger.h>
+#import "CWLogger.h"
 #import "CWConstants.h"
 #import "CWFlags.h"
 #import "Pantomime/CWFolderInformation.h"
@@ -48,6 +48,7 @@
 #import "CWIMAPCacheManager.h"
 #import "CWThreadSafeArray.h"
 #import "CWThreadSafeData.h"
+#import "CWWriteQueue.h"
 
 #import "NSDate+StringRepresentation.h"
 
@@ -56,12 +57,15 @@
 
 #import "CWOAuthUtils.h"
 #import "CWService+Protected.h"
+#import "CWServiceMetrics+Protected.h"
 #import "CWIMAPFolder+CWProtected.h"
+#import "CWIMAPLexer.h"
 
 //
 // This C function is used to verify if a line (specified in
 // "buf", with length "c") has a literal. If it does, the
-// value of the literal is returned.
+// value of the literal is returned. The literal8 of RFC 3516
+// ("~{n}") ends the same way.
 //
 // "0" means no literal.
 //
@@ -96,14 +100,166 @@ static inline int has_literal(char *buf, NSUInteger c)
     return 0;
 }
 
-@interface CWIMAPStore ()
+//
+// This C function is used to verify if the token at "index" begins
+// a FETCH response ("* <msn> FETCH ("). If it does, the MSN and the
+// index of the list of data items are returned.
+//
+static BOOL fetch_list(const cw_imap_lexer *lexer, NSUInteger index, NSUInteger *msn, NSUInteger *list)
+{
+    if (index + 3 >= lexer->count ||
+        !cw_imap_token_is(&lexer->tokens[index], "*") ||
+        !cw_imap_token_number(&lexer->tokens[index+1], msn) ||
+        !cw_imap_token_is(&lexer->tokens[index+2], "FETCH") ||
+        lexer->tokens[index+3].type != CWIMAPTokenListBegin)
+    {
+        return NO;
+    }
 
-/**
- Regular expression for extracting the UID from a FETCH response.
- */
-@property (strong, nonatomic, nonnull) NSRegularExpression *uidRegex;
+    *list = index + 3;
 
-@end
+    return YES;
+}
+
+//
+// This C function is used to verify if "lexer" read a LIST response
+// ("* LIST (<attributes>) <separator> <name>"). If it did, the indexes
+// of the attributes list, the separator and the name are returned. The
+// name is missing if its index is past the last token.
+//
+static BOOL list_response(const cw_imap_lexer *lexer, NSUInteger *attributes, NSUInteger *separator,
+                          NSUInteger *name)
+{
+    if (lexer->count < 3 ||
+        !cw_imap_token_is(&lexer->tokens[0], "*") ||
+        !cw_imap_token_is(&lexer->tokens[1], "LIST") ||
+        lexer->tokens[2].type != CWIMAPTokenListBegin)
+    {
+        return NO;
+    }
+
+    *attributes = 2;
+    *separator = cw_imap_lexer_next(lexer, 2);
+    *name = *separator + 1;
+
+    return (*separator < lexer->count);
+}
+
+//
+// This C function is used to obtain the attributes of a LIST response
+// ("\HasChildren \Sent"), "list" being the index of their list.
+//
+static NSString *list_attributes(const cw_imap_lexer *lexer, NSUInteger list)
+{
+    NSMutableString *aMutableString = [NSMutableString string];
+    NSUInteger i, end;
+
+    end = MIN(lexer->tokens[list].value, lexer->count);
+
+    for (i = list + 1; i < end; i++)
+    {
+        NSString *aString = cw_imap_token_string(&lexer->tokens[i], NSASCIIStringEncoding);
+
+        if (aString)
+        {
+            if ([aMutableString length]) [aMutableString appendString: @" "];
+            [aMutableString appendString: aString];
+        }
+    }
+
+    return aMutableString;
+}
+
+//
+// This C function is used to find the UID data item in the
+// FETCH responses read by "lexer". "0" means no UID.
+//
+static NSUInteger fetch_uid(const cw_imap_lexer *lexer)
+{
+    NSUInteger i, msn, list, end, uid;
+
+    for (i = 0; i < lexer->count; i = cw_imap_lexer_next(lexer, i))
+    {
+        if (!fetch_list(lexer, i, &msn, &list))
+        {
+            continue;
+        }
+
+        end = MIN(lexer->tokens[list].value, lexer->count);
+
+        for (i = list + 1; i + 1 < end; i = cw_imap_lexer_next(lexer, i + 1))
+        {
+            if (cw_imap_token_is(&lexer->tokens[i], "UID") &&
+                cw_imap_token_number(&lexer->tokens[i+1], &uid))
+            {
+                return uid;
+            }
+        }
+
+        i = list;
+    }
+
+    return 0;
+}
+
+//
+// This C function returns the capabilities of a [CAPABILITY ...] response
+// code (7.1), as sent in greetings and in the tagged OK of LOGIN or
+// AUTHENTICATE. nil means there is none.
+//
+static NSArray *capability_code(NSData *theData, NSStringEncoding theEncoding)
+{
+    const char *bytes;
+    NSUInteger start, end, length;
+    NSRange aRange;
+
+    aRange = [theData rangeOfCString: "[CAPABILITY "  options: NSCaseInsensitiveSearch];
+
+    if (aRange.location == NSNotFound)
+    {
+        return nil;
+    }
+
+    bytes = [theData bytes];
+    length = [theData length];
+    start = end = NSMaxRange(aRange);
+
+    while (end < length && bytes[end] != ']')
+    {
+        end++;
+    }
+
+    return [AUTORELEASE([[NSString alloc] initWithBytes: bytes + start  length: end - start  encoding: theEncoding])
+               componentsSeparatedByString: @" "];
+}
+
+//
+// The capabilities each server announced before authentication, keyed
+// by "host:port:transport". The next connection to the same server takes
+// them when its greeting has none, instead of asking with CAPABILITY.
+// An entry is dropped as soon as the server announces other ones before
+// authentication.
+//
+static inline BOOL is_authentication(IMAPCommand theCommand)
+{
+    return (theCommand == IMAP_LOGIN ||
+            theCommand == IMAP_AUTHENTICATE_CRAM_MD5 ||
+            theCommand == IMAP_AUTHENTICATE_LOGIN ||
+            theCommand == IMAP_AUTHENTICATE_PLAIN ||
+            theCommand == IMAP_AUTHENTICATE_XOAUTH2);
+}
+
+static NSMutableDictionary *capabilities_cache(void)
+{
+    static NSMutableDictionary *cache = nil;
+    static dispatch_once_t once;
+
+    dispatch_once(&once, ^{
+        cache = [[NSMutableDictionary alloc] init];
+    });
+
+    return cache;
+}
 
 //
 // Private methods
@@ -115,10 +271,22 @@ static inline int has_literal(char *buf, NSUInteger c)
 - (void) _parseBAD;
 - (void) _parseBYE;
 - (void) _parseCAPABILITY;
+- (void) _setCapabilities: (NSArray *) theCapabilities;
+- (NSString *) _capabilitiesCacheKey;
+- (void) _cacheCapabilities;
+- (void) _forgetCapabilities;
+- (void) _checkCachedCapabilities;
+- (void) _capabilitiesReceived: (NSArray *) theCapabilities;
+- (void) _authenticate: (IMAPCommand) theCommand
+             mechanism: (NSString *) theMechanism
+              response: (NSString *) theResponse;
 - (void) _parseEXISTS;
 - (void) _parseEXPUNGE;
 - (void) _parseFETCH_UIDS;
 - (void) _parseFETCH: (NSInteger) theMSN;
+- (void) _parseFETCH_BINARY: (NSInteger) theMSN;
+- (NSData *) _dataOfFetchValue: (const cw_imap_token *) theToken;
+- (void) _setLiteralDigestOfMessage: (CWMessage *) theMessage;
 - (void) _parseLIST;
 - (void) _parseLSUB;
 - (void) _parseNO;
@@ -131,7 +299,6 @@ static inline int has_literal(char *buf, NSUInteger c)
 - (void) _parseSELECT;
 - (void) _parseSTATUS;
 - (void) _parseSTARTTLS;
-- (void) _parseUIDVALIDITY: (const char *) theString;
 - (void) _restoreQueue;
 
 @end
@@ -179,12 +346,6 @@ static inline int has_literal(char *buf, NSUInteger c)
     _lastCommand = IMAP_AUTHORIZATION;
     _currentQueueObject = nil;
 
-    NSError *error;
-    _uidRegex = [NSRegularExpression
-                 regularExpressionWithPattern:@".*UID (\\d+).*"
-                 options: 0 error: &error];
-    assert(error == nil);
-
     return self;
 }
 
@@ -345,6 +506,8 @@ static inline int has_literal(char *buf, NSUInteger c)
 
         if (![_rbuf length]) return;
 
+        [_metrics parsingStarted];
+
         while ((aData = [_rbuf dropFirstLine]))
         {
             //LogInfo(@"aLine = |%@|", [aData asciiString]);
@@ -361,20 +524,36 @@ static inline int has_literal(char *buf, NSUInteger c)
                 {
                     int x;
 
-                    x = -2-self.currentQueueObject.literal;
+                    // The literal ends within this line, after its first x bytes.
+                    x = MIN((int) count, self.currentQueueObject.literal + (int) (count+2));
                     [[self.currentQueueObject.info objectForKey: @"NSData"] appendData: [aData subdataToIndex: x]];
+                    [[self.currentQueueObject.info objectForKey: @"Digest"] updateWithBytes: buf  length: x];
                     [_responsesFromServer addObject: [aData subdataFromIndex: x]];
                     //LogInfo(@"orig = |%@|, chooped = |%@| |%@|", [aData asciiString], [[aData subdataToIndex: x] asciiString], [[aData subdataFromIndex: x] asciiString]);
                 }
                 else
                 {
+                    CWDigest *aDigest = [self.currentQueueObject.info objectForKey: @"Digest"];
+
+                    // The CRLF ending the line is part of the literal, even its last one.
                     [[self.currentQueueObject.info objectForKey: @"NSData"] appendData: aData];
+                    [[self.currentQueueObject.info objectForKey: @"NSData"] appendData: _crlf];
+                    [aDigest updateWithData: aData];
+                    [aDigest updateWithData: _crlf];
                 }
 
                 // We are done reading a literal. Let's read again
                 // to see if we got a full response.
                 if (self.currentQueueObject.literal <= 0)
                 {
+                    CWDigest *aDigest = [self.currentQueueObject.info objectForKey: @"Digest"];
+
+                    if (aDigest)
+                    {
+                        [self.currentQueueObject.info setObject: [aDigest finalizeDigest]  forKey: @"LiteralDigest"];
+                        [self.currentQueueObject.info removeObjectForKey: @"Digest"];
+                    }
+
                     //LogInfo(@"DONE ACCUMULATING LITTERAL!\nread = |%@|", [[self.currentQueueObject.info objectForKey: @"NSData"] asciiString]);
                     //
                     // Let's see, if we can, what does the next line contain. If we got
@@ -407,11 +586,13 @@ static inline int has_literal(char *buf, NSUInteger c)
                         // end of our literal response and we need to call
                         // [super updateRead] to get more bytes from the socket
                         // in order to read the rest (")" or " UID 123)" for example).
+                        [_metrics parsingEnded];
                         while (!(aData = [_rbuf dropFirstLine]))
                         {
                             //SLog(@"NOTHING TO READ! WAITING...");
                             [super updateRead];
                         }
+                        [_metrics parsingStarted];
                         [_responsesFromServer addObject: aData];
                     }
 
@@ -429,11 +610,10 @@ static inline int has_literal(char *buf, NSUInteger c)
                 {
                     //LogInfo(@"Accumulating... %d remaining...", self.currentQueueObject.literal);
                     //
-                    // We are still accumulating bytes of the literal. Once we have appended
-                    // our CRLF, we just continue the loop since there's no need to try to
-                    // parse anything, as we don't have the complete response yet.
+                    // We are still accumulating bytes of the literal. We just continue the
+                    // loop since there's no need to try to parse anything, as we don't have
+                    // the complete response yet.
                     //
-                    [[self.currentQueueObject.info objectForKey: @"NSData"] appendData: _crlf];
                     continue;
                 }
             }
@@ -445,8 +625,20 @@ static inline int has_literal(char *buf, NSUInteger c)
                 if (self.currentQueueObject && (self.currentQueueObject.literal = has_literal(buf, count)))
                 {
                     //LogInfo(@"literal = %d", self.currentQueueObject.literal);
+                    [_metrics receivedLiteralOfLength: self.currentQueueObject.literal];
                     [self.currentQueueObject.info setObject: [NSMutableData dataWithCapacity: self.currentQueueObject.literal]
                                                      forKey: @"NSData"];
+                    [self.currentQueueObject.info removeObjectForKey: @"LiteralDigest"];
+
+                    if (_literalDigestAlgorithm != CWDigestAlgorithmNone)
+                    {
+                        CWDigest *aDigest = [CWDigest digestWithAlgorithm: _literalDigestAlgorithm];
+
+                        if (aDigest)
+                        {
+                            [self.currentQueueObject.info setObject: aDigest  forKey: @"Digest"];
+                        }
+                    }
                 }
             }
 
@@ -478,10 +670,26 @@ static inline int has_literal(char *buf, NSUInteger c)
                 //
                 if (*(buf-i) == '+')
                 {
+                    //
+                    // The server is ready for the next synchronizing literal of our
+                    // APPEND. We send it along with the rest of the command line, up
+                    // to the literal after it, if any.
+                    //
                     if (self.currentQueueObject && _lastCommand == IMAP_APPEND)
                     {
-                        [self bulkWriteData:@[[self.currentQueueObject.info objectForKey: @"NSDataToAppend"],
-                                              _crlf]];
+                        NSMutableDictionary *info = self.currentQueueObject.info;
+                        NSArray *allLiterals = [info objectForKey: @"Literals"];
+                        NSUInteger next = [[info objectForKey: @"NextLiteral"] unsignedIntegerValue];
+
+                        if (next < [allLiterals count])
+                        {
+                            NSString *aContinuation = [[info objectForKey: @"Continuations"] objectAtIndex: next];
+
+                            [self bulkWriteData:@[[allLiterals objectAtIndex: next],
+                                                  [aContinuation dataUsingEncoding: _defaultStringEncoding],
+                                                  _crlf]];
+                            [info setObject: [NSNumber numberWithUnsignedInteger: next + 1]  forKey: @"NextLiteral"];
+                        }
                         break;
                     }
                     else if (_lastCommand == IMAP_AUTHENTICATE_CRAM_MD5)
@@ -495,6 +703,17 @@ static inline int has_literal(char *buf, NSUInteger c)
                         break;
                     }
 
+                    //
+                    // The initial response of PLAIN or XOAUTH2, if the server lacks SASL-IR.
+                    //
+                    else if (self.currentQueueObject && [self.currentQueueObject.info objectForKey: @"Response"])
+                    {
+                        [self bulkWriteData:@[[self.currentQueueObject.info objectForKey: @"Response"],
+                                              _crlf]];
+                        [self.currentQueueObject.info removeObjectForKey: @"Response"];
+                        break;
+                    }
+
                     // IMAP_AUTHENTICATE_XOAUTH2 answers with OK response in case of success.
                     // In case case of failure a JSON containing the status is returned, no BAD or NO
                     // response.
@@ -510,6 +729,7 @@ static inline int has_literal(char *buf, NSUInteger c)
                     {
                         // We ignore the status contained in the response.
                         // This if clause is reached only in failure case.
+                        [self _forgetCapabilities];
                         AUTHENTICATION_FAILED(_delegate, _mechanism);
                         break;
                     }
@@ -659,6 +879,11 @@ static inline int has_literal(char *buf, NSUInteger c)
                         case IMAP_UID_FETCH_UIDS:
                             [self _parseFETCH_UIDS];
                             break;
+                        case IMAP_UID_FETCH_BINARY:
+                        case IMAP_UID_FETCH_BINARY_SIZE:
+                        case IMAP_UID_FETCH_PARTIAL:
+                            [self _parseFETCH_BINARY: msn];
+                            break;
                         default:
                             [self _parseFETCH: msn];
                     }
@@ -775,6 +1000,7 @@ static inline int has_literal(char *buf, NSUInteger c)
         } // while ((aData = split_lines...
         
         //LogInfo(@"While loop broken!");
+        [_metrics parsingEnded];
 }
 
 
@@ -813,7 +1039,11 @@ static inline int has_literal(char *buf, NSUInteger c)
         //LogInfo(@"queue count = %d", [_queue count]);
         //LogInfo(@"%@", [_queue description]);
         [strongSelf->_queue removeAllObjects];
+        [strongSelf->_metrics setQueueDepth: 0];
+        [strongSelf->_metrics reconnected];
         strongSelf->_lastCommand = IMAP_AUTHORIZATION;
+        strongSelf->_authenticated = NO;
+        [strongSelf->_capabilities removeAllObjects];
         LogInfo(@"reconnect currentQueueObject = nil");
         strongSelf.currentQueueObject = nil;
         strongSelf->_counter = 0;
@@ -866,14 +1096,20 @@ static inline int has_literal(char *buf, NSUInteger c)
             [strongSelf sendCommand: IMAP_AUTHENTICATE_LOGIN  info: nil  arguments: @"AUTHENTICATE LOGIN"];
             return;
         }
+        // AUTH=PLAIN
+        else if (theMechanism && [theMechanism caseInsensitiveCompare: @"PLAIN"] == NSOrderedSame)
+        {
+            NSString *clientResponse = [CWOAuthUtils base64EncodedPlainResponseForUser:theUsername
+                                                                              password:thePassword];
+            [strongSelf _authenticate: IMAP_AUTHENTICATE_PLAIN  mechanism: @"PLAIN"  response: clientResponse];
+            return;
+        }
         // AUTH=XOAUTH2
         else if (theMechanism && [theMechanism caseInsensitiveCompare: @"XOAUTH2"] == NSOrderedSame)
         {
             NSString *clientResponse = [CWOAuthUtils base64EncodedClientResponseForUser:theUsername
                                                                             accessToken:thePassword];
-            [strongSelf sendCommand: IMAP_AUTHENTICATE_XOAUTH2
-                         info: nil
-                    arguments: @"AUTHENTICATE XOAUTH2 %@", clientResponse];
+            [strongSelf _authenticate: IMAP_AUTHENTICATE_XOAUTH2  mechanism: @"XOAUTH2"  response: clientResponse];
             return;
         }
 
@@ -1278,70 +1514,37 @@ static inline int has_literal(char *buf, NSUInteger c)
 
 
 //
-// This method parses the flags received in theString and builds
-// a corresponding Flags object for them.
+// This method parses the flags found in the given range of tokens
+// and builds a corresponding Flags object for them.
 //
-- (void) _parseFlags: (NSString *) theString
+- (void) _parseFlags: (const cw_imap_lexer *) theLexer
+               range: (NSRange) theRange
              message: (CWIMAPMessage *) theMessage
               record: (CWCacheRecord *) theRecord
 {
+    static const struct { const char *name; PantomimeFlag flag; } names[] = {
+        { "\\Seen", PantomimeFlagSeen },
+        { "\\Recent", PantomimeFlagRecent },
+        { "\\Deleted", PantomimeFlagDeleted },
+        { "\\Answered", PantomimeFlagAnswered },
+        { "\\Flagged", PantomimeFlagFlagged },
+        { "\\Draft", PantomimeFlagDraft }
+    };
     CWFlags *theFlags;
-    NSRange aRange;
+    NSUInteger i, j;
 
     theFlags = [[CWFlags alloc] init];
 
-    // We check if the message has the Seen flag
-    aRange = [theString rangeOfString: @"\\Seen"
-                              options: NSCaseInsensitiveSearch];
-
-    if (aRange.location != NSNotFound)
-    {
-        [theFlags add: PantomimeFlagSeen];
-    }
-
-    // We check if the message has the Recent flag
-    aRange = [theString rangeOfString: @"\\Recent"
-                              options: NSCaseInsensitiveSearch];
-
-    if (aRange.location != NSNotFound)
-    {
-        [theFlags add: PantomimeFlagRecent];
-    }
-
-    // We check if the message has the Deleted flag
-    aRange = [theString rangeOfString: @"\\Deleted"
-                              options: NSCaseInsensitiveSearch];
-
-    if (aRange.location != NSNotFound)
-    {
-        [theFlags add: PantomimeFlagDeleted];
-    }
-
-    // We check if the message has the Answered flag
-    aRange = [theString rangeOfString: @"\\Answered"
-                              options: NSCaseInsensitiveSearch];
-
-    if (aRange.location != NSNotFound)
-    {
-        [theFlags add: PantomimeFlagAnswered];
-    }
-
-    // We check if the message has the Flagged flag
-    aRange = [theString rangeOfString: @"\\Flagged"
-                              options: NSCaseInsensitiveSearch];
-
-    if (aRange.location != NSNotFound)
+    for (i = theRange.location; i < NSMaxRange(theRange); i++)
     {
-        [theFlags add: PantomimeFlagFlagged];
-    }
-
-    // We check if the message has the Draft flag
-    aRange = [theString rangeOfString: @"\\Draft"
-                              options: NSCaseInsensitiveSearch];
-
-    if (aRange.location != NSNotFound)
-    {
-        [theFlags add: PantomimeFlagDraft];
+        for (j = 0; j < sizeof(names) / sizeof(names[0]); j++)
+        {
+            if (cw_imap_token_is(&theLexer->tokens[i], names[j].name))
+            {
+                [theFlags add: names[j].flag];
+                break;
+            }
+        }
     }
 
     [[theMessage flags] replaceWithFlags: theFlags];
@@ -1563,8 +1766,10 @@ static inline int has_literal(char *buf, NSUInteger c)
             case IMAP_AUTHENTICATE_CRAM_MD5:
             case IMAP_AUTHENTICATE_XOAUTH2: // Only added for completenes. In reality XOAuth2 never responds with BAD (only Gmail tested so far)
             case IMAP_AUTHENTICATE_LOGIN:
+            case IMAP_AUTHENTICATE_PLAIN:
                 // Probably wrong credentials.
                 // Example case: 0003 BAD [AUTHENTICATIONFAILED] AUTHENTICATE Invalid credentials
+                [self _forgetCapabilities];
                 AUTHENTICATION_FAILED(_delegate, _mechanism);
                 break;
             case IMAP_SELECT: {
@@ -1602,6 +1807,8 @@ static inline int has_literal(char *buf, NSUInteger c)
         if (![aData hasCPrefix: "*"])
         {
             [_queue removeLastObject];
+            [_metrics setQueueDepth: [_queue count]];
+            [_metrics commandCompleted];
             [self sendCommand: IMAP_EMPTY_QUEUE  info: nil  arguments: @""];
         }
 
@@ -1634,15 +1841,126 @@ static inline int has_literal(char *buf, NSUInteger c)
 // untagged response (6.1.1)
 - (void) _parseCAPABILITY
 {
+    NSArray *allCapabilities;
     NSString *aString;
     NSData *aData;
 
     aData = [_responsesFromServer objectAtIndex: 0];
     aString = [[NSString alloc] initWithData: aData  encoding: _defaultStringEncoding];
-
-    [_capabilities addObjectsFromArray: [[aString substringFromIndex: 13] componentsSeparatedByString: @" "]];
+    allCapabilities = [[aString substringFromIndex: 13] componentsSeparatedByString: @" "];
     RELEASE(aString);
 
+    //
+    // Servers also send their capabilities unasked, for instance right
+    // before the tagged OK of LOGIN. Only the answer to our CAPABILITY
+    // command goes on with the connection. The ones sent while we
+    // authenticate are those of the authenticated state.
+    //
+    if (_lastCommand == IMAP_CAPABILITY)
+    {
+        [self _capabilitiesReceived: allCapabilities];
+    }
+    else
+    {
+        [self _setCapabilities: allCapabilities];
+
+        if (!_authenticated && !is_authentication(_lastCommand))
+        {
+            [self _checkCachedCapabilities];
+        }
+    }
+}
+
+
+//
+// The capabilities replace the ones we knew, as they change with
+// STARTTLS and authentication.
+//
+- (void) _setCapabilities: (NSArray *) theCapabilities
+{
+    [_capabilities removeAllObjects];
+    _supportsBinary = NO;
+
+    for (NSString *aString in theCapabilities)
+    {
+        if (![aString length])
+        {
+            continue;
+        }
+
+        [_capabilities addObject: aString];
+
+        if ([aString caseInsensitiveCompare: @"BINARY"] == NSOrderedSame)
+        {
+            _supportsBinary = YES;
+        }
+    }
+}
+
+
+//
+//
+//
+- (NSString *) _capabilitiesCacheKey
+{
+    return [NSString stringWithFormat: @"%@:%u:%ld", _name, _port, (long)_connectionTransport];
+}
+
+
+//
+//
+//
+- (void) _cacheCapabilities
+{
+    NSMutableDictionary *aCache = capabilities_cache();
+
+    @synchronized(aCache) {
+        [aCache setObject: [_capabilities array]  forKey: [self _capabilitiesCacheKey]];
+    }
+}
+
+
+//
+//
+//
+- (void) _forgetCapabilities
+{
+    NSMutableDictionary *aCache = capabilities_cache();
+
+    @synchronized(aCache) {
+        [aCache removeObjectForKey: [self _capabilitiesCacheKey]];
+    }
+}
+
+
+//
+// Drops the cached capabilities of the server if they are not the ones
+// it just announced, before authentication.
+//
+- (void) _checkCachedCapabilities
+{
+    NSMutableDictionary *aCache = capabilities_cache();
+
+    @synchronized(aCache) {
+        NSArray *allCapabilities = [aCache objectForKey: [self _capabilitiesCacheKey]];
+
+        if (allCapabilities && ![[NSSet setWithArray: allCapabilities] isEqualToSet: [NSSet setWithArray: [_capabilities array]]])
+        {
+            [aCache removeObjectForKey: [self _capabilitiesCacheKey]];
+        }
+    }
+}
+
+
+//
+// We know what the server supports, from the greeting, the cache or
+// the CAPABILITY command. A reconnection authenticates right away.
+//
+- (void) _capabilitiesReceived: (NSArray *) theCapabilities
+{
+    [self _setCapabilities: theCapabilities];
+    [self _cacheCapabilities];
+
     if (_connection_state.reconnecting)
     {
         [self authenticate: _username  password: _password  mechanism: _mechanism];
@@ -1654,6 +1972,30 @@ static inline int has_literal(char *buf, NSUInteger c)
 }
 
 
+//
+// With SASL-IR (RFC 4959), the initial response goes along with the
+// AUTHENTICATE command, saving a round trip. Without it, we send it
+// once the server asks for it with an empty challenge.
+//
+- (void) _authenticate: (IMAPCommand) theCommand
+             mechanism: (NSString *) theMechanism
+              response: (NSString *) theResponse
+{
+    if ([self hasCapability: @"SASL-IR"])
+    {
+        [self sendCommand: theCommand  info: nil
+                arguments: @"AUTHENTICATE %@ %@", theMechanism, theResponse];
+    }
+    else
+    {
+        [self sendCommand: theCommand
+                     info: [NSDictionary dictionaryWithObject: [theResponse dataUsingEncoding: NSASCIIStringEncoding]
+                                                       forKey: @"Response"]
+                arguments: @"AUTHENTICATE %@", theMechanism];
+    }
+}
+
+
 //
 // This method parses an * 23 EXISTS untagged response. (7.3.1)
 //
@@ -1748,35 +2090,6 @@ static inline int has_literal(char *buf, NSUInteger c)
     LogInfo(@"Expunged %d", msn);
 }
 
-/**
- @Return: The UID extracted from a list of NSData (as part of a fetch request), or
- 0 if none could be identified.
- */
-- (NSUInteger)extractUIDFromDataArray:(NSArray *)datas
-{
-    for (NSData *data in datas) {
-        NSString *aString = [data asciiString];
-        NSTextCheckingResult *match = [self.uidRegex
-                                       firstMatchInString:aString options:0
-                                       range:NSMakeRange(0, aString.length)];
-        if (match) {
-            NSRange r = [match rangeAtIndex:1];
-            if (r.location != NSNotFound) {
-                NSString *uidString = [aString substringWithRange:r];
-                return uidString.integerValue;
-            }
-        }
-    }
-    /*
-     for (NSData *data in datas) {
-     NSString *aString = [data asciiString];
-     LogInfo("extractUID: '%@'", aString);
-     }
-     */
-    return 0;
-}
-
-
 /**
  Examples:
  "* 170 FETCH (UID 95516)"
@@ -1872,19 +2185,18 @@ static inline int has_literal(char *buf, NSUInteger c)
 //
 - (void) _parseFETCH: (NSInteger) theMSN
 {
-    NSMutableString *aMutableString;
-    NSCharacterSet *aCharacterSet;
-    CWIMAPMessage *aMessage;
-    NSScanner *aScanner;
-
+    CWIMAPMessage *aMessage = nil;
     NSMutableArray *aMutableArray;
-    NSString *aWord, *aString;
-    NSRange aRange;
+    cw_imap_lexer aLexer;
+    char aPrefix[32];
+    size_t aPrefixLength;
 
-    BOOL done, seen_fetch, must_flush_record;
+    BOOL seen_fetch, must_flush_record, finished, prefetched;
     // Indicates whether we are creating a new mail or are updating an existing one
     BOOL isMessageUpdate = NO;
-    NSInteger i, j, count, len;
+    // Whether a field the views of the folder sort on has changed
+    BOOL mustUpdateViews = NO;
+    NSUInteger i, count, theUID;
     CWCacheRecord *cacheRecord = [[CWCacheRecord alloc] init];
 
     //
@@ -1898,11 +2210,10 @@ static inline int has_literal(char *buf, NSUInteger c)
                     format: @"Unable to fetch message content from unselected mailbox."];
     }
 
-    count = [_responsesFromServer count]-1;
+    count = [_responsesFromServer count];
 
     //LogInfo(@"RESPONSES FROM SERVER: %d", count);
 
-    aMutableString = [[NSMutableString alloc] init];
     aMutableArray = [[NSMutableArray alloc] init];
 
     //
@@ -1917,10 +2228,32 @@ static inline int has_literal(char *buf, NSUInteger c)
     //
     // In such response, we must NOT consider the "* SEARCH" response.
     //
-    must_flush_record = seen_fetch = NO;
+    must_flush_record = seen_fetch = finished = prefetched = NO;
+
+    aPrefixLength = snprintf(aPrefix, sizeof(aPrefix), "* %ld FETCH", (long)theMSN);
+    cw_imap_lexer_init(&aLexer);
+
+    //
+    // We tokenize the lines of our response. The tokens point into
+    // the lines, which we keep until we are done.
+    //
+    for (i = 0; i < count; i++) {
+        NSData *aData = [_responsesFromServer objectAtIndex: i];
+
+        if (!seen_fetch && [aData length] >= aPrefixLength &&
+            strncasecmp([aData bytes], aPrefix, aPrefixLength) == 0)
+        {
+            seen_fetch = YES;
+        }
+
+        if (seen_fetch) {
+            [aMutableArray addObject: aData];
+            cw_imap_lexer_add_line(&aLexer, [aData bytes], [aData length]);
+        }
+    }
 
     // Extract the UID from anywhere in the response
-    NSUInteger theUID = [self extractUIDFromDataArray:_responsesFromServer.array];
+    theUID = fetch_uid(&aLexer);
 
     if (theUID == 0) {
         // If there is no UID in this response, try to deduce it from the mapping
@@ -1966,216 +2299,189 @@ static inline int has_literal(char *buf, NSUInteger c)
         //[[_selectedFolder cacheManager] addObject: aMessage];
     }
 
-    for (i = 0; i <= count; i++) {
-        aString = [[_responsesFromServer objectAtIndex: i] asciiString];
+    //
+    // We walk the data items of the FETCH responses, a name followed by its value.
+    //
+    i = 0;
+
+    while (i < aLexer.count && !finished) {
+        NSUInteger msn, list, end;
 
-        //LogInfo(@"%i: %@", i, aString);
-        if (!seen_fetch && [aString hasCaseInsensitivePrefix: [NSString stringWithFormat: @"* %ld FETCH", (long)theMSN]])
-        {
-            seen_fetch = YES;
+        if (!fetch_list(&aLexer, i, &msn, &list)) {
+            i = cw_imap_lexer_next(&aLexer, i);
+            continue;
         }
 
-        if (seen_fetch) {
-            [aMutableArray addObject: [_responsesFromServer objectAtIndex: i]];
-            [aMutableString appendString: aString];
-            if (i < count-1) {
-                [aMutableString appendString: @" "];
-            }
+        //
+        // We read the MSN
+        //
+        if (aMessage.messageNumber != msn) {
+            [aMessage setMessageNumber: msn];
+            messageUpdate.msn = YES;
+            mustUpdateViews = YES;
         }
-    }
 
-    //LogInfo(@"GOT TO PARSE: |%@|", aMutableString);
+        // Store any mapping MSN -> UID that came from the server
+        [_selectedFolder matchUID:theUID withMSN:theMSN];
 
-    aCharacterSet = [NSCharacterSet whitespaceAndNewlineCharacterSet];
-    len = [aMutableString length];
-    i = j = 0;
+        end = MIN(aLexer.tokens[list].value, aLexer.count);
+        i = list + 1;
 
-    aScanner = [[NSScanner alloc] initWithString: aMutableString];
-    [aScanner setScanLocation: i];
+        while (i < end) {
+            const cw_imap_token *aName = &aLexer.tokens[i];
+            const cw_imap_token *aValue = (i + 1 < end ? &aLexer.tokens[i + 1] : NULL);
+            NSUInteger n;
 
-    done = ![aScanner scanUpToCharactersFromSet: aCharacterSet  intoString: NULL];
+            //LogInfo(@"WORD |%.*s|", (int)aName->length, aName->bytes);
 
-    //
-    // We tokenize our string into words
-    //
-    while (!done) {
-        j = [aScanner scanLocation];
-        aWord = [[aMutableString substringWithRange: NSMakeRange(i,j-i)] stringByTrimmingWhiteSpaces];
-
-        //LogInfo(@"WORD |%@|", aWord);
-
-        if ([aWord characterAtIndex: 0] == '(') {
-            aWord = [aWord substringFromIndex: 1];
-        }
-
-        //
-        // We read the MSN
-        //
-        if ([aWord characterAtIndex: 0] == '*') {
-            int msn;
-
-            [aScanner scanInt: &msn];
-            //LogInfo(@"*** msn = %d", msn);
-            if (aMessage.messageNumber != msn) {
-                [aMessage setMessageNumber: msn];
-                messageUpdate.msn = YES;
+            //
+            // We read our UID
+            //
+            if (cw_imap_token_is(aName, "UID")) {
+                if (aValue && cw_imap_token_number(aValue, &n) && [aMessage UID] == 0) {
+                    [aMessage setUID: n];
+                    cacheRecord.imap_uid = n;
+                    messageUpdate.uid = YES;
+                }
             }
+            //
+            // We read our flags. We usually get something like FLAGS (\Seen)
+            //
+            else if (cw_imap_token_is(aName, "FLAGS")) {
+                if (aValue && aValue->type == CWIMAPTokenListBegin) {
+                    CWFlags *flagsBefore = aMessage.flags.copy;
+                    [self _parseFlags: &aLexer
+                                range: NSMakeRange(i + 2, MIN(aValue->value, end) - i - 2)
+                              message: aMessage
+                               record: cacheRecord];
+                    if (!isMessageUpdate) {
+                        messageUpdate.flags = YES;
+                    } else if (aMessage.flags.rawFlagsAsShort != flagsBefore.rawFlagsAsShort) {
+                        // For an existing message: trigger update only if the flags did actually change
+                        messageUpdate.flags = YES;
+                    }
+                }
+            }
+            //
+            // We read the RFC822 message size
+            //
+            else if (cw_imap_token_is(aName, "RFC822.SIZE") && !isMessageUpdate) {
+                if (aValue && cw_imap_token_number(aValue, &n)) {
+                    //LogInfo(@"size = %d", size);
+                    [aMessage setSize: n];
+                    cacheRecord.size = n;
+                    messageUpdate.rfc822Size = YES;
+                    mustUpdateViews = YES;
+                }
+            }
+            //
+            // We must not break immediately after parsing this information. It's very important
+            // since servers like Exchange might send us responses like:
+            //
+            // * 1 FETCH (FLAGS (\Seen) RFC822.SIZE 4491 BODY[HEADER.FIELDS (From To Cc Subject Date Message-ID References In-Reply-To Content-Type)] {337} UID 614348)
+            //
+            // If we break right away, we'll skip the size and more importantly, the UID.
+            //
+            else if (cw_imap_token_is(aName, "BODY[HEADER]") && !isMessageUpdate) {
+                [aMessage setHeadersFromData: [self _dataOfFetchValue: aValue]  record: cacheRecord];
+                messageUpdate.bodyHeader = YES;
+                mustUpdateViews = YES;
+            }
+            //
+            //
+            //
+            else if (cw_imap_token_is(aName, "BODY[TEXT]") && !isMessageUpdate) {
+                NSData *aData = [self _dataOfFetchValue: aValue];
 
-            // Store any mapping MSN -> UID that came from the server
-            [_selectedFolder matchUID:theUID withMSN:theMSN];
-        }
-        // end of reading MSN
-
-        //
-        // We read our UID
-        //
-        if ([aWord caseInsensitiveCompare: @"UID"] == NSOrderedSame)
-        {
-            NSUInteger uid;
+                if (![aMessage content]) {
+                    //
+                    // We do an initial check for the message body. If we haven't read a literal,
+                    // [self.currentQueueObject.info objectForKey: @"NSData"] returns nil. This can
+                    // happen with messages having a totally emtpy body. For those messages,
+                    // we simply set a default content, being an empty NSData instance.
+                    //
+                    if (!aData) aData = [NSData data];
 
-            [aScanner scanUnsignedInt: &uid];
-            //LogInfo(@"uid %d j = %d, scanLoc = %d", uid, j, [aScanner scanLocation]);
+                    [CWMIMEUtility setContentFromRawSource: aData  inPart: aMessage];
+                    [self _setLiteralDigestOfMessage: aMessage];
+                    [aMessage setInitialized: YES];
 
-            if ([aMessage UID] == 0)
-            {
-                [aMessage setUID: uid];
-                cacheRecord.imap_uid = uid;
-                messageUpdate.uid = YES;
-            }
+                    [self.currentQueueObject.info setObject: aMessage  forKey: @"Message"];
 
-            j = [aScanner scanLocation];
-        }
-        //
-        // We read our flags. We usually get something like FLAGS (\Seen)
-        //
-        else if ([aWord caseInsensitiveCompare: @"FLAGS"] == NSOrderedSame) {
-            // We get the substring inside our ( )
-            aRange = [aMutableString rangeOfString: @")"  options: 0  range: NSMakeRange(j,len-j)];
-            //LogInfo(@"Flags = |%@|", [aMutableString substringWithRange: NSMakeRange(j+2, aRange.location-j-2)]);
-            CWFlags *flagsBefore = aMessage.flags.copy;
-            [self _parseFlags: [aMutableString substringWithRange: NSMakeRange(j+2, aRange.location-j-2)]
-                      message: aMessage
-                       record: cacheRecord];
-            j = aRange.location + 1;
-            [aScanner setScanLocation: j];
-            if (!isMessageUpdate) {
-                messageUpdate.flags = YES;
-            } else if (aMessage.flags.rawFlagsAsShort != flagsBefore.rawFlagsAsShort) {
-                // For an existing message: trigger update only if the flags did actually change
-                messageUpdate.flags = YES;
+                    messageUpdate.bodyText = YES;
+                    [[_selectedFolder cacheManager] writeRecord: cacheRecord  message: aMessage
+                                                  messageUpdate: messageUpdate];
+                    prefetched = YES;
+                }
+                finished = YES;
+                break;
             }
-        }
-        //
-        // We read the RFC822 message size
-        //
-        else if ([aWord caseInsensitiveCompare: @"RFC822.SIZE"] == NSOrderedSame&& !isMessageUpdate) {
-            int size;
-
-            [aScanner scanInt: &size];
-            //LogInfo(@"size = %d", size);
-            [aMessage setSize: size];
-            cacheRecord.size = size;
-
-            j = [aScanner scanLocation];
+            //
+            //
+            //
+            else if ((cw_imap_token_is(aName, "RFC822") || cw_imap_token_is(aName, "BODY[]"))
+                     && !isMessageUpdate) {
+                NSData *aData = [self _dataOfFetchValue: aValue];
+                if (!aData) aData = [NSData data];
 
-            messageUpdate.rfc822Size = YES;
-        }
-        //
-        // We must not break immediately after parsing this information. It's very important
-        // since servers like Exchange might send us responses like:
-        //
-        // * 1 FETCH (FLAGS (\Seen) RFC822.SIZE 4491 BODY[HEADER.FIELDS (From To Cc Subject Date Message-ID References In-Reply-To Content-Type)] {337} UID 614348)
-        //
-        // If we break right away, we'll skip the size and more importantly, the UID.
-        //
-        else if ([aWord caseInsensitiveCompare: @"BODY[HEADER]"] == NSOrderedSame && !isMessageUpdate) {
-            [[self.currentQueueObject.info objectForKey: @"NSData"] replaceCRLFWithLF];
-            [aMessage setHeadersFromData: [self.currentQueueObject.info objectForKey: @"NSData"]  record: cacheRecord];
-            messageUpdate.bodyHeader = YES;
-        }
-        //
-        //
-        //
-        else if ([aWord caseInsensitiveCompare: @"BODY[TEXT]"] == NSOrderedSame && !isMessageUpdate) {
-            [[self.currentQueueObject.info objectForKey: @"NSData"] replaceCRLFWithLF];
-            if (![aMessage content]) {
-                NSData *aData;
+                [aMessage setHeadersFromData: aData record: cacheRecord];
+                mustUpdateViews = YES;
 
-                //
-                // We do an initial check for the message body. If we haven't read a literal,
-                // [self.currentQueueObject.info objectForKey: @"NSData"] returns nil. This can
-                // happen with messages having a totally emtpy body. For those messages,
-                // we simply set a default content, being an empty NSData instance.
-                //
-                aData = [self.currentQueueObject.info objectForKey: @"NSData"];
+                NSRange aRange = [aData rangeOfCString: "\n\n"];
+                if (aRange.location != NSNotFound) {
+                    [CWMIMEUtility setContentFromRawSource:
+                     [aData subdataWithRange: NSMakeRange(aRange.location + 2,
+                                                          [aData length] - (aRange.location + 2))]
+                                                    inPart: aMessage];
+                }
 
-                if (!aData) aData = [NSData data];
+                [aMessage setRawSource: aData];
+                [self _setLiteralDigestOfMessage: aMessage];
 
-                [CWMIMEUtility setContentFromRawSource: aData  inPart: aMessage];
                 [aMessage setInitialized: YES];
 
                 [self.currentQueueObject.info setObject: aMessage  forKey: @"Message"];
 
-                messageUpdate.bodyText = YES;
+                messageUpdate.rfc822 = YES;
                 [[_selectedFolder cacheManager] writeRecord: cacheRecord  message: aMessage
                                               messageUpdate: messageUpdate];
-
-                PERFORM_SELECTOR_2(_delegate, @selector(messagePrefetchCompleted:), PantomimeMessagePrefetchCompleted, aMessage, @"Message");
-            }
-            break;
-        }
-        //
-        //
-        //
-        else if (([aWord caseInsensitiveCompare: @"RFC822"] == NSOrderedSame ||
-                 [aWord caseInsensitiveCompare: @"BODY[]"] == NSOrderedSame)
-                 && !isMessageUpdate) {
-            [[self.currentQueueObject.info objectForKey: @"NSData"] replaceCRLFWithLF];
-
-            NSData *aData = [self.currentQueueObject.info objectForKey: @"NSData"];
-            if (!aData) aData = [NSData data];
-
-            [aMessage setHeadersFromData: aData record: cacheRecord];
-
-            NSRange aRange = [aData rangeOfCString: "\n\n"];
-            if (aRange.location != NSNotFound) {
-                [CWMIMEUtility setContentFromRawSource:
-                 [aData subdataWithRange: NSMakeRange(aRange.location + 2,
-                                                      [aData length] - (aRange.location + 2))]
-                                                inPart: aMessage];
+                prefetched = YES;
+                finished = YES;
+                break;
             }
 
-            [aMessage setRawSource: aData];
-
-            [aMessage setInitialized: YES];
+            i = cw_imap_lexer_next(&aLexer, i + 1);
+        }
 
-            [self.currentQueueObject.info setObject: aMessage  forKey: @"Message"];
+        if (!finished) {
+            i = cw_imap_lexer_next(&aLexer, list);
+        }
+    }
 
-            messageUpdate.rfc822 = YES;
+    if (!finished && must_flush_record) {
+        if (isMessageUpdate && !messageUpdate.isNoChange) {
+            // If the message existed locally before (is update), bother the cache manager only
+            // if something has changed on server.
             [[_selectedFolder cacheManager] writeRecord: cacheRecord  message: aMessage
                                           messageUpdate: messageUpdate];
-
-            PERFORM_SELECTOR_2(_delegate, @selector(messagePrefetchCompleted:),
-                               PantomimeMessagePrefetchCompleted, aMessage, @"Message");
-
-            break;
         }
+    }
 
-        i = j;
-        done = ![aScanner scanUpToCharactersFromSet: aCharacterSet  intoString: NULL];
+    cw_imap_lexer_free(&aLexer);
 
-        if (done && must_flush_record) {
-            if (isMessageUpdate && !messageUpdate.isNoChange) {
-                // If the message existed locally before (is update), bother the cache manager only
-                // if something has changed on server.
-                [[_selectedFolder cacheManager] writeRecord: cacheRecord  message: aMessage
-                                              messageUpdate: messageUpdate];
-            }
-        }
+    //
+    // The message was appended to the folder, and so to its views, before
+    // its size, number and headers were read. We move it once, now that
+    // they all are known, and before the delegate can look at the views.
+    //
+    if (mustUpdateViews) {
+        [_selectedFolder updateMessage: aMessage];
     }
 
-    RELEASE(aScanner);
-    RELEASE(aMutableString);
+    if (prefetched) {
+        PERFORM_SELECTOR_2(_delegate, @selector(messagePrefetchCompleted:),
+                           PantomimeMessagePrefetchCompleted, aMessage, @"Message");
+    }
 
     //
     // It is important that we remove the responses we have processed. This is particularly
@@ -2189,6 +2495,230 @@ static inline int has_literal(char *buf, NSUInteger c)
 }
 
 
+//
+// The contents of a FETCH data item: the bytes of the literal we read
+// for it, or its quoted string.
+//
+- (NSData *) _dataOfFetchValue: (const cw_imap_token *) theToken
+{
+    if (!theToken || theToken->type == CWIMAPTokenLiteral)
+    {
+        NSMutableData *aData = [self.currentQueueObject.info objectForKey: @"NSData"];
+
+        [aData replaceCRLFWithLF];
+        return aData;
+    }
+
+    return cw_imap_token_data(theToken);
+}
+
+
+//
+// Moves the digest of the literal we just read, if we computed one,
+// to the message whose content was read from it.
+//
+- (void) _setLiteralDigestOfMessage: (CWMessage *) theMessage
+{
+    NSData *aDigest = [self.currentQueueObject.info objectForKey: @"LiteralDigest"];
+
+    if (aDigest)
+    {
+        [theMessage setProperty: aDigest  forKey: PantomimeMessageLiteralDigest];
+        [self.currentQueueObject.info removeObjectForKey: @"LiteralDigest"];
+    }
+}
+
+
+//
+// This method parses the FETCH response to a IMAP_UID_FETCH_BINARY,
+// IMAP_UID_FETCH_BINARY_SIZE or IMAP_UID_FETCH_PARTIAL command:
+//
+// * 12 FETCH (UID 54 BINARY[2] ~{3456}
+// ...
+// )
+//
+// * 12 FETCH (UID 54 BINARY.SIZE[2] 3456)
+//
+// * 12 FETCH (UID 54 BODY[]<1048576> {1048576}
+// ...
+// )
+//
+// The content of BINARY[section] was decoded by the server and is set
+// on the part as is. If the server lacks BINARY, we fetched BODY[section]
+// instead and decode it like any other part. A partial fetch names the
+// origin of its bytes, like BODY[]<1048576>. A window of a spooled section
+// is written as is at its offset. Other FETCH responses, like flag updates,
+// are parsed by -_parseFETCH:.
+//
+- (void) _parseFETCH_BINARY: (NSInteger) theMSN
+{
+    NSMutableArray *aMutableArray;
+    NSString *aSection, *aPath, *anOrigin;
+    cw_imap_lexer aLexer;
+    CWPart *aPart;
+    const char *aBinaryName, *aBodyName, *aSizeName, *aSpoolName;
+    char aPrefix[32];
+    size_t aPrefixLength;
+    unsigned long long offset;
+    NSUInteger i, count;
+    BOOL seen_fetch, found;
+
+    aPart = [self.currentQueueObject.info objectForKey: @"Part"];
+    aPath = [self.currentQueueObject.info objectForKey: @"Path"];
+    aSection = [self.currentQueueObject.info objectForKey: @"Section"];
+    offset = [[self.currentQueueObject.info objectForKey: @"Offset"] unsignedLongLongValue];
+
+    if (!aSection || (!aPart && !aPath))
+    {
+        [self _parseFETCH: theMSN];
+        return;
+    }
+
+    anOrigin = ([self.currentQueueObject.info objectForKey: @"Length"] ? @"<0>" : @"");
+    aBinaryName = [[NSString stringWithFormat: @"BINARY[%@]%@", aSection, anOrigin] UTF8String];
+    aBodyName = [[NSString stringWithFormat: @"BODY[%@]%@", aSection, anOrigin] UTF8String];
+    aSizeName = [[NSString stringWithFormat: @"BINARY.SIZE[%@]", aSection] UTF8String];
+    aSpoolName = (aPath ? [[NSString stringWithFormat: @"BODY[%@]<%llu>", aSection, offset] UTF8String] : NULL);
+
+    aMutableArray = [[NSMutableArray alloc] init];
+    aPrefixLength = snprintf(aPrefix, sizeof(aPrefix), "* %ld FETCH", (long)theMSN);
+    count = [_responsesFromServer count];
+    seen_fetch = found = NO;
+
+    cw_imap_lexer_init(&aLexer);
+
+    for (i = 0; i < count; i++)
+    {
+        NSData *aData = [_responsesFromServer objectAtIndex: i];
+
+        if (!seen_fetch && [aData length] >= aPrefixLength &&
+            strncasecmp([aData bytes], aPrefix, aPrefixLength) == 0)
+        {
+            seen_fetch = YES;
+        }
+
+        if (seen_fetch)
+        {
+            [aMutableArray addObject: aData];
+            cw_imap_lexer_add_line(&aLexer, [aData bytes], [aData length]);
+        }
+    }
+
+    for (i = 0; i < aLexer.count; i = cw_imap_lexer_next(&aLexer, i))
+    {
+        NSUInteger msn, list, end, n;
+
+        if (!fetch_list(&aLexer, i, &msn, &list))
+        {
+            continue;
+        }
+
+        end = MIN(aLexer.tokens[list].value, aLexer.count);
+
+        for (i = list + 1; i < end; i = cw_imap_lexer_next(&aLexer, i + 1))
+        {
+            const cw_imap_token *aName = &aLexer.tokens[i];
+            const cw_imap_token *aValue = (i + 1 < end ? &aLexer.tokens[i + 1] : NULL);
+
+            if (aSpoolName)
+            {
+                NSFileHandle *aFileHandle;
+                NSData *aData = nil;
+
+                if (!cw_imap_token_is(aName, aSpoolName))
+                {
+                    continue;
+                }
+
+                // The offsets of the next windows count the bytes as sent.
+                if (aValue && aValue->type == CWIMAPTokenLiteral)
+                {
+                    aData = [self.currentQueueObject.info objectForKey: @"NSData"];
+                    [self.currentQueueObject.info removeObjectForKey: @"NSData"];
+                }
+                else if (aValue)
+                {
+                    aData = cw_imap_token_data(aValue);
+                }
+
+                if (!aData) aData = [NSData data];
+
+                aFileHandle = [NSFileHandle fileHandleForWritingAtPath: aPath];
+
+                if (aFileHandle)
+                {
+                    [aFileHandle seekToFileOffset: offset];
+                    [aFileHandle writeData: aData];
+                    [aFileHandle truncateFileAtOffset: offset + [aData length]];
+                    [aFileHandle closeFile];
+
+                    [self.currentQueueObject.info setObject: [NSNumber numberWithUnsignedInteger: [aData length]]
+                                                     forKey: @"Received"];
+                    found = YES;
+                }
+            }
+            else if (cw_imap_token_is(aName, aBinaryName))
+            {
+                NSData *aData = nil;
+
+                if (aValue && aValue->type == CWIMAPTokenLiteral)
+                {
+                    // The bytes are binary, their line endings must be kept.
+                    aData = [self.currentQueueObject.info objectForKey: @"NSData"];
+                    [self.currentQueueObject.info removeObjectForKey: @"NSData"];
+                }
+                else if (aValue)
+                {
+                    aData = cw_imap_token_data(aValue);
+                }
+
+                if (!aData) aData = [NSData data];
+
+                [aPart setContent: aData];
+                [aPart setSize: [aData length]];
+                found = YES;
+            }
+            else if (cw_imap_token_is(aName, aBodyName))
+            {
+                NSData *aData = [self _dataOfFetchValue: aValue];
+
+                if (!aData) aData = [NSData data];
+
+                aData = [CWMIMEUtility discreteContentFromRawSource: aData
+                                                          encoding: [aPart contentTransferEncoding]];
+                [aPart setContent: aData];
+                [aPart setSize: [aData length]];
+                found = YES;
+            }
+            else if (cw_imap_token_is(aName, aSizeName))
+            {
+                if (aValue && cw_imap_token_number(aValue, &n))
+                {
+                    [aPart setSize: n];
+                    found = YES;
+                }
+            }
+        }
+
+        i = list;
+    }
+
+    cw_imap_lexer_free(&aLexer);
+
+    if (found)
+    {
+        [self.currentQueueObject.info setObject: [NSNumber numberWithBool: YES]  forKey: @"Fetched"];
+        [_responsesFromServer removeObjectsInArray: aMutableArray];
+    }
+    else
+    {
+        [self _parseFETCH: theMSN];
+    }
+
+    RELEASE(aMutableArray);
+}
+
+
 //
 // This command parses the result of a LIST command. See 7.2.2 for the complete
 // description of the LIST response.
@@ -2222,14 +2752,21 @@ static inline int has_literal(char *buf, NSUInteger c)
 //
 - (void) _parseLIST
 {
-    NSString *aFolderName, *aString, *theString;
-    NSRange r1, r2;
-    NSUInteger len;
+    NSString *aFolderName, *aString;
+    NSUInteger count, attributes, separator, name;
+    cw_imap_lexer aLexer;
+    NSData *aData;
+
+    count = [_responsesFromServer count];
+    aData = [_responsesFromServer lastObject];
+    aFolderName = nil;
+
+    cw_imap_lexer_init(&aLexer);
+    cw_imap_lexer_add_line(&aLexer, [aData bytes], [aData length]);
 
-    theString = [[_responsesFromServer lastObject] imapUtf7String];
     //
-    // We verify if we got the number of bytes to read instead of the real mailbox name.
-    // That happens if we couldn't get the ASCII string of what we read.
+    // We verify if we got the mailbox name on its own, as a literal, instead of
+    // the whole response.
     //
     // Some servers seem to send that when the mailbox name is 8-bit. Those 8-bit mailbox
     // names were undefined in earlier versions of the IMAP protocol (now deprecated).
@@ -2237,50 +2774,66 @@ static inline int has_literal(char *buf, NSUInteger c)
     //
     // The RFC says we SHOULD interpret that as UTF-8.
     //
-    // If we got a 8-bit string, we rollback to get the previous answer in order
-    // to also decode the mailbox attribute.
+    // If we got the name on its own, we rollback to get the previous answer in order
+    // to also decode the mailbox attributes.
     //
-    if (!theString)
+    if (!list_response(&aLexer, &attributes, &separator, &name) && count > 1)
     {
-        aFolderName = AUTORELEASE([[NSString alloc] initWithData: [_responsesFromServer lastObject]  encoding: NSUTF8StringEncoding]);
+        aFolderName = AUTORELEASE([[NSString alloc] initWithData: aData  encoding: NSUTF8StringEncoding]);
 
         // We get the "previous" line which contains our mailbox attributes
-        theString = [[_responsesFromServer objectAtIndex: [_responsesFromServer count]-2] asciiString];
-    }
-    else
-    {
-        // We get the folder name and the mailbox name attributes
-        aFolderName = [self _folderNameFromString: theString];
+        aData = [_responsesFromServer objectAtIndex: count-2];
+        cw_imap_lexer_reset(&aLexer);
+        cw_imap_lexer_add_line(&aLexer, [aData bytes], [aData length]);
     }
 
-    //
-    // If the folder name starts/ends with {}, that means it was "wrongly" encoded using
-    // 8-bit characters which are not allowed. We just return since we'll re-enter in
-    // _parseLIST whenever the real mailbox name will be read.
-    //
-    len = [aFolderName length];
-    if (len > 0 && [aFolderName characterAtIndex: 0] == '{' && [aFolderName characterAtIndex: len-1] == '}')
+    if (!list_response(&aLexer, &attributes, &separator, &name))
     {
+        cw_imap_lexer_free(&aLexer);
         return;
     }
 
-    // We try to get our name attributes.
-    r1 = [theString rangeOfString: @"("];
+    // Check if we got "NIL" or a real separator.
+    if (aLexer.tokens[separator].type == CWIMAPTokenQuoted && aLexer.tokens[separator].length == 1)
+    {
+        _folderSeparator = aLexer.tokens[separator].bytes[0];
+    }
+    else
+    {
+        _folderSeparator = 0;
+    }
 
-    if (r1.location == NSNotFound)
+    if (!aFolderName)
     {
-        return;
+        //
+        // If the folder name is a literal, it was "wrongly" encoded using 8-bit
+        // characters which are not allowed. We just return since we'll re-enter in
+        // _parseLIST whenever the real mailbox name will be read.
+        //
+        if (name >= aLexer.count || aLexer.tokens[name].type == CWIMAPTokenLiteral)
+        {
+            cw_imap_lexer_free(&aLexer);
+            return;
+        }
+
+        aFolderName = cw_imap_token_string(&aLexer.tokens[name],
+                                           CFStringConvertEncodingToNSStringEncoding(kCFStringEncodingUTF7_IMAP));
+
+        if (!aFolderName)
+        {
+            aFolderName = cw_imap_token_string(&aLexer.tokens[name], NSUTF8StringEncoding);
+        }
     }
 
-    r2 = [theString rangeOfString: @")"  options: 0  range: NSMakeRange(r1.location+1, [theString length]-r1.location-1)];
+    // We get our name attributes.
+    aString = list_attributes(&aLexer, attributes);
+    cw_imap_lexer_free(&aLexer);
 
-    if (r2.location == NSNotFound)
+    if (!aFolderName)
     {
         return;
     }
 
-    aString = [theString substringWithRange: NSMakeRange(r1.location+1, r2.location-r1.location-1)];
-
     // We get all the supported flags
     PantomimeFolderAttribute folderAttributes = [self _folderAttributesForServerResponse:aString];
 
@@ -2455,7 +3008,10 @@ static inline int has_literal(char *buf, NSUInteger c)
             case IMAP_AUTHENTICATE_CRAM_MD5:
             case IMAP_AUTHENTICATE_LOGIN:
             case IMAP_AUTHENTICATE_XOAUTH2:
+            case IMAP_AUTHENTICATE_PLAIN:
             case IMAP_LOGIN:
+                // The cached capabilities might have led to the wrong mechanism.
+                [self _forgetCapabilities];
                 AUTHENTICATION_FAILED(_delegate, _mechanism);
                 break;
 
@@ -2510,6 +3066,28 @@ static inline int has_literal(char *buf, NSUInteger c)
                 PERFORM_SELECTOR_1(_delegate, @selector(folderSearchFailed:), PantomimeFolderSearchFailed);
                 break;
 
+            case IMAP_UID_FETCH_BINARY:
+                //
+                // Servers answer NO [UNKNOWN-CTE] when they cannot decode
+                // a part (RFC 3516, 4.3). We then fetch it as is and decode
+                // it ourselves.
+                //
+                if ([self.currentQueueObject.arguments rangeOfString: @"BINARY.PEEK"].location != NSNotFound &&
+                    [aData rangeOfCString: "[UNKNOWN-CTE]"  options: NSCaseInsensitiveSearch].location != NSNotFound)
+                {
+                    [self fetchPart: [self.currentQueueObject.info objectForKey: @"Part"]
+                            section: [self.currentQueueObject.info objectForKey: @"Section"]
+                                UID: [[self.currentQueueObject.info objectForKey: @"UID"] unsignedIntegerValue]
+                             binary: NO
+                             length: [[self.currentQueueObject.info objectForKey: @"Length"] unsignedIntegerValue]];
+                    break;
+                }
+                // fall through
+            case IMAP_UID_FETCH_BINARY_SIZE:
+            case IMAP_UID_FETCH_PARTIAL:
+                PERFORM_SELECTOR_3(_delegate, @selector(partFetchFailed:), PantomimePartFetchFailed, self.currentQueueObject.info);
+                break;
+
             case IMAP_STATUS:
                 PERFORM_SELECTOR_2(_delegate, @selector(folderStatusFailed:), PantomimeFolderStatusFailed, [self.currentQueueObject.info objectForKey: @"Name"], @"Name");
                 break;
@@ -2570,6 +3148,8 @@ static inline int has_literal(char *buf, NSUInteger c)
             PERFORM_SELECTOR_3(_delegate, @selector(commandCompleted:), @"PantomimeCommandCompleted", self.currentQueueObject.info);
 
             [_queue removeLastObject];
+            [_metrics setQueueDepth: [_queue count]];
+            [_metrics commandCompleted];
             [self sendCommand: IMAP_EMPTY_QUEUE  info: nil  arguments: @""];
         }
 
@@ -2600,6 +3180,21 @@ static inline int has_literal(char *buf, NSUInteger c)
 
         //LogInfo(@"IN _parseOK: |%@|", [aData asciiString]);
 
+        //
+        // Any tagged OK may carry the capabilities (7.1). Before we are
+        // authenticated, they must agree with the cached ones.
+        //
+        if (![aData hasCPrefix: "*"] && !_authenticated && !is_authentication(_lastCommand))
+        {
+            NSArray *allCapabilities = capability_code(aData, _defaultStringEncoding);
+
+            if (allCapabilities)
+            {
+                [self _setCapabilities: allCapabilities];
+                [self _checkCachedCapabilities];
+            }
+        }
+
         switch (_lastCommand)
         {
             case IMAP_APPEND:
@@ -2620,7 +3215,19 @@ static inline int has_literal(char *buf, NSUInteger c)
             case IMAP_AUTHENTICATE_CRAM_MD5:
             case IMAP_AUTHENTICATE_LOGIN:
             case IMAP_AUTHENTICATE_XOAUTH2:
-            case IMAP_LOGIN:
+            case IMAP_AUTHENTICATE_PLAIN:
+            case IMAP_LOGIN: {
+                // Servers may announce their capabilities after authentication in the
+                // tagged OK (7.1), they replace the ones we had before.
+                NSArray *allCapabilities = capability_code(aData, _defaultStringEncoding);
+
+                if (allCapabilities)
+                {
+                    [self _setCapabilities: allCapabilities];
+                }
+
+                _authenticated = YES;
+
                 if (_connection_state.reconnecting)
                 {
                     if (_selectedFolder)
@@ -2646,11 +3253,31 @@ static inline int has_literal(char *buf, NSUInteger c)
                     AUTHENTICATION_COMPLETED(_delegate, _mechanism);
                 }
                 break;
+            }
 
             case IMAP_AUTHORIZATION:
-                if ([aData hasCPrefix: "* OK"])
+                // Once we know the capabilities, a later untagged OK is no greeting.
+                if ([aData hasCPrefix: "* OK"] && ![_capabilities count])
                 {
-                    [self sendCommand: IMAP_CAPABILITY  info: nil  arguments: @"CAPABILITY"];
+                    NSArray *allCapabilities = capability_code(aData, _defaultStringEncoding);
+
+                    if (!allCapabilities)
+                    {
+                        NSMutableDictionary *aCache = capabilities_cache();
+
+                        @synchronized(aCache) {
+                            allCapabilities = [aCache objectForKey: [self _capabilitiesCacheKey]];
+                        }
+                    }
+
+                    if (allCapabilities)
+                    {
+                        [self _capabilitiesReceived: allCapabilities];
+                    }
+                    else
+                    {
+                        [self sendCommand: IMAP_CAPABILITY  info: nil  arguments: @"CAPABILITY"];
+                    }
                 }
                 else
                 {
@@ -2736,6 +3363,41 @@ static inline int has_literal(char *buf, NSUInteger c)
                 PERFORM_SELECTOR_2(_delegate, @selector(folderFetchCompleted:), PantomimeFolderFetchCompleted, _selectedFolder, @"Folder");
                 break;
 
+            case IMAP_UID_FETCH_BINARY:
+            case IMAP_UID_FETCH_BINARY_SIZE: {
+                NSDictionary *userInfo = [NSDictionary dictionaryWithObjectsAndKeys:
+                                          [self.currentQueueObject.info objectForKey: @"Part"], @"Part",
+                                          [self.currentQueueObject.info objectForKey: @"Section"], @"Section", nil];
+
+                // An OK without the data item means there is no such message or part.
+                if ([self.currentQueueObject.info objectForKey: @"Fetched"]) {
+                    PERFORM_SELECTOR_3(_delegate, @selector(partFetchCompleted:), PantomimePartFetchCompleted, userInfo);
+                } else {
+                    PERFORM_SELECTOR_3(_delegate, @selector(partFetchFailed:), PantomimePartFetchFailed, userInfo);
+                }
+                break;
+            }
+
+            case IMAP_UID_FETCH_PARTIAL: {
+                NSDictionary *info = self.currentQueueObject.info;
+                NSDictionary *userInfo = [NSDictionary dictionaryWithObjectsAndKeys:
+                                          [info objectForKey: @"Path"], @"Path",
+                                          [info objectForKey: @"Section"], @"Section", nil];
+
+                if (![info objectForKey: @"Fetched"]) {
+                    PERFORM_SELECTOR_3(_delegate, @selector(partFetchFailed:), PantomimePartFetchFailed, userInfo);
+                } else if ([[info objectForKey: @"Received"] unsignedIntegerValue] == [[info objectForKey: @"Window"] unsignedIntegerValue]) {
+                    // A full window, the section might go on. The next one starts at the end of the file.
+                    [self fetchSection: [info objectForKey: @"Section"]
+                                   UID: [[info objectForKey: @"UID"] unsignedIntegerValue]
+                                toFile: [info objectForKey: @"Path"]
+                                window: [[info objectForKey: @"Window"] unsignedIntegerValue]];
+                } else {
+                    PERFORM_SELECTOR_3(_delegate, @selector(partFetchCompleted:), PantomimePartFetchCompleted, userInfo);
+                }
+                break;
+            }
+
             case IMAP_UID_FETCH_FLAGS: {
                 _connection_state.opening_mailbox = NO;
                 PERFORM_SELECTOR_2(_delegate, @selector(folderSyncCompleted:), PantomimeFolderSyncCompleted, _selectedFolder, @"Folder");
@@ -2824,6 +3486,8 @@ static inline int has_literal(char *buf, NSUInteger c)
             }
 
             [_queue removeLastObject];
+            [_metrics setQueueDepth: [_queue count]];
+            [_metrics commandCompleted];
             [self sendCommand: IMAP_EMPTY_QUEUE  info: nil  arguments: @""];
         }
 
@@ -3016,6 +3680,7 @@ static inline int has_literal(char *buf, NSUInteger c)
 //
 - (void) _parseSELECT
 {
+    cw_imap_lexer aLexer;
     NSData *aData;
     NSUInteger i, count;
 
@@ -3031,37 +3696,56 @@ static inline int has_literal(char *buf, NSUInteger c)
     // The last object in _responsesFromServer is a tagged OK response.
     // We need to parse it here.
     count = [_responsesFromServer count];
+    cw_imap_lexer_init(&aLexer);
 
     for (i = 0; i < count; i++)
     {
-        aData = [[_responsesFromServer objectAtIndex: i] dataByTrimmingWhiteSpaces];
+        const cw_imap_token *aCode;
+        NSUInteger n;
 
-        //LogInfo(@"|%@|", [aData asciiString]);
-        // * OK [UIDVALIDITY 1052146864]
-        if ([aData hasCPrefix: "* OK [UIDVALIDITY"])
+        aData = [_responsesFromServer objectAtIndex: i];
+        cw_imap_lexer_reset(&aLexer);
+        cw_imap_lexer_add_line(&aLexer, [aData bytes], [aData length]);
+
+        // We only look at the response codes of OK responses: "<tag> OK [<code> ...]"
+        if (aLexer.count < 4 || !cw_imap_token_is(&aLexer.tokens[1], "OK") ||
+            aLexer.tokens[2].type != CWIMAPTokenCodeBegin)
         {
-            [self _parseUIDVALIDITY: [aData cString]];
+            continue;
         }
 
+        aCode = &aLexer.tokens[3];
+
+        // * OK [UIDVALIDITY 1052146864]
+        if (cw_imap_token_is(aCode, "UIDVALIDITY"))
+        {
+            if (aLexer.count > 4 && cw_imap_token_number(&aLexer.tokens[4], &n))
+            {
+                [_selectedFolder setUIDValidity: n];
+            }
+        }
         // S: * OK [UIDNEXT 4392] Predicted next UID
-        if ([aData hasCPrefix: "* OK [UIDNEXT"])
+        else if (cw_imap_token_is(aCode, "UIDNEXT"))
         {
-            [self _parseUIDNEXT: [aData cString]];
+            if (aLexer.count > 4 && cw_imap_token_number(&aLexer.tokens[4], &n))
+            {
+                [_selectedFolder setNextUID: n];
+            }
         }
-
         // 3c4d OK [READ-ONLY] Completed
-        if ([aData rangeOfCString: "OK [READ-ONLY]"].length)
+        else if (cw_imap_token_is(aCode, "READ-ONLY"))
         {
             [_selectedFolder setMode: PantomimeReadOnlyMode];
         }
-
         // 1a2b OK [READ-WRITE] Completed
-        if ([aData rangeOfCString: "OK [READ-WRITE]"].length)
+        else if (cw_imap_token_is(aCode, "READ-WRITE"))
         {
             [_selectedFolder setMode: PantomimeReadWriteMode];
         }
     }
 
+    cw_imap_lexer_free(&aLexer);
+
     if (_connection_state.reconnecting)
     {
         [self _restoreQueue];
@@ -3101,22 +3785,44 @@ static inline int has_literal(char *buf, NSUInteger c)
     NSDictionary *info;
     NSData *aData;
 
-    NSRange aRange;
-    int messages, unseen;
+    NSUInteger i, list, end, messages, unseen;
+    cw_imap_lexer aLexer;
 
     aData = [_responsesFromServer lastObject];
 
-    aRange = [aData rangeOfCString: "("  options: NSBackwardsSearch];
-    aFolderName = [[[aData subdataToIndex: (aRange.location-1)] subdataFromIndex: 9] asciiString];
+    cw_imap_lexer_init(&aLexer);
+    cw_imap_lexer_add_line(&aLexer, [aData bytes], [aData length]);
+
+    list = 3;
+
+    if (aLexer.count <= list || aLexer.tokens[list].type != CWIMAPTokenListBegin ||
+        !(aFolderName = cw_imap_token_string(&aLexer.tokens[2], NSASCIIStringEncoding)))
+    {
+        cw_imap_lexer_free(&aLexer);
+        return;
+    }
 
-    sscanf([[aData subdataFromIndex: aRange.location] cString], "(MESSAGES %d UNSEEN %d)", &messages, &unseen);
+    messages = unseen = 0;
+    end = MIN(aLexer.tokens[list].value, aLexer.count);
+
+    for (i = list + 1; i + 1 < end; i += 2)
+    {
+        if (cw_imap_token_is(&aLexer.tokens[i], "MESSAGES"))
+        {
+            cw_imap_token_number(&aLexer.tokens[i+1], &messages);
+        }
+        else if (cw_imap_token_is(&aLexer.tokens[i], "UNSEEN"))
+        {
+            cw_imap_token_number(&aLexer.tokens[i+1], &unseen);
+        }
+    }
+
+    cw_imap_lexer_free(&aLexer);
 
     aFolderInformation = [[CWFolderInformation alloc] init];
     [aFolderInformation setNbOfMessages: messages];
     [aFolderInformation setNbOfUnreadMessages: unseen];
     
-    // Before putting the folder in our dictionary, we unquote it.
-    aFolderName = [aFolderName stringFromQuotedString];
     [_folderStatus setObject: aFolderInformation  forKey: aFolderName];
     
     info = [NSDictionary dictionaryWithObjectsAndKeys: aFolderInformation, @"FolderInformation", aFolderName, @"FolderName", nil];
@@ -3133,24 +3839,6 @@ static inline int has_literal(char *buf, NSUInteger c)
 }
 
 
-//
-// Example: * OK [UIDVALIDITY 948394385]
-//
-- (void) _parseUIDVALIDITY: (const char *) theString
-{
-    unsigned int n;
-    sscanf(theString, "* OK [UIDVALIDITY %u]", &n);
-    [_selectedFolder setUIDValidity: n];
-}
-
-- (void) _parseUIDNEXT: (const char *) theString
-{
-    unsigned int n;
-    sscanf(theString, "* OK [UIDNEXT %u]", &n);
-    [_selectedFolder setNextUID:n];
-}
-
-
 //
 //
 //
@@ -3158,7 +3846,20 @@ static inline int has_literal(char *buf, NSUInteger c)
 {
     // Synchronize all methods that alter the _queue
     @synchronized(self) {
-        // We restore our list of pending commands
+        // We restore our list of pending commands. They are sent again: an
+        // APPEND starts over with its first literal, the partial literal we
+        // were reading for a command must go.
+        for (CWIMAPQueueObject *aQueueObject in _connection_state.previous_queue)
+        {
+            [aQueueObject.info removeObjectForKey: @"NextLiteral"];
+
+            if (aQueueObject.literal)
+            {
+                aQueueObject.literal = 0;
+                [aQueueObject.info removeObjectForKey: @"NSData"];
+                [aQueueObject.info removeObjectForKey: @"Digest"];
+            }
+        }
         [_queue addObjectsFromArray: _connection_state.previous_queue];
 
         // We clean the state
@@ -0,0 +1,34 @@
+//
+//  CWInternetAddress+Parsing.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWInternetAddress.h"
+
+@interface CWInternetAddress (Parsing)
+
+/**
+ Parses an RFC 5322 address-list, like the value of a To: or Cc: header, in a single pass over
+ the raw header bytes. Handles groups, quoted strings, comments, "addr (Name)" and encoded-words
+ in display names, which are decoded using theCharset if not nil (see CWMIMEUtility
+ +decodeHeader:charset:). Malformed entries without an address are skipped.
+
+ @return The CWInternetAddress instances, in order.
+ */
++ (NSArray *) addressesFromBytes: (const unsigned char *) theBytes
+                          length: (NSUInteger) theLength
+                         charset: (NSString *) theCharset;
+
+/**
+ Same as -initWithString:, on raw header bytes holding a single mailbox. Encoded-words in the
+ display name are decoded like in +addressesFromBytes:length:charset:.
+
+ @return The instance, nil if there is no address.
+ */
+- (instancetype) initWithBytes: (const unsigned char *) theBytes
+                        length: (NSUInteger) theLength
+                       charset: (NSString *) theCharset;
+
+@end
@@ -20,6 +20,7 @@
 **  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 */
 #import "CWInternetAddress.h"
+#import "CWInternetAddress+Parsing.h"
 
 #import "CWConstants.h"
 #import "CWMIMEUtility.h"
@@ -29,6 +30,37 @@
 
 #import <Foundation/Foundation.h>
 
+#include <string.h>
+
+//
+// The parts of one mailbox of an address-list, as byte ranges. See next_mailbox().
+//
+typedef struct
+{
+  NSRange phrase;   // the display name, or the addr-spec if there is no angle-addr
+  NSRange angle;    // what is between < and >
+  NSRange comment;  // the first comment, for "addr (Name)"
+} cw_mailbox;
+
+static NSUInteger next_mailbox(const unsigned char *theBytes, NSUInteger theStart, NSUInteger theLength,
+			       BOOL isList, cw_mailbox *theMailbox);
+
+//
+// Private methods
+//
+@interface CWInternetAddress (Private)
+
+- (id) _initWithBytes: (const unsigned char *) theBytes
+	       length: (NSUInteger) theLength
+	      charset: (NSString *) theCharset
+	       decode: (BOOL) theBOOL;
+- (id) _initWithMailbox: (cw_mailbox *) theMailbox
+		  bytes: (const unsigned char *) theBytes
+		charset: (NSString *) theCharset
+		 decode: (BOOL) theBOOL;
+
+@end
+
 //
 //
 //
@@ -36,13 +68,10 @@
 
 - (id) initWithString: (NSString *) theString
 {
-  NSInteger a, b;
+  const char *bytes;
 
-  self = [super init];
-  
   if (!theString)
     {
-      AUTORELEASE_VOID(self);
       return nil;
     }
   
@@ -53,102 +82,23 @@
   // <ludovic@Sophos.ca>
   // "Marcotte, Ludovic" <ludovic@Sophos.ca>
   // "Joe" User <joe@acme.com>
+  // joe@acme.com (Joe User)
   //
-//!  also support "joe@acme.com (Joe User)"
+  // theString is already decoded, so we don't decode encoded-words again.
+  bytes = [theString UTF8String];
 
-  a = [theString indexOfCharacter: '<'];
-
-  if (a >= 0)
+  if (!bytes)
     {
-      b = [theString indexOfCharacter: '>'  fromIndex: a+1];
-
-      // If the trailing '>' is missing, then just take the rest of the string
-      if (b < 0)
-	{
-	  b = [theString length];
-	}
-      
-      [self setAddress: [theString substringWithRange: NSMakeRange(a+1,b-a-1)]];
-	  
-      if (a > 0)
-	{
-	  NSInteger c, d;
-
-	  c = [theString indexOfCharacter: '"'];
-
-	  if (c >= 0)
-	    {
-	      d = [theString indexOfCharacter: '"'  fromIndex: c+1];
-	      
-	      //
-	      // We make sure we check this. We could get something like:
-	      // Joe" User <joe@acme.com>
-	      //
-	      if (d > c)
-		{
-		  BOOL b;
-		  
-		  b = YES;
-		  
-		  //
-		  // Check if between d and a there is only whitespace, this covers
-		  // cases like: "Joe" User <joe@acme.com>"
-		  //
-		  if (d < a)
-		    {
-		      unichar buf[[theString length]];
-		      unsigned idx;
-		      
-		      [theString getCharacters: buf range: NSMakeRange(d+1, a-d)];
-		      idx = 0;
-		      while (b && idx < a-d)
-			{
-			  b = isspace(buf[idx]);
-			  idx++;
-			}
-		    }
-		  
-		  if (b)
-		    {
-		      [self setPersonal: [theString substringWithRange: NSMakeRange(c+1,d-c-1)]];
-		    }
-		  else
-		    {
-		      [self setPersonal: [[theString substringWithRange: NSMakeRange(0,a)]
-					   stringByTrimmingWhiteSpaces]];
-		    }
-		}
-	    }
-	  else
-	    {
-	      [self setPersonal: [[theString substringWithRange: NSMakeRange(0,a)]
-				   stringByTrimmingWhiteSpaces]];
-	    }
-	}
-    }
-  else
-    {
-      [self setAddress: theString];
-    }
-
-    // Remove trailing back slashes.
-    NSString *addressString = [self.address stringFromQuotedString];
-    while ([addressString hasSuffix:@"\\"]) {
-        NSUInteger lastIndex = addressString.length - 1;
-        if (lastIndex > 0) {
-            lastIndex -= 1;
-        }
-        addressString = [addressString substringToIndex:lastIndex];
+      return nil;
     }
 
-    if (addressString.length == 0) {
-        return nil;
-    } else {
-        self.address = addressString;
-        return self;
-    }
+  return [self _initWithBytes: (const unsigned char *)bytes
+			length: strlen(bytes)
+		       charset: nil
+			decode: NO];
 }
 
+
 //
 //
 //
@@ -403,3 +353,359 @@
 @end
 
 
+//
+//
+//
+@implementation CWInternetAddress (Parsing)
+
++ (NSArray *) addressesFromBytes: (const unsigned char *) theBytes
+                          length: (NSUInteger) theLength
+                         charset: (NSString *) theCharset
+{
+  NSMutableArray *allAddresses;
+  NSUInteger i;
+
+  allAddresses = [NSMutableArray array];
+  i = 0;
+
+  while (i < theLength)
+    {
+      CWInternetAddress *anInternetAddress;
+      cw_mailbox aMailbox;
+
+      i = next_mailbox(theBytes, i, theLength, YES, &aMailbox);
+      anInternetAddress = [[CWInternetAddress alloc] _initWithMailbox: &aMailbox
+							      bytes: theBytes
+							    charset: theCharset
+							     decode: YES];
+
+      // We ignore malformed addresses and empty group members.
+      if (anInternetAddress)
+	{
+	  [allAddresses addObject: anInternetAddress];
+	}
+    }
+
+  return allAddresses;
+}
+
+
+//
+//
+//
+- (instancetype) initWithBytes: (const unsigned char *) theBytes
+                        length: (NSUInteger) theLength
+                       charset: (NSString *) theCharset
+{
+  return [self _initWithBytes: theBytes  length: theLength  charset: theCharset  decode: YES];
+}
+
+@end
+
+
+//
+//
+//
+@implementation CWInternetAddress (Private)
+
+- (id) _initWithBytes: (const unsigned char *) theBytes
+	       length: (NSUInteger) theLength
+	      charset: (NSString *) theCharset
+	       decode: (BOOL) theBOOL
+{
+  cw_mailbox aMailbox;
+
+  next_mailbox(theBytes, 0, theLength, NO, &aMailbox);
+
+  return [self _initWithMailbox: &aMailbox  bytes: theBytes  charset: theCharset  decode: theBOOL];
+}
+
+
+//
+// Makes one string per part, the encoded-words of the display name
+// (if theBOOL is YES) and non-ASCII bytes being the slow path.
+//
+- (id) _initWithMailbox: (cw_mailbox *) theMailbox
+		  bytes: (const unsigned char *) theBytes
+		charset: (NSString *) theCharset
+		 decode: (BOOL) theBOOL
+{
+  NSRange anAddressRange, aPersonalRange;
+  NSString *aString;
+  NSUInteger i;
+  BOOL ascii, encoded;
+
+  self = [super init];
+
+  if (theMailbox->angle.location != NSNotFound)
+    {
+      anAddressRange = theMailbox->angle;
+      aPersonalRange = theMailbox->phrase;
+
+      // obs-route: <@relay1,@relay2:joe@acme.com>
+      if (anAddressRange.length && theBytes[anAddressRange.location] == '@')
+	{
+	  for (i = NSMaxRange(anAddressRange); i > anAddressRange.location; i--)
+	    {
+	      if (theBytes[i-1] == ':')
+		{
+		  anAddressRange = NSMakeRange(i, NSMaxRange(anAddressRange) - i);
+		  break;
+		}
+	    }
+	}
+    }
+  else
+    {
+      anAddressRange = theMailbox->phrase;
+      aPersonalRange = theMailbox->comment;
+    }
+
+  // We remove the quotes around the address, and the trailing back slashes.
+  if (anAddressRange.length > 1 &&
+      theBytes[anAddressRange.location] == '"' && theBytes[NSMaxRange(anAddressRange)-1] == '"')
+    {
+      anAddressRange.location++;
+      anAddressRange.length -= 2;
+    }
+
+  while (anAddressRange.length && theBytes[NSMaxRange(anAddressRange)-1] == '\\')
+    {
+      anAddressRange.length--;
+    }
+
+  if (anAddressRange.location == NSNotFound || anAddressRange.length == 0)
+    {
+      return nil;
+    }
+
+  aString = [[NSString alloc] initWithBytes: theBytes + anAddressRange.location
+				     length: anAddressRange.length
+				   encoding: NSUTF8StringEncoding];
+
+  if (!aString)
+    {
+      aString = [[NSString alloc] initWithBytes: theBytes + anAddressRange.location
+					 length: anAddressRange.length
+				       encoding: NSISOLatin1StringEncoding];
+    }
+
+  [self setAddress: aString];
+
+  if (aPersonalRange.location == NSNotFound || aPersonalRange.length == 0)
+    {
+      return self;
+    }
+
+  // "Marcotte, Ludovic" <ludovic@Sophos.ca>, but not "Joe" User <joe@acme.com>
+  if (aPersonalRange.length > 1 &&
+      theBytes[aPersonalRange.location] == '"' && theBytes[NSMaxRange(aPersonalRange)-1] == '"')
+    {
+      BOOL single;
+
+      single = YES;
+
+      for (i = aPersonalRange.location + 1; i < NSMaxRange(aPersonalRange) - 1; i++)
+	{
+	  if (theBytes[i] == '\\')
+	    {
+	      i++;
+	    }
+	  else if (theBytes[i] == '"')
+	    {
+	      single = NO;
+	      break;
+	    }
+	}
+
+      if (single)
+	{
+	  aPersonalRange.location++;
+	  aPersonalRange.length -= 2;
+	}
+    }
+
+  ascii = YES;
+  encoded = NO;
+
+  for (i = aPersonalRange.location; i < NSMaxRange(aPersonalRange); i++)
+    {
+      if (theBytes[i] > 127)
+	{
+	  ascii = NO;
+	}
+      else if (theBytes[i] == '=' && i + 1 < NSMaxRange(aPersonalRange) && theBytes[i+1] == '?')
+	{
+	  encoded = YES;
+	}
+    }
+
+  if (theBOOL && (encoded || !ascii))
+    {
+      aString = [CWMIMEUtility decodeHeader: [NSData dataWithBytesNoCopy: (void *)(theBytes + aPersonalRange.location)
+								   length: aPersonalRange.length
+							     freeWhenDone: NO]
+				    charset: theCharset];
+    }
+  else
+    {
+      aString = [[NSString alloc] initWithBytes: theBytes + aPersonalRange.location
+					 length: aPersonalRange.length
+				       encoding: (ascii ? NSASCIIStringEncoding : NSUTF8StringEncoding)];
+    }
+
+  [self setPersonal: aString];
+
+  return self;
+}
+
+@end
+
+
+//
+// C functions
+//
+static inline BOOL is_wsp(unsigned char c)
+{
+  return (c == ' ' || c == '\t' || c == '\r' || c == '\n');
+}
+
+
+//
+// Returns the index following the quoted string, or the comment, starting at theStart.
+//
+static NSUInteger skip_quoted(const unsigned char *theBytes, NSUInteger theStart, NSUInteger theLength)
+{
+  NSUInteger i;
+
+  for (i = theStart + 1; i < theLength && theBytes[i] != '"'; i++)
+    {
+      if (theBytes[i] == '\\') i++;
+    }
+
+  return (i < theLength ? i + 1 : theLength);
+}
+
+static NSUInteger skip_comment(const unsigned char *theBytes, NSUInteger theStart, NSUInteger theLength)
+{
+  NSUInteger i, depth;
+
+  depth = 1;
+
+  for (i = theStart + 1; i < theLength && depth; i++)
+    {
+      if (theBytes[i] == '\\') i++;
+      else if (theBytes[i] == '(') depth++;
+      else if (theBytes[i] == ')') depth--;
+    }
+
+  return MIN(i, theLength);
+}
+
+
+//
+// Tokenizes one mailbox starting at theStart and returns the index following it.
+// In a list (isList == YES), mailboxes are separated by commas, and group names
+// ("undisclosed-recipients:") and group ends (";") are dropped.
+//
+static NSUInteger next_mailbox(const unsigned char *theBytes, NSUInteger theStart, NSUInteger theLength,
+			       BOOL isList, cw_mailbox *theMailbox)
+{
+  NSUInteger i, j, phraseEnd;
+
+  theMailbox->phrase = theMailbox->angle = theMailbox->comment = NSMakeRange(NSNotFound, 0);
+  phraseEnd = 0;
+  i = theStart;
+
+  while (i < theLength)
+    {
+      unsigned char c;
+
+      c = theBytes[i];
+
+      if (is_wsp(c))
+	{
+	  i++;
+	  continue;
+	}
+
+      if (c == '(')
+	{
+	  j = skip_comment(theBytes, i, theLength);
+
+	  if (theMailbox->comment.location == NSNotFound)
+	    {
+	      // We don't keep the parentheses, nor the white space around the text.
+	      NSUInteger start, end;
+
+	      start = i + 1;
+	      end = (theBytes[j-1] == ')' ? j - 1 : j);
+
+	      while (start < end && is_wsp(theBytes[start])) start++;
+	      while (end > start && is_wsp(theBytes[end-1])) end--;
+
+	      theMailbox->comment = NSMakeRange(start, end - start);
+	    }
+
+	  i = j;
+	  continue;
+	}
+
+      if (c == '<' && theMailbox->angle.location == NSNotFound)
+	{
+	  NSUInteger start, end;
+
+	  for (j = i + 1; j < theLength && theBytes[j] != '>'; j++)
+	    {
+	      if (theBytes[j] == '"')
+		{
+		  j = skip_quoted(theBytes, j, theLength) - 1;
+		}
+	    }
+
+	  start = i + 1;
+	  end = j;
+
+	  while (start < end && is_wsp(theBytes[start])) start++;
+	  while (end > start && is_wsp(theBytes[end-1])) end--;
+
+	  theMailbox->angle = NSMakeRange(start, end - start);
+	  i = MIN(j + 1, theLength);
+	  continue;
+	}
+
+      if (isList && (c == ',' || c == ';'))
+	{
+	  i++;
+	  break;
+	}
+
+      if (isList && c == ':' && theMailbox->angle.location == NSNotFound)
+	{
+	  // The group name is not an address.
+	  theMailbox->phrase = theMailbox->comment = NSMakeRange(NSNotFound, 0);
+	  i++;
+	  continue;
+	}
+
+      j = (c == '"' ? skip_quoted(theBytes, i, theLength) : i + 1);
+
+      // Whatever follows the angle-addr is ignored.
+      if (theMailbox->angle.location == NSNotFound)
+	{
+	  if (theMailbox->phrase.location == NSNotFound)
+	    {
+	      theMailbox->phrase.location = i;
+	    }
+
+	  phraseEnd = j;
+	  theMailbox->phrase.length = phraseEnd - theMailbox->phrase.location;
+	}
+
+      i = j;
+    }
+
+  return i;
+}
+
+
@@ -8,29 +8,28 @@
 
 #import <Foundation/Foundation.h>
 
-NS_ASSUME_NONNULL_BEGIN
-
-@interface CWLogger : NSObject
+#import <PantomimeFramework/CWLogging.h>
 
-+ (void)logInfoFilename:(const char *)filename
-               function:(const char *)function
-                   line:(NSInteger)line
-                 message:(NSString *)message;
+NS_ASSUME_NONNULL_BEGIN
 
-+ (void)logWarnFilename:(const char *)filename
-               function:(const char *)function
-                   line:(NSInteger)line
-                message:(NSString *)message;
+//
+// The most verbose level compiled in. Messages above it cost nothing at all,
+// e.g. build with CW_LOG_LEVEL_MAX=CWLogLevelWarn to strip all LogInfo calls.
+//
+#ifndef CW_LOG_LEVEL_MAX
+#define CW_LOG_LEVEL_MAX CWLogLevelInfo
+#endif
 
-+ (void)logErrorFilename:(const char *)filename
-                function:(const char *)function
-                    line:(NSInteger)line
-                 message:(NSString *)message;
+/** The current level. Read it with +[CWLogger level], only the macros below use it directly. */
+extern CWLogLevel CWLoggerCurrentLevel;
 
-@end
+#define CW_LOG_ENABLED(theLevel) ((theLevel) <= CW_LOG_LEVEL_MAX && (theLevel) <= CWLoggerCurrentLevel)
 
-#define LogInfo(...) [CWLogger logInfoFilename:__FILE__ function:__FUNCTION__ line:__LINE__ message:[NSString stringWithFormat:__VA_ARGS__]];
-#define LogWarn(...) [CWLogger logWarnFilename:__FILE__ function:__FUNCTION__ line:__LINE__ message:[NSString stringWithFormat:__VA_ARGS__]];
-#define LogError(...) [CWLogger logErrorFilename:__FILE__ function:__FUNCTION__ line:__LINE__ message:[NSString stringWithFormat:__VA_ARGS__]];
+//
+// The arguments are only evaluated if the level is enabled.
+//
+#define LogInfo(...) do { if (CW_LOG_ENABLED(CWLogLevelInfo)) [CWLogger logInfoFilename:__FILE__ function:__FUNCTION__ line:__LINE__ message:[NSString stringWithFormat:__VA_ARGS__]]; } while (0)
+#define LogWarn(...) do { if (CW_LOG_ENABLED(CWLogLevelWarn)) [CWLogger logWarnFilename:__FILE__ function:__FUNCTION__ line:__LINE__ message:[NSString stringWithFormat:__VA_ARGS__]]; } while (0)
+#define LogError(...) do { if (CW_LOG_ENABLED(CWLogLevelError)) [CWLogger logErrorFilename:__FILE__ function:__FUNCTION__ line:__LINE__ message:[NSString stringWithFormat:__VA_ARGS__]]; } while (0)
 
 NS_ASSUME_NONNULL_END
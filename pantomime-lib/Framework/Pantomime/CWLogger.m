@@ -0,0 +1,242 @@
+//
+//  CWLogger.m
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWLogger.h"
+
+// The default sink hands messages over to the application's logger.
+#undef LogInfo
+#undef LogWarn
+#undef LogError
+#import <PlanckToolboxForExtensions/PEPLogger.h>
+
+#include <stdatomic.h>
+
+//
+// Number of messages the buffer holds. Must be a power of two.
+//
+#define LOG_BUFFER_SIZE 1024
+
+#ifdef DEBUG
+CWLogLevel CWLoggerCurrentLevel = CWLogLevelInfo;
+#else
+CWLogLevel CWLoggerCurrentLevel = CWLogLevelWarn;
+#endif
+
+//
+// A bounded multi-producer queue (D. Vyukov). Each slot carries a sequence
+// number telling whether it is free for the producer at a given position
+// or ready for the consumer.
+//
+typedef struct
+{
+    _Atomic(NSUInteger) sequence;
+    CWLogLevel level;
+    const char *filename;
+    const char *function;
+    NSInteger line;
+    CFTypeRef message;
+} log_slot;
+
+static log_slot slots[LOG_BUFFER_SIZE];
+static _Atomic(NSUInteger) head;
+static NSUInteger tail;
+static _Atomic(NSUInteger) dropped;
+static atomic_bool scheduled;
+
+static dispatch_queue_t writer_queue;
+static CWLogSink sink;
+
+
+//
+//
+//
+static void default_sink(CWLogLevel theLevel, const char *theFilename, const char *theFunction,
+                         NSInteger theLine, NSString *theMessage)
+{
+    const char *aName = strrchr(theFilename, '/');
+
+    aName = aName ? aName + 1 : theFilename;
+
+    switch (theLevel)
+    {
+        case CWLogLevelError:
+            LogError(@"%s:%ld %s %@", aName, (long) theLine, theFunction, theMessage);
+            break;
+        case CWLogLevelWarn:
+            LogWarn(@"%s:%ld %s %@", aName, (long) theLine, theFunction, theMessage);
+            break;
+        default:
+            LogInfo(@"%s:%ld %s %@", aName, (long) theLine, theFunction, theMessage);
+            break;
+    }
+}
+
+//
+// Only ever runs on writer_queue, so there is a single consumer.
+//
+static void drain(void *theContext)
+{
+    CWLogSink aSink;
+
+    atomic_store(&scheduled, false);
+
+    @synchronized ([CWLogger class]) {
+        aSink = sink;
+    }
+
+    while (YES)
+    {
+        log_slot *aSlot = &slots[tail & (LOG_BUFFER_SIZE - 1)];
+        NSString *aMessage;
+
+        if (atomic_load_explicit(&aSlot->sequence, memory_order_acquire) != tail + 1)
+        {
+            break;
+        }
+
+        aMessage = CFBridgingRelease(aSlot->message);
+        aSlot->message = NULL;
+
+        @autoreleasepool
+        {
+            if (aSink)
+            {
+                aSink(aSlot->level, aSlot->filename, aSlot->function, aSlot->line, aMessage);
+            }
+            else
+            {
+                default_sink(aSlot->level, aSlot->filename, aSlot->function, aSlot->line, aMessage);
+            }
+        }
+
+        atomic_store_explicit(&aSlot->sequence, tail + LOG_BUFFER_SIZE, memory_order_release);
+        tail++;
+    }
+}
+
+//
+// Never blocks: if the buffer is full, the message is dropped.
+//
+static void enqueue(CWLogLevel theLevel, const char *theFilename, const char *theFunction,
+                    NSInteger theLine, NSString *theMessage)
+{
+    NSUInteger pos = atomic_load_explicit(&head, memory_order_relaxed);
+    log_slot *aSlot;
+
+    while (YES)
+    {
+        NSUInteger seq;
+        NSInteger diff;
+
+        aSlot = &slots[pos & (LOG_BUFFER_SIZE - 1)];
+        seq = atomic_load_explicit(&aSlot->sequence, memory_order_acquire);
+        diff = (NSInteger) seq - (NSInteger) pos;
+
+        if (diff == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&head, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            atomic_fetch_add_explicit(&dropped, 1, memory_order_relaxed);
+            return;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&head, memory_order_relaxed);
+        }
+    }
+
+    aSlot->level = theLevel;
+    aSlot->filename = theFilename;
+    aSlot->function = theFunction;
+    aSlot->line = theLine;
+    aSlot->message = CFBridgingRetain(theMessage);
+    atomic_store_explicit(&aSlot->sequence, pos + 1, memory_order_release);
+
+    if (!atomic_exchange(&scheduled, true))
+    {
+        dispatch_async_f(writer_queue, NULL, drain);
+    }
+}
+
+
+//
+//
+//
+@implementation CWLogger
+
++ (void) initialize
+{
+    if (self == [CWLogger class])
+    {
+        NSUInteger i;
+
+        for (i = 0; i < LOG_BUFFER_SIZE; i++)
+        {
+            atomic_init(&slots[i].sequence, i);
+        }
+        writer_queue = dispatch_queue_create("pantomime.log.writer", DISPATCH_QUEUE_SERIAL);
+    }
+}
+
++ (CWLogLevel) level
+{
+    return CWLoggerCurrentLevel;
+}
+
++ (void) setLevel: (CWLogLevel) theLevel
+{
+    CWLoggerCurrentLevel = theLevel;
+}
+
++ (void) setSink: (CWLogSink) theSink
+{
+    @synchronized (self) {
+        sink = [theSink copy];
+    }
+}
+
++ (void) flush
+{
+    dispatch_sync_f(writer_queue, NULL, drain);
+}
+
++ (NSUInteger) droppedMessages
+{
+    return atomic_load_explicit(&dropped, memory_order_relaxed);
+}
+
++ (void) logInfoFilename: (const char *) theFilename
+                function: (const char *) theFunction
+                    line: (NSInteger) theLine
+                 message: (NSString *) theMessage
+{
+    enqueue(CWLogLevelInfo, theFilename, theFunction, theLine, theMessage);
+}
+
++ (void) logWarnFilename: (const char *) theFilename
+                function: (const char *) theFunction
+                    line: (NSInteger) theLine
+                 message: (NSString *) theMessage
+{
+    enqueue(CWLogLevelWarn, theFilename, theFunction, theLine, theMessage);
+}
+
++ (void) logErrorFilename: (const char *) theFilename
+                 function: (const char *) theFunction
+                     line: (NSInteger) theLine
+                  message: (NSString *) theMessage
+{
+    enqueue(CWLogLevelError, theFilename, theFunction, theLine, theMessage);
+}
+
+@end
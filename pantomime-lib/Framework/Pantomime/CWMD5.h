@@ -27,6 +27,21 @@
 #import <Foundation/NSObject.h>
 #import <Foundation/NSString.h>
 
+//
+// The bundled MD5 implementation, also used by CWDigest when the
+// system has no crypto library.
+//
+struct MD5Context {
+  unsigned int buf[4];
+  unsigned int bits[2];
+  unsigned char in[64];
+};
+
+void MD5Init(struct MD5Context *context);
+void MD5Update(struct MD5Context *context, unsigned char const *buf,
+               NSUInteger len);
+void MD5Final(unsigned char digest[16], struct MD5Context *context);
+
 /*!
   @class CWMD5
   @abstract MD5 Message-Digest algorithm implementation.
@@ -34,6 +49,9 @@
               This algorithm is described in RFC 1321. It also supports the HMAC
 	      keyed-hashing for message authentication (described in RFC 2104). HMAC
 	      is used in the CRAM-MD5 SASL authentication mechanim.
+	      The data may also be handed over in pieces, using -init
+	      and -updateWithBytes:length:. See CWDigest for other
+	      algorithms.
 */
 @interface CWMD5 : NSObject
 {
@@ -42,6 +60,7 @@
 
     BOOL _has_computed_digest;
     unsigned char _digest[16];
+    struct MD5Context _context;
 }
 
 /*!
@@ -52,6 +71,30 @@
 */
 - (id) initWithData: (NSData *) theData;
 
+/*!
+  @method init
+  @discussion Initializes an instance with no data, to be handed
+              over using -updateWithBytes:length:.
+  @result An instance of CWMD5.
+*/
+- (id) init;
+
+/*!
+  @method updateWithBytes:length:
+  @discussion This method is used to append bytes to the instance's
+              data. It has no effect once the digest has been computed.
+  @param theBytes The bytes to append.
+  @param theLength The number of bytes.
+*/
+- (void) updateWithBytes: (const void *) theBytes
+                  length: (NSUInteger) theLength;
+
+/*!
+  @method updateWithData:
+  @discussion See -updateWithBytes:length:.
+*/
+- (void) updateWithData: (NSData *) theData;
+
 /*!
   @method computeDigest
   @discussion This method is used to compute the MD5 digest
@@ -59,6 +102,13 @@
 */
 - (void) computeDigest;
 
+/*!
+  @method finalizeDigest
+  @discussion This method computes the digest, if needed, and returns it.
+  @result The digest, as a NSData instance.
+*/
+- (NSData *) finalizeDigest;
+
 /*!
   @method digest
   @discussion This method is used to obtain the computed digest,
@@ -77,6 +127,7 @@
 /*!
   @method hmacAsStringUsingPassword:
   @discussion Computes the HMAC using <i>thePassword</i> and returns it.
+              Only the data given to -initWithData: is used.
   @param thePassword The password to use when computing the HMAC.
   @result The computed HMAC, as a NSString instance.
 */
@@ -22,6 +22,7 @@
 
 #import "Pantomime/CWMD5.h"
 #import "CWConstants.h"
+#import "CWDigest.h"
 #import "NSData+Extensions.h"
 
 #import <string.h>
@@ -29,16 +30,6 @@
 
 #define word32 unsigned int
 
-struct MD5Context {
-  word32 buf[4];
-  word32 bits[2];
-  unsigned char in[64];
-};
-
-void MD5Init(struct MD5Context *context);
-void MD5Update(struct MD5Context *context, unsigned char const *buf,
-               NSUInteger len);
-void MD5Final(unsigned char digest[16], struct MD5Context *context);
 void MD5Transform(word32 buf[4], word32 const in[16]);
 
 void md5_hmac(unsigned char *digest, const unsigned char* text, NSUInteger text_len, const unsigned char* key, NSUInteger key_len);
@@ -53,10 +44,21 @@ void md5_hmac(unsigned char *digest, const unsigned char* text, NSUInteger text_
   self = [super init];
   _data = RETAIN(theData);
   _has_computed_digest = NO;
+  MD5Init(&_context);
+  MD5Update(&_context, [_data bytes], [_data length]);
   return self;
 }
 
 
+//
+//
+//
+- (id) init
+{
+  return [self initWithData: nil];
+}
+
+
 //
 //
 //
@@ -72,27 +74,52 @@ void md5_hmac(unsigned char *digest, const unsigned char* text, NSUInteger text_
 //
 - (void) computeDigest
 {
-  struct MD5Context ctx;
-  unsigned char *bytes;
-  NSUInteger len;
-  
   // If we already have computed the digest
   if (_has_computed_digest)
     {
       return;
     }
 
-  bytes = (unsigned char *)[_data bytes];
-  len = [_data length];
-
-  MD5Init(&ctx);
-  MD5Update(&ctx, bytes, len);
-  MD5Final(_digest, &ctx);
+  MD5Final(_digest, &_context);
 
   _has_computed_digest = YES;
 }
 
 
+//
+//
+//
+- (void) updateWithBytes: (const void *) theBytes
+                  length: (NSUInteger) theLength
+{
+  if (_has_computed_digest)
+    {
+      return;
+    }
+
+  MD5Update(&_context, theBytes, theLength);
+}
+
+
+//
+//
+//
+- (void) updateWithData: (NSData *) theData
+{
+  [self updateWithBytes: [theData bytes]  length: [theData length]];
+}
+
+
+//
+//
+//
+- (NSData *) finalizeDigest
+{
+  [self computeDigest];
+  return [self digest];
+}
+
+
 //
 //
 //
@@ -116,20 +143,8 @@ void md5_hmac(unsigned char *digest, const unsigned char* text, NSUInteger text_
     {
       return nil;
     }
-  else
-    {
-      NSMutableString *aMutableString;
-      int i;
 
-      aMutableString = [[NSMutableString alloc] init];
-      
-      for (i = 0; i < 16; i++)
-	{
-	  [aMutableString appendFormat: @"%02x", (unsigned int)_digest[i]];
-	}
-      
-      return AUTORELEASE(aMutableString);
-    }
+  return [CWDigest hexStringFromData: [self digest]];
 }
 
 
@@ -145,23 +160,14 @@ void md5_hmac(unsigned char *digest, const unsigned char* text, NSUInteger text_
     }
   else
     {
-      NSMutableString *aMutableString;
       unsigned char result[16];
       unsigned char *s;
-      int i;
 
       s = (unsigned char*)[_data cString];
       md5_hmac(result, s, strlen((char*)s), (unsigned char*)
                [thePassword cStringUsingEncoding:NSUTF8StringEncoding], [thePassword length]);
-      
-      aMutableString = [[NSMutableString alloc] init];
 
-      for (i = 0; i < 16; i++)
-	{
-	  [aMutableString appendFormat: @"%02x", (unsigned int)result[i]];
-	}
-      
-      return AUTORELEASE(aMutableString);
+      return [CWDigest hexStringFromData: [NSData dataWithBytes: result  length: 16]];
     }
 }
 
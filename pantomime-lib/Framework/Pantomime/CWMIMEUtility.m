@@ -29,6 +29,7 @@
 #import "Pantomime/NSString+Extensions.h"
 #import "NSData+Extensions.h"
 #import "CWPart.h"
+#import "CWHTMLText.h"
 #import "Pantomime/CWMD5.h"
 #import "Pantomime/CWUUFile.h"
 
@@ -48,13 +49,121 @@
 //
 // C functions
 //
-char ent(char **ref);
-char *striphtml(char *s, NSInteger encoding);
 NSString *unique_id(void);
 
 static const char *hexDigit = "0123456789ABCDEF";
 static int seed_count = 1;
 
+//
+// YES if theBytes are 7-bit and hold no encoded-word.
+//
+static BOOL is_plain_ascii(const char *theBytes, NSUInteger theLength)
+{
+  NSUInteger i;
+
+  for (i = 0; i < theLength; i++)
+    {
+      if ((unsigned char)theBytes[i] > 127 ||
+	  (theBytes[i] == '=' && i+1 < theLength && theBytes[i+1] == '?'))
+	{
+	  return NO;
+	}
+    }
+
+  return YES;
+}
+
+//
+// YES if 7-bit bytes read the same in theEncoding as in US-ASCII.
+//
+static BOOL is_ascii_superset(NSInteger theEncoding)
+{
+  switch (theEncoding)
+    {
+    case NSASCIIStringEncoding:
+    case NSUTF8StringEncoding:
+    case NSISOLatin1StringEncoding:
+    case NSISOLatin2StringEncoding:
+    case NSWindowsCP1250StringEncoding:
+    case NSWindowsCP1251StringEncoding:
+    case NSWindowsCP1252StringEncoding:
+    case NSWindowsCP1253StringEncoding:
+    case NSWindowsCP1254StringEncoding:
+    case NSMacOSRomanStringEncoding:
+    case NSJapaneseEUCStringEncoding:
+      return YES;
+    default:
+      return NO;
+    }
+}
+
+//
+// Appends text found outside of encoded-words, in theCharset if not nil,
+// otherwise in UTF-8 or US-ASCII.
+//
+static void append_text(NSMutableString *theString, const char *theBytes, NSUInteger theLength, NSData *theCharset)
+{
+  NSString *aString;
+
+  aString = nil;
+
+  if (theCharset)
+    {
+      aString = [NSString stringWithData: [NSData dataWithBytes: theBytes  length: theLength]
+				 charset: theCharset];
+      RETAIN_VOID(aString);
+    }
+
+  if (!aString)
+    {
+      aString = [[NSString alloc] initWithBytes: theBytes  length: theLength
+				       encoding: NSUTF8StringEncoding];
+    }
+
+  // Fallback for rare cases where "... encoding: NSUTF8StringEncoding" fails and returns nil.
+  if (!aString)
+    {
+      aString = [[NSString alloc] initWithBytes: theBytes  length: theLength
+				       encoding: NSASCIIStringEncoding];
+    }
+
+  if (aString)
+    {
+      [theString appendString: aString];
+      DESTROY(aString);
+    }
+}
+
+//
+// Converts the decoded bytes of a run of encoded-words, if any, and empties
+// theWords. The charset of the words is overridden by theCharset if not nil.
+// If they can't be converted, the words in theRange are kept as they were.
+//
+static void append_words(NSMutableString *theString, NSMutableData *theWords, NSData *theData,
+			 NSRange theRange, NSRange theWordsCharset, NSData *theCharset)
+{
+  NSString *aString;
+
+  if (![theWords length])
+    {
+      return;
+    }
+
+  aString = [NSString stringWithData: theWords
+			     charset: (theCharset ? theCharset : [theData subdataWithRange: theWordsCharset])];
+
+  if (aString)
+    {
+      [theString appendString: aString];
+    }
+  else
+    {
+      append_text(theString, (const char *)[theData bytes]+theRange.location, theRange.length, theCharset);
+    }
+
+  [theWords setLength: 0];
+}
+
 @implementation CWMIMEUtility
 
 //
@@ -65,15 +174,20 @@ static int seed_count = 1;
 // =?iso-8859-1?Q?ab=E7de?= =?iso-8859-1?Q?_?= =?iso-8859-1?Q?oo=F4oo?=
 // Abd =?ISO-8859-1?Q?=E8?= fghijklmn
 //
+// Headers without encoded-words, which are most of them, are returned
+// without scanning them twice. The bytes of adjacent encoded-words in the
+// same charset are decoded into one buffer and converted once, which also
+// joins multibyte characters split over two words by some mailers.
 //
 + (NSString *) decodeHeader: (NSData *) theData
 		    charset: (NSString *) theCharset
 {
   NSMutableString *aMutableString;
-  NSData *charset, *encoded_text;
-  NSString *aString;
+  NSMutableData *words;
+  NSData *charset, *decoded;
   
-    NSUInteger length, i, start, i_charset, i_encoding, end;
+  NSUInteger length, i, start, i_charset, i_encoding, end;
+  NSUInteger words_start, words_end, words_charset, words_charset_length;
   const char *bytes;
  
   BOOL ignore_span;
@@ -92,10 +206,19 @@ static int seed_count = 1;
     }
 
   bytes = [theData bytes];
+  charset = (theCharset ? [theCharset dataUsingEncoding: NSASCIIStringEncoding] : nil);
+
+  if (is_plain_ascii(bytes, length) &&
+      (!charset || is_ascii_superset([NSString encodingForCharset: charset])))
+    {
+      return AUTORELEASE([[NSString alloc] initWithBytes: bytes  length: length  encoding: NSASCIIStringEncoding]);
+    }
   
   aMutableString = [[NSMutableString alloc] initWithCapacity: length];
+  words = [[NSMutableData alloc] init];
   
   start = i = 0;
+  words_start = words_end = words_charset = words_charset_length = 0;
   ignore_span = NO;
   
   while (i < (length - 1))
@@ -113,23 +236,9 @@ static int seed_count = 1;
       
       if (i != start && !ignore_span)
 	{
-	  aString = nil;
-
-	  if (theCharset)
-	    {  
-	      aString = [NSString stringWithData: [NSData dataWithBytes: bytes+start  length: i-start]
-				  charset: [theCharset dataUsingEncoding: NSASCIIStringEncoding]];
-	      RETAIN_VOID(aString);
-	    }
-	  
-	  if (!aString)
-	    {
-            aString = [[NSString alloc] initWithBytes: bytes+start  length: i-start
-                                             encoding:NSUTF8StringEncoding];
-	    }
-
-	  [aMutableString appendString: aString];
-	  DESTROY(aString);
+	  append_words(aMutableString, words, theData, NSMakeRange(words_start, words_end-words_start),
+		       NSMakeRange(words_charset, words_charset_length), charset);
+	  append_text(aMutableString, bytes+start, i-start, charset);
 	}
       
       start = i;
@@ -182,68 +291,59 @@ static int seed_count = 1;
       end = i;
       i += 2;
       
-      if (theCharset)
-	{
-	  charset = [theCharset dataUsingEncoding: NSASCIIStringEncoding];
-	}
-      else
-	{
-	  charset = [theData subdataWithRange: NSMakeRange(start+2,i_charset-start-2)];
-	}
-      
-      encoded_text = [theData subdataWithRange: NSMakeRange(i_encoding,end-i_encoding)];
-      
       if (encoding == 'q' || encoding == 'Q')
 	{
-	  aString = [NSString stringWithData: [encoded_text decodeQuotedPrintableInHeader: YES]
-			      charset: charset];
+	  decoded = [[theData subdataNoCopyWithRange: NSMakeRange(i_encoding,end-i_encoding)] decodeQuotedPrintableInHeader: YES];
 	}
       else if (encoding == 'b' || encoding== 'B')
 	{
-	  aString = [NSString stringWithData: [encoded_text decodeBase64]
-			      charset: charset];
+	  decoded = [[theData subdataNoCopyWithRange: NSMakeRange(i_encoding,end-i_encoding)] decodeBase64];
 	}
       else
 	{
 	  continue;
 	}
 
-      if (!aString)
+      // A word in another charset, or one we can't decode, ends the run.
+      if (!decoded ||
+	  (!charset && [words length] &&
+	   (i_charset-start-2 != words_charset_length ||
+	    strncasecmp(bytes+start+2, bytes+words_charset, words_charset_length) != 0)))
+	{
+	  append_words(aMutableString, words, theData, NSMakeRange(words_start, words_end-words_start),
+		       NSMakeRange(words_charset, words_charset_length), charset);
+	}
+
+      if (!decoded)
 	{
 	  continue;
 	}
       
-      [aMutableString appendString: aString];
-      aString = nil;
+      if (![words length])
+	{
+	  words_start = start;
+	  words_charset = start+2;
+	  words_charset_length = i_charset-start-2;
+	}
+
+      [words appendData: decoded];
+      words_end = i;
       start = i;
       ignore_span = YES;
     }
   
   i = length;
-  
-    if (i != start && !ignore_span)
+
+  append_words(aMutableString, words, theData, NSMakeRange(words_start, words_end-words_start),
+		       NSMakeRange(words_charset, words_charset_length), charset);
+
+  if (i != start && !ignore_span)
     {
-        aString = nil;
-        if (theCharset)
-        {
-            aString = [NSString stringWithData: [NSData dataWithBytes: bytes+start  length: i-start]
-                                       charset: [theCharset dataUsingEncoding: NSASCIIStringEncoding]];
-            RETAIN_VOID(aString);
-        }
-        if (!aString)
-        {
-            aString = [[NSString alloc] initWithBytes: bytes+start  length: i-start
-                                             encoding: NSUTF8StringEncoding];
-        }
-        // Fallback for rare cases where "... encoding: NSUTF8StringEncoding" fails and returns nil.
-        if (!aString) {
-            aString = [[NSString alloc] initWithBytes: bytes+start  length: i-start
-                                             encoding: NSASCIIStringEncoding];
-        }
-        [aMutableString appendString: aString];
-        DESTROY(aString);
+      append_text(aMutableString, bytes+start, i-start, charset);
     }
-    return AUTORELEASE(aMutableString);
+
+  RELEASE(words);
+  return AUTORELEASE(aMutableString);
 }
 
 
@@ -616,239 +716,42 @@ static int seed_count = 1;
   //
   if ([thePart isMIMEType: @"text"  subType: @"html"])
     {
-      char *buf, *bytes;
- 
-      buf = (char *)malloc(([aContent length]+1)*sizeof(char));
-      memset(buf, 0, [aContent length]+1);
-      memcpy(buf, [aContent bytes], [aContent length]);
+      NSStringEncoding encoding;
 
-      bytes = striphtml(buf, [NSString encodingForPart: thePart]);
-      free(buf);
+      encoding = [NSString encodingForPart: thePart];
+      aContent = cw_html_to_text([aContent bytes], [aContent length], encoding);
 
-      aContent = [NSData dataWithBytesNoCopy: bytes  length: strlen(bytes)  freeWhenDone: YES];
+      // The text is in UTF-8, we return it in the charset of the part
+      if (encoding != NSUTF8StringEncoding)
+	{
+	  aContent = [AUTORELEASE([[NSString alloc] initWithData: aContent  encoding: NSUTF8StringEncoding])
+		       dataUsingEncoding: encoding  allowLossyConversion: YES];
+	}
     }
   
   return aContent;
 }
 
-@end
-
 
 //
-// This C function has been written by Abhijit Menon-Sen <ams@wiw.org>
-// This code is in the public domain.
 //
-char *striphtml(char *s, NSInteger encoding)
+//
++ (NSData *) plainTextUTF8ContentFromPart: (CWPart *) thePart
 {
-  char c, *t, *text;
+  NSData *aContent;
 
-  if ((t = text = malloc(strlen(s)+1)) == NULL)
-    {
-      return NULL;
-    }
+  aContent = (NSData *)[thePart content];
 
-  while ((c = *s++))
+  if ([thePart isMIMEType: @"text"  subType: @"html"])
     {
-      if (c == '<')
-        {
-          /*
-           * Ignore everything to the end of this tag or sgml comment.
-           */
-          if (s[0] == '!' && s[1] == '-' && s[2] == '-')
-            {
-              s += 3;
-              while ((c = *s++))
-                {
-                  if (c == '-' && s[0] == '-' && s[1] == '>')
-                    {
-                      s += 2;
-                      break;
-                    }
-                }
-            }
-          else
-            {
-              while ((c = *s++))
-                {
-                  if (c == '>')
-                    {
-                      break;
-                    }
-                }
-            }
-        }
-      else if (c == '&')
-        {
-	  NSString *aString;
-
-	  c = ent(&s);
-	  aString = AUTORELEASE([[NSString alloc] initWithBytes: &c  length: 1  encoding: NSISOLatin1StringEncoding]);
-
-	  if ([aString length])
-	    {
-	      NSData *aData;
-
-	      aData = [aString dataUsingEncoding: encoding];
-	      
-	      if (aData)
-		{
-		  char *bytes;
-		  NSUInteger len;
-		  
-		  bytes = (char *)[aData bytes];
-		  len = [aData length];
-		  
-		  while (len--)
-		    {
-		      *t++ = *bytes;
-		      bytes++;
-		    }
-		}
-	    }
-	}
-      else
-        {
-          *t++ = c;
-        }
+      return cw_html_to_text([aContent bytes], [aContent length], [NSString encodingForPart: thePart]);
     }
 
-  *t++ = '\0';
-
-  return text;
+  return [[NSString stringWithData: aContent  charset: [[thePart charset] dataUsingEncoding: NSASCIIStringEncoding]]
+	   dataUsingEncoding: NSUTF8StringEncoding];
 }
 
-
-//
-// This C function has been written by Abhijit Menon-Sen <ams@wiw.org>
-// This code is in the public domain.
-//
-char ent(char **ref)
-{
-  int i;
-  char c = ' ', *s = *ref, *t = s;
-  
-  struct {
-    char *name;
-    char chr;
-  } refs[] = {
-    { "lt"    , '<'       },
-    { "gt"    , '>'       },
-    { "amp"   , '&'       },
-    { "quot"  , '"'       },
-    { "nbsp"  , (char)160 },
-    { "iexcl" , (char)161 },
-    { "cent"  , (char)162 },
-    { "pound" , (char)163 },
-    { "curren", (char)164 },
-    { "yen"   , (char)165 },
-    { "brvbar", (char)166 },
-    { "sect"  , (char)167 },
-    { "uml"   , (char)168 },
-    { "copy"  , (char)169 },
-    { "ordf"  , (char)170 },
-    { "laquo" , (char)171 },
-    { "not"   , (char)172 },
-    { "shy"   , (char)173 },
-    { "reg"   , (char)174 },
-    { "macr"  , (char)175 },
-    { "deg"   , (char)176 },
-    { "plusmn", (char)177 },
-    { "sup2"  , (char)178 },
-    { "sup3"  , (char)179 },
-    { "acute" , (char)180 },
-    { "micro" , (char)181 },
-    { "para"  , (char)182 },
-    { "middot", (char)183 },
-    { "cedil" , (char)184 },
-    { "sup1"  , (char)185 },
-    { "ordm"  , (char)186 },
-    { "raquo" , (char)187 },
-    { "frac14", (char)188 },
-    { "frac12", (char)189 },
-    { "frac34", (char)190 },
-    { "iquest", (char)191 },
-    { "Agrave", (char)192 },
-    { "Aacute", (char)193 },
-    { "Acirc" , (char)194 },
-    { "Atilde", (char)195 },
-    { "Auml"  , (char)196 },
-    { "Aring" , (char)197 },
-    { "AElig" , (char)198 },
-    { "Ccedil", (char)199 },
-    { "Egrave", (char)200 },
-    { "Eacute", (char)201 },
-    { "Ecirc" , (char)202 },
-    { "Euml"  , (char)203 },
-    { "Igrave", (char)204 },
-    { "Iacute", (char)205 },
-    { "Icirc" , (char)206 },
-    { "Iuml"  , (char)207 },
-    { "ETH"   , (char)208 },
-    { "Ntilde", (char)209 },
-    { "Ograve", (char)210 },
-    { "Oacute", (char)211 },
-    { "Ocirc" , (char)212 },
-    { "Otilde", (char)213 },
-    { "Ouml"  , (char)214 },
-    { "times" , (char)215 },
-    { "Oslash", (char)216 },
-    { "Ugrave", (char)217 },
-    { "Uacute", (char)218 },
-    { "Ucirc" , (char)219 },
-    { "Uuml"  , (char)220 },
-    { "Yacute", (char)221 },
-    { "THORN" , (char)222 },
-    { "szlig" , (char)223 },
-    { "agrave", (char)224 },
-    { "aacute", (char)225 },
-    { "acirc" , (char)226 },
-    { "atilde", (char)227 },
-    { "auml"  , (char)228 },
-    { "aring" , (char)229 },
-    { "aelig" , (char)230 },
-    { "ccedil", (char)231 },
-    { "egrave", (char)232 },
-    { "eacute", (char)233 },
-    { "ecirc" , (char)234 },
-    { "euml"  , (char)235 },
-    { "igrave", (char)236 },
-    { "iacute", (char)237 },
-    { "icirc" , (char)238 },
-    { "iuml"  , (char)239 },
-    { "eth"   , (char)240 },
-    { "ntilde", (char)241 },
-    { "ograve", (char)242 },
-    { "oacute", (char)243 },
-    { "ocirc" , (char)244 },
-    { "otilde", (char)245 },
-    { "ouml"  , (char)246 },
-    { "divide", (char)247 },
-    { "oslash", (char)248 },
-    { "ugrave", (char)249 },
-    { "uacute", (char)250 },
-    { "ucirc" , (char)251 },
-    { "uuml"  , (char)252 },
-    { "yacute", (char)253 },
-    { "thorn" , (char)254 },
-    { "yuml"  , (char)255 }
-  };
-  
-  while (isalpha((int)(unsigned char)*s) || isdigit((int)(unsigned char)*s) || *s == '#')
-    s++;
-  
-  for (i = 0; i < sizeof(refs)/sizeof(refs[0]); i++) {
-    if (strncmp(refs[i].name, t, s-t) == 0) {
-      c = refs[i].chr;
-      break;
-    }
-  }
-  
-  if (*s == ';')
-    s++;
-  
-  *ref = s;
-  return c;
-}
+@end
 
 
 //
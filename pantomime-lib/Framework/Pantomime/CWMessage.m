@@ -25,7 +25,9 @@
 #import <Foundation/Foundation.h>
 
 #import "CWFlags.h"
+#import "CWFlags+CWProtected.h"
 #import "CWFolder.h"
+#import "CWFolder+CWProtected.h"
 #import "CWInternetAddress.h"
 #import "CWMIMEMultipart.h"
 #import "CWMIMEUtility.h"
@@ -72,6 +74,12 @@ static CWRegEx *prefixSubjFwdHdrAndSuffixSubjFwdTrlRegex = nil;
 
 @end
 
+//
+// We observe our flags to let our folder know about changes.
+//
+@interface CWMessage () <CWFlagsObserver>
+@end
+
 
 //
 //
@@ -118,6 +126,7 @@ static CWRegEx *prefixSubjFwdHdrAndSuffixSubjFwdTrlRegex = nil;
 
     _recipients = [[NSMutableArray alloc] init];
     _flags = [[CWFlags alloc] init];
+    [_flags setObserver: self];
     _initialized = NO;
     _references = nil;
     _folder = nil;
@@ -260,6 +269,7 @@ static CWRegEx *prefixSubjFwdHdrAndSuffixSubjFwdTrlRegex = nil;
     // unarchiving IMAP caches.
     _flags = [[CWFlags alloc] init];
     [_flags replaceWithFlags: [theCoder decodeObject]];
+    [_flags setObserver: self];
 
     // It's very important to set the "initialized" ivar to NO since we didn't serialize the content.
     // or our message.
@@ -630,7 +640,40 @@ static CWRegEx *prefixSubjFwdHdrAndSuffixSubjFwdTrlRegex = nil;
 //
 - (void) setFlags: (CWFlags *) theFlags
 {
-    ASSIGN(_flags, theFlags);
+    PantomimeFlag theOldFlags;
+
+    if (theFlags == _flags)
+    {
+        return;
+    }
+
+    //
+    // We adopt the instance and observe it, as it now holds our flags.
+    // The folder learns about the change like about any other one.
+    //
+    theOldFlags = [_flags rawFlags];
+
+    if ([_flags observer] == self)
+    {
+        [_flags setObserver: nil];
+    }
+
+    ASSIGN(_flags, (theFlags ? theFlags : AUTORELEASE([[CWFlags alloc] init])));
+    [_flags setObserver: self];
+
+    if ([_flags rawFlags] != theOldFlags)
+    {
+        [self flags: _flags  didChangeFrom: theOldFlags];
+    }
+}
+
+
+//
+// CWFlagsObserver protocol
+//
+- (void) flags: (CWFlags *) theFlags  didChangeFrom: (PantomimeFlag) theOldFlags
+{
+    [_folder message: self  didChangeFlagsFrom: theOldFlags];
 }
 
 
@@ -1891,8 +1934,7 @@ static CWRegEx *prefixSubjFwdHdrAndSuffixSubjFwdTrlRegex = nil;
     {
         NSData *d;
 
-        d = [[NSString stringWithData: [CWMIMEUtility plainTextContentFromPart: thePart]  charset: [[thePart charset] dataUsingEncoding: NSASCIIStringEncoding]]
-             dataUsingEncoding: NSUTF8StringEncoding];
+        d = [CWMIMEUtility plainTextUTF8ContentFromPart: thePart];
         [theMutableData appendData: d];
         *theBOOL = YES;
     }
@@ -1936,9 +1978,7 @@ static CWRegEx *prefixSubjFwdHdrAndSuffixSubjFwdTrlRegex = nil;
                 [aPart isMIMEType: @"text"  subType: @"enriched"] ||
                 [aPart isMIMEType: @"text"  subType: @"html"])
             {
-                [theMutableData appendData: [[NSString stringWithData: [CWMIMEUtility plainTextContentFromPart: aPart]
-                                                              charset: [[aPart charset] dataUsingEncoding: NSASCIIStringEncoding]]
-                                             dataUsingEncoding: NSUTF8StringEncoding]];
+                [theMutableData appendData: [CWMIMEUtility plainTextUTF8ContentFromPart: aPart]];
 
                 // If our original Content-Type is multipart/alternative, no need to
                 // consider to the other text/* parts. Otherwise, we just append
@@ -0,0 +1,1205 @@
+//
+//  CWMessageArchive.m
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWMessageArchive.h"
+
+#import "CWConstants.h"
+#import "CWFlags.h"
+#import "CWIMAPMessage.h"
+#import "CWInternetAddress.h"
+#import "CWMessage.h"
+#import "CWMIMEMultipart.h"
+#import "CWPart.h"
+#import "CWSubrangeData.h"
+
+#import "CWLogger.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define ARCHIVE_MAGIC "CWMA"
+#define ARCHIVE_VERSION 1
+
+//
+// An archive is laid out as:
+//
+// "CWMA" | version (u32) | offset of the index (u64) | records | index
+//
+// The index holds the interned names (count, then a string for each)
+// followed by the offset of every message record (count, then the
+// offsets). Fixed-width integers are little-endian, all other integers
+// are LEB128 varints. Strings and data are prefixed by their length.
+//
+// A value is a tag byte followed by its payload. Parts and messages are
+// records: their payload starts with its length as a u32, so that a
+// reader can step over them without decoding them.
+//
+#define ARCHIVE_HEADER_LENGTH 16
+
+enum {
+    ARCHIVE_NIL = 0,
+    ARCHIVE_STRING,     // length, UTF-8 bytes
+    ARCHIVE_DATA,       // length, bytes
+    ARCHIVE_INTEGER,    // zigzag varint
+    ARCHIVE_REAL,       // IEEE 754 double
+    ARCHIVE_DATE,       // IEEE 754 double, seconds since 1970
+    ARCHIVE_ARRAY,      // count, values
+    ARCHIVE_ADDRESS,    // type, address, personal
+    ARCHIVE_FLAGS,      // flags
+    ARCHIVE_PART,       // record: part
+    ARCHIVE_MESSAGE,    // record: kind, part, message fields
+    ARCHIVE_MULTIPART,  // count, part or message records
+    ARCHIVE_KEYED       // length, NSKeyedArchiver data of other property list like objects
+};
+
+//
+// The class of archived messages.
+//
+enum {
+    ARCHIVE_KIND_MESSAGE = 0,
+    ARCHIVE_KIND_IMAP_MESSAGE
+};
+
+
+//
+// Writing
+//
+static void put_varint(NSMutableData *theData, uint64_t theValue)
+{
+    uint8_t buffer[10];
+    NSUInteger i = 0;
+
+    while (theValue >= 0x80)
+    {
+        buffer[i++] = (uint8_t) (theValue | 0x80);
+        theValue >>= 7;
+    }
+    buffer[i++] = (uint8_t) theValue;
+
+    [theData appendBytes: buffer  length: i];
+}
+
+static void put_byte(NSMutableData *theData, uint8_t theByte)
+{
+    [theData appendBytes: &theByte  length: 1];
+}
+
+static void put_uint32(NSMutableData *theData, uint32_t theValue)
+{
+    theValue = CFSwapInt32HostToLittle(theValue);
+    [theData appendBytes: &theValue  length: 4];
+}
+
+static void put_uint64(NSMutableData *theData, uint64_t theValue)
+{
+    theValue = CFSwapInt64HostToLittle(theValue);
+    [theData appendBytes: &theValue  length: 8];
+}
+
+static void put_double(NSMutableData *theData, double theValue)
+{
+    uint64_t bits;
+
+    memcpy(&bits, &theValue, 8);
+    put_uint64(theData, bits);
+}
+
+static void put_string(NSMutableData *theData, NSString *theString)
+{
+    const char *s = CFStringGetCStringPtr((__bridge CFStringRef) theString, kCFStringEncodingUTF8);
+
+    if (s)
+    {
+        size_t length = strlen(s);
+
+        put_varint(theData, length);
+        [theData appendBytes: s  length: length];
+    }
+    else
+    {
+        NSData *aData = [theString dataUsingEncoding: NSUTF8StringEncoding];
+
+        put_varint(theData, [aData length]);
+        [theData appendData: aData];
+    }
+}
+
+
+//
+// Reading. A cursor that runs past its end fails, and reads nothing but
+// zeroes from then on.
+//
+typedef struct
+{
+    const uint8_t *bytes;
+    NSUInteger length;
+    NSUInteger offset;
+    BOOL failed;
+} cw_archive_cursor;
+
+static const uint8_t *get_bytes(cw_archive_cursor *theCursor, NSUInteger theLength)
+{
+    const uint8_t *bytes;
+
+    if (theCursor->failed || theLength > theCursor->length - theCursor->offset)
+    {
+        theCursor->failed = YES;
+        return NULL;
+    }
+
+    bytes = theCursor->bytes + theCursor->offset;
+    theCursor->offset += theLength;
+
+    return bytes;
+}
+
+static uint64_t get_varint(cw_archive_cursor *theCursor)
+{
+    uint64_t value = 0;
+    unsigned int shift;
+
+    for (shift = 0; shift < 64; shift += 7)
+    {
+        const uint8_t *b = get_bytes(theCursor, 1);
+
+        if (!b)
+        {
+            return 0;
+        }
+
+        value |= (uint64_t) (*b & 0x7f) << shift;
+
+        if (!(*b & 0x80))
+        {
+            return value;
+        }
+    }
+
+    theCursor->failed = YES;
+
+    return 0;
+}
+
+static uint8_t get_byte(cw_archive_cursor *theCursor)
+{
+    const uint8_t *b = get_bytes(theCursor, 1);
+
+    return (b ? *b : 0);
+}
+
+static uint32_t get_uint32(cw_archive_cursor *theCursor)
+{
+    const uint8_t *b = get_bytes(theCursor, 4);
+    uint32_t value = 0;
+
+    if (b)
+    {
+        memcpy(&value, b, 4);
+    }
+
+    return CFSwapInt32LittleToHost(value);
+}
+
+static uint64_t get_uint64(cw_archive_cursor *theCursor)
+{
+    const uint8_t *b = get_bytes(theCursor, 8);
+    uint64_t value = 0;
+
+    if (b)
+    {
+        memcpy(&value, b, 8);
+    }
+
+    return CFSwapInt64LittleToHost(value);
+}
+
+static double get_double(cw_archive_cursor *theCursor)
+{
+    uint64_t bits = get_uint64(theCursor);
+    double value;
+
+    memcpy(&value, &bits, 8);
+
+    return value;
+}
+
+static NSString *get_string(cw_archive_cursor *theCursor)
+{
+    uint64_t length = get_varint(theCursor);
+    const uint8_t *bytes = get_bytes(theCursor, (NSUInteger) length);
+
+    if (!bytes)
+    {
+        return nil;
+    }
+
+    return AUTORELEASE([[NSString alloc] initWithBytes: bytes  length: (NSUInteger) length  encoding: NSUTF8StringEncoding]);
+}
+
+
+//
+// The classes values stored with NSKeyedArchiver may decode to.
+//
+static NSSet *keyed_classes(void)
+{
+    static NSSet *allClasses;
+    static dispatch_once_t once;
+
+    dispatch_once(&once, ^{
+        allClasses = [[NSSet alloc] initWithObjects: [NSArray class], [NSDictionary class], [NSString class],
+                      [NSData class], [NSNumber class], [NSDate class], [NSNull class], [NSURL class], nil];
+    });
+
+    return allClasses;
+}
+
+
+//
+//
+//
+@interface CWMessageArchiveWriter : NSObject
+{
+    NSMutableData *_data;
+    NSMutableDictionary<NSString *, NSNumber *> *_nameIDs;
+    NSMutableArray<NSString *> *_names;
+}
+
+- (NSData *) dataWithMessages: (NSArray *) theMessages;
+- (void) writeValue: (id) theValue;
+- (void) writePart: (CWPart *) thePart;
+
+@end
+
+
+//
+//
+//
+@interface CWMessageArchive ()
+{
+    NSData *_data;
+    NSArray<NSString *> *_names;
+    uint64_t *_offsets;
+    NSUInteger _count;
+}
+@end
+
+
+//
+//
+//
+@interface CWMessageArchive (Private)
+
+- (id) _readValue: (cw_archive_cursor *) theCursor;
+- (CWPart *) _readRecordOfType: (uint8_t) theType  cursor: (cw_archive_cursor *) theCursor;
+- (NSString *) _readName: (cw_archive_cursor *) theCursor;
+- (cw_archive_cursor) _cursorAtOffset: (NSUInteger) theOffset;
+
+@end
+
+
+//
+// A multipart whose parts are decoded from the archive when they are
+// first asked for. Changing it decodes all of them.
+//
+@interface CWArchivedMultipart : CWMIMEMultipart
+{
+    CWMessageArchive *_archive;
+    NSUInteger *_offsets;
+    NSMutableArray *_decodedParts;
+    NSUInteger _count;
+}
+
+- (id) initWithArchive: (CWMessageArchive *) theArchive
+               offsets: (NSUInteger *) theOffsets
+                 count: (NSUInteger) theCount;
+
+@end
+
+
+//
+// Access to the parameters, there is no public accessor for all of them.
+//
+@interface CWPart (CWMessageArchive)
+
+- (NSDictionary *) _archivedParameters;
+
+@end
+
+
+//
+//
+//
+@implementation CWPart (CWMessageArchive)
+
+- (NSDictionary *) _archivedParameters
+{
+    return _parameters;
+}
+
+@end
+
+
+//
+//
+//
+@implementation CWMessageArchiveWriter
+
+- (id) init
+{
+    self = [super init];
+
+    _data = [[NSMutableData alloc] initWithCapacity: 65536];
+    _nameIDs = [[NSMutableDictionary alloc] init];
+    _names = [[NSMutableArray alloc] init];
+
+    return self;
+}
+
+
+//
+//
+//
+- (NSData *) dataWithMessages: (NSArray *) theMessages
+{
+    NSMutableArray *allOffsets;
+    NSUInteger i, indexOffset;
+
+    allOffsets = [NSMutableArray arrayWithCapacity: [theMessages count]];
+
+    [_data appendBytes: ARCHIVE_MAGIC  length: 4];
+    put_uint32(_data, ARCHIVE_VERSION);
+    put_uint64(_data, 0);
+
+    for (i = 0; i < [theMessages count]; i++)
+    {
+        [allOffsets addObject: [NSNumber numberWithUnsignedInteger: [_data length]]];
+        [self writeValue: [theMessages objectAtIndex: i]];
+    }
+
+    indexOffset = [_data length];
+
+    put_varint(_data, [_names count]);
+
+    for (i = 0; i < [_names count]; i++)
+    {
+        put_string(_data, [_names objectAtIndex: i]);
+    }
+
+    put_varint(_data, [allOffsets count]);
+
+    for (i = 0; i < [allOffsets count]; i++)
+    {
+        put_varint(_data, [[allOffsets objectAtIndex: i] unsignedLongLongValue]);
+    }
+
+    // We can now tell where the index is
+    uint64_t anOffset = CFSwapInt64HostToLittle(indexOffset);
+    [_data replaceBytesInRange: NSMakeRange(8, 8)  withBytes: &anOffset];
+
+    return _data;
+}
+
+
+//
+// Names are written as their position in the index.
+//
+- (void) writeName: (NSString *) theName
+{
+    NSNumber *anID = [_nameIDs objectForKey: theName];
+
+    if (!anID)
+    {
+        anID = [NSNumber numberWithUnsignedInteger: [_names count]];
+        [_names addObject: theName];
+        [_nameIDs setObject: anID  forKey: theName];
+    }
+
+    put_varint(_data, [anID unsignedIntegerValue]);
+}
+
+
+//
+//
+//
+- (void) writeValue: (id) theValue
+{
+    if (!theValue)
+    {
+        put_byte(_data, ARCHIVE_NIL);
+    }
+    else if ([theValue isKindOfClass: [NSString class]])
+    {
+        put_byte(_data, ARCHIVE_STRING);
+        put_string(_data, theValue);
+    }
+    else if ([theValue isKindOfClass: [NSData class]])
+    {
+        put_byte(_data, ARCHIVE_DATA);
+        put_varint(_data, [(NSData *) theValue length]);
+        [_data appendData: theValue];
+    }
+    else if ([theValue isKindOfClass: [NSNumber class]])
+    {
+        const char *aType = [theValue objCType];
+
+        if (strcmp(aType, @encode(double)) == 0 || strcmp(aType, @encode(float)) == 0)
+        {
+            put_byte(_data, ARCHIVE_REAL);
+            put_double(_data, [theValue doubleValue]);
+        }
+        else
+        {
+            int64_t n = [theValue longLongValue];
+
+            put_byte(_data, ARCHIVE_INTEGER);
+            put_varint(_data, ((uint64_t) n << 1) ^ (uint64_t) (n >> 63));
+        }
+    }
+    else if ([theValue isKindOfClass: [NSDate class]])
+    {
+        put_byte(_data, ARCHIVE_DATE);
+        put_double(_data, [theValue timeIntervalSince1970]);
+    }
+    else if ([theValue isKindOfClass: [NSArray class]])
+    {
+        put_byte(_data, ARCHIVE_ARRAY);
+        put_varint(_data, [(NSArray *) theValue count]);
+
+        for (id o in theValue)
+        {
+            [self writeValue: o];
+        }
+    }
+    else if ([theValue isKindOfClass: [CWInternetAddress class]])
+    {
+        CWInternetAddress *anAddress = (CWInternetAddress *) theValue;
+
+        put_byte(_data, ARCHIVE_ADDRESS);
+        put_varint(_data, [anAddress type]);
+        [self writeValue: [anAddress address]];
+        [self writeValue: [anAddress personal]];
+    }
+    else if ([theValue isKindOfClass: [CWFlags class]])
+    {
+        put_byte(_data, ARCHIVE_FLAGS);
+        put_varint(_data, ((CWFlags *) theValue)->flags);
+    }
+    else if ([theValue isKindOfClass: [CWPart class]])
+    {
+        [self writePart: theValue];
+    }
+    else if ([theValue isKindOfClass: [CWMIMEMultipart class]])
+    {
+        CWMIMEMultipart *aMultipart = (CWMIMEMultipart *) theValue;
+        NSUInteger i;
+
+        put_byte(_data, ARCHIVE_MULTIPART);
+        put_varint(_data, [aMultipart count]);
+
+        for (i = 0; i < [aMultipart count]; i++)
+        {
+            [self writePart: [aMultipart partAtIndex: i]];
+        }
+    }
+    else
+    {
+        NSError *anError = nil;
+        NSData *aData = [NSKeyedArchiver archivedDataWithRootObject: theValue  requiringSecureCoding: YES  error: &anError];
+
+        if (!aData)
+        {
+            LogError(@"Unable to archive a value of class %@: %@", [theValue class], anError);
+            put_byte(_data, ARCHIVE_NIL);
+            return;
+        }
+
+        put_byte(_data, ARCHIVE_KEYED);
+        put_varint(_data, [aData length]);
+        [_data appendData: aData];
+    }
+}
+
+
+//
+//
+//
+- (void) writePart: (CWPart *) thePart
+{
+    NSDictionary *allHeaders, *allParameters;
+    NSUInteger start;
+    uint32_t aLength;
+    BOOL isMessage;
+
+    isMessage = [thePart isKindOfClass: [CWMessage class]];
+
+    put_byte(_data, (isMessage ? ARCHIVE_MESSAGE : ARCHIVE_PART));
+    start = [_data length];
+    put_uint32(_data, 0);
+
+    if (isMessage)
+    {
+        put_varint(_data, ([thePart isKindOfClass: [CWIMAPMessage class]] ? ARCHIVE_KIND_IMAP_MESSAGE : ARCHIVE_KIND_MESSAGE));
+    }
+
+    allHeaders = [thePart allHeaders];
+    put_varint(_data, [allHeaders count]);
+
+    for (NSString *aName in allHeaders)
+    {
+        [self writeName: aName];
+        [self writeValue: [allHeaders objectForKey: aName]];
+    }
+
+    allParameters = [thePart _archivedParameters];
+    put_varint(_data, [allParameters count]);
+
+    for (NSString *aName in allParameters)
+    {
+        [self writeName: aName];
+        [self writeValue: [allParameters objectForKey: aName]];
+    }
+
+    put_varint(_data, (uint64_t) [thePart size]);
+    [self writeValue: [thePart defaultCharset]];
+    [self writeValue: [thePart content]];
+
+    if (isMessage)
+    {
+        CWMessage *aMessage = (CWMessage *) thePart;
+
+        [self writeValue: [aMessage recipients]];
+        [self writeValue: [aMessage allReferences]];
+        put_varint(_data, [aMessage messageNumber]);
+        put_varint(_data, [aMessage flags]->flags);
+        put_byte(_data, [aMessage isInitialized]);
+
+        if ([aMessage isKindOfClass: [CWIMAPMessage class]])
+        {
+            put_varint(_data, [(CWIMAPMessage *) aMessage UID]);
+        }
+    }
+
+    NSAssert([_data length] - start - 4 <= UINT32_MAX, @"Part records are limited to 4 GB");
+    aLength = CFSwapInt32HostToLittle((uint32_t) ([_data length] - start - 4));
+    [_data replaceBytesInRange: NSMakeRange(start, 4)  withBytes: &aLength];
+}
+
+@end
+
+
+//
+//
+//
+@implementation CWMessageArchive
+
++ (NSData *) archivedDataWithMessages: (NSArray<CWMessage *> *) theMessages
+{
+    return [[[CWMessageArchiveWriter alloc] init] dataWithMessages: theMessages];
+}
+
+
+//
+//
+//
+- (instancetype) initWithData: (NSData *) theData
+{
+    NSMutableArray *allNames;
+    cw_archive_cursor aCursor;
+    uint64_t indexOffset, count, i;
+
+    self = [super init];
+
+    if (!self)
+    {
+        return nil;
+    }
+
+    if ([theData length] < ARCHIVE_HEADER_LENGTH ||
+        memcmp([theData bytes], ARCHIVE_MAGIC, 4) != 0)
+    {
+        return nil;
+    }
+
+    // We keep an immutable copy, decoded contents point into it.
+    _data = [theData copy];
+    aCursor = [self _cursorAtOffset: 4];
+
+    if (get_uint32(&aCursor) != ARCHIVE_VERSION)
+    {
+        LogError(@"Unsupported message archive version");
+        return nil;
+    }
+
+    indexOffset = get_uint64(&aCursor);
+
+    if (indexOffset < ARCHIVE_HEADER_LENGTH || indexOffset > [_data length])
+    {
+        return nil;
+    }
+
+    aCursor = [self _cursorAtOffset: (NSUInteger) indexOffset];
+    count = get_varint(&aCursor);
+
+    if (count > aCursor.length)
+    {
+        return nil;
+    }
+
+    allNames = [NSMutableArray arrayWithCapacity: (NSUInteger) count];
+
+    for (i = 0; i < count; i++)
+    {
+        NSString *aName = get_string(&aCursor);
+
+        if (!aName)
+        {
+            return nil;
+        }
+        [allNames addObject: aName];
+    }
+
+    _names = allNames;
+    _count = (NSUInteger) get_varint(&aCursor);
+
+    if (aCursor.failed || _count > aCursor.length)
+    {
+        return nil;
+    }
+
+    _offsets = malloc(MAX(_count, 1) * sizeof(uint64_t));
+
+    if (!_offsets)
+    {
+        return nil;
+    }
+
+    for (i = 0; i < _count; i++)
+    {
+        _offsets[i] = get_varint(&aCursor);
+    }
+
+    if (aCursor.failed)
+    {
+        return nil;
+    }
+
+    return self;
+}
+
+
+//
+//
+//
+- (instancetype) initWithContentsOfFile: (NSString *) thePath
+{
+    NSData *aData = [NSData dataWithContentsOfFile: thePath
+                                           options: NSDataReadingMappedIfSafe
+                                             error: NULL];
+
+    if (!aData)
+    {
+        return nil;
+    }
+
+    return [self initWithData: aData];
+}
+
+
+//
+//
+//
+- (void) dealloc
+{
+    free(_offsets);
+}
+
+
+//
+//
+//
+- (NSUInteger) count
+{
+    return _count;
+}
+
+
+//
+//
+//
+- (CWMessage *) messageAtIndex: (NSUInteger) theIndex
+{
+    cw_archive_cursor aCursor;
+    id aMessage;
+
+    if (theIndex >= _count)
+    {
+        [NSException raise: NSRangeException
+                    format: @"Index %lu is out of bounds (%lu messages).", (unsigned long) theIndex, (unsigned long) _count];
+    }
+
+    if (_offsets[theIndex] >= [_data length])
+    {
+        return nil;
+    }
+
+    aCursor = [self _cursorAtOffset: (NSUInteger) _offsets[theIndex]];
+    aMessage = [self _readValue: &aCursor];
+
+    if (aCursor.failed || ![aMessage isKindOfClass: [CWMessage class]])
+    {
+        LogError(@"Corrupted record for message %lu in archive", (unsigned long) theIndex);
+        return nil;
+    }
+
+    return aMessage;
+}
+
+@end
+
+
+//
+//
+//
+@implementation CWMessageArchive (Private)
+
+- (cw_archive_cursor) _cursorAtOffset: (NSUInteger) theOffset
+{
+    cw_archive_cursor aCursor;
+
+    aCursor.bytes = [_data bytes];
+    aCursor.length = [_data length];
+    aCursor.offset = MIN(theOffset, aCursor.length);
+    aCursor.failed = (theOffset > aCursor.length);
+
+    return aCursor;
+}
+
+
+//
+//
+//
+- (NSString *) _readName: (cw_archive_cursor *) theCursor
+{
+    uint64_t anID = get_varint(theCursor);
+
+    if (anID >= [_names count])
+    {
+        theCursor->failed = YES;
+        return nil;
+    }
+
+    return [_names objectAtIndex: (NSUInteger) anID];
+}
+
+
+//
+//
+//
+- (id) _readValue: (cw_archive_cursor *) theCursor
+{
+    uint8_t aType = get_byte(theCursor);
+
+    if (theCursor->failed)
+    {
+        return nil;
+    }
+
+    switch (aType)
+    {
+        case ARCHIVE_NIL:
+            return nil;
+
+        case ARCHIVE_STRING:
+            return get_string(theCursor);
+
+        case ARCHIVE_DATA: {
+            NSUInteger aLength = (NSUInteger) get_varint(theCursor);
+            NSUInteger start = theCursor->offset;
+
+            if (!get_bytes(theCursor, aLength))
+            {
+                return nil;
+            }
+
+            // We share the bytes of the archive instead of copying them.
+            return [CWSubrangeData dataWithParent: _data  range: NSMakeRange(start, aLength)];
+        }
+
+        case ARCHIVE_INTEGER: {
+            uint64_t n = get_varint(theCursor);
+
+            return [NSNumber numberWithLongLong: (int64_t) (n >> 1) ^ -(int64_t) (n & 1)];
+        }
+
+        case ARCHIVE_REAL:
+            return [NSNumber numberWithDouble: get_double(theCursor)];
+
+        case ARCHIVE_DATE:
+            return [NSDate dateWithTimeIntervalSince1970: get_double(theCursor)];
+
+        case ARCHIVE_ARRAY: {
+            uint64_t i, count = get_varint(theCursor);
+            NSMutableArray *anArray;
+
+            if (count > theCursor->length - theCursor->offset)
+            {
+                theCursor->failed = YES;
+                return nil;
+            }
+
+            anArray = [NSMutableArray arrayWithCapacity: (NSUInteger) count];
+
+            for (i = 0; i < count && !theCursor->failed; i++)
+            {
+                id o = [self _readValue: theCursor];
+
+                if (o)
+                {
+                    [anArray addObject: o];
+                }
+            }
+
+            return anArray;
+        }
+
+        case ARCHIVE_ADDRESS: {
+            PantomimeRecipientType aRecipientType = (PantomimeRecipientType) get_varint(theCursor);
+            NSString *anAddress = [self _readValue: theCursor];
+            NSString *aPersonal = [self _readValue: theCursor];
+
+            return AUTORELEASE([[CWInternetAddress alloc] initWithPersonal: aPersonal
+                                                                   address: anAddress
+                                                                      type: aRecipientType]);
+        }
+
+        case ARCHIVE_FLAGS:
+            return AUTORELEASE([[CWFlags alloc] initWithFlags: (PantomimeFlag) get_varint(theCursor)]);
+
+        case ARCHIVE_PART:
+        case ARCHIVE_MESSAGE:
+            return [self _readRecordOfType: aType  cursor: theCursor];
+
+        case ARCHIVE_MULTIPART: {
+            uint64_t i, count = get_varint(theCursor);
+            NSUInteger *allOffsets;
+
+            if (count > theCursor->length - theCursor->offset)
+            {
+                theCursor->failed = YES;
+                return nil;
+            }
+
+            // We only step over the parts, they are decoded when asked for.
+            allOffsets = malloc(MAX((NSUInteger) count, 1) * sizeof(NSUInteger));
+
+            if (!allOffsets)
+            {
+                theCursor->failed = YES;
+                return nil;
+            }
+
+            for (i = 0; i < count && !theCursor->failed; i++)
+            {
+                allOffsets[i] = theCursor->offset;
+                get_byte(theCursor);
+                get_bytes(theCursor, get_uint32(theCursor));
+            }
+
+            if (theCursor->failed)
+            {
+                free(allOffsets);
+                return nil;
+            }
+
+            return AUTORELEASE([[CWArchivedMultipart alloc] initWithArchive: self
+                                                                    offsets: allOffsets
+                                                                      count: (NSUInteger) count]);
+        }
+
+        case ARCHIVE_KEYED: {
+            NSUInteger aLength = (NSUInteger) get_varint(theCursor);
+            const uint8_t *bytes = get_bytes(theCursor, aLength);
+            id o = nil;
+
+            if (!bytes)
+            {
+                return nil;
+            }
+
+            // An archive must not be able to instantiate any class it names.
+            @try
+            {
+                o = [NSKeyedUnarchiver unarchivedObjectOfClasses: keyed_classes()
+                                                        fromData: [NSData dataWithBytesNoCopy: (void *) bytes
+                                                                                       length: aLength
+                                                                                 freeWhenDone: NO]
+                                                           error: NULL];
+            }
+            @catch (NSException *anException)
+            {
+                o = nil;
+            }
+
+            if (!o)
+            {
+                theCursor->failed = YES;
+            }
+
+            return o;
+        }
+    }
+
+    // A type of a later version, we cannot tell how long it is.
+    theCursor->failed = YES;
+
+    return nil;
+}
+
+
+//
+//
+//
+- (CWPart *) _readRecordOfType: (uint8_t) theType  cursor: (cw_archive_cursor *) theCursor
+{
+    NSMutableDictionary *allHeaders;
+    cw_archive_cursor aCursor;
+    CWPart *aPart;
+    uint32_t aLength;
+    uint64_t i, count;
+    NSUInteger kind;
+    id aContent;
+
+    aLength = get_uint32(theCursor);
+
+    if (!get_bytes(theCursor, aLength))
+    {
+        return nil;
+    }
+
+    // We read the record alone, what follows it within a later version is skipped.
+    aCursor = *theCursor;
+    aCursor.length = aCursor.offset;
+    aCursor.offset -= aLength;
+
+    kind = ARCHIVE_KIND_MESSAGE;
+
+    if (theType == ARCHIVE_MESSAGE)
+    {
+        kind = (NSUInteger) get_varint(&aCursor);
+        aPart = AUTORELEASE((kind == ARCHIVE_KIND_IMAP_MESSAGE ? [[CWIMAPMessage alloc] init] : [[CWMessage alloc] init]));
+    }
+    else
+    {
+        aPart = AUTORELEASE([[CWPart alloc] init]);
+    }
+
+    count = get_varint(&aCursor);
+    allHeaders = [NSMutableDictionary dictionaryWithCapacity: (NSUInteger) MIN(count, 64)];
+
+    for (i = 0; i < count && !aCursor.failed; i++)
+    {
+        NSString *aName = [self _readName: &aCursor];
+        id aValue = [self _readValue: &aCursor];
+
+        if (aName && aValue)
+        {
+            [allHeaders setObject: aValue  forKey: aName];
+        }
+    }
+
+    [aPart setHeaders: allHeaders];
+
+    count = get_varint(&aCursor);
+
+    for (i = 0; i < count && !aCursor.failed; i++)
+    {
+        NSString *aName = [self _readName: &aCursor];
+        id aValue = [self _readValue: &aCursor];
+
+        if (aName && aValue)
+        {
+            [aPart setParameter: aValue  forKey: aName];
+        }
+    }
+
+    [aPart setSize: (NSInteger) get_varint(&aCursor)];
+    [aPart setDefaultCharset: [self _readValue: &aCursor]];
+
+    aContent = [self _readValue: &aCursor];
+
+    if ([aContent isKindOfClass: [NSData class]] ||
+        [aContent isKindOfClass: [CWMessage class]] ||
+        [aContent isKindOfClass: [CWMIMEMultipart class]])
+    {
+        [aPart setContent: aContent];
+    }
+
+    if (theType == ARCHIVE_MESSAGE)
+    {
+        CWMessage *aMessage = (CWMessage *) aPart;
+        NSArray *allRecipients = [self _readValue: &aCursor];
+        NSArray *allReferences = [self _readValue: &aCursor];
+
+        if ([allRecipients isKindOfClass: [NSArray class]])
+        {
+            [aMessage setRecipients: allRecipients];
+        }
+        if ([allReferences isKindOfClass: [NSArray class]])
+        {
+            [aMessage setReferences: allReferences];
+        }
+
+        [aMessage setMessageNumber: (NSUInteger) get_varint(&aCursor)];
+        // Like -initWithCoder:, we must not call -setFlags:, CWIMAPMessage forwards it to its folder.
+        [[aMessage flags] replaceWithFlags: AUTORELEASE([[CWFlags alloc] initWithFlags: (PantomimeFlag) get_varint(&aCursor)])];
+
+        if (get_byte(&aCursor))
+        {
+            [aMessage setInitialized: YES];
+        }
+
+        if (kind == ARCHIVE_KIND_IMAP_MESSAGE)
+        {
+            [(CWIMAPMessage *) aMessage setUID: (NSUInteger) get_varint(&aCursor)];
+        }
+    }
+
+    if (aCursor.failed)
+    {
+        theCursor->failed = YES;
+        return nil;
+    }
+
+    return aPart;
+}
+
+@end
+
+
+//
+//
+//
+@implementation CWArchivedMultipart
+
+- (id) initWithArchive: (CWMessageArchive *) theArchive
+               offsets: (NSUInteger *) theOffsets
+                 count: (NSUInteger) theCount
+{
+    NSUInteger i;
+
+    self = [super init];
+
+    _archive = theArchive;
+    _offsets = theOffsets;
+    _count = theCount;
+    _decodedParts = [[NSMutableArray alloc] initWithCapacity: theCount];
+
+    for (i = 0; i < theCount; i++)
+    {
+        [_decodedParts addObject: [NSNull null]];
+    }
+
+    return self;
+}
+
+
+//
+//
+//
+- (void) dealloc
+{
+    free(_offsets);
+}
+
+
+//
+// Decodes the parts not decoded yet and hands all of them to our superclass.
+//
+- (void) _decodeAllParts
+{
+    NSUInteger i;
+
+    if (!_archive)
+    {
+        return;
+    }
+
+    for (i = 0; i < _count; i++)
+    {
+        [super addPart: [self partAtIndex: i]];
+    }
+
+    _archive = nil;
+    _decodedParts = nil;
+}
+
+
+//
+//
+//
+- (void) addPart: (CWPart *) thePart
+{
+    [self _decodeAllParts];
+    [super addPart: thePart];
+}
+
+
+//
+//
+//
+- (void) removePart: (CWPart *) thePart
+{
+    [self _decodeAllParts];
+    [super removePart: thePart];
+}
+
+
+//
+//
+//
+- (NSUInteger) count
+{
+    return (_archive ? _count : [super count]);
+}
+
+
+//
+//
+//
+- (CWPart *) partAtIndex: (NSUInteger) theIndex
+{
+    cw_archive_cursor aCursor;
+    CWPart *aPart;
+
+    if (!_archive)
+    {
+        return [super partAtIndex: theIndex];
+    }
+
+    aPart = [_decodedParts objectAtIndex: theIndex];
+
+    if ([aPart isKindOfClass: [CWPart class]])
+    {
+        return aPart;
+    }
+
+    aCursor = [_archive _cursorAtOffset: _offsets[theIndex]];
+    aPart = [_archive _readValue: &aCursor];
+
+    // The records were stepped over once, a failure here is a corruption within one.
+    if (![aPart isKindOfClass: [CWPart class]])
+    {
+        LogError(@"Corrupted record for part %lu in archive", (unsigned long) theIndex);
+        aPart = AUTORELEASE([[CWPart alloc] init]);
+    }
+
+    [_decodedParts replaceObjectAtIndex: theIndex  withObject: aPart];
+
+    return aPart;
+}
+
+@end
@@ -24,11 +24,13 @@
 
 #import <Foundation/Foundation.h>
 
-#import <PlanckToolboxForExtensions/PEPLogger.h>
+#import "CWLogger.h"
 
 #import "CWConstants.h"
+#import "CWDate.h"
 #import "CWFlags.h"
 #import "CWInternetAddress.h"
+#import "CWInternetAddress+Parsing.h"
 #import <PantomimeFramework/CWMessage.h>
 #import "CWMIMEUtility.h"
 #import "NSMutableString+Extension.h"
@@ -47,78 +49,6 @@
 #import <Foundation/NSString.h>
 #import <Foundation/NSURL.h>
 
-//
-//
-//
-static char *month_name[12] = {"jan", "feb", "mar", "apr", "may", "jun", "jul", "aug", "sep", "oct", "nov", "dec"};
-
-static struct _timezone {
-    char *name;          /* time zone name */
-    int offset;         /* offset, in minutes, EAST of GMT */
-} timezone_info[] = {
-
-    /* the following are from RFC-822 */
-    { "ut", 0 },
-    { "gmt", 0 },
-    { "est", -5*3600 },   { "edt", -4*3600 },       /* USA eastern standard */
-    { "cst", -6*3600 },   { "cdt", -5*3600 },       /* USA central standard */
-    { "mst", -7*3600 },   { "mdt", -6*3600 },       /* USA mountain standard */
-    { "pst", -8*3600 },   { "pdt", -7*3600 },       /* USA pacific standard */
-    { "z", 0 }, /* zulu time (the rest of the military codes are bogus) */
-
-    /* popular European timezones */
-    { "wet", 0*3600 },                            /* western european */
-    { "met", 1*3600 },                            /* middle european */
-    { "eet", 2*3600 },                            /* eastern european */
-    { "bst", 1*3600 },                            /* ??? british summer time */
-
-    /* Canadian timezones */
-    { "ast", -4*3600 },   { "adt", -3*3600 },       /* atlantic */
-    { "nst", -3*1800 },{ "ndt", -2*1800 },          /* newfoundland */
-    { "yst", -9*3600 },   { "ydt", -8*3600 },       /* yukon */
-    { "hst", -10*3600 },                            /* hawaii (not really canada) */
-
-    /* Asian timezones */
-    { "jst", 9*3600 },                            /* japan */
-    { "sst", 8*3600 },                            /* singapore */
-
-    /* South-Pacific timezones */
-    { "nzst", 12*3600 },  { "nzdt", 13*3600 },      /* new zealand */
-    { "wst", 8*3600 },    { "wdt", 9*3600 },        /* western australia */
-
-    /*
-     * Daylight savings modifiers.  These are not real timezones.
-     * They are used for things like "met dst".  The "met" timezone
-     * is 1*3600, and applying the "dst" modifier makes it 2*3600.
-     */
-    { "dst", 1*3600 },
-    { "dt", 1*3600 },
-    { "st", 1*3600 }
-};
-
-//
-//
-//
-NSInteger next_word(unsigned char *buf, NSUInteger start, NSUInteger len, unsigned char *word)
-{
-    unsigned char *p;
-    NSUInteger i;
-
-    for (p = buf+start, i = start; (isspace(*p) || *p == ','); ++p, ++i);
-
-    if (start >= len) return -1;
-
-    while (i < len && !(isspace(*p) || *p == ','))
-    {
-        *word++ = *p++;
-        i++;
-    }
-
-    *word = '\0';
-
-    return p-buf-start;
-}
-
 // MARK: - private interface
 
 @interface CWParser (Private)
@@ -377,179 +307,14 @@ NSRange shrinkRange(NSRange range)
 + (void) parseDate: (NSData *) theLine
          inMessage: (CWMessage *) theMessage
 {
-    if ([[theLine asciiString] containsString:@"__Smtpdate"]) {
-        // We have seen spammer to use this date: "Date: __Smtpdate", which we consider invalid.
-        // Do nothing.
-        return;
-    }
+    NSTimeInterval aTime;
 
-    if ([theLine length] > 6)
+    // We skip "Date: ". Values that are not dates, like the "__Smtpdate"
+    // some spammers use, are ignored.
+    if ([theLine length] > 6 &&
+        CWParseRFC5322Date((const unsigned char *)[theLine bytes] + 6, [theLine length] - 6, &aTime))
     {
-        NSData *aData;
-
-        NSInteger month;
-        int day, year, hours, mins, secs;
-        NSUInteger tz, i, j, len, tot, s;
-        unsigned char *bytes, *word;
-
-        aData = [theLine subdataFromIndex: 6];
-
-        word = malloc(256);
-        *word = '\0';
-
-        //LogInfo(@"Have to parse |%@|", [aData asciiString]);
-
-        bytes = (unsigned char*)[aData bytes];
-        tot = [aData length];
-        i = len = 0;
-        s = 0;
-        tz = 0;
-
-        // date-time       =       [ day-of-week "," ] date FWS time [CFWS]
-        // day-of-week     =       ([FWS] day-name) / obs-day-of-week
-        // day-name        =       "Mon" / "Tue" / "Wed" / "Thu" /
-        //                         "Fri" / "Sat" / "Sun"
-        // date            =       day month year
-        // year            =       4*DIGIT / obs-year
-        // month           =       (FWS month-name FWS) / obs-month
-        // month-name      =       "Jan" / "Feb" / "Mar" / "Apr" /
-        //                         "May" / "Jun" / "Jul" / "Aug" /
-        //                         "Sep" / "Oct" / "Nov" / "Dec"
-        //
-        // day             =       ([FWS] 1*2DIGIT) / obs-day
-        // time            =       time-of-day FWS zone
-        // time-of-day     =       hour ":" minute [ ":" second ]
-        // hour            =       2DIGIT / obs-hour
-        // minute          =       2DIGIT / obs-minute
-        // second          =       2DIGIT / obs-second
-        // zone            =       (( "+" / "-" ) 4DIGIT) / obs-zone
-        //
-        // We need to handle RFC2822 and UNIX time:
-        //
-        // Date: Wed, 02 Jan 2002 09:07:19 -0700
-        // Date: 02 Jan 2002 19:57:49 +0000
-        //
-        // And broken dates such as:
-        //
-        // Date: Thu, 03 Jan 2002 16:40:30 GMT
-        // Date: Wed, 2 Jan 2002 08:56:18 -0700 (MST)
-        // Date: Wed, 9 Jan 2002 10:04:23 -0500 (Eastern Standard Time)
-        // Date: 11-Jan-02
-        // Date: Tue, 15 Jan 2002 15:45:53 -0801
-        // Date: Thu, 17 Jan 2002 11:54:11 -0900<br>
-        //
-        //while (i < tot && isspace(*bytes))
-        //	{
-        //	  i++; bytes++;
-        //	}
-
-        len = next_word(bytes, i, tot, word); if (len <= 0) { free(word); return; }
-
-        if (isalpha(*word))
-        {
-            //LogInfo(@"UNIX DATE");
-
-            // We skip the first word, no need for it.
-            i += len+1; len = next_word(bytes, i, tot, word); if (len <= 0) { free(word); return; }
-        }
-
-
-        month = year = -1;
-
-        // We got a RFC 822 date. The syntax is:
-        // day month year hh:mm:ss zone
-        // For example: 03 Apr 2003 17:27:06 +0200
-        //LogInfo(@"RFC-822 time");
-        day = atoi((const char*)word);
-
-        //printf("len = %d |%s| day = %d\n", len, word, day);
-
-        // We get the month name and we convert it.
-        i += len+1; len = next_word(bytes, i, tot, word); if (len <= 0) { free(word); return; }
-
-        for (j = 0; j < 12; j++)
-        {
-            if (strncasecmp((const char*)word, month_name[j], 3) == 0)
-            {
-                month = j+1;
-            }
-        }
-
-        if (month < 0) { free(word); return; }
-
-        //printf("len = %d |%s| month = %d\n", len, word, month);
-
-        // We get the year.
-        i += len+1; len = next_word(bytes, i, tot, word); if (len <= 0) { free(word); return; }
-        year = atoi((const char*)word);
-
-        if (year < 70) year += 2000;
-        if (year < 100) year += 1900;
-
-        //printf("len = %d |%s| year = %d\n", len, word, year);
-
-        // We parse the time using the hh:mm:ss format.
-        i += len+1; len = next_word(bytes, i, tot, word); if (len <= 0) { free(word); return; }
-        sscanf((const char*)word, "%d:%d:%d", &hours, &mins, &secs);
-        //printf("len = %d |%s| %d:%d:%d\n", len, word, hours, mins, secs);
-
-        // We parse the timezone.
-        i += len+1; len = next_word(bytes, i, tot, word);
-
-        if (len <= 0)
-        {
-            tz = 0;
-        }
-        else
-        {
-            unsigned char *p;
-
-            p = word;
-
-            if (*p == '-' || *p == '+')
-            {
-                s = (*p == '-' ? -1 : 1);
-                p++;
-            }
-
-            len = strlen((const char*)p);
-
-            if (isdigit(*p))
-            {
-                if (len == 2)
-                {
-                    tz = (*(p)-48)*36000+*((p+1)-48)*3600;
-                }
-                else
-                {
-                    tz = (*(p)-48)*36000+(*(p+1)-48)*3600+(*(p+2)-48)*10+(*(p+3)-48);
-                }
-            }
-            else
-            {
-                for (j = 0; j < sizeof(timezone_info)/sizeof(timezone_info[0]); j++)
-                {
-                    if (strncasecmp((const char*)p, timezone_info[j].name, len) == 0)
-                    {
-                        tz = timezone_info[j].offset;
-                    }
-                }
-            }
-            tz = s*tz;
-        }
-        NSCalendar *calendar = [NSCalendar currentCalendar];
-        NSDateComponents *components = [[NSDateComponents alloc] init];
-        [components setDay:day];
-        [components setMonth:month];
-        [components setYear:year];
-        [components setHour:hours];
-        [components setMinute:mins];
-        [components setSecond:secs];
-        [components setTimeZone:[NSTimeZone timeZoneForSecondsFromGMT: tz]];
-        NSDate *date = [calendar dateFromComponents:components];
-
-        [theMessage setOriginationDate:date];
-        free(word);
+        [theMessage setOriginationDate: [NSDate dateWithTimeIntervalSince1970: aTime]];
     }
 }
 
@@ -563,10 +328,7 @@ NSRange shrinkRange(NSRange range)
 {  
     CWInternetAddress *anInternetAddress;
     NSData *aData;
-
-    NSUInteger i, len, s_len, x, y;
-    unsigned char *bytes;
-    BOOL b;
+    NSUInteger len;
 
     len = 0;
     if (theBOOL)
@@ -602,44 +364,13 @@ NSRange shrinkRange(NSRange range)
         aData = [theLine subdataFromIndex: len];
     }
 
-    bytes = (unsigned char*)[aData bytes];
-    len = [aData length];
-    b = NO; x = 0;
-
-    for (i = 0; i < len; i++)
+    // Malformed addresses are ignored.
+    for (anInternetAddress in [CWInternetAddress addressesFromBytes: [aData bytes]
+                                                             length: [aData length]
+                                                            charset: [theMessage defaultCharset]])
     {
-        if (*bytes == '"')
-        {
-            b = !b;
-        }
-
-        if (*bytes == ',' || i == len-1)
-        {
-            if (b)
-            {
-                bytes++;
-                continue;
-            }
-
-            y = i;
-
-            // We strip the trailing comma for all but the last entries.
-            s_len = y-x;
-            if (i == len-1) s_len++;
-
-            anInternetAddress = [[CWInternetAddress alloc]
-                                 initWithString: [CWMIMEUtility decodeHeader: [[aData subdataWithRange: NSMakeRange(x, s_len)] dataByTrimmingWhiteSpaces]
-                                                                     charset: [theMessage defaultCharset]]];
-
-            if (anInternetAddress) { // ignore malformed addresses
-                [anInternetAddress setType: theType];
-                [theMessage addRecipient: anInternetAddress];
-                RELEASE(anInternetAddress);
-            }
-            x = y+1;
-        }
-
-        bytes++;
+        [anInternetAddress setType: theType];
+        [theMessage addRecipient: anInternetAddress];
     }
 
     return aData;
@@ -669,9 +400,9 @@ NSRange shrinkRange(NSRange range)
         aData = [theLine subdataFromIndex: 6];
     }
 
-    anInternetAddress = [[CWInternetAddress alloc] initWithString:
-                         [CWMIMEUtility decodeHeader: aData charset: [theMessage defaultCharset]]
-                         ];
+    anInternetAddress = [[CWInternetAddress alloc] initWithBytes: [aData bytes]
+                                                          length: [aData length]
+                                                         charset: [theMessage defaultCharset]];
     [theMessage setFrom: anInternetAddress];
     RELEASE(anInternetAddress);
 
@@ -793,59 +524,18 @@ NSRange shrinkRange(NSRange range)
 {
     if ([theLine length] > 10)
     {
-        CWInternetAddress *anInternetAddress;
-        NSMutableArray *aMutableArray;
+        NSArray *allAddresses;
         NSData *aData;
 
-        unsigned char *bytes;
-        NSUInteger i, len, s_len, x, y;
-        BOOL b;
-
-        aMutableArray = [[NSMutableArray alloc] init];
         aData = [theLine subdataFromIndex: 10];
-        bytes = (unsigned char*)[aData bytes];
-        len = [aData length];
-        b = NO; x = 0;
-
-        for (i = 0; i < len; i++)
-        {
-            if (*bytes == '"')
-            {
-                b = !b;
-            }
-
-            if (*bytes == ',' || i == len-1)
-            {
-                if (b)
-                {
-                    bytes++;
-                    continue;
-                }
-
-                y = i;
-
-                // We strip the trailing comma for all but the last entries.
-                s_len = y-x;
-                if (i == len-1) s_len++;
-
-                anInternetAddress = [[CWInternetAddress alloc]
-                                     initWithString: [CWMIMEUtility decodeHeader: [[aData subdataWithRange: NSMakeRange(x, s_len)] dataByTrimmingWhiteSpaces]
-                                                                         charset: [theMessage defaultCharset]]];
+        allAddresses = [CWInternetAddress addressesFromBytes: [aData bytes]
+                                                      length: [aData length]
+                                                     charset: [theMessage defaultCharset]];
 
-                [aMutableArray addObject: anInternetAddress];
-                RELEASE(anInternetAddress);
-                x = y+1;
-            }
-
-            bytes++;
-        }
-
-        if ([aMutableArray count])
+        if ([allAddresses count])
         {
-            [theMessage setReplyTo: aMutableArray];
+            [theMessage setReplyTo: allAddresses];
         }
-
-        RELEASE(aMutableArray);
     }
 }
 
@@ -860,9 +550,9 @@ NSRange shrinkRange(NSRange range)
     {
         CWInternetAddress *anInternetAddress;
 
-        anInternetAddress = [[CWInternetAddress alloc] initWithString: [CWMIMEUtility decodeHeader:
-                                                                        [theLine subdataFromIndex: 13]
-                                                                                           charset: [theMessage defaultCharset]]];
+        anInternetAddress = [[CWInternetAddress alloc] initWithBytes: (const unsigned char *)[theLine bytes] + 13
+                                                              length: [theLine length] - 13
+                                                             charset: [theMessage defaultCharset]];
 
         [theMessage setResentFrom: anInternetAddress];
         RELEASE(anInternetAddress);
@@ -945,12 +635,12 @@ NSRange shrinkRange(NSRange range)
 
     if (range.location != NSNotFound)
     {
-        aName = [theLine subdataWithRange: NSMakeRange(0, range.location)];
+        aName = [theLine subdataNoCopyWithRange: NSMakeRange(0, range.location)];
 
         // we keep only the headers that have a value
         if (([theLine length]-range.location-1) > 0)
         {
-            aValue = [theLine subdataWithRange: NSMakeRange(range.location + 2, [theLine length]-range.location-2)];
+            aValue = [theLine subdataNoCopyWithRange: NSMakeRange(range.location + 2, [theLine length]-range.location-2)];
 
             [theMessage addHeader: [aName asciiString]  withValue: [aValue asciiString]];
         }
@@ -1038,7 +728,7 @@ NSRange shrinkRange(NSRange range)
     }
 
     NSMutableData *resultData = [[NSMutableData alloc] initWithData:
-                                 [[[inData subdataWithRange: r1] dataByTrimmingWhiteSpaces]
+                                 [[[inData subdataNoCopyWithRange: r1] dataByTrimmingWhiteSpaces]
                                   dataFromQuotedData]
                                  ];
     // VERY IMPORTANT:
@@ -1088,7 +778,7 @@ NSRange shrinkRange(NSRange range)
                     value_end = len;
                 }
                 [resultData appendData:
-                 [[[inData subdataWithRange: NSMakeRange(value_start, value_end - value_start)]
+                 [[[inData subdataNoCopyWithRange: NSMakeRange(value_start, value_end - value_start)]
                    dataFromSemicolonTerminatedData]
                   dataFromQuotedData]];
             }
@@ -115,9 +115,9 @@ static int currentPartVersion = 2;
         return self;
     }
 
-    [self setHeadersFromData:[theData subdataWithRange:NSMakeRange(0,aRange.location)]];
+    [self setHeadersFromData:[theData subdataNoCopyWithRange:NSMakeRange(0,aRange.location)]];
     [CWMIMEUtility setContentFromRawSource:
-     [theData subdataWithRange:NSMakeRange(aRange.location + 2,
+     [theData subdataNoCopyWithRange:NSMakeRange(aRange.location + 2,
                                            [theData length]-(aRange.location+2))] inPart: self];
 
     return self;
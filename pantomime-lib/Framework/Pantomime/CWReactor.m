@@ -0,0 +1,157 @@
+//
+//  CWReactor.m
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWReactor.h"
+
+#import "CWLogger.h"
+
+static NSUInteger const kDefaultMaximumNumberOfThreads = 4;
+
+static CWReactor *sharedReactor = nil;
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface CWReactor ()
+
+@property (nonatomic, strong) NSArray<NSThread *> *threads;
+
+@end
+
+@implementation CWReactor
+{
+    NSUInteger *_loads;
+}
+
++ (CWReactor *)sharedReactor
+{
+    @synchronized(self) {
+        if (!sharedReactor) {
+            NSUInteger count = [[NSProcessInfo processInfo] activeProcessorCount];
+            sharedReactor = [[CWReactor alloc]
+                             initWithNumberOfThreads:MIN(count, kDefaultMaximumNumberOfThreads)];
+        }
+        return sharedReactor;
+    }
+}
+
++ (void)setSharedReactor:(CWReactor *)theReactor
+{
+    @synchronized(self) {
+        sharedReactor = theReactor;
+    }
+}
+
+- (instancetype)initWithNumberOfThreads:(NSUInteger)theCount
+{
+    if (self = [super init]) {
+        theCount = MAX(theCount, 1);
+        _loads = calloc(theCount, sizeof(NSUInteger));
+
+        NSMutableArray *threads = [NSMutableArray arrayWithCapacity:theCount];
+        dispatch_semaphore_t started = dispatch_semaphore_create(0);
+
+        for (NSUInteger i = 0; i < theCount; i++) {
+            // The threads must not retain the reactor, they never exit.
+            NSThread *thread = [[NSThread alloc] initWithTarget:[self class]
+                                                       selector:@selector(runEventLoop:)
+                                                         object:started];
+            thread.name = [NSString stringWithFormat:@"CWReactor %p #%lu",
+                           self, (unsigned long) i];
+            [threads addObject:thread];
+            [thread start];
+        }
+
+        // Wait for the run loops, so performs are never queued on a thread without one.
+        for (NSUInteger i = 0; i < theCount; i++) {
+            dispatch_semaphore_wait(started, DISPATCH_TIME_FOREVER);
+        }
+
+        _threads = threads;
+        LogInfo(@"CWReactor: started %lu threads", (unsigned long) theCount);
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    free(_loads);
+}
+
+- (NSUInteger)numberOfThreads
+{
+    return self.threads.count;
+}
+
+- (NSThread *)attach
+{
+    @synchronized(self) {
+        NSUInteger best = 0;
+        for (NSUInteger i = 1; i < self.threads.count; i++) {
+            if (_loads[i] < _loads[best]) {
+                best = i;
+            }
+        }
+        _loads[best]++;
+        return self.threads[best];
+    }
+}
+
+- (void)detach:(NSThread *)theThread
+{
+    @synchronized(self) {
+        NSUInteger index = [self.threads indexOfObjectIdenticalTo:theThread];
+        if (index != NSNotFound && _loads[index] > 0) {
+            _loads[index]--;
+        }
+    }
+}
+
+- (NSUInteger)numberOfConnectionsOnThread:(NSThread *)theThread
+{
+    @synchronized(self) {
+        NSUInteger index = [self.threads indexOfObjectIdenticalTo:theThread];
+        return index == NSNotFound ? 0 : _loads[index];
+    }
+}
+
+- (void)performBlock:(dispatch_block_t)theBlock onThread:(NSThread *)theThread
+{
+    if ([NSThread currentThread] == theThread) {
+        theBlock();
+    } else {
+        [[self class] performSelector:@selector(runBlock:)
+                             onThread:theThread
+                           withObject:[theBlock copy]
+                        waitUntilDone:NO];
+    }
+}
+
+#pragma mark - Event Loop
+
++ (void)runBlock:(dispatch_block_t)theBlock
+{
+    theBlock();
+}
+
++ (void)runEventLoop:(dispatch_semaphore_t)started
+{
+    NSRunLoop *runLoop = [NSRunLoop currentRunLoop];
+
+    // A run loop without any source returns immediately, so keep a port around.
+    [runLoop addPort:[NSPort port] forMode:NSDefaultRunLoopMode];
+    dispatch_semaphore_signal(started);
+
+    while (1) {
+        @autoreleasepool {
+            [runLoop runMode:NSDefaultRunLoopMode beforeDate:[NSDate distantFuture]];
+        }
+    }
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -27,19 +27,31 @@
 #import "sys/types.h"
 #import "regex.h"
 
+#import <Foundation/NSData.h>
 #import <Foundation/NSObject.h>
+#import <Foundation/NSRange.h>
 #import <Foundation/NSString.h>
 
+struct cw_byte_regex;
+
 /*!
   @class CWRegEx
   @abstract Provides a simple object-oriented wrapper around POSIX regex.
   @discussion This class provides a simple and efficient interface around
               POSIX regex, which are available on most UNIX (or like) systems.
+
+              Extended patterns using only literals, bracket expressions,
+              ".", "*", "+", "?", "|", groups and anchors are matched by
+              a linear-time matcher working on bytes, others by regexec(3).
+              Both find the same matches, as regexec(3) does in the C locale.
+              Instances are immutable and can be used from several threads.
 */
 @interface CWRegEx : NSObject
 {
   @private
     regex_t _re;
+    BOOL _compiled;
+    struct cw_byte_regex *_program;
 }
 
 /*!
@@ -65,15 +77,16 @@
 
 /*!
   @method regexWithPattern:
-  @discussion Invokes initWithPattern: with <i>thePattern</i> and
-              autoreleases the returned instance.
+  @discussion Invokes regexWithPattern: flags: with <i>thePattern</i>
+              and the default REG_EXTENDED flag.
 */
 + (id) regexWithPattern: (NSString *) thePattern;
 
 /*!
   @method regexWithPattern: flags:
-  @discussion Invokes initWithPattern: flags: with <i>thePattern</i> and
-              <i>theFlags</i>, then autoreleases the returned instance.
+  @discussion Returns an instance for <i>thePattern</i> and <i>theFlags</i>.
+              Compiled patterns are cached, so asking again for the
+              same pattern and flags does not compile it again.
 */
 + (id) regexWithPattern: (NSString *) thePattern
                   flags: (int) theFlags;
@@ -83,10 +96,29 @@
   @discussion This method is used to try to match <i>theString</i>
               using the instance's pattern.
   @param theString The string to match.
-  @result An array of matches (NSString instances), which can be empty but not nil.
+  @result An array of matches (NSValue instances holding the ranges of
+          the matches in the UTF-8 representation of <i>theString</i>),
+          which can be empty but not nil.
 */
 - (NSArray *) matchString: (NSString *) theString;
 
+/*!
+  @method matchData: range: ranges: count:
+  @discussion This method is used to find the matches of the instance's
+              pattern in bytes, without converting or copying them.
+              <i>theRange</i> is matched as if it was the whole string:
+              "^" matches at its start, "$" at its end.
+  @param theData The bytes to match.
+  @param theRange The range of <i>theData</i> to match.
+  @param theRanges A buffer receiving the ranges of the matches, in <i>theData</i>.
+  @param theCount The capacity of <i>theRanges</i>. Matching stops once it is full.
+  @result The number of matches written to <i>theRanges</i>.
+*/
+- (NSUInteger) matchData: (NSData *) theData
+                   range: (NSRange) theRange
+                  ranges: (NSRange *) theRanges
+                   count: (NSUInteger) theCount;
+
 /*!
   @method matchString: withPattern: isCaseSensitive:
   @discussion This method provides an easy way to quickly
@@ -95,7 +127,7 @@
   @param theString The string to match.
   @param thePattern The regular expression to use.
   @param theBOOL Case-sensitive, or not.
-  @result An array of matches (NSString instances), which can be empty but not nil.
+  @result An array of matches (NSValue instances, see matchString:), which can be empty but not nil.
 */
 + (NSArray *) matchString: (NSString *) theString
               withPattern: (NSString *) thePattern
@@ -23,12 +23,23 @@
 
 #import "Pantomime/CWRegEx.h"
 
+#import "CWByteRegex.h"
 #import "CWConstants.h"
 
 #import <Foundation/NSArray.h>
+#import <Foundation/NSDictionary.h>
+#import <Foundation/NSNull.h>
 #import <Foundation/NSValue.h>
 
 #import <stdlib.h>
+#import <string.h>
+
+//
+// The maximum number of compiled patterns kept by +regexWithPattern: flags:
+//
+#define CACHE_SIZE 256
+
+static NSMutableDictionary *cache = nil;
 
 
 //
@@ -57,21 +68,22 @@
 - (id) initWithPattern: (NSString *) thePattern
 		 flags: (int) theFlags
 {
-  int status;
-  char *error;
+  const char *aPattern;
   
   if ((self = [super init]))
     {
-      status = regcomp(&_re, [thePattern cStringUsingEncoding:NSUTF8StringEncoding], theFlags);
-      if (status != 0)
+      aPattern = [thePattern cStringUsingEncoding:NSUTF8StringEncoding];
+
+      // regcomp(3) still validates the pattern and serves
+      // as a fallback for what our own matcher lacks.
+      if (!aPattern || regcomp(&_re, aPattern, theFlags) != 0)
         {
-	  error = malloc(255*sizeof(char));
-	  regerror(status, &_re, error, 255);
-	  free(error);
-	  
 	  AUTORELEASE_VOID(self);
-	  self = nil;
+	  return nil;
         }
+
+      _compiled = YES;
+      _program = cw_byte_regex_compile(aPattern, theFlags);
     }
 
   return self;
@@ -83,7 +95,7 @@
 //
 + (id) regexWithPattern: (NSString *) thePattern
 {
-  return AUTORELEASE([[self alloc] initWithPattern: thePattern]);
+  return [self regexWithPattern: thePattern  flags: REG_EXTENDED];
 }
 
 
@@ -93,7 +105,40 @@
 + (id) regexWithPattern: (NSString *) thePattern
 		  flags: (int) theFlags
 {
-  return AUTORELEASE([[self alloc] initWithPattern: thePattern  flags: theFlags]);
+  NSString *aKey;
+  id aRegex;
+
+  if (!thePattern)
+    {
+      return nil;
+    }
+
+  aKey = [NSString stringWithFormat: @"%d:%@", theFlags, thePattern];
+
+  @synchronized ([CWRegEx class])
+    {
+      if (!cache)
+	{
+	  cache = [[NSMutableDictionary alloc] init];
+	}
+
+      aRegex = [cache objectForKey: aKey];
+
+      if (!aRegex)
+	{
+	  aRegex = AUTORELEASE([[self alloc] initWithPattern: thePattern  flags: theFlags]);
+
+	  if ([cache count] >= CACHE_SIZE)
+	    {
+	      [cache removeAllObjects];
+	    }
+
+	  // Invalid patterns are remembered too
+	  [cache setObject: (aRegex ? aRegex : [NSNull null])  forKey: aKey];
+	}
+    }
+
+  return (aRegex == [NSNull null] ? nil : aRegex);
 }
 
 
@@ -102,58 +147,135 @@
 //
 - (void)dealloc
 {
-  regfree(&_re);
+  if (_compiled)
+    {
+      regfree(&_re);
+    }
+  cw_byte_regex_free(_program);
   //[super dealloc];
 }
 
 
+//
+// Finds the first match in [theStart, theEnd) of theBytes.
+//
+- (BOOL) _search: (const unsigned char *) theBytes
+	    from: (NSUInteger) theStart
+	     end: (NSUInteger) theEnd
+	  notBOL: (BOOL) theBOOL
+	   match: (NSRange *) theMatch
+{
+  regmatch_t rm[1];
+  int status;
+
+  if (_program)
+    {
+      return cw_byte_regex_search(_program, theBytes, theStart, theEnd, theBOOL, theMatch);
+    }
+
+#ifdef REG_STARTEND
+  rm[0].rm_so = 0;
+  rm[0].rm_eo = (regoff_t) (theEnd - theStart);
+  status = regexec(&_re, (const char *) theBytes + theStart, 1, rm,
+		   REG_STARTEND | (theBOOL ? REG_NOTBOL : 0));
+#else
+  {
+    char *s;
+
+    s = malloc(theEnd - theStart + 1);
+    memcpy(s, theBytes + theStart, theEnd - theStart);
+    s[theEnd - theStart] = 0;
+    status = regexec(&_re, s, 1, rm, (theBOOL ? REG_NOTBOL : 0));
+    free(s);
+  }
+#endif
+
+  if (status != 0)
+    {
+      return NO;
+    }
+
+  *theMatch = NSMakeRange(theStart + (NSUInteger) rm[0].rm_so, (NSUInteger) (rm[0].rm_eo - rm[0].rm_so));
+  return YES;
+}
+
+
 //
 //
 //
 - (NSArray *) matchString: (NSString *) theString
 {
   NSMutableArray *aMutableArray;
-    
-    NSUInteger offset;
-    int status;
-  char *s, *error;
-  regmatch_t rm[1];
+  NSUInteger offset, length;
+  NSRange aRange;
+  const char *s;
+  BOOL notBOL;
   
-  s = (char*)[theString cStringUsingEncoding:NSUTF8StringEncoding];
+  s = [theString cStringUsingEncoding:NSUTF8StringEncoding];
   aMutableArray = [[NSMutableArray alloc] init];
-  
-  status = regexec(&_re, s, 1, rm, 0);
+
+  if (!s)
+    {
+      return AUTORELEASE(aMutableArray);
+    }
+
+  length = strlen(s);
   offset = 0;
+  notBOL = NO;
   
-  while (status == 0)
+  while ([self _search: (const unsigned char *) s  from: offset  end: length  notBOL: notBOL  match: &aRange])
     {
-      NSValue *aValue;
-      
-      aValue = [NSValue valueWithRange: NSMakeRange(offset + (NSUInteger) rm[0].rm_so,
-                                                    (NSUInteger) (rm[0].rm_eo - rm[0].rm_so))];
-      
-      [aMutableArray addObject: aValue];
-      
-      offset += rm[0].rm_eo;
+      [aMutableArray addObject: [NSValue valueWithRange: aRange]];
       
-      if (rm[0].rm_eo - rm[0].rm_so == 0)
+      if (aRange.length == 0)
         {
-	  status = 1;
-        }
-      else
-        {
-	  status = regexec(&_re, s + offset, 1, rm, REG_NOTBOL);
+	  break;
         }
+
+      offset = NSMaxRange(aRange);
+      notBOL = YES;
     }
   
-  if (status != REG_NOMATCH)
+  return AUTORELEASE(aMutableArray);
+}
+
+
+//
+//
+//
+- (NSUInteger) matchData: (NSData *) theData
+		   range: (NSRange) theRange
+		  ranges: (NSRange *) theRanges
+		   count: (NSUInteger) theCount
+{
+  const unsigned char *bytes;
+  NSUInteger offset, end, count;
+  BOOL notBOL;
+
+  if (NSMaxRange(theRange) > [theData length])
     {
-      error = malloc(255*sizeof(char));
-      regerror(status, &_re, error, 255);
-      free(error);
+      return 0;
     }
-  
-  return AUTORELEASE(aMutableArray);
+
+  bytes = [theData bytes];
+  offset = theRange.location;
+  end = NSMaxRange(theRange);
+  notBOL = NO;
+  count = 0;
+
+  while (count < theCount &&
+	 [self _search: bytes  from: offset  end: end  notBOL: notBOL  match: &theRanges[count]])
+    {
+      if (theRanges[count++].length == 0)
+	{
+	  break;
+	}
+
+      offset = NSMaxRange(theRanges[count-1]);
+      notBOL = YES;
+    }
+
+  return count;
 }
 
 
@@ -8,11 +8,12 @@
 
 #import "CWSMTP+Protected.h"
 #import "CWService+Protected.h"
+#import "CWServiceMetrics+Protected.h"
 
 #import <PantomimeFramework/CWMessage.h>
 #import "CWThreadSafeArray.h"
 
-#import <PlanckToolboxForExtensions/PEPLogger.h>
+#import "CWLogger.h"
 #import "NSData+Extensions.h"
 
 @implementation CWSMTP (Protected)
@@ -106,6 +107,7 @@
             aQueueObject = [[CWSMTPQueueObject alloc] initWithCommand: theCommand
                                                             arguments: aString];
             [_queue insertObject: aQueueObject  atIndex: 0];
+            [_metrics setQueueDepth: [_queue count]];
 
             // If we had queued commands, we return since we'll eventually
             // dequeue them one by one. Otherwise, we run it immediately.
@@ -129,6 +131,7 @@
                 LogInfo(@"Sending |%@|", aQueueObject->arguments);
             }
             _lastCommand = aQueueObject->command;
+            [_metrics commandStarted: _lastCommand];
             [self bulkWriteData:@[[aQueueObject->arguments
                                    dataUsingEncoding: _defaultStringEncoding],
                                   _crlf]];
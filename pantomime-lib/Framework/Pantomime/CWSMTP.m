@@ -39,8 +39,9 @@
 
 #import "CWOAuthUtils.h"
 #import "CWService+Protected.h"
+#import "CWServiceMetrics+Protected.h"
 
-#import <PlanckToolboxForExtensions/PEPLogger.h>
+#import "CWLogger.h"
 
 // The hostname/domain used to do EHLO/HELO
 static NSString *pEpEHLOBase = @"pretty.Easy.privacy";
@@ -245,6 +246,7 @@ static inline CWInternetAddress *next_recipient(NSMutableArray *theRecipients, B
     //LogInfo(@"IN UPDATE READ");
 
     [super updateRead];
+    [_metrics parsingStarted];
 
     while ((aData = [_rbuf dropFirstLine]))
     {
@@ -260,6 +262,8 @@ static inline CWInternetAddress *next_recipient(NSMutableArray *theRecipients, B
             [self _parseServerOutput];
         }
     }
+
+    [_metrics parsingEnded];
 }
 
 
@@ -280,6 +284,7 @@ static inline CWInternetAddress *next_recipient(NSMutableArray *theRecipients, B
 - (int) reconnect
 {
     dispatch_sync(self.serviceQueue, ^{
+        [self->_metrics reconnected];
         [super reconnect];
     });
 
@@ -1049,6 +1054,8 @@ static inline CWInternetAddress *next_recipient(NSMutableArray *theRecipients, B
     {
         [_queue removeLastObject];
     }
+    [_metrics setQueueDepth: [_queue count]];
+    [_metrics commandCompleted];
 
     [self sendCommand: SMTP_EMPTY_QUEUE  arguments: @""];
 }
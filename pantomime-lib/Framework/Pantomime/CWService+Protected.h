@@ -18,8 +18,9 @@ NS_ASSUME_NONNULL_BEGIN
     __block CWThreadSafeArray *_capabilities;
     __block CWThreadSafeArray *_runLoopModes;
     __block CWThreadSafeArray *_queue;
-    __block CWThreadSafeData *_wbuf;
+    __block CWWriteQueue *_wbuf;
     __block CWThreadSafeData *_rbuf;
+    CWServiceMetrics *_metrics;
     __block NSString *_mechanism;
     __block NSString *_username;
     __block NSString *_password;
@@ -44,6 +45,7 @@ NS_ASSUME_NONNULL_BEGIN
     __block unsigned int _lastCommand;
     __block unsigned int _port;
     __block BOOL _connected;
+    __block BOOL _reportsSentData;
     __block id __weak _Nullable __block _delegate;
 
     __block id<CWConnection> _connection;
@@ -67,11 +69,11 @@ NS_ASSUME_NONNULL_BEGIN
 #define NET_BUF_SIZE 4096
 
 //
-// We set the size increment of blocks we will write. Under Mac OS X, we use 1024 bytes
-// in order to avoid a strange bug in SSL_write. This prevents us from no longer beeing
-// notified after a couple of writes that we can actually write data!
+// We set the size increment of blocks we will write. Under Mac OS X, the stream takes
+// what fits in its buffer and we write again as long as it has space, so a block only
+// bounds how long the write queue is held at once.
 //
-#define WRITE_BLOCK_SIZE 1024
+#define WRITE_BLOCK_SIZE 65536
 
 //
 // Default timeout used when waiting for something to complete.
@@ -127,6 +129,8 @@ NS_ASSUME_NONNULL_BEGIN
 
  You should never have to invoke this method directly.
 
+ The data is queued without being copied, so it must not be mutated afterwards.
+
  @param The bytes to buffer
  */
 - (void) writeData: (NSData *_Nonnull) theData;
@@ -137,6 +141,8 @@ NS_ASSUME_NONNULL_BEGIN
 
  You should never have to invoke this method directly.
 
+ The data is queued without being copied, so it must not be mutated afterwards.
+
  @param The bytes to buffer
  */
 - (void) bulkWriteData: (NSArray<NSData*> *_Nonnull) bulkData;
@@ -9,7 +9,9 @@
 #import "CWService+Protected.h"
 #import "CWService.h"
 
+#import "CWServiceMetrics+Protected.h"
 #import "CWThreadSafeData.h"
+#import "CWWriteQueue.h"
 #import "CWTCPConnection.h"
 
 @implementation CWService (Protected)
@@ -53,45 +55,48 @@
 - (void) updateWrite
 {
     @synchronized(self) {
-        if ([_wbuf length] == 0)
-        {
-            return;
-        }
-        unsigned char *bytes;
-        NSInteger count, len;
-
-        bytes = (unsigned char*)[_wbuf bytes];
-        len = [_wbuf length];
+        id<CWConnection> connection = _connection;
+        BOOL reportsSentData = (_reportsSentData && _delegate &&
+                                [_delegate respondsToSelector: @selector(service:sentData:)]);
+        __block NSData *sentData = nil;
+        NSInteger count;
 
+        do
+        {
 #ifdef MACOSX
-        count = [_connection write: bytes  length: len > WRITE_BLOCK_SIZE ? WRITE_BLOCK_SIZE : len];
+            NSUInteger maxLength = WRITE_BLOCK_SIZE;
 #else
-        count = [_connection write: bytes  length: len];
+            NSUInteger maxLength = NSUIntegerMax;
 #endif
-        // If nothing was written or if an error occured, we return.
-        if (count <= 0)
-        {
-            return;
-        }
-        // Otherwise, we inform our delegate that we wrote some data...
-        else if (_delegate && [_delegate respondsToSelector: @selector(service:sentData:)])
-        {
-            [_delegate performSelector: @selector(service:sentData:)
-                            withObject: self
-                            withObject: [_wbuf subdataToIndex: (int) count]];
-        }
-
-        //LogInfo(@"count = %d, len = %d", count, len);
+            // The queued bytes are written in place, we only copy them if
+            // our delegate wants to know what we wrote.
+            count = [_wbuf writeWithMaxLength: maxLength
+                                       writer: ^NSInteger(const unsigned char *bytes, NSUInteger length) {
+                NSInteger written = [connection write: (unsigned char *) bytes  length: length];
+                if (written > 0 && reportsSentData)
+                {
+                    sentData = [NSData dataWithBytes: bytes  length: written];
+                }
+                return written;
+            }];
 
-        // If we have been able to write everything...
-        if (count == len)
-        {
-            [_wbuf reset];
-        }
-        else
-        {
-            [_wbuf truncateLeadingBytes:count];
+            // If nothing was written or if an error occured, we return.
+            if (count <= 0)
+            {
+                return;
+            }
+            [_metrics sentBytes: count];
+
+            // Otherwise, we inform our delegate that we wrote some data...
+            if (sentData)
+            {
+                [_delegate performSelector: @selector(service:sentData:)
+                                withObject: self
+                                withObject: sentData];
+                sentData = nil;
+            }
         }
+        while ([_wbuf length] && [connection canWrite]);
     }
 }
 
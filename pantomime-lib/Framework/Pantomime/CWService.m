@@ -22,10 +22,11 @@
 
 #import "CWService.h"
 #import "CWService+Protected.h"
+#import "CWServiceMetrics+Protected.h"
 
 #import "CWConstants.h"
 #import "NSData+Extensions.h"
-#import <PlanckToolboxForExtensions/PEPLogger.h>
+#import "CWLogger.h"
 
 #import <Foundation/NSBundle.h>
 #import <Foundation/NSDictionary.h>
@@ -38,6 +39,7 @@
 #import "CWTCPConnection.h"
 #import "CWThreadSafeArray.h"
 #import "CWThreadSafeData.h"
+#import "CWWriteQueue.h"
 
 @interface CWService ()
 
@@ -77,7 +79,8 @@
         _password = nil;
 
         _rbuf = [CWThreadSafeData new];
-        _wbuf = [CWThreadSafeData new];
+        _wbuf = [CWWriteQueue new];
+        _metrics = [CWServiceMetrics new];
 
         _runLoopModes = [[CWThreadSafeArray alloc] initWithArray:@[NSDefaultRunLoopMode]];
         _connectionTimeout = _readTimeout = _writeTimeout = DEFAULT_TIMEOUT;
@@ -148,6 +151,37 @@
 }
 
 
+//
+//
+//
+- (void) setReportsSentData: (BOOL) theBOOL
+{
+    @synchronized (self) {
+        _reportsSentData = theBOOL;
+    }
+}
+
+
+//
+//
+//
+- (BOOL) reportsSentData
+{
+    @synchronized (self) {
+        return _reportsSentData;
+    }
+}
+
+
+//
+//
+//
+- (CWServiceMetrics *) metrics
+{
+    return _metrics;
+}
+
+
 //
 //
 //
@@ -248,6 +282,7 @@
         NSData *aData;
 
         aData = [[NSData alloc] initWithBytes: buf  length: count];
+        [_metrics receivedBytes: count];
 
         if (_delegate && [_delegate respondsToSelector: @selector(service:receivedData:)])
         {
@@ -0,0 +1,58 @@
+//
+//  CWServiceMetrics+Protected.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWServiceMetrics.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Recording side of CWServiceMetrics, used by CWService and its subclasses.
+ This header must not be accessable to clients.
+
+ Commands are expected to run one at a time, as they do in CWIMAPStore and CWSMTP: a command
+ starts when it is written and completes when its tagged (or final) response is parsed.
+ All methods are thread safe.
+ */
+@interface CWServiceMetrics (Protected)
+
+/**
+ @return A monotonic timestamp in seconds, for measuring durations.
+ */
++ (NSTimeInterval)now;
+
+- (void)receivedBytes:(NSUInteger)count;
+
+- (void)sentBytes:(NSUInteger)count;
+
+- (void)receivedLiteralOfLength:(NSUInteger)length;
+
+- (void)setQueueDepth:(NSUInteger)depth;
+
+/**
+ Starts a span for the given command. A span still running is dropped.
+ */
+- (void)commandStarted:(unsigned int)command;
+
+/**
+ Ends the running span, if any, records its latency and hands it to spanHandler.
+ */
+- (void)commandCompleted;
+
+/**
+ Brackets parsing of received bytes. Time spent in between is parse time.
+ */
+- (void)parsingStarted;
+- (void)parsingEnded;
+
+/**
+ Counts a reconnect and drops the running span, as its response will never come.
+ */
+- (void)reconnected;
+
+@end
+
+NS_ASSUME_NONNULL_END
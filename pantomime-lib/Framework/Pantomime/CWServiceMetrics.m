@@ -0,0 +1,463 @@
+//
+//  CWServiceMetrics.m
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWServiceMetrics.h"
+#import "CWServiceMetrics+Protected.h"
+
+#include <float.h>
+#include <math.h>
+#include <time.h>
+
+//
+// Bucket i counts latencies below 2^i ms, the last one everything else.
+//
+#define HISTOGRAM_BUCKETS 17
+
+//
+//
+//
+@interface CWLatencyHistogram ()
+{
+@package
+    NSUInteger _buckets[HISTOGRAM_BUCKETS];
+    NSUInteger _count;
+    NSTimeInterval _totalTime;
+    NSTimeInterval _minimum;
+    NSTimeInterval _maximum;
+}
+
+- (void) addLatency: (NSTimeInterval) theLatency;
+
+@end
+
+@implementation CWLatencyHistogram
+
++ (NSUInteger) numberOfBuckets
+{
+    return HISTOGRAM_BUCKETS;
+}
+
++ (NSTimeInterval) upperBoundOfBucket: (NSUInteger) theIndex
+{
+    if (theIndex >= HISTOGRAM_BUCKETS - 1)
+    {
+        return DBL_MAX;
+    }
+    return ldexp(0.001, (int) theIndex);
+}
+
+- (id) copyWithZone: (NSZone *) theZone
+{
+    CWLatencyHistogram *aCopy = [[CWLatencyHistogram allocWithZone: theZone] init];
+
+    memcpy(aCopy->_buckets, _buckets, sizeof(_buckets));
+    aCopy->_count = _count;
+    aCopy->_totalTime = _totalTime;
+    aCopy->_minimum = _minimum;
+    aCopy->_maximum = _maximum;
+    return aCopy;
+}
+
+- (void) addLatency: (NSTimeInterval) theLatency
+{
+    NSUInteger i = 0;
+
+    while (i < HISTOGRAM_BUCKETS - 1 && theLatency >= [CWLatencyHistogram upperBoundOfBucket: i])
+    {
+        i++;
+    }
+    _buckets[i]++;
+
+    if (!_count || theLatency < _minimum)
+    {
+        _minimum = theLatency;
+    }
+    if (theLatency > _maximum)
+    {
+        _maximum = theLatency;
+    }
+    _totalTime += theLatency;
+    _count++;
+}
+
+- (NSUInteger) count
+{
+    return _count;
+}
+
+- (NSUInteger) countInBucket: (NSUInteger) theIndex
+{
+    return theIndex < HISTOGRAM_BUCKETS ? _buckets[theIndex] : 0;
+}
+
+- (NSTimeInterval) totalTime
+{
+    return _totalTime;
+}
+
+- (NSTimeInterval) minimum
+{
+    return _minimum;
+}
+
+- (NSTimeInterval) maximum
+{
+    return _maximum;
+}
+
+- (NSTimeInterval) percentile: (double) thePercentile
+{
+    NSUInteger rank, seen, i;
+
+    if (!_count)
+    {
+        return 0;
+    }
+
+    rank = (NSUInteger) ceil(MAX(0, MIN(100, thePercentile)) / 100.0 * _count);
+    rank = MAX(rank, 1);
+
+    for (i = 0, seen = 0; i < HISTOGRAM_BUCKETS; i++)
+    {
+        seen += _buckets[i];
+        if (seen >= rank)
+        {
+            break;
+        }
+    }
+    return MIN([CWLatencyHistogram upperBoundOfBucket: i], _maximum);
+}
+
+- (NSString *) description
+{
+    return [NSString stringWithFormat: @"<%@: %p> count: %lu, min: %.3fs, p50: %.3fs, p99: %.3fs, max: %.3fs",
+            [self class], self, (unsigned long) _count, _minimum,
+            [self percentile: 50], [self percentile: 99], _maximum];
+}
+
+@end
+
+
+//
+//
+//
+@interface CWTraceSpan ()
+
+@property (nonatomic) unsigned int command;
+@property (nonatomic) NSDate *startDate;
+@property (nonatomic) NSTimeInterval duration;
+@property (nonatomic) NSTimeInterval waitTime;
+@property (nonatomic) NSTimeInterval parseTime;
+@property (nonatomic) NSUInteger bytesSent;
+@property (nonatomic) NSUInteger bytesReceived;
+
+@end
+
+@implementation CWTraceSpan
+
+- (NSString *) description
+{
+    return [NSString stringWithFormat: @"<%@: %p> command: %u, duration: %.3fs, wait: %.3fs, parse: %.3fs, sent: %lu, received: %lu",
+            [self class], self, _command, _duration, _waitTime, _parseTime,
+            (unsigned long) _bytesSent, (unsigned long) _bytesReceived];
+}
+
+@end
+
+
+//
+//
+//
+@interface CWServiceMetrics ()
+{
+    NSMutableDictionary<NSNumber *, CWLatencyHistogram *> *_latencies;
+    unsigned long long _bytesReceived;
+    unsigned long long _bytesSent;
+    unsigned long long _literalBytes;
+    NSUInteger _reconnects;
+    NSUInteger _queueDepth;
+    NSUInteger _maximumQueueDepth;
+    NSUInteger _literals;
+    NSUInteger _largestLiteral;
+    NSTimeInterval _parseTime;
+    NSTimeInterval _waitTime;
+
+    // The running command, if any
+    CWTraceSpan *_span;
+    NSTimeInterval _spanStart;
+    BOOL _spanAnswered;
+
+    // Set while parsing, 0 otherwise
+    NSTimeInterval _parseStart;
+}
+@end
+
+@implementation CWServiceMetrics
+
+- (instancetype) init
+{
+    self = [super init];
+    if (self)
+    {
+        _latencies = [NSMutableDictionary new];
+    }
+    return self;
+}
+
+- (unsigned long long) bytesReceived
+{
+    @synchronized (self) {
+        return _bytesReceived;
+    }
+}
+
+- (unsigned long long) bytesSent
+{
+    @synchronized (self) {
+        return _bytesSent;
+    }
+}
+
+- (NSUInteger) reconnects
+{
+    @synchronized (self) {
+        return _reconnects;
+    }
+}
+
+- (NSUInteger) queueDepth
+{
+    @synchronized (self) {
+        return _queueDepth;
+    }
+}
+
+- (NSUInteger) maximumQueueDepth
+{
+    @synchronized (self) {
+        return _maximumQueueDepth;
+    }
+}
+
+- (NSUInteger) literals
+{
+    @synchronized (self) {
+        return _literals;
+    }
+}
+
+- (unsigned long long) literalBytes
+{
+    @synchronized (self) {
+        return _literalBytes;
+    }
+}
+
+- (NSUInteger) largestLiteral
+{
+    @synchronized (self) {
+        return _largestLiteral;
+    }
+}
+
+- (NSTimeInterval) parseTime
+{
+    @synchronized (self) {
+        return _parseTime;
+    }
+}
+
+- (NSTimeInterval) waitTime
+{
+    @synchronized (self) {
+        return _waitTime;
+    }
+}
+
+- (NSArray<NSNumber *> *) commands
+{
+    @synchronized (self) {
+        return [[_latencies allKeys] sortedArrayUsingSelector: @selector(compare:)];
+    }
+}
+
+- (CWLatencyHistogram *) latencyForCommand: (unsigned int) theCommand
+{
+    @synchronized (self) {
+        return [[_latencies objectForKey: @(theCommand)] copy];
+    }
+}
+
+- (void) reset
+{
+    @synchronized (self) {
+        [_latencies removeAllObjects];
+        _bytesReceived = _bytesSent = _literalBytes = 0;
+        _reconnects = _literals = _largestLiteral = 0;
+        _maximumQueueDepth = _queueDepth;
+        _parseTime = _waitTime = 0;
+    }
+}
+
+- (NSString *) description
+{
+    @synchronized (self) {
+        return [NSString stringWithFormat: @"<%@: %p> received: %llu, sent: %llu, parse: %.3fs, wait: %.3fs, queue: %lu (max %lu), literals: %lu (%llu bytes), reconnects: %lu",
+                [self class], self, _bytesReceived, _bytesSent, _parseTime, _waitTime,
+                (unsigned long) _queueDepth, (unsigned long) _maximumQueueDepth,
+                (unsigned long) _literals, _literalBytes, (unsigned long) _reconnects];
+    }
+}
+
+@end
+
+
+//
+//
+//
+@implementation CWServiceMetrics (Protected)
+
++ (NSTimeInterval) now
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+- (void) receivedBytes: (NSUInteger) theCount
+{
+    @synchronized (self) {
+        _bytesReceived += theCount;
+
+        if (_span)
+        {
+            if (!_spanAnswered)
+            {
+                _span.waitTime = [CWServiceMetrics now] - _spanStart;
+                _waitTime += _span.waitTime;
+                _spanAnswered = YES;
+            }
+            _span.bytesReceived += theCount;
+        }
+    }
+}
+
+- (void) sentBytes: (NSUInteger) theCount
+{
+    @synchronized (self) {
+        _bytesSent += theCount;
+        _span.bytesSent += theCount;
+    }
+}
+
+- (void) receivedLiteralOfLength: (NSUInteger) theLength
+{
+    @synchronized (self) {
+        _literals++;
+        _literalBytes += theLength;
+        _largestLiteral = MAX(_largestLiteral, theLength);
+    }
+}
+
+- (void) setQueueDepth: (NSUInteger) theDepth
+{
+    @synchronized (self) {
+        _queueDepth = theDepth;
+        _maximumQueueDepth = MAX(_maximumQueueDepth, theDepth);
+    }
+}
+
+- (void) commandStarted: (unsigned int) theCommand
+{
+    @synchronized (self) {
+        _span = [CWTraceSpan new];
+        _span.command = theCommand;
+        _span.startDate = [NSDate date];
+        _spanStart = [CWServiceMetrics now];
+        _spanAnswered = NO;
+    }
+}
+
+- (void) commandCompleted
+{
+    void (^handler)(CWTraceSpan *) = nil;
+    CWTraceSpan *aSpan;
+
+    @synchronized (self) {
+        NSTimeInterval now;
+        CWLatencyHistogram *aHistogram;
+
+        if (!_span)
+        {
+            return;
+        }
+
+        now = [CWServiceMetrics now];
+        aSpan = _span;
+        _span = nil;
+
+        // The parse time so far belongs to the completed command,
+        // the rest of it to the next one.
+        if (_parseStart)
+        {
+            aSpan.parseTime += now - _parseStart;
+            _parseTime += now - _parseStart;
+            _parseStart = now;
+        }
+        aSpan.duration = now - _spanStart;
+
+        aHistogram = [_latencies objectForKey: @(aSpan.command)];
+        if (!aHistogram)
+        {
+            aHistogram = [CWLatencyHistogram new];
+            [_latencies setObject: aHistogram  forKey: @(aSpan.command)];
+        }
+        [aHistogram addLatency: aSpan.duration];
+
+        handler = self.spanHandler;
+    }
+
+    if (handler)
+    {
+        handler(aSpan);
+    }
+}
+
+- (void) parsingStarted
+{
+    @synchronized (self) {
+        _parseStart = [CWServiceMetrics now];
+    }
+}
+
+- (void) parsingEnded
+{
+    @synchronized (self) {
+        NSTimeInterval elapsed;
+
+        if (!_parseStart)
+        {
+            return;
+        }
+
+        elapsed = [CWServiceMetrics now] - _parseStart;
+        _parseTime += elapsed;
+        _span.parseTime += elapsed;
+        _parseStart = 0;
+    }
+}
+
+- (void) reconnected
+{
+    @synchronized (self) {
+        _reconnects++;
+        _span = nil;
+    }
+}
+
+@end
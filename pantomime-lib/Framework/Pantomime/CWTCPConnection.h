@@ -10,7 +10,7 @@
 
 #import "CWConnection.h"
 
-#import <PlanckToolboxForExtensions/PEPLogger.h>
+#import "CWLogger.h"
 
 @interface CWTCPConnection : NSObject<CWConnection, NSStreamDelegate>
 
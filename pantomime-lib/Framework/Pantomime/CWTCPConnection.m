@@ -12,9 +12,10 @@
 
 #import "CWTCPConnection.h"
 
-#import <PlanckToolboxForExtensions/PEPLogger.h>
+#import "CWLogger.h"
 
 #import "NSStream+TLS.h"
+#import "CWReactor.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -29,7 +30,9 @@ NS_ASSUME_NONNULL_BEGIN
 @property (atomic, strong, nullable) NSOutputStream *writeStream;
 @property (atomic, strong) NSMutableSet<NSStream *> *openConnections;
 @property (nonatomic) NSMutableArray *fatalErrors;
-@property (nullable, strong) NSThread *backgroundThread;
+@property (atomic, strong, nullable) CWReactor *reactor;
+/// The reactor thread our streams are scheduled on, see -connect.
+@property (atomic, strong, nullable) NSThread *reactorThread;
 @property (atomic) BOOL isGettingClosed;
 @property (nonatomic, nullable) SecIdentityRef clientCertificate;
 
@@ -103,9 +106,7 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)closeAndRemoveStream:(NSStream *)stream
 {
     if (stream) {
-        [stream close];
         [self.openConnections removeObject:stream];
-        [stream removeFromRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
         if (stream == self.readStream) {
             self.readStream = nil;
         } else if (stream == self.writeStream) {
@@ -114,49 +115,53 @@ NS_ASSUME_NONNULL_BEGIN
     }
 }
 
+/// Closes streams and unschedules them from the run loop of the reactor thread they are
+/// scheduled on, which must be done on that thread. Does not touch self, since it is also
+/// used from -dealloc.
++ (void)closeStreams:(NSArray<NSStream *> *)streams
+           onReactor:(CWReactor *)reactor
+              thread:(NSThread *)thread
+{
+    [reactor performBlock:^{
+        for (NSStream *stream in streams) {
+            stream.delegate = nil;
+            [stream close];
+            [stream removeFromRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
+        }
+    } onThread:thread];
+    [reactor detach:thread];
+}
+
 #pragma mark - Run Loop
 
-- (void)connectInBackgroundAndStartRunLoop
+/// Runs on the reactor thread. Synchronized with -close, which may run on any thread, so
+/// that the streams are either set up before it collects them or not at all.
+- (void)openStreams
 {
-    NSInputStream *inputStream = nil;
-    NSOutputStream *outputStream = nil;
-
-    [NSStream getStreamsToHostWithName:self.name
-                                  port:self.port
-                           inputStream:&inputStream
-                          outputStream:&outputStream];
+    @synchronized(self) {
+        if (self.isGettingClosed) {
+            // Closed before the reactor got to us.
+            return;
+        }
 
-    if (inputStream == nil || outputStream == nil) {
-        [self signalErrorAndClose];
-    }
+        NSInputStream *inputStream = nil;
+        NSOutputStream *outputStream = nil;
 
-    self.readStream = inputStream;
-    self.writeStream = outputStream;
+        [NSStream getStreamsToHostWithName:self.name
+                                      port:self.port
+                               inputStream:&inputStream
+                              outputStream:&outputStream];
 
-    [self setupStream:self.readStream];
-    [self setupStream:self.writeStream];
+        if (inputStream != nil && outputStream != nil) {
+            self.readStream = inputStream;
+            self.writeStream = outputStream;
 
-    NSRunLoop *runLoop = [NSRunLoop currentRunLoop];
-    while (1) {
-        if ( [NSThread currentThread].isCancelled ) {
-            break;
-        }
-        @autoreleasepool {
-            [runLoop runMode:NSDefaultRunLoopMode beforeDate: [NSDate distantFuture]];
+            [self setupStream:self.readStream];
+            [self setupStream:self.writeStream];
+            return;
         }
     }
-    self.backgroundThread = nil;
-}
-
-- (void)cancelNoop {}
-
-- (void)cancelBackgroundThread
-{
-    if (self.backgroundThread) {
-        [self.backgroundThread cancel];
-        [self performSelector:@selector(cancelNoop) onThread:self.backgroundThread withObject:nil
-                waitUntilDone:NO];
-    }
+    [self signalErrorAndClose];
 }
 
 #pragma mark - CWConnection
@@ -169,11 +174,23 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)close
 {
     @synchronized(self) {
+        NSMutableArray<NSStream *> *streams = [NSMutableArray arrayWithCapacity:2];
+        if (self.readStream) {
+            [streams addObject:self.readStream];
+        }
+        if (self.writeStream) {
+            [streams addObject:self.writeStream];
+        }
         [self closeAndRemoveStream:self.readStream];
         [self closeAndRemoveStream:self.writeStream];
         self.connected = NO;
         self.isGettingClosed = YES;
-        [self cancelBackgroundThread];
+        if (self.reactorThread) {
+            [CWTCPConnection closeStreams:streams
+                                onReactor:self.reactor
+                                   thread:self.reactorThread];
+            self.reactorThread = nil;
+        }
     }
 }
 
@@ -209,16 +226,16 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)connect
 {
-    self.backgroundThread = [[NSThread alloc]
-                             initWithTarget:self
-                             selector:@selector(connectInBackgroundAndStartRunLoop)
-                             object:nil];
-    self.backgroundThread.name = [NSString
-                                  stringWithFormat:@"CWTCPConnection %@:%d 0x%lu",
-                                  self.name,
-                                  self.port,
-                                  (unsigned long) self.backgroundThread];
-    [self.backgroundThread start];
+    // Instead of a thread of our own, our streams get scheduled on one of the
+    // event loop threads of the reactor, shared with other connections.
+    self.reactor = [CWReactor sharedReactor];
+    self.reactorThread = [self.reactor attach];
+    LogInfo(@"connect %@:%d on %@", self.name, self.port, self.reactorThread.name);
+
+    __weak CWTCPConnection *weakSelf = self;
+    [self.reactor performBlock:^{
+        [weakSelf openStreams];
+    } onThread:self.reactorThread];
 }
 
 - (BOOL)canWrite
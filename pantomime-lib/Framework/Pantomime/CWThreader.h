@@ -0,0 +1,96 @@
+//
+//  CWThreader.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#ifndef _Pantomime_H_CWThreader
+#define _Pantomime_H_CWThreader
+
+#import <Foundation/Foundation.h>
+
+@class CWContainer;
+@class CWMessage;
+
+/*!
+  @class CWThreader
+  @discussion This class maintains the threads of a set of messages, as
+              described in <a href="http://www.jwz.org/doc/threading.html">message threading</a>,
+              but incrementally: messages are inserted and removed one at a
+              time and only the containers they reference are touched.
+
+              Containers are indexed by Message-ID, so linking a message to
+              its parents is a constant number of lookups per reference.
+              Root containers that share a base subject are grouped, the way
+              the subject pass of the original algorithm does it. Roots are
+              indexed by base subject, so grouping one is a single lookup,
+              and siblings are doubly linked, so taking a container out of
+              a large subject group does not walk the group.
+              Links created by subject grouping are weaker than the ones
+              obtained from References and In-Reply-To: they are replaced
+              as soon as an actual parent shows up.
+
+              This class is not thread-safe.
+*/
+@interface CWThreader : NSObject
+
+/*!
+  @method addMessage:
+  @discussion This method is used to thread a new message. Adding the
+              same message twice has no effect.
+  @param theMessage The message to add.
+*/
+- (void) addMessage: (CWMessage *) theMessage;
+
+/*!
+  @method addMessages:
+  @discussion This method is used to thread a batch of messages.
+  @param theMessages The CWMessage instances to add.
+*/
+- (void) addMessages: (NSArray *) theMessages;
+
+/*!
+  @method removeMessage:
+  @discussion This method is used to remove a message from the threads.
+              Its container is kept as an empty placeholder as long
+              as it has children, in order not to break its thread.
+  @param theMessage The message to remove.
+*/
+- (void) removeMessage: (CWMessage *) theMessage;
+
+/*!
+  @method updateMessage:
+  @discussion This method is used to move a message to the right thread
+              once its headers are known, or after they changed.
+              It does nothing if the message was not added.
+  @param theMessage The message to update.
+*/
+- (void) updateMessage: (CWMessage *) theMessage;
+
+/*!
+  @method removeAllMessages
+  @discussion This method is used to drop all threads.
+*/
+- (void) removeAllMessages;
+
+/*!
+  @method containerForMessage:
+  @discussion This method is used to obtain the container of a message.
+  @param theMessage The message.
+  @result The container, nil if the message was not added.
+*/
+- (CWContainer *) containerForMessage: (CWMessage *) theMessage;
+
+/*!
+  @method rootContainers
+  @discussion This method is used to obtain the root of every thread,
+              in no particular order. A root container holds no message
+              when the first message of its thread is missing.
+  @result The root containers, as CWContainer instances.
+*/
+- (NSArray *) rootContainers;
+
+@end
+
+#endif // _Pantomime_H_CWThreader
@@ -0,0 +1,522 @@
+//
+//  CWThreader.m
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWThreader.h"
+
+#import "CWConstants.h"
+#import "Pantomime/CWContainer.h"
+#import <PantomimeFramework/CWMessage.h>
+
+//
+//
+//
+@interface CWThreader ()
+{
+  // Message-ID -> container, placeholders included
+  NSMutableDictionary *_idTable;
+
+  // container -> Message-ID, for the containers present in _idTable
+  NSMapTable *_containerIDs;
+
+  // message -> container
+  NSMapTable *_messageTable;
+
+  NSMutableSet *_roots;
+
+  // base subject -> root container, and back
+  NSMutableDictionary *_subjectTable;
+  NSMapTable *_rootSubjects;
+
+  // Containers whose parent link comes from subject grouping
+  NSHashTable *_subjectLinks;
+}
+@end
+
+
+//
+//
+//
+@interface CWThreader (Private)
+
+- (CWContainer *) _containerForID: (NSString *) theID;
+- (void) _setParent: (CWContainer *) theParent
+        ofContainer: (CWContainer *) theContainer
+            subject: (BOOL) isSubjectLink;
+- (void) _detachContainer: (CWContainer *) theContainer;
+- (void) _pruneContainer: (CWContainer *) theContainer;
+- (void) _groupBySubject: (CWContainer *) theRoot;
+- (NSString *) _subjectKeyOfContainer: (CWContainer *) theContainer;
+
+@end
+
+
+//
+//
+//
+static inline BOOL is_reply(CWMessage *theMessage)
+{
+  return [[theMessage subject] length] > [[theMessage baseSubject] length];
+}
+
+static inline CWContainer *root_of(CWContainer *theContainer)
+{
+  while (theContainer->parent)
+    {
+      theContainer = theContainer->parent;
+    }
+
+  return theContainer;
+}
+
+
+//
+//
+//
+@implementation CWThreader
+
+- (id) init
+{
+  self = [super init];
+
+  if (self)
+    {
+      _idTable = [[NSMutableDictionary alloc] init];
+      _containerIDs = [NSMapTable mapTableWithKeyOptions: NSPointerFunctionsObjectPointerPersonality
+                                            valueOptions: NSPointerFunctionsStrongMemory];
+      _messageTable = [NSMapTable mapTableWithKeyOptions: NSPointerFunctionsObjectPointerPersonality
+                                            valueOptions: NSPointerFunctionsStrongMemory];
+      _roots = [[NSMutableSet alloc] init];
+      _subjectTable = [[NSMutableDictionary alloc] init];
+      _rootSubjects = [NSMapTable mapTableWithKeyOptions: NSPointerFunctionsObjectPointerPersonality
+                                            valueOptions: NSPointerFunctionsStrongMemory];
+      _subjectLinks = [NSHashTable hashTableWithOptions: NSPointerFunctionsObjectPointerPersonality];
+    }
+
+  return self;
+}
+
+
+//
+//
+//
+- (void) addMessage: (CWMessage *) theMessage
+{
+  CWContainer *aContainer, *aParent, *aReference;
+  NSMutableArray *allReferences;
+  NSString *aMessageID;
+
+  if (!theMessage || [_messageTable objectForKey: theMessage])
+    {
+      return;
+    }
+
+  //
+  // (1A) Find or create the container of the message. A placeholder
+  // left by one of its replies is filled in; a duplicate or missing
+  // Message-ID gets a container of its own, outside of the table.
+  // -messageID is not used since it makes one up when it is missing.
+  //
+  aMessageID = [[theMessage allHeaders] objectForKey: @"Message-ID"];
+  aContainer = (aMessageID ? [_idTable objectForKey: aMessageID] : nil);
+
+  if (aContainer && !aContainer->message)
+    {
+      aContainer->message = theMessage;
+    }
+  else
+    {
+      if (aContainer || !aMessageID)
+	{
+	  aContainer = AUTORELEASE([[CWContainer alloc] init]);
+	}
+      else
+	{
+	  aContainer = [self _containerForID: aMessageID];
+	}
+
+      aContainer->message = theMessage;
+      [_roots addObject: aContainer];
+    }
+
+  [_messageTable setObject: aContainer  forKey: theMessage];
+
+  //
+  // (1B) Link the References together, oldest first. A reference that
+  // already has a parent keeps it unless it came from subject grouping.
+  //
+  allReferences = [NSMutableArray arrayWithArray: ([theMessage allReferences] ? [theMessage allReferences] : [NSArray array])];
+
+  if ([theMessage inReplyTo] && ![[allReferences lastObject] isEqualToString: [theMessage inReplyTo]])
+    {
+      [allReferences addObject: [theMessage inReplyTo]];
+    }
+
+  aParent = nil;
+
+  for (NSString *anID in allReferences)
+    {
+      if (aMessageID && [anID isEqualToString: aMessageID])
+	{
+	  continue;
+	}
+
+      aReference = [self _containerForID: anID];
+
+      if (aParent && aReference != aParent &&
+	  (!aReference->parent || [_subjectLinks containsObject: aReference]) &&
+	  ![aParent isDescendantOf: aReference])
+	{
+	  [self _setParent: aParent  ofContainer: aReference  subject: NO];
+	}
+
+      // Placeholders that could not be linked would stay empty forever
+      if (aParent && !aParent->child)
+	{
+	  [self _pruneContainer: aParent];
+	}
+
+      aParent = aReference;
+    }
+
+  //
+  // (1C) The last reference is the parent of the message, overriding
+  // whatever a previous message claimed.
+  //
+  if (aParent && aParent != aContainer->parent && ![aParent isDescendantOf: aContainer])
+    {
+      [self _setParent: aParent  ofContainer: aContainer  subject: NO];
+    }
+  else if (aParent && !aParent->child)
+    {
+      [self _pruneContainer: aParent];
+    }
+
+  [self _groupBySubject: root_of(aContainer)];
+}
+
+
+//
+//
+//
+- (void) addMessages: (NSArray *) theMessages
+{
+  NSUInteger i, count;
+
+  count = [theMessages count];
+
+  for (i = 0; i < count; i++)
+    {
+      [self addMessage: [theMessages objectAtIndex: i]];
+    }
+}
+
+
+//
+//
+//
+- (void) removeMessage: (CWMessage *) theMessage
+{
+  CWContainer *aContainer;
+  NSString *aKey;
+
+  if (!theMessage || !(aContainer = [_messageTable objectForKey: theMessage]))
+    {
+      return;
+    }
+
+  [_messageTable removeObjectForKey: theMessage];
+  aContainer->message = nil;
+
+  // The subject of a placeholder root is the one of its first child,
+  // which may differ; re-register it.
+  aKey = [_rootSubjects objectForKey: aContainer];
+
+  if (aKey)
+    {
+      [_subjectTable removeObjectForKey: aKey];
+      [_rootSubjects removeObjectForKey: aContainer];
+    }
+
+  if (![_containerIDs objectForKey: aContainer])
+    {
+      // Containers outside of the table cannot be referenced and have no
+      // placeholder to keep; hand their children over.
+      CWContainer *aParent = aContainer->parent;
+
+      while (aContainer->child)
+	{
+	  CWContainer *aChild = aContainer->child;
+
+	  [self _detachContainer: aChild];
+
+	  if (aParent)
+	    {
+	      [aParent addChild: aChild];
+	    }
+	  else
+	    {
+	      [_roots addObject: aChild];
+	      [self _groupBySubject: aChild];
+	    }
+	}
+    }
+
+  [self _pruneContainer: aContainer];
+
+  if (!aContainer->parent && [_roots containsObject: aContainer])
+    {
+      [self _groupBySubject: aContainer];
+    }
+}
+
+
+//
+//
+//
+- (void) updateMessage: (CWMessage *) theMessage
+{
+  if ([_messageTable objectForKey: theMessage])
+    {
+      [self removeMessage: theMessage];
+      [self addMessage: theMessage];
+    }
+}
+
+
+//
+//
+//
+- (void) removeAllMessages
+{
+  [_idTable removeAllObjects];
+  [_containerIDs removeAllObjects];
+  [_messageTable removeAllObjects];
+  [_roots removeAllObjects];
+  [_subjectTable removeAllObjects];
+  [_rootSubjects removeAllObjects];
+  [_subjectLinks removeAllObjects];
+}
+
+
+//
+//
+//
+- (CWContainer *) containerForMessage: (CWMessage *) theMessage
+{
+  return [_messageTable objectForKey: theMessage];
+}
+
+
+//
+//
+//
+- (NSArray *) rootContainers
+{
+  return [_roots allObjects];
+}
+
+@end
+
+
+//
+// Private methods
+//
+@implementation CWThreader (Private)
+
+//
+// Returns the container for theID, creating an empty root if needed.
+//
+- (CWContainer *) _containerForID: (NSString *) theID
+{
+  CWContainer *aContainer;
+
+  aContainer = [_idTable objectForKey: theID];
+
+  if (!aContainer)
+    {
+      aContainer = AUTORELEASE([[CWContainer alloc] init]);
+      [_idTable setObject: aContainer  forKey: theID];
+      [_containerIDs setObject: theID  forKey: aContainer];
+      [_roots addObject: aContainer];
+    }
+
+  return aContainer;
+}
+
+
+//
+//
+//
+- (void) _setParent: (CWContainer *) theParent
+        ofContainer: (CWContainer *) theContainer
+            subject: (BOOL) isSubjectLink
+{
+  CWContainer *anOldParent;
+
+  anOldParent = theContainer->parent;
+
+  [self _detachContainer: theContainer];
+  [theParent addChild: theContainer];
+
+  if (isSubjectLink)
+    {
+      [_subjectLinks addObject: theContainer];
+    }
+
+  if (anOldParent)
+    {
+      [self _pruneContainer: anOldParent];
+    }
+}
+
+
+//
+// Unlinks theContainer from its parent, or from the root set.
+//
+- (void) _detachContainer: (CWContainer *) theContainer
+{
+  if (theContainer->parent)
+    {
+      [theContainer->parent removeChild: theContainer];
+      [_subjectLinks removeObject: theContainer];
+    }
+  else
+    {
+      NSString *aKey = [_rootSubjects objectForKey: theContainer];
+
+      if (aKey)
+	{
+	  [_subjectTable removeObjectForKey: aKey];
+	  [_rootSubjects removeObjectForKey: theContainer];
+	}
+
+      [_roots removeObject: theContainer];
+    }
+}
+
+
+//
+// Drops empty containers, walking up. A subject placeholder left with a
+// single child is dissolved and the child becomes a root again.
+//
+- (void) _pruneContainer: (CWContainer *) theContainer
+{
+  while (theContainer && !theContainer->message)
+    {
+      CWContainer *aParent = theContainer->parent;
+      NSString *anID = [_containerIDs objectForKey: theContainer];
+
+      if (theContainer->child && (anID || theContainer->child->next))
+	{
+	  return;
+	}
+
+      if (theContainer->child)
+	{
+	  CWContainer *aChild = theContainer->child;
+
+	  [self _detachContainer: theContainer];
+	  [self _detachContainer: aChild];
+	  [_roots addObject: aChild];
+	  [self _groupBySubject: aChild];
+	  return;
+	}
+
+      if (anID)
+	{
+	  [_idTable removeObjectForKey: anID];
+	  [_containerIDs removeObjectForKey: theContainer];
+	}
+
+      [self _detachContainer: theContainer];
+      theContainer = aParent;
+    }
+}
+
+
+//
+// The subject pass of the original algorithm, for one root at a time.
+//
+- (void) _groupBySubject: (CWContainer *) theRoot
+{
+  CWContainer *anOther, *aPlaceholder;
+  NSString *aKey;
+
+  if (theRoot->parent || [_rootSubjects objectForKey: theRoot])
+    {
+      return;
+    }
+
+  aKey = [self _subjectKeyOfContainer: theRoot];
+
+  if (!aKey)
+    {
+      return;
+    }
+
+  anOther = [_subjectTable objectForKey: aKey];
+
+  if (!anOther)
+    {
+      [_subjectTable setObject: theRoot  forKey: aKey];
+      [_rootSubjects setObject: aKey  forKey: theRoot];
+      return;
+    }
+
+  if (!anOther->message)
+    {
+      [self _setParent: anOther  ofContainer: theRoot  subject: YES];
+    }
+  else if (!theRoot->message)
+    {
+      [self _setParent: theRoot  ofContainer: anOther  subject: YES];
+      [_subjectTable setObject: theRoot  forKey: aKey];
+      [_rootSubjects setObject: aKey  forKey: theRoot];
+    }
+  else if (is_reply(theRoot->message) && !is_reply(anOther->message))
+    {
+      [self _setParent: anOther  ofContainer: theRoot  subject: YES];
+    }
+  else if (!is_reply(theRoot->message) && is_reply(anOther->message))
+    {
+      [self _setParent: theRoot  ofContainer: anOther  subject: YES];
+      [_subjectTable setObject: theRoot  forKey: aKey];
+      [_rootSubjects setObject: aKey  forKey: theRoot];
+    }
+  else
+    {
+      aPlaceholder = AUTORELEASE([[CWContainer alloc] init]);
+      [_roots addObject: aPlaceholder];
+      [self _setParent: aPlaceholder  ofContainer: anOther  subject: YES];
+      [self _setParent: aPlaceholder  ofContainer: theRoot  subject: YES];
+      [_subjectTable setObject: aPlaceholder  forKey: aKey];
+      [_rootSubjects setObject: aKey  forKey: aPlaceholder];
+    }
+}
+
+
+//
+//
+//
+- (NSString *) _subjectKeyOfContainer: (CWContainer *) theContainer
+{
+  CWMessage *aMessage;
+  NSString *aKey;
+
+  aMessage = theContainer->message;
+
+  if (!aMessage && theContainer->child)
+    {
+      aMessage = theContainer->child->message;
+    }
+
+  aKey = [aMessage baseSubject];
+
+  return ([aKey length] ? aKey : nil);
+}
+
+@end
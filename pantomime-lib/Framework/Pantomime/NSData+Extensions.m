@@ -28,7 +28,10 @@
 #import <Foundation/NSException.h>
 #import <Foundation/NSString.h>
 
+#import "CWByteSearch.h"
 #import "CWConstants.h"
+#import "CWFormatFlowed.h"
+#import "CWSubrangeData.h"
 
 #import <stdlib.h>
 #import <string.h>
@@ -44,10 +47,11 @@ static const char *hexDigit = "0123456789ABCDEF";
 
 
 
-//!
-// add an NSData cluster member NSSubrangeData that retaind its parent and
-// used its data. Would make almost all of these operations work without
-// copying.
+//
+// The methods returning parts of the receiver (subdataFromIndex:,
+// componentsSeparatedByCString:, ...) return CWSubrangeData slices
+// sharing its bytes instead of copies.
+//
 @implementation NSData (PantomimeExtensions)
 
 //
@@ -363,60 +367,42 @@ static const char *hexDigit = "0123456789ABCDEF";
                   options: (NSUInteger) theOptions
                     range: (NSRange) theRange
 {
-  const char *b, *bytes;
+  const unsigned char *bytes;
   NSUInteger i, len, slen;
 
-    bytes = [self bytes];
-
-    len = [self length];
-    if (!bytes || !theCString || len == 0 || theCString[0] == '\0' ||
-        theRange.length == 0) {
-        return NSMakeRange(NSNotFound,0);
-    }
-
-
-  slen = strlen(theCString);
+  bytes = [self bytes];
+  len = [self length];
 
-    if (theRange.length < slen) {
-        return NSMakeRange(NSNotFound,0);
+  if (!bytes || !theCString || theCString[0] == '\0' || theRange.location >= len)
+    {
+      return NSMakeRange(NSNotFound,0);
     }
 
-  b = bytes;
-  
-  if (len > theRange.location + theRange.length)
+  if (len - theRange.location > theRange.length)
     {
       len = theRange.location + theRange.length;
     }
 
-//!  this could be optimized
-  if (theOptions & NSCaseInsensitiveSearch)
-    {
-      i = theRange.location;
-      b += i;
-      
-      for (; i <= len-slen; i++, b++)
-	{
-	  if (!strncasecmp(theCString,b,slen))
-	    {
-	      return NSMakeRange(i,slen);
-	    }
-	}
-    }
-  else
+  slen = strlen(theCString);
+  i = cw_byte_search(bytes + theRange.location, len - theRange.location,
+		     (const unsigned char *) theCString, slen,
+		     (theOptions & NSCaseInsensitiveSearch) != 0);
+
+  if (i == NSNotFound)
     {
-      i = theRange.location;
-      b += i;
-      
-      for (; i <= len-slen; i++, b++)
-	{
-	  if (!memcmp(theCString,b,slen))
-	    {
-	      return NSMakeRange(i,slen);
-	    }
-	}
+      return NSMakeRange(NSNotFound,0);
     }
 
-  return NSMakeRange(NSNotFound,0);
+  return NSMakeRange(theRange.location + i, slen);
+}
+
+
+//
+//
+//
+- (NSData *) subdataNoCopyWithRange: (NSRange) theRange
+{
+  return [CWSubrangeData dataWithParent: self  range: theRange];
 }
 
 
@@ -425,7 +411,7 @@ static const char *hexDigit = "0123456789ABCDEF";
 //
 - (NSData *) subdataFromIndex: (NSUInteger) theIndex
 {
-  return [self subdataWithRange: NSMakeRange(theIndex, [self length] - theIndex)];
+  return [self subdataNoCopyWithRange: NSMakeRange(theIndex, [self length] - theIndex)];
 }
 
 
@@ -434,7 +420,7 @@ static const char *hexDigit = "0123456789ABCDEF";
 //
 - (NSData *) subdataToIndex: (NSUInteger) theIndex
 {
-  return [self subdataWithRange: NSMakeRange(0, theIndex)];
+  return [self subdataNoCopyWithRange: NSMakeRange(0, theIndex)];
 }
 
 - (NSData *)dataByTrimmingWhiteSpaces
@@ -449,7 +435,7 @@ static const char *hexDigit = "0123456789ABCDEF";
     if (j < i) {
         return [NSData new];
     }
-    return [self subdataWithRange: NSMakeRange(i, j - i + 1)];
+    return [self subdataNoCopyWithRange: NSMakeRange(i, j - i + 1)];
 }
 
 
@@ -503,7 +489,7 @@ static const char *hexDigit = "0123456789ABCDEF";
   
   if (bytes[0] == '"' && bytes[len-1] == '"')
     {
-      return [self subdataWithRange: NSMakeRange(1, len-2)];
+      return [self subdataNoCopyWithRange: NSMakeRange(1, len-2)];
     }
   
   return AUTORELEASE(RETAIN(self));
@@ -539,19 +525,11 @@ static const char *hexDigit = "0123456789ABCDEF";
 //
 - (NSInteger) indexOfCharacter: (char) theCharacter
 {
-  const char *b;
-  NSUInteger i, len;
- 
-  b = [self bytes];
-  len = [self length];
+  NSUInteger i;
 
-  for ( i = 0; i < len; i++, b++)
-    if (*b == theCharacter)
-      {
-	return i;
-      }
-  
-  return -1;
+  i = cw_byte_search_char([self bytes], [self length], (unsigned char) theCharacter);
+
+  return (i == NSNotFound ? -1 : (NSInteger) i);
 }
 
 
@@ -641,12 +619,7 @@ static const char *hexDigit = "0123456789ABCDEF";
       return NO;
     }
       
-  if ( !strncasecmp(bytes,theCString,slen) )
-    {
-      return YES;
-    }
-
-  return NO;
+  return cw_byte_case_equal((const unsigned char *) bytes, (const unsigned char *) theCString, slen);
 }
 
 
@@ -672,12 +645,7 @@ static const char *hexDigit = "0123456789ABCDEF";
       return NO;
     }  
 
-  if (!strncasecmp(&bytes[len-slen],theCString,slen))
-    {
-      return YES;
-    }
-  
-  return NO;
+  return cw_byte_case_equal((const unsigned char *) &bytes[len-slen], (const unsigned char *) theCString, slen);
 }
 
 
@@ -737,27 +705,30 @@ static const char *hexDigit = "0123456789ABCDEF";
 - (NSArray *) componentsSeparatedByCString: (const char *) theCString
 {
   NSMutableArray *aMutableArray;
+  NSData *aData;
   NSRange r1, r2;
   NSUInteger len;
   
+  // A mutable receiver is copied once, all components then share the copy.
+  aData = [self copy];
   aMutableArray = [[NSMutableArray alloc] init];
-  len = [self length];
+  len = [aData length];
   r1 = NSMakeRange(0,len);
   
-  r2 = [self rangeOfCString: theCString
+  r2 = [aData rangeOfCString: theCString
 	     options: 0 
 	     range: r1];
   
   while (r2.length)
     {
-      [aMutableArray addObject: [self subdataWithRange: NSMakeRange(r1.location, r2.location - r1.location)]];
+      [aMutableArray addObject: [aData subdataNoCopyWithRange: NSMakeRange(r1.location, r2.location - r1.location)]];
       r1.location = r2.location + r2.length;
       r1.length = len - r1.location;
       
-      r2 = [self rangeOfCString: theCString  options: 0  range: r1];
+      r2 = [aData rangeOfCString: theCString  options: 0  range: r1];
     }
 
-  [aMutableArray addObject: [self subdataWithRange: NSMakeRange(r1.location, len - r1.location)]];
+  [aMutableArray addObject: [aData subdataNoCopyWithRange: NSMakeRange(r1.location, len - r1.location)]];
   
   return AUTORELEASE(aMutableArray);
 }
@@ -765,27 +736,29 @@ static const char *hexDigit = "0123456789ABCDEF";
 - (void)enumerateComponentsSeperatedByString:(const char *)theCString
                                        block:(void (^)(NSData *aLine, NSUInteger count, BOOL isLast))block
 {
-    NSUInteger len = [self length];
+    // A mutable receiver is copied once, all components then share the copy.
+    NSData *data = [self copy];
+    NSUInteger len = [data length];
     NSRange r1 = NSMakeRange(0,len);
 
-    NSRange r2 = [self rangeOfCString:theCString
+    NSRange r2 = [data rangeOfCString:theCString
                               options:0
                                 range:r1];
 
 
     NSUInteger count = 0;
     while (r2.length) {
-        block([self subdataWithRange:NSMakeRange(r1.location, r2.location - r1.location)],
+        block([data subdataNoCopyWithRange:NSMakeRange(r1.location, r2.location - r1.location)],
               count,
               NO);
         count++;
         r1.location = r2.location + r2.length;
         r1.length = len - r1.location;
 
-        r2 = [self rangeOfCString: theCString  options: 0  range: r1];
+        r2 = [data rangeOfCString: theCString  options: 0  range: r1];
     }
 
-    block([self subdataWithRange:NSMakeRange(r1.location, len - r1.location)], count, YES);
+    block([data subdataNoCopyWithRange:NSMakeRange(r1.location, len - r1.location)], count, YES);
 }
 
 //
@@ -874,170 +847,7 @@ static const char *hexDigit = "0123456789ABCDEF";
 //
 - (NSData *) unwrapWithLimit: (NSUInteger) theQuoteLimit
 {
-  NSMutableData *aMutableData, *lines;
-  NSData *aLine;
-
-  NSUInteger i, len, quote_depth, line_quote_depth, line_start;
-  BOOL is_flowed;
-
-  len = [self length];
-
-  aMutableData = [[NSMutableData alloc] init];//WithCapacity: len];
-  lines = [[NSMutableData alloc] init];
-  quote_depth = -1;
-  
-  // We analyse the string until the last character
-  for (i = 0; i < len;)
-    {
-      // We analyse the quote depth of the current line
-      if ([self characterAtIndex: i] == '>')
-	{
-	  for (line_quote_depth = 0; i < len && [self characterAtIndex: i] == '>'; i++)
-	    {
-	      line_quote_depth++;
-	    }
-	}
-      else
-	{
-	  line_quote_depth = 0;
-	}
-      
-      // If the current quote depth is not defined, set it to quote depth of current line
-      if (quote_depth == -1)
-	{
-	  quote_depth = line_quote_depth;
-	}
-      
-      // We verify if the line has been space-stuffed
-      if (i < len && [self characterAtIndex: i] == ' ')
-	{
-	  i++;
-	}
-      line_start = i;
-
-      // We look for the next line break
-      for (; i < len && [self characterAtIndex: i] != '\n'; i++);
-      
-      // We get the actual content of the current line
-      aLine = [self subdataWithRange: NSMakeRange(line_start, i-line_start)];
-      
-      // We verify if the line ends with a soft break 
-      is_flowed = [aLine length] > 0 && [aLine characterAtIndex: [aLine length]-1] == ' ';
-
-      // We must handle usenet signature as a special case
-      if (is_flowed && [aLine caseInsensitiveCCompare: "-- "] == NSOrderedSame)
-	{
-	  is_flowed = NO;
-	}
-
-      if (is_flowed && quote_depth == line_quote_depth)
-	{ 
-	  // The current line is flowed;
-	  // we append it to the buffer without quote characters
-	  [lines appendData: aLine];
-	}
-      else if (is_flowed)
-	{ 
-	  // The current line is flowed but has mis-matched quoting
-
-	  // We first append the previous paragraph to the buffer with the necessary quote characters
-	  if (quote_depth)
-	    {
-	      [lines replaceBytesInRange: NSMakeRange(0, [lines length])
-		     withBytes: [[lines quoteWithLevel: quote_depth  wrappingLimit: theQuoteLimit] bytes]];
-	    }
-
-	  [aMutableData appendData: lines];
-	  [aMutableData appendCString: "\n"];
-	  
-	  // We initialize the current paragraph with the current line
-	  [lines replaceBytesInRange: NSMakeRange(0, [lines length])  withBytes: [aLine bytes]];
-	  
-	  // We set the paragraph depth with the current line depth
-	  quote_depth = line_quote_depth;
-	}
-      else if (!is_flowed && quote_depth == line_quote_depth)
-	{ 
-	  // The line is fixed, we append it.
-	  [lines appendData: aLine];
-	  
-	  // We add the necessary quote characters in the paragraph
-	  if (quote_depth)
-	    {
-	      NSData *d;
-	      
-	      d = [lines quoteWithLevel: quote_depth   wrappingLimit: theQuoteLimit];
-	      [lines replaceBytesInRange: NSMakeRange(0, [lines length])
-		     withBytes: [d bytes]  length: [d length]];
-	    }
-
-	  // We append the paragraph (if any)
-	  if ([lines length])
-	    {
-	      [aMutableData appendData: lines];
-	    }
-	  [aMutableData appendCString: "\n"];
-	  
-	  // We empty the paragraph buffer
-	  [lines replaceBytesInRange: NSMakeRange(0,[lines length])
-			   withBytes: NULL
-			      length: 0];
-
-	  // We reset the paragraph depth
-	  quote_depth = -1;
-	}
-      else
-	{
-	  // The line is fixed but has mis-matched quoting
-	  
-	  // We first append the previous paragraph (if any) to the buffer with the necessary quote characters
-	  if (quote_depth)
-	    {
-	      [lines replaceBytesInRange: NSMakeRange(0, [lines length])
-		     withBytes: [[lines quoteWithLevel: quote_depth  wrappingLimit: theQuoteLimit] bytes]];
-	    }
-	  
-	  [aMutableData appendData: lines];
-	  [aMutableData appendCString: "\n"];
-
-	  // We append the fixed line to the buffer with the necessary quote characters
-	  if (line_quote_depth)
-	    {
-	      aLine = [aLine quoteWithLevel: line_quote_depth  wrappingLimit: theQuoteLimit];
-	    }
-
-	  [aMutableData appendData: aLine];
-	  [aMutableData appendCString: "\n"];
-
-	  // We empty the paragraph buffer
-	  [lines replaceBytesInRange: NSMakeRange(0,[lines length])
-			   withBytes: NULL
-			      length: 0];
-
-	  // We reset the paragraph depth
-	  quote_depth = -1;
-	}
-      
-      // The next iteration must starts after the line break
-      i++;
-    }
-
-  // We must handle flowed lines that don't have a fixed line break at the end of the message
-  if ([lines length])
-    {
-      if (quote_depth)
-	{
-	  [lines replaceBytesInRange: NSMakeRange(0, [lines length])
-		 withBytes: [[lines quoteWithLevel: quote_depth  wrappingLimit: theQuoteLimit] bytes]];
-	}
-
-      [aMutableData appendData: lines];
-      [aMutableData appendCString: "\n"];
-    }
-
-  DESTROY(lines);
-
-  return AUTORELEASE(aMutableData);
+  return cw_flowed_unwrap([self bytes], [self length], theQuoteLimit);
 }
 
 
@@ -1046,193 +856,7 @@ static const char *hexDigit = "0123456789ABCDEF";
 //
 - (NSData *) wrapWithLimit: (NSUInteger) theLimit
 {
-  NSMutableData *aMutableData;
-  NSData *aLine, *part;
-  NSArray *lines;
-  NSUInteger i, j, k, split;
-  int depth;
-
-  // We first verify if the string is valid
-  if ([self length] == 0)
-    {
-      return [NSData data];
-    }
-  
-  // We then verify if the limit is valid
-  if (theLimit == 0 || theLimit > 998)
-    {
-      theLimit = 998;
-    }
-  
-  // We initialize our local variables
-  aMutableData = [[NSMutableData alloc] init];//WithCapacity: [self length]];
-  lines = [self componentsSeparatedByCString: "\n"];
-  
-  // We analyse each line
-  for (i = 0; i < [lines count]; i++)
-    {
-      aLine = [lines objectAtIndex: i];
-
-      // We compute the quote depth
-      for (depth = 0; depth < [aLine length] && [aLine characterAtIndex: depth] == '>'; depth++);
-      j = depth;
-      
-      // We remove the leading whitespace if any
-      if (depth && [aLine length] > j && [aLine characterAtIndex: j] == 32)
-	{
-	  j++;
-	}
-
-      aLine = [aLine subdataFromIndex: j];
-
-      // If the line is NOT the signature separator, we remove the trailing space(s)
-      if ([aLine caseInsensitiveCCompare: "-- "] != NSOrderedSame)
-	{
-	  for (j = [aLine length]; j > 0 && [aLine characterAtIndex: j-1] == 32; j--);
-	  if (depth && j < [aLine length])
-	    {
-	      // If line is quoted, we preserve a whitespace for the soft-break
-	      j++;
-	    }
-	  aLine = [aLine subdataToIndex: j];
-	}
-
-      // If the line is the signature separator or if the line length with the
-      // quote characters and the space-stuffing is lower than the limit,
-      // we directly append the line to the buffer
-      if ([aLine caseInsensitiveCCompare: "-- "] == NSOrderedSame || depth+1+[aLine length] <= theLimit)
-	{
-	  // We add the quote characters
-	  for (j = 0; j < depth; j++)
-	    {
-	      [aMutableData appendCString: ">"];
-	    }
-	  
-	  // We space-stuff the line if necessary. The conditions are:
-	  // - the line is quoted or
-	  // - the line starts with a quote character or
-	  // - the line starts with a whitespace or
-	  // - the line starts with the word From.
-	  if (depth ||
-	      ([aLine length] && ([aLine characterAtIndex: 0] == '>' || [aLine characterAtIndex: 0] == ' ' || [aLine hasCPrefix: "From"])))
-	    {
-	      [aMutableData appendCString: " "];
-	    }
-
-	  // We append the line to the buffer
-	  [aMutableData appendData: aLine];
-	  [aMutableData appendCString: "\n"];
-	  
-	  // We jump to the next line
-	  continue;
-	}
-
-      // We look for the right place to split the line
-      for (j = 0; j < [aLine length];)
-	{
-	  // We verify if the line after character j has a length lower than the limit
-	  if ([aLine length] - j + depth + 1 < theLimit)
-	    {
-	      split = [aLine length];
-	    }
-	  // No it hasn't
-	  else
-	    {
-	      split = j;
-	      
-	      // We search for the last whitespace before the limit
-	      for (k = j; k < [aLine length] && k - j + depth + 1 < theLimit; k++)
-		{
-		  if ([aLine characterAtIndex: k] == 32)
-		    {
-		      split = k;
-		    }
-		}
-
-		/*
-		No good spot; include the entire next word. This isn't really
-		optimal, but the alternative is to split the word, and that
-		would be horribly ugly. Also, it'd mean that deeply quoted
-		text might appear with one letter on each row, which is even
-		uglier and means that the receiver won't be able to
-		reconstruct the text.
-
-		A proper fix would be to have both parameters for a 'soft'
-		line limit that we _try_ to break before, and a 'hard' line
-		limit that specifies an actual hard limit of a protocol or
-		something. In NNTP, the values would be 72 and 998
-		respectively. This means that text quoted 70 levels (and yes,
-		I have seen such posts) will appear with one unbroken word on
-		each line (as long as the word is shorter than 928
-		characters). This is still ugly, but:
-
-		a. invalid (protocol-wise) lines will never be generated
-		   (unless something's quoted >998 levels)
-
-		b. a MIME decoder that handles format=flowed will be able to
-		   reconstruct the text properly
-
-		(Additionally, it might turn out to be useful to have a lower
-		limit on wrapping length, eg. 20. If the effective line
-		length is shorter than this, wrap to quote-depth+soft-limit
-		(so eg. text quoted 60 times would be wrapped at 60+72
-		characters instead of 72). This wouldn't make any difference
-		on flowed capable MIME decoders, but might turn out to look
-		better when viewed with non-flowed handling programs.
-		Hopefully, such deeply quoted text won't be common enough to
-		be worth the trouble, so people with non-flowed capable
-		software will simply have to live with the ugly posts in
-		those cases.)
- 		*/
-	      if (split == j)
-		{
-		  // No whitespace found before the limit;
-		  // continue farther until a whitespace or the last character of the line
-		  for (; k < [aLine length] && [aLine characterAtIndex: k] != 32; k++);
-		  split = k;
-		}
-	    }
-
-	  // Since the line will be splitted, we must keep a whitespace for
-	  // the soft-line break
-	  if (split < [aLine length])
-	    {
-	      split++;
-	    }
-	  
-	  // Retrieve splitted part of line
-	  part = [aLine subdataWithRange: NSMakeRange(j, split - j)];
-
-	  // We add the quote characters
-	  for (k = 0; k < depth; k++)
-	    {
-	      [aMutableData appendCString: ">"];
-	    }
-	  
-	  // We space-stuff the line if necesary.
-	  if (depth ||
-	      ([part length] && ([part characterAtIndex: 0] == '>' || [part characterAtIndex: 0] == ' ' || [part hasCPrefix: "From"])))
-	    {
-	      [aMutableData appendCString: " "];
-	    }
-
-	  // Append line part to buffer
-	  [aMutableData appendData: part];
-	  [aMutableData appendCString: "\n"];
-	  
-	  // Next iteration continues where current split occured 
-	  j = split;
-	}
-
-      
-    }
-  
-  if (i > 0)
-    {
-      [aMutableData replaceBytesInRange: NSMakeRange([aMutableData length]-1, 1)  withBytes: NULL  length: 0];
-    }
-  
-  return AUTORELEASE(aMutableData);
+  return cw_flowed_wrap([self bytes], [self length], theLimit);
 }
 
 //
@@ -1241,54 +865,7 @@ static const char *hexDigit = "0123456789ABCDEF";
 - (NSData *) quoteWithLevel: (NSUInteger) theLevel
 	      wrappingLimit: (NSUInteger) theLimit
 {
-  NSMutableData *aMutableData, *aQuotePrefix;
-  NSData *aData, *aLine;
-  NSArray *lines;
-  BOOL isQuoted;
-  int i;
-
-  // We verify if the wrapping limit is smaller then the quote level
-  if (theLevel > theLimit) 
-    {
-      return [NSData data];
-    }
-  
-  aMutableData = [[NSMutableData alloc] initWithCapacity: [self length]];
-  aQuotePrefix = [[NSMutableData alloc] initWithCapacity: theLevel];
-
-  // We wrap the string to the proper limit
-  aData = [self wrapWithLimit: (theLimit - theLevel)];
-  lines = [aData componentsSeparatedByCString: "\n"];
-
-  // We prepare the line prefix
-  for (i = 0; i < theLevel; i++)
-    {
-      [aQuotePrefix appendCString: ">"];
-    }
-  
-  // We add the line prefix to each wrapped line
-  for (i = 0; i < [lines count]; i++)
-    {
-      aLine = [lines objectAtIndex: i];
-      isQuoted = ([aLine length] > 0 && [aLine characterAtIndex: 0] == '>');
-      
-      [aMutableData appendData: aQuotePrefix];
-      if (!isQuoted)
-	{
-	  [aMutableData appendCString: " "];
-	}
-      [aMutableData appendData: aLine];
-      [aMutableData appendCString: "\n"];
-    }
-
-  if (i > 0)
-    {
-      [aMutableData replaceBytesInRange: NSMakeRange([aMutableData length]-1, 1)  withBytes: NULL  length: 0];
-    }
-
-  RELEASE(aQuotePrefix);
-
-  return AUTORELEASE(aMutableData);
+  return cw_flowed_quote([self bytes], [self length], theLevel, theLimit);
 }
 
 @end
@@ -10,6 +10,8 @@
 
 @interface NSDate (StringRepresentation)
 
+/// Creates a string representation as used in the "Date" header, in the default time zone.
+///  Example: "Thu, 21 Jun 2018 17:51:47 +0000"
 - (NSString *)rfc2822String;
 
 /// Creates a string representations in forma IMAP date/time, which is defined as:
@@ -10,20 +10,22 @@
 
 #import "NSDate+StringRepresentation.h"
 
+#import "CWDate.h"
+
 @implementation NSDate (StringRepresentation)
 
 - (NSString *)rfc2822String {
-    NSDateFormatter *formatter = [[NSDateFormatter alloc] init];
-    formatter.dateFormat = @"EEE, dd MMM yyyy HH:mm:ss Z";
-    formatter.locale = [[NSLocale alloc] initWithLocaleIdentifier:@"en_US_POSIX"];
-    return [formatter stringFromDate:self];
+    char buffer[CW_DATE_BUFFER_SIZE];
+    NSInteger offset = [[NSTimeZone defaultTimeZone] secondsFromGMTForDate:self];
+    NSUInteger length = CWFormatRFC5322Date([self timeIntervalSince1970], offset, buffer);
+    return [[NSString alloc] initWithBytes:buffer length:length encoding:NSASCIIStringEncoding];
 }
 
 - (NSString *)dateTimeString {
-    NSDateFormatter *formatter = [NSDateFormatter new];
-    formatter.dateFormat = @"dd-MMM-yyyy HH:mm:ss Z";
-    formatter.locale = [[NSLocale alloc] initWithLocaleIdentifier:@"en_US_POSIX"];
-    return [formatter stringFromDate:self];
+    char buffer[CW_DATE_BUFFER_SIZE];
+    NSInteger offset = [[NSTimeZone defaultTimeZone] secondsFromGMTForDate:self];
+    NSUInteger length = CWFormatIMAPDateTime([self timeIntervalSince1970], offset, buffer);
+    return [[NSString alloc] initWithBytes:buffer length:length encoding:NSASCIIStringEncoding];
 }
 
 @end
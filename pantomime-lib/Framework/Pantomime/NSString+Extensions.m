@@ -57,6 +57,113 @@
 
 #define IS_PRINTABLE(c) (isascii(c) && isprint(c))
 
+//
+// Maps a lowercase charset name to its encoding, -1 if there is none.
+//
+static NSInteger encoding_for_charset_name(NSString *name, BOOL shouldConvertToNSStringEncoding)
+{
+    // We define some aliases for the string encoding.
+    static struct { char *name; int encoding; BOOL fromCoreFoundation; } encodings[] = {
+        {"ascii"         ,NSASCIIStringEncoding          ,NO},
+        {"us-ascii"      ,NSASCIIStringEncoding          ,NO},
+        {"default"       ,NSASCIIStringEncoding          ,NO},  // Ah... spammers.
+        {"utf-8"         ,NSUTF8StringEncoding           ,NO},
+        {"iso-8859-1"    ,NSISOLatin1StringEncoding      ,NO},
+        {"x-user-defined",NSISOLatin1StringEncoding      ,NO},  // To prevent a lame bug in Outlook.
+        {"unknown"       ,NSISOLatin1StringEncoding      ,NO},  // Once more, blame Outlook.
+        {"x-unknown"     ,NSISOLatin1StringEncoding      ,NO},  // To prevent a lame bug in Pine 4.21.
+        {"unknown-8bit"  ,NSISOLatin1StringEncoding      ,NO},  // To prevent a lame bug in Mutt/1.3.28i
+        {"0"             ,NSISOLatin1StringEncoding      ,NO},  // To prevent a lame bug in QUALCOMM Windows Eudora Version 6.0.1.1
+        {""              ,NSISOLatin1StringEncoding      ,NO},  // To prevent a lame bug in Ximian Evolution
+        {"iso8859_1"     ,NSISOLatin1StringEncoding      ,NO},  // To prevent a lame bug in Openwave WebEngine
+        {"iso-8859-2"    ,NSISOLatin2StringEncoding      ,NO},
+#ifndef MACOSX
+        {"iso-8859-3"   ,NSISOLatin3StringEncoding                 ,NO},
+        {"iso-8859-4"   ,NSISOLatin4StringEncoding                 ,NO},
+        {"iso-8859-5"   ,NSISOCyrillicStringEncoding               ,NO},
+        {"iso-8859-6"   ,NSISOArabicStringEncoding                 ,NO},
+        {"iso-8859-7"   ,NSISOGreekStringEncoding                  ,NO},
+        {"iso-8859-8"   ,NSISOHebrewStringEncoding                 ,NO},
+        {"iso-8859-9"   ,NSISOLatin5StringEncoding                 ,NO},
+        {"iso-8859-10"  ,NSISOLatin6StringEncoding                 ,NO},
+        {"iso-8859-11"  ,NSISOThaiStringEncoding                   ,NO},
+        {"iso-8859-13"  ,NSISOLatin7StringEncoding                 ,NO},
+        {"iso-8859-14"  ,NSISOLatin8StringEncoding                 ,NO},
+        {"iso-8859-15"  ,NSISOLatin9StringEncoding                 ,NO},
+        {"koi8-r"       ,NSKOI8RStringEncoding                     ,NO},
+        {"big5"         ,NSBIG5StringEncoding                      ,NO},
+        {"gb2312"       ,NSGB2312StringEncoding                    ,NO},
+        {"utf-7"        ,NSUTF7StringEncoding                      ,NO},
+        {"unicode-1-1-utf-7", NSUTF7StringEncoding                 ,NO},  // To prever a bug (sort of) in MS Hotmail
+#endif
+        {"windows-1250" ,NSWindowsCP1250StringEncoding             ,NO},
+        {"windows-1251" ,NSWindowsCP1251StringEncoding             ,NO},
+        {"cyrillic (windows-1251)", NSWindowsCP1251StringEncoding  ,NO},  // To prevent a bug in MS Hotmail
+        {"windows-1252" ,NSWindowsCP1252StringEncoding             ,NO},
+        {"windows-1253" ,NSWindowsCP1253StringEncoding             ,NO},
+        {"windows-1254" ,NSWindowsCP1254StringEncoding             ,NO},
+        {"iso-2022-jp"  ,NSISO2022JPStringEncoding                 ,NO},
+        {"euc-jp"       ,NSJapaneseEUCStringEncoding               ,NO},
+    };
+
+    const char *cname = [name UTF8String];
+    int i;
+
+    for (i = 0; i < sizeof(encodings)/sizeof(encodings[0]); i++)
+    {
+        if (strcmp(cname, encodings[i].name) == 0)
+        {
+            int enc = encodings[i].encoding;
+            // Under OS X, we use CoreFoundation if necessary to convert the encoding
+            // to a NSString encoding.
+#ifdef MACOSX
+            if (encodings[i].fromCoreFoundation)
+            {
+                if (shouldConvertToNSStringEncoding)
+                {
+                    return CFStringConvertEncodingToNSStringEncoding(enc);
+                }
+                else
+                {
+                    return enc;
+                }
+            }
+            else
+            {
+                // enc is a NSStringEncoding
+                if (!shouldConvertToNSStringEncoding)
+                {
+                    return CFStringConvertNSStringEncodingToEncoding(enc);
+                }
+                return enc;
+            }
+#else
+            return enc;
+#endif
+        }
+    }
+
+#ifdef MACOSX
+    // Last resort: try using CoreFoundation...
+    CFStringEncoding enc;
+
+    enc = CFStringConvertIANACharSetNameToEncoding((CFStringRef)name);
+    if (kCFStringEncodingInvalidId != enc)
+    {
+        if (shouldConvertToNSStringEncoding)
+        {
+            return CFStringConvertEncodingToNSStringEncoding(enc);
+        }
+        else
+        {
+            return enc;
+        }
+    }
+#endif
+
+    return -1;
+}
+
 //
 //
 //
@@ -193,117 +300,52 @@
 + (NSInteger) encodingForCharset: (NSData *) theCharset
        convertToNSStringEncoding: (BOOL) shouldConvertToNSStringEncoding
 {
-    // We define some aliases for the string encoding.
-    static struct { char *name; int encoding; BOOL fromCoreFoundation; } encodings[] = {
-        {"ascii"         ,NSASCIIStringEncoding          ,NO},
-        {"us-ascii"      ,NSASCIIStringEncoding          ,NO},
-        {"default"       ,NSASCIIStringEncoding          ,NO},  // Ah... spammers.
-        {"utf-8"         ,NSUTF8StringEncoding           ,NO},
-        {"iso-8859-1"    ,NSISOLatin1StringEncoding      ,NO},
-        {"x-user-defined",NSISOLatin1StringEncoding      ,NO},  // To prevent a lame bug in Outlook.
-        {"unknown"       ,NSISOLatin1StringEncoding      ,NO},  // Once more, blame Outlook.
-        {"x-unknown"     ,NSISOLatin1StringEncoding      ,NO},  // To prevent a lame bug in Pine 4.21.
-        {"unknown-8bit"  ,NSISOLatin1StringEncoding      ,NO},  // To prevent a lame bug in Mutt/1.3.28i
-        {"0"             ,NSISOLatin1StringEncoding      ,NO},  // To prevent a lame bug in QUALCOMM Windows Eudora Version 6.0.1.1
-        {""              ,NSISOLatin1StringEncoding      ,NO},  // To prevent a lame bug in Ximian Evolution
-        {"iso8859_1"     ,NSISOLatin1StringEncoding      ,NO},  // To prevent a lame bug in Openwave WebEngine
-        {"iso-8859-2"    ,NSISOLatin2StringEncoding      ,NO},
-#ifndef MACOSX
-        {"iso-8859-3"   ,NSISOLatin3StringEncoding                 ,NO},
-        {"iso-8859-4"   ,NSISOLatin4StringEncoding                 ,NO},
-        {"iso-8859-5"   ,NSISOCyrillicStringEncoding               ,NO},
-        {"iso-8859-6"   ,NSISOArabicStringEncoding                 ,NO},
-        {"iso-8859-7"   ,NSISOGreekStringEncoding                  ,NO},
-        {"iso-8859-8"   ,NSISOHebrewStringEncoding                 ,NO},
-        {"iso-8859-9"   ,NSISOLatin5StringEncoding                 ,NO},
-        {"iso-8859-10"  ,NSISOLatin6StringEncoding                 ,NO},
-        {"iso-8859-11"  ,NSISOThaiStringEncoding                   ,NO},
-        {"iso-8859-13"  ,NSISOLatin7StringEncoding                 ,NO},
-        {"iso-8859-14"  ,NSISOLatin8StringEncoding                 ,NO},
-        {"iso-8859-15"  ,NSISOLatin9StringEncoding                 ,NO},
-        {"koi8-r"       ,NSKOI8RStringEncoding                     ,NO},
-        {"big5"         ,NSBIG5StringEncoding                      ,NO},
-        {"gb2312"       ,NSGB2312StringEncoding                    ,NO},
-        {"utf-7"        ,NSUTF7StringEncoding                      ,NO},
-        {"unicode-1-1-utf-7", NSUTF7StringEncoding                 ,NO},  // To prever a bug (sort of) in MS Hotmail
-#endif
-        {"windows-1250" ,NSWindowsCP1250StringEncoding             ,NO},
-        {"windows-1251" ,NSWindowsCP1251StringEncoding             ,NO},
-        {"cyrillic (windows-1251)", NSWindowsCP1251StringEncoding  ,NO},  // To prevent a bug in MS Hotmail
-        {"windows-1252" ,NSWindowsCP1252StringEncoding             ,NO},
-        {"windows-1253" ,NSWindowsCP1253StringEncoding             ,NO},
-        {"windows-1254" ,NSWindowsCP1254StringEncoding             ,NO},
-        {"iso-2022-jp"  ,NSISO2022JPStringEncoding                 ,NO},
-        {"euc-jp"       ,NSJapaneseEUCStringEncoding               ,NO},
-    };
-
+    // Charset names are looked up once per header and body part, so the
+    // result is cached per name. The cache is dropped when it gets large, as
+    // the names come from the messages.
+    static NSMutableDictionary *cache[2];
+    NSNumber *cached;
     NSString *name;
-    int i;
+    NSInteger encoding;
 
     name = [[[NSString alloc ] initWithBytes: [theCharset bytes] length: [theCharset length]
                                     encoding: NSUTF8StringEncoding] lowercaseString];
     AUTORELEASE_VOID(name);
 
-    NSMutableArray *encodingNames = [NSMutableArray array];
-    for (i = 0; i < sizeof(encodings)/sizeof(encodings[0]); i++) {
-        NSString *string = [[NSString alloc] initWithCString:encodings[i].name
-                                                    encoding:NSUTF8StringEncoding];
-        [encodingNames addObject:string];
+    if (!name)
+    {
+        return -1;
     }
 
-    for (i = 0; i < sizeof(encodings)/sizeof(encodings[0]); i++)
+    @synchronized([NSString class])
     {
-        if ([name isEqualToString: encodingNames[i]])
+        if (!cache[0])
         {
-            int enc = encodings[i].encoding;
-            // Under OS X, we use CoreFoundation if necessary to convert the encoding
-            // to a NSString encoding.
-#ifdef MACOSX
-            if (encodings[i].fromCoreFoundation)
-            {
-                if (shouldConvertToNSStringEncoding)
-                {
-                    return CFStringConvertEncodingToNSStringEncoding(enc);
-                }
-                else
-                {
-                    return enc;
-                }
-            }
-            else
-            {
-                // enc is a NSStringEncoding
-                if (!shouldConvertToNSStringEncoding)
-                {
-                    return CFStringConvertNSStringEncodingToEncoding(enc);
-                }
-                return enc;
-            }
-#else
-            return enc;
-#endif
+            cache[0] = [[NSMutableDictionary alloc] init];
+            cache[1] = [[NSMutableDictionary alloc] init];
         }
+        cached = [cache[shouldConvertToNSStringEncoding ? 1 : 0] objectForKey: name];
     }
 
-#ifdef MACOSX
-    // Last resort: try using CoreFoundation...
-    CFStringEncoding enc;
+    if (cached)
+    {
+        return [cached integerValue];
+    }
 
-    enc = CFStringConvertIANACharSetNameToEncoding((CFStringRef)name);
-    if (kCFStringEncodingInvalidId != enc)
+    encoding = encoding_for_charset_name(name, shouldConvertToNSStringEncoding);
+
+    @synchronized([NSString class])
     {
-        if (shouldConvertToNSStringEncoding)
-        {
-            return CFStringConvertEncodingToNSStringEncoding(enc);
-        }
-        else
+        NSMutableDictionary *aDictionary = cache[shouldConvertToNSStringEncoding ? 1 : 0];
+
+        if ([aDictionary count] >= 256)
         {
-            return enc;
+            [aDictionary removeAllObjects];
         }
+        [aDictionary setObject: [NSNumber numberWithInteger: encoding]  forKey: name];
     }
-#endif
 
-    return -1;
+    return encoding;
 }
 
 //
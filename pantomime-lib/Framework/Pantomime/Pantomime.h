@@ -56,6 +56,7 @@
 #ifdef MACOSX
 #import "CWMacOSXGlue.h"
 #endif
+#import "CWDigest.h"
 #import "CWMD5.h"
 #import <PantomimeFramework/CWMessage.h>
 #import "CWMIMEMultipart.h"
@@ -65,9 +66,11 @@
 #import "CWParser.h"
 #import "CWPart.h"
 #import "CWService.h"
+#import "CWServiceMetrics.h"
 #import "CWSMTP.h"
 #import "CWStore.h"
 #import "CWTCPConnection.h"
+#import "CWThreader.h"
 #import "CWTransport.h"
 #import "CWUUFile.h"
 #import "CWVirtualFolder.h"
@@ -0,0 +1,43 @@
+//
+//  CWByteRegex.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A compiled POSIX extended regular expression, matched on bytes by simulating its NFA.
+
+ Matching is linear in the length of the input and finds the leftmost-longest match, like
+ regexec(3) in the C locale. Only a subset of POSIX EREs is supported: literals, ".", bracket
+ expressions (with character classes like [:space:]), "*", "+", "?", "|", groups and the
+ anchors "^" and "$". Patterns using anything else, like bounds ({m,n}) or back-references,
+ are not compiled and must be handed to regexec(3).
+ */
+typedef struct cw_byte_regex cw_byte_regex;
+
+/**
+ @param pattern The pattern, NUL-terminated.
+ @param flags The regcomp(3) flags. Only REG_EXTENDED and REG_ICASE are supported,
+        REG_EXTENDED is required.
+ @return The compiled pattern, NULL if it or the flags are not supported.
+ */
+cw_byte_regex * _Nullable cw_byte_regex_compile(const char *pattern, int flags);
+
+void cw_byte_regex_free(cw_byte_regex * _Nullable regex);
+
+/**
+ Searches for the leftmost-longest match within [from, end) of bytes. Like regexec(3) with
+ REG_STARTEND, "^" matches at from unless notbol is set, "$" matches at end.
+
+ @param match Set to the match, in offsets from bytes, if one is found.
+ @return YES if a match was found.
+ */
+BOOL cw_byte_regex_search(const cw_byte_regex *regex, const unsigned char *bytes,
+                          NSUInteger from, NSUInteger end, BOOL notbol, NSRange *match);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,864 @@
+//
+//  CWByteRegex.m
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWByteRegex.h"
+
+#include <ctype.h>
+#include <regex.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Patterns longer than that are left to regexec(3), so that the
+// recursive parser and code generator stay shallow.
+//
+#define MAX_PATTERN_LENGTH 1024
+
+typedef uint8_t byte_set[32];
+
+static inline void set_add(byte_set set, unsigned char c)
+{
+    set[c >> 3] |= (uint8_t) (1 << (c & 7));
+}
+
+static inline BOOL set_contains(const byte_set set, unsigned char c)
+{
+    return (set[c >> 3] >> (c & 7)) & 1;
+}
+
+//
+// Program
+//
+enum
+{
+    OP_CLASS,   // consumes a byte of class x
+    OP_SPLIT,   // continues at x and y
+    OP_JMP,     // continues at x
+    OP_BOL,
+    OP_EOL,
+    OP_MATCH
+};
+
+typedef struct
+{
+    uint8_t op;
+    uint32_t x;
+    uint32_t y;
+} instruction;
+
+struct cw_byte_regex
+{
+    instruction *code;
+    NSUInteger count;
+    byte_set *classes;
+
+    // What a match can start with, to skip positions that cannot
+    byte_set first;
+    BOOL nullable;
+    BOOL anchored;
+};
+
+//
+// Parser, building a syntax tree
+//
+enum
+{
+    NODE_CLASS,
+    NODE_CAT,
+    NODE_ALT,
+    NODE_STAR,
+    NODE_PLUS,
+    NODE_QUEST,
+    NODE_EMPTY,
+    NODE_BOL,
+    NODE_EOL
+};
+
+typedef struct
+{
+    uint8_t type;
+    int a;
+    int b;
+} node;
+
+typedef struct
+{
+    const unsigned char *pattern;
+    NSUInteger length;
+    NSUInteger pos;
+    BOOL icase;
+    BOOL failed;
+
+    node *nodes;
+    NSUInteger nodeCount;
+    NSUInteger nodeCapacity;
+
+    byte_set *classes;
+    NSUInteger classCount;
+    NSUInteger classCapacity;
+} parser;
+
+static int parse_alternation(parser *p);
+
+static int new_node(parser *p, uint8_t type, int a, int b)
+{
+    if (p->failed)
+    {
+        return -1;
+    }
+
+    if (p->nodeCount == p->nodeCapacity)
+    {
+        NSUInteger capacity = p->nodeCapacity ? 2 * p->nodeCapacity : 16;
+        node *nodes = realloc(p->nodes, capacity * sizeof(node));
+
+        if (!nodes)
+        {
+            p->failed = YES;
+            return -1;
+        }
+        p->nodes = nodes;
+        p->nodeCapacity = capacity;
+    }
+
+    p->nodes[p->nodeCount] = (node) { type, a, b };
+    return (int) p->nodeCount++;
+}
+
+static int new_class(parser *p, const byte_set set)
+{
+    byte_set folded;
+    int c;
+
+    if (p->classCount == p->classCapacity)
+    {
+        NSUInteger capacity = p->classCapacity ? 2 * p->classCapacity : 8;
+        byte_set *classes = realloc(p->classes, capacity * sizeof(byte_set));
+
+        if (!classes)
+        {
+            p->failed = YES;
+            return -1;
+        }
+        p->classes = classes;
+        p->classCapacity = capacity;
+    }
+
+    memcpy(folded, set, sizeof(byte_set));
+    if (p->icase)
+    {
+        for (c = 'a'; c <= 'z'; c++)
+        {
+            if (set_contains(set, c) || set_contains(set, c - 'a' + 'A'))
+            {
+                set_add(folded, c);
+                set_add(folded, c - 'a' + 'A');
+            }
+        }
+    }
+    memcpy(p->classes[p->classCount], folded, sizeof(byte_set));
+
+    return new_node(p, NODE_CLASS, (int) p->classCount++, 0);
+}
+
+static int literal(parser *p, unsigned char c)
+{
+    byte_set set = {0};
+
+    set_add(set, c);
+    return new_class(p, set);
+}
+
+//
+// The named classes, in the C locale.
+//
+static BOOL add_named_class(byte_set set, const char *name, NSUInteger length)
+{
+    int c;
+
+#define IS(s) (length == strlen(s) && strncmp(name, s, length) == 0)
+    for (c = 0; c < 256; c++)
+    {
+        BOOL upper = (c >= 'A' && c <= 'Z');
+        BOOL lower = (c >= 'a' && c <= 'z');
+        BOOL digit = (c >= '0' && c <= '9');
+        BOOL graph = (c > 0x20 && c < 0x7f);
+        BOOL in;
+
+        if (IS("alpha")) in = upper || lower;
+        else if (IS("digit")) in = digit;
+        else if (IS("alnum")) in = upper || lower || digit;
+        else if (IS("upper")) in = upper;
+        else if (IS("lower")) in = lower;
+        else if (IS("space")) in = (c == ' ' || (c >= '\t' && c <= '\r'));
+        else if (IS("blank")) in = (c == ' ' || c == '\t');
+        else if (IS("punct")) in = graph && !upper && !lower && !digit;
+        else if (IS("print")) in = graph || c == ' ';
+        else if (IS("graph")) in = graph;
+        else if (IS("cntrl")) in = (c < 0x20 || c == 0x7f);
+        else if (IS("xdigit")) in = digit || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+        else return NO;
+
+        if (in)
+        {
+            set_add(set, c);
+        }
+    }
+#undef IS
+
+    return YES;
+}
+
+static int parse_bracket(parser *p)
+{
+    byte_set set = {0};
+    BOOL negate = NO;
+    NSUInteger i;
+
+    if (p->pos < p->length && p->pattern[p->pos] == '^')
+    {
+        negate = YES;
+        p->pos++;
+    }
+
+    // A leading ']' is a literal
+    if (p->pos < p->length && p->pattern[p->pos] == ']')
+    {
+        set_add(set, ']');
+        p->pos++;
+    }
+
+    while (p->pos < p->length && p->pattern[p->pos] != ']')
+    {
+        unsigned char lo = p->pattern[p->pos];
+
+        if (lo == '[' && p->pos + 1 < p->length)
+        {
+            unsigned char kind = p->pattern[p->pos + 1];
+
+            if (kind == '.' || kind == '=')
+            {
+                // Collating elements and equivalence classes
+                p->failed = YES;
+                return -1;
+            }
+
+            if (kind == ':')
+            {
+                const char *name = (const char *) p->pattern + p->pos + 2;
+                const char *end = strstr(name, ":]");
+
+                if (!end || !add_named_class(set, name, (NSUInteger) (end - name)))
+                {
+                    p->failed = YES;
+                    return -1;
+                }
+                p->pos = (NSUInteger) (end - (const char *) p->pattern) + 2;
+                continue;
+            }
+        }
+
+        p->pos++;
+
+        if (p->pos + 1 < p->length && p->pattern[p->pos] == '-' && p->pattern[p->pos + 1] != ']')
+        {
+            unsigned char hi = p->pattern[p->pos + 1];
+
+            if (hi == '[' || hi < lo)
+            {
+                p->failed = YES;
+                return -1;
+            }
+            for (i = lo; i <= hi; i++)
+            {
+                set_add(set, (unsigned char) i);
+            }
+            p->pos += 2;
+        }
+        else
+        {
+            set_add(set, lo);
+        }
+    }
+
+    if (p->pos >= p->length)
+    {
+        p->failed = YES;
+        return -1;
+    }
+    p->pos++;
+
+    if (negate)
+    {
+        // Folding first, so that [^a] does not match 'A' with REG_ICASE
+        int n = new_class(p, set);
+
+        if (n < 0)
+        {
+            return -1;
+        }
+        for (i = 0; i < sizeof(byte_set); i++)
+        {
+            p->classes[p->nodes[n].a][i] = (uint8_t) ~p->classes[p->nodes[n].a][i];
+        }
+        return n;
+    }
+
+    return new_class(p, set);
+}
+
+static int parse_atom(parser *p)
+{
+    unsigned char c = p->pattern[p->pos++];
+    byte_set all;
+    int n;
+
+    switch (c)
+    {
+        case '(':
+            if (p->pos < p->length && p->pattern[p->pos] == ')')
+            {
+                p->pos++;
+                return new_node(p, NODE_EMPTY, 0, 0);
+            }
+            n = parse_alternation(p);
+            if (p->pos >= p->length || p->pattern[p->pos] != ')')
+            {
+                p->failed = YES;
+                return -1;
+            }
+            p->pos++;
+            return n;
+
+        case '[':
+            return parse_bracket(p);
+
+        case '.':
+            memset(all, 0xff, sizeof(byte_set));
+            return new_class(p, all);
+
+        case '^':
+            return new_node(p, NODE_BOL, 0, 0);
+
+        case '$':
+            return new_node(p, NODE_EOL, 0, 0);
+
+        case '\\':
+            // \w, \<, \1 and the like are extensions or back-references
+            if (p->pos >= p->length || isalnum(p->pattern[p->pos]) || p->pattern[p->pos] == '<' ||
+                p->pattern[p->pos] == '>' || p->pattern[p->pos] == '`' || p->pattern[p->pos] == '\'')
+            {
+                p->failed = YES;
+                return -1;
+            }
+            return literal(p, p->pattern[p->pos++]);
+
+        case '*':
+        case '+':
+        case '?':
+        case '{':
+        case ')':
+            // Undefined by POSIX, or a bound
+            p->failed = YES;
+            return -1;
+
+        default:
+            return literal(p, c);
+    }
+}
+
+static int parse_repetition(parser *p)
+{
+    int n = parse_atom(p);
+
+    while (!p->failed && p->pos < p->length)
+    {
+        unsigned char c = p->pattern[p->pos];
+        uint8_t type;
+
+        if (c == '*') type = NODE_STAR;
+        else if (c == '+') type = NODE_PLUS;
+        else if (c == '?') type = NODE_QUEST;
+        else if (c == '{')
+        {
+            p->failed = YES;
+            return -1;
+        }
+        else break;
+
+        if (p->nodes[n].type == NODE_BOL || p->nodes[n].type == NODE_EOL)
+        {
+            p->failed = YES;
+            return -1;
+        }
+
+        p->pos++;
+        n = new_node(p, type, n, 0);
+    }
+
+    return n;
+}
+
+static int parse_concatenation(parser *p)
+{
+    int n = -1;
+
+    while (!p->failed && p->pos < p->length &&
+           p->pattern[p->pos] != '|' && p->pattern[p->pos] != ')')
+    {
+        int next = parse_repetition(p);
+
+        n = (n < 0 ? next : new_node(p, NODE_CAT, n, next));
+    }
+
+    return (n < 0 ? new_node(p, NODE_EMPTY, 0, 0) : n);
+}
+
+static int parse_alternation(parser *p)
+{
+    int n = parse_concatenation(p);
+
+    while (!p->failed && p->pos < p->length && p->pattern[p->pos] == '|')
+    {
+        p->pos++;
+        n = new_node(p, NODE_ALT, n, parse_concatenation(p));
+    }
+
+    return n;
+}
+
+//
+// Code generation
+//
+typedef struct
+{
+    instruction *code;
+    NSUInteger count;
+    NSUInteger capacity;
+    BOOL failed;
+} generator;
+
+static NSUInteger emit(generator *g, uint8_t op, uint32_t x, uint32_t y)
+{
+    if (g->count == g->capacity)
+    {
+        NSUInteger capacity = g->capacity ? 2 * g->capacity : 32;
+        instruction *code = realloc(g->code, capacity * sizeof(instruction));
+
+        if (!code)
+        {
+            g->failed = YES;
+            return 0;
+        }
+        g->code = code;
+        g->capacity = capacity;
+    }
+
+    g->code[g->count] = (instruction) { op, x, y };
+    return g->count++;
+}
+
+static void generate(generator *g, const node *nodes, int n)
+{
+    NSUInteger s, j, l;
+
+    if (g->failed)
+    {
+        return;
+    }
+
+    switch (nodes[n].type)
+    {
+        case NODE_CLASS:
+            emit(g, OP_CLASS, (uint32_t) nodes[n].a, 0);
+            break;
+
+        case NODE_CAT:
+            generate(g, nodes, nodes[n].a);
+            generate(g, nodes, nodes[n].b);
+            break;
+
+        case NODE_ALT:
+            s = emit(g, OP_SPLIT, 0, 0);
+            generate(g, nodes, nodes[n].a);
+            j = emit(g, OP_JMP, 0, 0);
+            if (g->failed) return;
+            g->code[s].x = (uint32_t) s + 1;
+            g->code[s].y = (uint32_t) g->count;
+            generate(g, nodes, nodes[n].b);
+            if (g->failed) return;
+            g->code[j].x = (uint32_t) g->count;
+            break;
+
+        case NODE_STAR:
+            s = emit(g, OP_SPLIT, 0, 0);
+            generate(g, nodes, nodes[n].a);
+            emit(g, OP_JMP, (uint32_t) s, 0);
+            if (g->failed) return;
+            g->code[s].x = (uint32_t) s + 1;
+            g->code[s].y = (uint32_t) g->count;
+            break;
+
+        case NODE_PLUS:
+            l = g->count;
+            generate(g, nodes, nodes[n].a);
+            emit(g, OP_SPLIT, (uint32_t) l, (uint32_t) g->count + 1);
+            break;
+
+        case NODE_QUEST:
+            s = emit(g, OP_SPLIT, 0, 0);
+            generate(g, nodes, nodes[n].a);
+            if (g->failed) return;
+            g->code[s].x = (uint32_t) s + 1;
+            g->code[s].y = (uint32_t) g->count;
+            break;
+
+        case NODE_BOL:
+            emit(g, OP_BOL, 0, 0);
+            break;
+
+        case NODE_EOL:
+            emit(g, OP_EOL, 0, 0);
+            break;
+
+        default:
+            break;
+    }
+}
+
+//
+// Computes the bytes a match can start with, if it can be empty and
+// if it can only start where "^" matches.
+//
+static void analyze(cw_byte_regex *regex)
+{
+    uint32_t *stack = malloc((2 * regex->count + 1) * sizeof(uint32_t));
+    BOOL *seen = calloc(regex->count, sizeof(BOOL));
+    NSUInteger top = 0;
+    NSUInteger i;
+
+    memset(regex->first, 0, sizeof(byte_set));
+    regex->nullable = NO;
+    regex->anchored = YES;
+
+    if (!stack || !seen)
+    {
+        // Be conservative
+        memset(regex->first, 0xff, sizeof(byte_set));
+        regex->nullable = YES;
+        regex->anchored = NO;
+        free(stack);
+        free(seen);
+        return;
+    }
+
+    stack[top++] = 0;
+    while (top)
+    {
+        uint32_t pc = stack[--top];
+        const instruction *inst = &regex->code[pc];
+
+        if (seen[pc])
+        {
+            continue;
+        }
+        seen[pc] = YES;
+
+        switch (inst->op)
+        {
+            case OP_CLASS:
+                for (i = 0; i < sizeof(byte_set); i++)
+                {
+                    regex->first[i] |= regex->classes[inst->x][i];
+                }
+                regex->anchored = NO;
+                break;
+            case OP_MATCH:
+                regex->nullable = YES;
+                regex->anchored = NO;
+                break;
+            case OP_SPLIT:
+                stack[top++] = inst->y;
+                stack[top++] = inst->x;
+                break;
+            case OP_JMP:
+                stack[top++] = inst->x;
+                break;
+            case OP_EOL:
+                stack[top++] = pc + 1;
+                break;
+            case OP_BOL:
+                // This path only matches where "^" does
+                break;
+        }
+    }
+
+    free(stack);
+    free(seen);
+}
+
+//
+//
+//
+cw_byte_regex *cw_byte_regex_compile(const char *pattern, int flags)
+{
+    parser p;
+    generator g;
+    cw_byte_regex *regex;
+    int root;
+
+    if (!(flags & REG_EXTENDED) || (flags & ~(REG_EXTENDED | REG_ICASE)))
+    {
+        return NULL;
+    }
+
+    memset(&p, 0, sizeof(p));
+    p.pattern = (const unsigned char *) pattern;
+    p.length = strlen(pattern);
+    p.icase = (flags & REG_ICASE) != 0;
+
+    if (p.length > MAX_PATTERN_LENGTH)
+    {
+        return NULL;
+    }
+
+    root = parse_alternation(&p);
+    if (p.failed || p.pos != p.length)
+    {
+        free(p.nodes);
+        free(p.classes);
+        return NULL;
+    }
+
+    memset(&g, 0, sizeof(g));
+    generate(&g, p.nodes, root);
+    emit(&g, OP_MATCH, 0, 0);
+    free(p.nodes);
+
+    if (g.failed)
+    {
+        free(g.code);
+        free(p.classes);
+        return NULL;
+    }
+
+    regex = calloc(1, sizeof(cw_byte_regex));
+    if (!regex)
+    {
+        free(g.code);
+        free(p.classes);
+        return NULL;
+    }
+    regex->code = g.code;
+    regex->count = g.count;
+    regex->classes = p.classes;
+    analyze(regex);
+
+    return regex;
+}
+
+
+//
+//
+//
+void cw_byte_regex_free(cw_byte_regex *regex)
+{
+    if (regex)
+    {
+        free(regex->code);
+        free(regex->classes);
+        free(regex);
+    }
+}
+
+
+//
+// Matching. Threads are kept in sparse sets, ordered by the position
+// their match started at, so the first thread reaching a state always
+// is the leftmost one and later ones can be dropped.
+//
+typedef struct
+{
+    uint32_t *dense;
+    uint32_t *sparse;
+    NSUInteger *start;
+    NSUInteger count;
+} thread_list;
+
+static inline BOOL list_contains(const thread_list *l, uint32_t pc)
+{
+    return l->sparse[pc] < l->count && l->dense[l->sparse[pc]] == pc;
+}
+
+static void add_thread(const cw_byte_regex *regex, thread_list *l, uint32_t *stack, uint32_t pc,
+                       NSUInteger start, NSUInteger pos, NSUInteger from, NSUInteger end, BOOL notbol)
+{
+    NSUInteger top = 0;
+
+    stack[top++] = pc;
+    while (top)
+    {
+        const instruction *inst;
+
+        pc = stack[--top];
+        if (list_contains(l, pc))
+        {
+            continue;
+        }
+        l->sparse[pc] = (uint32_t) l->count;
+        l->dense[l->count] = pc;
+        l->start[l->count] = start;
+        l->count++;
+
+        inst = &regex->code[pc];
+        switch (inst->op)
+        {
+            case OP_SPLIT:
+                stack[top++] = inst->y;
+                stack[top++] = inst->x;
+                break;
+            case OP_JMP:
+                stack[top++] = inst->x;
+                break;
+            case OP_BOL:
+                if (pos == from && !notbol)
+                {
+                    stack[top++] = pc + 1;
+                }
+                break;
+            case OP_EOL:
+                if (pos == end)
+                {
+                    stack[top++] = pc + 1;
+                }
+                break;
+        }
+    }
+}
+
+BOOL cw_byte_regex_search(const cw_byte_regex *regex, const unsigned char *bytes,
+                          NSUInteger from, NSUInteger end, BOOL notbol, NSRange *match)
+{
+    NSUInteger n = regex->count;
+    NSUInteger bestStart = NSNotFound, bestEnd = 0;
+    NSUInteger pos = from;
+    thread_list lists[2], *clist, *nlist, *tmp;
+    uint32_t *memory, *stack;
+    NSUInteger *starts;
+    NSUInteger i;
+
+    if (regex->anchored && notbol)
+    {
+        return NO;
+    }
+
+    memory = calloc(6 * n + 1, sizeof(uint32_t));
+    starts = malloc(2 * n * sizeof(NSUInteger));
+    if (!memory || !starts)
+    {
+        free(memory);
+        free(starts);
+        return NO;
+    }
+    lists[0] = (thread_list) { memory, memory + n, starts, 0 };
+    lists[1] = (thread_list) { memory + 2 * n, memory + 3 * n, starts + n, 0 };
+    stack = memory + 4 * n;
+    clist = &lists[0];
+    nlist = &lists[1];
+
+    while (YES)
+    {
+        if (!clist->count && bestStart == NSNotFound)
+        {
+            // Nothing running, skip to where a match can start
+            if (pos != from || notbol)
+            {
+                if (regex->anchored)
+                {
+                    break;
+                }
+                if (!regex->nullable)
+                {
+                    while (pos < end && !set_contains(regex->first, bytes[pos]))
+                    {
+                        pos++;
+                    }
+                    if (pos == end)
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (bestStart == NSNotFound)
+        {
+            add_thread(regex, clist, stack, 0, pos, pos, from, end, notbol);
+        }
+
+        for (i = 0; i < clist->count; i++)
+        {
+            if (regex->code[clist->dense[i]].op == OP_MATCH)
+            {
+                NSUInteger start = clist->start[i];
+
+                if (bestStart == NSNotFound || start < bestStart)
+                {
+                    bestStart = start;
+                    bestEnd = pos;
+                }
+                else if (start == bestStart)
+                {
+                    bestEnd = pos;
+                }
+                break;
+            }
+        }
+
+        // Threads starting after the best match cannot beat it
+        if (bestStart != NSNotFound)
+        {
+            while (clist->count && clist->start[clist->count - 1] > bestStart)
+            {
+                clist->count--;
+            }
+        }
+
+        if (pos >= end || (!clist->count && bestStart != NSNotFound))
+        {
+            break;
+        }
+
+        nlist->count = 0;
+        for (i = 0; i < clist->count; i++)
+        {
+            const instruction *inst = &regex->code[clist->dense[i]];
+
+            if (inst->op == OP_CLASS && set_contains(regex->classes[inst->x], bytes[pos]))
+            {
+                add_thread(regex, nlist, stack, clist->dense[i] + 1, clist->start[i], pos + 1, from, end, notbol);
+            }
+        }
+
+        tmp = clist;
+        clist = nlist;
+        nlist = tmp;
+        pos++;
+    }
+
+    free(memory);
+    free(starts);
+
+    if (bestStart == NSNotFound)
+    {
+        return NO;
+    }
+
+    *match = NSMakeRange(bestStart, bestEnd - bestStart);
+    return YES;
+}
@@ -0,0 +1,48 @@
+//
+//  CWByteSearch.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Search kernels on raw bytes, backing the searches of NSData+Extensions. All of them return
+ offsets from bytes, NSNotFound if nothing is found. Case-insensitive comparisons only fold
+ ASCII letters, like strncasecmp(3) in the C locale.
+ */
+
+/**
+ @return The offset of the first c in bytes.
+ */
+NSUInteger cw_byte_search_char(const unsigned char *bytes, NSUInteger length, unsigned char c);
+
+/**
+ Scans for the first byte of a small set, like ";\n", 16 bytes at a time where SSE2 or NEON
+ are available.
+
+ @param set The bytes to look for, NUL-terminated. Up to 4 of them are vectorized.
+ @return The offset of the first byte of bytes that is in set.
+ */
+NSUInteger cw_byte_search_any(const unsigned char *bytes, NSUInteger length, const char *set);
+
+/**
+ Finds needle in bytes. Candidates are found by scanning for the first byte of needle with
+ memchr(3) or cw_byte_search_any(), which is fast as long as it is not too frequent; when
+ verifying candidates costs too much, the search switches to the Two-Way algorithm of
+ Crochemore and Perrin, which is linear in the worst case.
+
+ @return The offset of the first occurrence of needle, 0 if needle is empty.
+ */
+NSUInteger cw_byte_search(const unsigned char *bytes, NSUInteger length,
+                          const unsigned char *needle, NSUInteger needle_length, BOOL ignore_case);
+
+/**
+ @return YES if both buffers hold the same length bytes, ignoring the case of ASCII letters.
+ */
+BOOL cw_byte_case_equal(const unsigned char *a, const unsigned char *b, NSUInteger length);
+
+NS_ASSUME_NONNULL_END
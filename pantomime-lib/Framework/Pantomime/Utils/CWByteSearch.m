@@ -0,0 +1,371 @@
+//
+//  CWByteSearch.m
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWByteSearch.h"
+
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define CW_BYTE_SEARCH_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define CW_BYTE_SEARCH_NEON 1
+#endif
+
+static inline unsigned char fold(unsigned char c)
+{
+    return (c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c);
+}
+
+static inline BOOL byte_equal(unsigned char a, unsigned char b, BOOL ignore_case)
+{
+    return (a == b || (ignore_case && fold(a) == fold(b)));
+}
+
+static inline BOOL bytes_equal(const unsigned char *a, const unsigned char *b, NSUInteger length,
+                               BOOL ignore_case)
+{
+    return (ignore_case ? cw_byte_case_equal(a, b, length) : memcmp(a, b, length) == 0);
+}
+
+//
+// Finds the first byte in bytes that is in a set of 2 to 4 bytes, padded to 4.
+//
+static NSUInteger search_set(const unsigned char *bytes, NSUInteger length, const unsigned char set[4])
+{
+    NSUInteger i = 0;
+
+#if defined(CW_BYTE_SEARCH_SSE2)
+    __m128i s0 = _mm_set1_epi8((char)set[0]), s1 = _mm_set1_epi8((char)set[1]);
+    __m128i s2 = _mm_set1_epi8((char)set[2]), s3 = _mm_set1_epi8((char)set[3]);
+
+    for (; i + 16 <= length; i += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(bytes + i));
+        __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, s0), _mm_cmpeq_epi8(v, s1)),
+                                 _mm_or_si128(_mm_cmpeq_epi8(v, s2), _mm_cmpeq_epi8(v, s3)));
+        int mask = _mm_movemask_epi8(m);
+
+        if (mask)
+        {
+            return i + __builtin_ctz((unsigned int)mask);
+        }
+    }
+#elif defined(CW_BYTE_SEARCH_NEON)
+    uint8x16_t s0 = vdupq_n_u8(set[0]), s1 = vdupq_n_u8(set[1]);
+    uint8x16_t s2 = vdupq_n_u8(set[2]), s3 = vdupq_n_u8(set[3]);
+
+    for (; i + 16 <= length; i += 16)
+    {
+        uint8x16_t v = vld1q_u8(bytes + i);
+        uint8x16_t m = vorrq_u8(vorrq_u8(vceqq_u8(v, s0), vceqq_u8(v, s1)),
+                                vorrq_u8(vceqq_u8(v, s2), vceqq_u8(v, s3)));
+        // Narrows every byte of the mask to 4 bits, the first match is then at ctz / 4.
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+
+        if (mask)
+        {
+            return i + (__builtin_ctzll(mask) >> 2);
+        }
+    }
+#endif
+
+    for (; i < length; i++)
+    {
+        unsigned char c = bytes[i];
+
+        if (c == set[0] || c == set[1] || c == set[2] || c == set[3])
+        {
+            return i;
+        }
+    }
+
+    return NSNotFound;
+}
+
+//
+// The first byte of needle, or its two cases, as a set for search_set().
+//
+static void first_byte_set(const unsigned char *needle, BOOL ignore_case, unsigned char set[4])
+{
+    unsigned char c = needle[0];
+
+    set[0] = set[1] = set[2] = set[3] = c;
+
+    if (ignore_case && ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')))
+    {
+        set[1] = set[3] = (unsigned char)(c ^ 0x20);
+    }
+}
+
+static inline NSUInteger search_first_byte(const unsigned char *bytes, NSUInteger length,
+                                           const unsigned char set[4])
+{
+    return (set[0] == set[1] ? cw_byte_search_char(bytes, length, set[0]) : search_set(bytes, length, set));
+}
+
+//
+// Two-Way string matching, see M. Crochemore and D. Perrin, "Two-way string-matching",
+// Journal of the ACM 38(3), 1991, and C. Charras and T. Lecroq, "Handbook of Exact String
+// Matching Algorithms".
+//
+static NSInteger maximal_suffix(const unsigned char *x, NSInteger m, BOOL reversed, BOOL ignore_case,
+                                NSInteger *period)
+{
+    NSInteger ms = -1, j = 0, k = 1, p = 1;
+
+    while (j + k < m)
+    {
+        unsigned char a = x[j + k], b = x[ms + k];
+
+        if (ignore_case)
+        {
+            a = fold(a);
+            b = fold(b);
+        }
+
+        if (reversed ? a > b : a < b)
+        {
+            j += k;
+            k = 1;
+            p = j - ms;
+        }
+        else if (a == b)
+        {
+            if (k != p)
+            {
+                k++;
+            }
+            else
+            {
+                j += p;
+                k = 1;
+            }
+        }
+        else
+        {
+            ms = j;
+            j = ms + 1;
+            k = p = 1;
+        }
+    }
+
+    *period = p;
+
+    return ms;
+}
+
+static NSUInteger two_way(const unsigned char *y, NSInteger n, const unsigned char *x, NSInteger m,
+                          BOOL ignore_case)
+{
+    NSInteger ell, per, p, q, i, j, memory;
+
+    i = maximal_suffix(x, m, NO, ignore_case, &p);
+    j = maximal_suffix(x, m, YES, ignore_case, &q);
+
+    if (i > j)
+    {
+        ell = i;
+        per = p;
+    }
+    else
+    {
+        ell = j;
+        per = q;
+    }
+
+    if (bytes_equal(x, x + per, ell + 1, ignore_case))
+    {
+        // The needle is periodic, we remember how much of the period matched.
+        j = 0;
+        memory = -1;
+
+        while (j <= n - m)
+        {
+            i = MAX(ell, memory) + 1;
+            while (i < m && byte_equal(x[i], y[i + j], ignore_case))
+            {
+                i++;
+            }
+
+            if (i >= m)
+            {
+                i = ell;
+                while (i > memory && byte_equal(x[i], y[i + j], ignore_case))
+                {
+                    i--;
+                }
+                if (i <= memory)
+                {
+                    return j;
+                }
+                j += per;
+                memory = m - per - 1;
+            }
+            else
+            {
+                j += i - ell;
+                memory = -1;
+            }
+        }
+    }
+    else
+    {
+        per = MAX(ell + 1, m - ell - 1) + 1;
+        j = 0;
+
+        while (j <= n - m)
+        {
+            i = ell + 1;
+            while (i < m && byte_equal(x[i], y[i + j], ignore_case))
+            {
+                i++;
+            }
+
+            if (i >= m)
+            {
+                i = ell;
+                while (i >= 0 && byte_equal(x[i], y[i + j], ignore_case))
+                {
+                    i--;
+                }
+                if (i < 0)
+                {
+                    return j;
+                }
+                j += per;
+            }
+            else
+            {
+                j += i - ell;
+            }
+        }
+    }
+
+    return NSNotFound;
+}
+
+
+//
+//
+//
+NSUInteger cw_byte_search_char(const unsigned char *bytes, NSUInteger length, unsigned char c)
+{
+    const unsigned char *found = memchr(bytes, c, length);
+
+    return (found ? (NSUInteger)(found - bytes) : NSNotFound);
+}
+
+NSUInteger cw_byte_search_any(const unsigned char *bytes, NSUInteger length, const char *set)
+{
+    NSUInteger count = strlen(set), i;
+    unsigned char padded[4];
+    BOOL table[256];
+
+    if (count == 0)
+    {
+        return NSNotFound;
+    }
+    if (count == 1)
+    {
+        return cw_byte_search_char(bytes, length, (unsigned char)set[0]);
+    }
+    if (count <= 4)
+    {
+        for (i = 0; i < 4; i++)
+        {
+            padded[i] = (unsigned char)set[MIN(i, count - 1)];
+        }
+        return search_set(bytes, length, padded);
+    }
+
+    memset(table, 0, sizeof(table));
+    for (i = 0; i < count; i++)
+    {
+        table[(unsigned char)set[i]] = YES;
+    }
+    for (i = 0; i < length; i++)
+    {
+        if (table[bytes[i]])
+        {
+            return i;
+        }
+    }
+
+    return NSNotFound;
+}
+
+NSUInteger cw_byte_search(const unsigned char *bytes, NSUInteger length,
+                          const unsigned char *needle, NSUInteger needle_length, BOOL ignore_case)
+{
+    NSUInteger i, last, found, work;
+    unsigned char set[4];
+
+    if (needle_length == 0)
+    {
+        return 0;
+    }
+    if (needle_length > length)
+    {
+        return NSNotFound;
+    }
+
+    first_byte_set(needle, ignore_case, set);
+
+    if (needle_length == 1)
+    {
+        return search_first_byte(bytes, length, set);
+    }
+
+    last = length - needle_length;
+    work = 0;
+
+    for (i = 0; i <= last; i++)
+    {
+        found = search_first_byte(bytes + i, last - i + 1, set);
+
+        if (found == NSNotFound)
+        {
+            return NSNotFound;
+        }
+        i += found;
+
+        // The last byte filters out most candidates before comparing the rest.
+        if (byte_equal(bytes[i + needle_length - 1], needle[needle_length - 1], ignore_case) &&
+            bytes_equal(bytes + i + 1, needle + 1, needle_length - 2, ignore_case))
+        {
+            return i;
+        }
+
+        // Too many candidates, like in "aaaa...", would make this quadratic.
+        work += needle_length;
+        if (work > 2 * i + 4096)
+        {
+            found = two_way(bytes + i + 1, (NSInteger)(length - i - 1), needle, (NSInteger)needle_length,
+                            ignore_case);
+            return (found == NSNotFound ? NSNotFound : found + i + 1);
+        }
+    }
+
+    return NSNotFound;
+}
+
+BOOL cw_byte_case_equal(const unsigned char *a, const unsigned char *b, NSUInteger length)
+{
+    NSUInteger i;
+
+    for (i = 0; i < length; i++)
+    {
+        if (a[i] != b[i] && fold(a[i]) != fold(b[i]))
+        {
+            return NO;
+        }
+    }
+
+    return YES;
+}
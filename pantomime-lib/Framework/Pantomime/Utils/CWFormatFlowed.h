@@ -0,0 +1,40 @@
+//
+//  CWFormatFlowed.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The format=flowed codec (RFC 3676) behind -wrapWithLimit:, -quoteWithLevel:wrappingLimit: and
+ -unwrapWithLimit: of NSData. It works on the bytes of the text in a single pass and writes
+ into one output buffer, sized for the text up front. Lines are separated by "\n".
+ */
+
+/**
+ Wraps the lines longer than limit at spaces, keeping a trailing space on every line that
+ continues on the next one (a soft line break). Quoted lines keep their quote depth, lines
+ are space-stuffed when needed.
+
+ @param limit The maximum line length. 0 or more than 998 means 998.
+ */
+NSData *cw_flowed_wrap(const unsigned char *bytes, NSUInteger length, NSUInteger limit);
+
+/**
+ Wraps the text to limit - level and quotes each of its lines level more times.
+
+ @return The quoted text, empty if level is more than limit.
+ */
+NSData *cw_flowed_quote(const unsigned char *bytes, NSUInteger length, NSUInteger level, NSUInteger limit);
+
+/**
+ Joins the flowed lines into paragraphs. Quoted paragraphs are quoted again and wrapped to
+ quote_limit, unquoted ones are left on a single line.
+ */
+NSData *cw_flowed_unwrap(const unsigned char *bytes, NSUInteger length, NSUInteger quote_limit);
+
+NS_ASSUME_NONNULL_END
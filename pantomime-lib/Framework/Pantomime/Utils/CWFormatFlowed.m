@@ -0,0 +1,404 @@
+//
+//  CWFormatFlowed.m
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWFormatFlowed.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static const NSUInteger kMaximumLineLength = 998;
+
+typedef struct
+{
+    unsigned char *bytes;
+    NSUInteger length;
+    NSUInteger capacity;
+} flowed_buffer;
+
+static void buffer_init(flowed_buffer *buffer, NSUInteger capacity)
+{
+    buffer->capacity = MAX(capacity, 64);
+    buffer->bytes = malloc(buffer->capacity);
+    buffer->length = 0;
+}
+
+static void buffer_reserve(flowed_buffer *buffer, NSUInteger length)
+{
+    if (buffer->length + length > buffer->capacity)
+    {
+        buffer->capacity = MAX(buffer->capacity * 2, buffer->length + length);
+        buffer->bytes = realloc(buffer->bytes, buffer->capacity);
+    }
+}
+
+static inline void buffer_append(flowed_buffer *buffer, const unsigned char *bytes, NSUInteger length)
+{
+    buffer_reserve(buffer, length);
+    memcpy(buffer->bytes + buffer->length, bytes, length);
+    buffer->length += length;
+}
+
+static inline void buffer_append_repeated(flowed_buffer *buffer, unsigned char c, NSUInteger count)
+{
+    buffer_reserve(buffer, count);
+    memset(buffer->bytes + buffer->length, c, count);
+    buffer->length += count;
+}
+
+//
+// Hands the bytes of buffer over to the returned data.
+//
+static NSData *buffer_data(flowed_buffer *buffer)
+{
+    if (buffer->length == 0)
+    {
+        free(buffer->bytes);
+        return [NSData data];
+    }
+
+    return [[NSData alloc] initWithBytesNoCopy: buffer->bytes  length: buffer->length  freeWhenDone: YES];
+}
+
+static inline BOOL is_signature_separator(const unsigned char *bytes, NSUInteger length)
+{
+    return length == 3 && memcmp(bytes, "-- ", 3) == 0;
+}
+
+//
+// Writes a line of the wrapped text followed by "\n", quoted level more times if quoting. A
+// quoting prefix is followed by a space unless the line is already quoted. depth is
+// the quote depth of the line, which is space-stuffed if it is quoted, starts with a space,
+// a quote character or "From".
+//
+static void write_line(flowed_buffer *out, BOOL quoting, NSUInteger level, NSUInteger depth,
+                       const unsigned char *bytes, NSUInteger length)
+{
+    BOOL stuffed = (depth ||
+                    (length && (bytes[0] == '>' || bytes[0] == ' ' ||
+                                (length >= 4 && memcmp(bytes, "From", 4) == 0))));
+
+    buffer_reserve(out, level + 1 + depth + 1 + length + 1);
+
+    if (quoting)
+    {
+        buffer_append_repeated(out, '>', level);
+        if (!depth)
+        {
+            buffer_append(out, (const unsigned char *)" ", 1);
+        }
+    }
+
+    buffer_append_repeated(out, '>', depth);
+    if (stuffed)
+    {
+        buffer_append(out, (const unsigned char *)" ", 1);
+    }
+    buffer_append(out, bytes, length);
+    buffer_append(out, (const unsigned char *)"\n", 1);
+}
+
+static void wrap_line(flowed_buffer *out, const unsigned char *line, NSUInteger length,
+                      NSUInteger limit, BOOL quoting, NSUInteger level)
+{
+    NSUInteger depth, i, j, k, split;
+
+    // We compute the quote depth and remove the leading whitespace if any
+    for (depth = 0; depth < length && line[depth] == '>'; depth++);
+    i = depth;
+
+    if (depth && i < length && line[i] == ' ')
+    {
+        i++;
+    }
+    line += i;
+    length -= i;
+
+    // If the line is NOT the signature separator, we remove the trailing space(s)
+    if (!is_signature_separator(line, length))
+    {
+        for (j = length; j > 0 && line[j-1] == ' '; j--);
+        if (depth && j < length)
+        {
+            // If line is quoted, we preserve a whitespace for the soft-break
+            j++;
+        }
+        length = j;
+    }
+
+    if (is_signature_separator(line, length) || depth + 1 + length <= limit)
+    {
+        write_line(out, quoting, level, depth, line, length);
+        return;
+    }
+
+    // We look for the right place to split the line
+    for (j = 0; j < length;)
+    {
+        if (length - j + depth + 1 < limit)
+        {
+            split = length;
+        }
+        else
+        {
+            split = j;
+
+            // We search for the last whitespace before the limit
+            for (k = j; k < length && k - j + depth + 1 < limit; k++)
+            {
+                if (line[k] == ' ')
+                {
+                    split = k;
+                }
+            }
+
+            /*
+             No good spot; include the entire next word. This isn't really
+             optimal, but the alternative is to split the word, and that
+             would be horribly ugly. Also, it'd mean that deeply quoted
+             text might appear with one letter on each row, which is even
+             uglier and means that the receiver won't be able to
+             reconstruct the text.
+
+             A proper fix would be to have both parameters for a 'soft'
+             line limit that we _try_ to break before, and a 'hard' line
+             limit that specifies an actual hard limit of a protocol or
+             something. In NNTP, the values would be 72 and 998
+             respectively. This means that text quoted 70 levels (and yes,
+             I have seen such posts) will appear with one unbroken word on
+             each line (as long as the word is shorter than 928
+             characters). This is still ugly, but:
+
+             a. invalid (protocol-wise) lines will never be generated
+                (unless something's quoted >998 levels)
+
+             b. a MIME decoder that handles format=flowed will be able to
+             reconstruct the text properly
+
+             (Additionally, it might turn out to be useful to have a lower
+             limit on wrapping length, eg. 20. If the effective line
+             length is shorter than this, wrap to quote-depth+soft-limit
+             (so eg. text quoted 60 times would be wrapped at 60+72
+             characters instead of 72). This wouldn't make any difference
+             on flowed capable MIME decoders, but might turn out to look
+             better when viewed with non-flowed handling programs.
+             Hopefully, such deeply quoted text won't be common enough to
+             be worth the trouble, so people with non-flowed capable
+             software will simply have to live with the ugly posts in
+             those cases.)
+             */
+            if (split == j)
+            {
+                // No whitespace found before the limit;
+                // continue farther until a whitespace or the last character of the line
+                for (; k < length && line[k] != ' '; k++);
+                split = k;
+            }
+        }
+
+        // Since the line will be splitted, we must keep a whitespace for
+        // the soft-line break
+        if (split < length)
+        {
+            split++;
+        }
+
+        write_line(out, quoting, level, depth, line + j, split - j);
+        j = split;
+    }
+}
+
+//
+// Wraps the lines of bytes, quoting them level more times if quoting. Does not end the
+// last line.
+//
+static void wrap(flowed_buffer *out, const unsigned char *bytes, NSUInteger length,
+                 NSUInteger limit, BOOL quoting, NSUInteger level)
+{
+    NSUInteger start = out->length, i = 0;
+
+    if (limit == 0 || limit > kMaximumLineLength)
+    {
+        limit = kMaximumLineLength;
+    }
+
+    if (length)
+    {
+        for (;;)
+        {
+            const unsigned char *eol = memchr(bytes + i, '\n', length - i);
+            NSUInteger end = (eol ? (NSUInteger)(eol - bytes) : length);
+
+            wrap_line(out, bytes + i, end - i, limit, quoting, level);
+
+            if (!eol)
+            {
+                break;
+            }
+            i = end + 1;
+        }
+    }
+
+    if (out->length > start)
+    {
+        out->length--;
+    }
+    else if (quoting)
+    {
+        // The quoted text has a single empty line.
+        buffer_append_repeated(out, '>', level);
+        buffer_append(out, (const unsigned char *)" ", 1);
+    }
+}
+
+static void quote(flowed_buffer *out, const unsigned char *bytes, NSUInteger length,
+                  NSUInteger level, NSUInteger limit)
+{
+    if (level <= limit)
+    {
+        wrap(out, bytes, length, limit - level, YES, level);
+    }
+}
+
+//
+// Writes a paragraph of unwrapped text, quoted depth times, followed by "\n".
+//
+static void write_paragraph(flowed_buffer *out, const unsigned char *bytes, NSUInteger length,
+                            NSUInteger depth, NSUInteger quote_limit)
+{
+    if (depth)
+    {
+        quote(out, bytes, length, depth, quote_limit);
+    }
+    else
+    {
+        buffer_append(out, bytes, length);
+    }
+    buffer_append(out, (const unsigned char *)"\n", 1);
+}
+
+
+//
+//
+//
+NSData *cw_flowed_wrap(const unsigned char *bytes, NSUInteger length, NSUInteger limit)
+{
+    flowed_buffer out;
+
+    if (length == 0)
+    {
+        return [NSData data];
+    }
+
+    buffer_init(&out, length + length / 16);
+    wrap(&out, bytes, length, limit, NO, 0);
+
+    return buffer_data(&out);
+}
+
+NSData *cw_flowed_quote(const unsigned char *bytes, NSUInteger length, NSUInteger level, NSUInteger limit)
+{
+    flowed_buffer out;
+
+    if (level > limit)
+    {
+        return [NSData data];
+    }
+
+    buffer_init(&out, length + length / 16 + (length / 32 + 1) * (level + 1));
+    quote(&out, bytes, length, level, limit);
+
+    return buffer_data(&out);
+}
+
+NSData *cw_flowed_unwrap(const unsigned char *bytes, NSUInteger length, NSUInteger quote_limit)
+{
+    NSUInteger i, quote_depth, line_quote_depth, line_start;
+    flowed_buffer out, paragraph;
+    BOOL is_flowed;
+
+    buffer_init(&out, length + length / 16);
+    buffer_init(&paragraph, 256);
+    quote_depth = NSNotFound;
+
+    for (i = 0; i < length; i++)
+    {
+        const unsigned char *eol, *line;
+        NSUInteger line_length;
+
+        // We analyse the quote depth of the current line
+        for (line_quote_depth = 0; i < length && bytes[i] == '>'; i++)
+        {
+            line_quote_depth++;
+        }
+
+        // If the current quote depth is not defined, set it to quote depth of current line
+        if (quote_depth == NSNotFound)
+        {
+            quote_depth = line_quote_depth;
+        }
+
+        // We verify if the line has been space-stuffed
+        if (i < length && bytes[i] == ' ')
+        {
+            i++;
+        }
+        line_start = i;
+
+        eol = memchr(bytes + i, '\n', length - i);
+        i = (eol ? (NSUInteger)(eol - bytes) : length);
+        line = bytes + line_start;
+        line_length = i - line_start;
+
+        // We verify if the line ends with a soft break, usenet signatures excepted
+        is_flowed = (line_length > 0 && line[line_length-1] == ' ' &&
+                     !is_signature_separator(line, line_length));
+
+        if (is_flowed && quote_depth == line_quote_depth)
+        {
+            // The current line is flowed, we append it to the paragraph
+            buffer_append(&paragraph, line, line_length);
+        }
+        else if (is_flowed)
+        {
+            // The current line is flowed but has mis-matched quoting: it starts a new paragraph
+            write_paragraph(&out, paragraph.bytes, paragraph.length, quote_depth, quote_limit);
+
+            paragraph.length = 0;
+            buffer_append(&paragraph, line, line_length);
+            quote_depth = line_quote_depth;
+        }
+        else if (quote_depth == line_quote_depth)
+        {
+            // The line is fixed, it ends the paragraph
+            buffer_append(&paragraph, line, line_length);
+            write_paragraph(&out, paragraph.bytes, paragraph.length, quote_depth, quote_limit);
+
+            paragraph.length = 0;
+            quote_depth = NSNotFound;
+        }
+        else
+        {
+            // The line is fixed but has mis-matched quoting: it ends the paragraph
+            // and is written on its own
+            write_paragraph(&out, paragraph.bytes, paragraph.length, quote_depth, quote_limit);
+            write_paragraph(&out, line, line_length, line_quote_depth, quote_limit);
+
+            paragraph.length = 0;
+            quote_depth = NSNotFound;
+        }
+    }
+
+    // We must handle flowed lines that don't have a fixed line break at the end of the message
+    if (paragraph.length)
+    {
+        write_paragraph(&out, paragraph.bytes, paragraph.length, quote_depth, quote_limit);
+    }
+
+    free(paragraph.bytes);
+
+    return buffer_data(&out);
+}
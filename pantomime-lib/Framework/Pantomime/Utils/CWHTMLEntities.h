@@ -0,0 +1,2330 @@
+//
+//  CWHTMLEntities.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+//  Generated by Tools/gen-html-entities/gen-html-entities.py, do not edit.
+//
+
+#define CW_HTML_ENTITY_COUNT 2125
+
+typedef struct
+{
+    const char *name;
+    /** The UTF-8 encoded characters. */
+    const char *value;
+    uint8_t name_length;
+    uint8_t value_length;
+    /** YES if the reference may omit its ";", like "&amp" */
+    BOOL legacy;
+} cw_html_entity;
+
+static const cw_html_entity cw_html_entities[CW_HTML_ENTITY_COUNT] = {
+    { "Tcedil", "\xc5\xa2", 6, 2, NO },
+    { "updownarrow", "\xe2\x86\x95", 11, 3, NO },
+    { "Fopf", "\xf0\x9d\x94\xbd", 4, 4, NO },
+    { "curvearrowright", "\xe2\x86\xb7", 15, 3, NO },
+    { "kjcy", "\xd1\x9c", 4, 2, NO },
+    { "ufisht", "\xe2\xa5\xbe", 6, 3, NO },
+    { "divonx", "\xe2\x8b\x87", 6, 3, NO },
+    { "starf", "\xe2\x98\x85", 5, 3, NO },
+    { "Otilde", "\xc3\x95", 6, 2, YES },
+    { "eqcirc", "\xe2\x89\x96", 6, 3, NO },
+    { "subdot", "\xe2\xaa\xbd", 6, 3, NO },
+    { "gtrapprox", "\xe2\xaa\x86", 9, 3, NO },
+    { "amp", "&", 3, 1, YES },
+    { "doteqdot", "\xe2\x89\x91", 8, 3, NO },
+    { "equest", "\xe2\x89\x9f", 6, 3, NO },
+    { "racute", "\xc5\x95", 6, 2, NO },
+    { "sqcup", "\xe2\x8a\x94", 5, 3, NO },
+    { "edot", "\xc4\x97", 4, 2, NO },
+    { "Sqrt", "\xe2\x88\x9a", 4, 3, NO },
+    { "therefore", "\xe2\x88\xb4", 9, 3, NO },
+    { "Tcaron", "\xc5\xa4", 6, 2, NO },
+    { "supdsub", "\xe2\xab\x98", 7, 3, NO },
+    { "multimap", "\xe2\x8a\xb8", 8, 3, NO },
+    { "DownTeeArrow", "\xe2\x86\xa7", 12, 3, NO },
+    { "coprod", "\xe2\x88\x90", 6, 3, NO },
+    { "circledast", "\xe2\x8a\x9b", 10, 3, NO },
+    { "lesdotor", "\xe2\xaa\x83", 8, 3, NO },
+    { "bot", "\xe2\x8a\xa5", 3, 3, NO },
+    { "leftrightharpoons", "\xe2\x87\x8b", 17, 3, NO },
+    { "dotsquare", "\xe2\x8a\xa1", 9, 3, NO },
+    { "complement", "\xe2\x88\x81", 10, 3, NO },
+    { "oscr", "\xe2\x84\xb4", 4, 3, NO },
+    { "Zopf", "\xe2\x84\xa4", 4, 3, NO },
+    { "CircleTimes", "\xe2\x8a\x97", 11, 3, NO },
+    { "vnsup", "\xe2\x8a\x83\xe2\x83\x92", 5, 6, NO },
+    { "Gammad", "\xcf\x9c", 6, 2, NO },
+    { "uparrow", "\xe2\x86\x91", 7, 3, NO },
+    { "Sum", "\xe2\x88\x91", 3, 3, NO },
+    { "Pi", "\xce\xa0", 2, 2, NO },
+    { "LeftArrowBar", "\xe2\x87\xa4", 12, 3, NO },
+    { "lbrack", "[", 6, 1, NO },
+    { "Igrave", "\xc3\x8c", 6, 2, YES },
+    { "ll", "\xe2\x89\xaa", 2, 3, NO },
+    { "rdquor", "\xe2\x80\x9d", 6, 3, NO },
+    { "SucceedsSlantEqual", "\xe2\x89\xbd", 18, 3, NO },
+    { "Beta", "\xce\x92", 4, 2, NO },
+    { "uogon", "\xc5\xb3", 5, 2, NO },
+    { "Ubrcy", "\xd0\x8e", 5, 2, NO },
+    { "mapstoleft", "\xe2\x86\xa4", 10, 3, NO },
+    { "gnap", "\xe2\xaa\x8a", 4, 3, NO },
+    { "LeftDownVector", "\xe2\x87\x83", 14, 3, NO },
+    { "boxhD", "\xe2\x95\xa5", 5, 3, NO },
+    { "Bfr", "\xf0\x9d\x94\x85", 3, 4, NO },
+    { "boxVL", "\xe2\x95\xa3", 5, 3, NO },
+    { "Lscr", "\xe2\x84\x92", 4, 3, NO },
+    { "rAarr", "\xe2\x87\x9b", 5, 3, NO },
+    { "InvisibleComma", "\xe2\x81\xa3", 14, 3, NO },
+    { "DiacriticalDot", "\xcb\x99", 14, 2, NO },
+    { "cudarrl", "\xe2\xa4\xb8", 7, 3, NO },
+    { "barvee", "\xe2\x8a\xbd", 6, 3, NO },
+    { "hkswarow", "\xe2\xa4\xa6", 8, 3, NO },
+    { "opar", "\xe2\xa6\xb7", 4, 3, NO },
+    { "doteq", "\xe2\x89\x90", 5, 3, NO },
+    { "uharr", "\xe2\x86\xbe", 5, 3, NO },
+    { "circledR", "\xc2\xae", 8, 2, NO },
+    { "ruluhar", "\xe2\xa5\xa8", 7, 3, NO },
+    { "Square", "\xe2\x96\xa1", 6, 3, NO },
+    { "ang", "\xe2\x88\xa0", 3, 3, NO },
+    { "Updownarrow", "\xe2\x87\x95", 11, 3, NO },
+    { "nsmid", "\xe2\x88\xa4", 5, 3, NO },
+    { "Congruent", "\xe2\x89\xa1", 9, 3, NO },
+    { "simeq", "\xe2\x89\x83", 5, 3, NO },
+    { "sstarf", "\xe2\x8b\x86", 6, 3, NO },
+    { "heartsuit", "\xe2\x99\xa5", 9, 3, NO },
+    { "RightTee", "\xe2\x8a\xa2", 8, 3, NO },
+    { "UnderBar", "_", 8, 1, NO },
+    { "RightTriangleEqual", "\xe2\x8a\xb5", 18, 3, NO },
+    { "MediumSpace", "\xe2\x81\x9f", 11, 3, NO },
+    { "prnsim", "\xe2\x8b\xa8", 6, 3, NO },
+    { "int", "\xe2\x88\xab", 3, 3, NO },
+    { "CloseCurlyQuote", "\xe2\x80\x99", 15, 3, NO },
+    { "prec", "\xe2\x89\xba", 4, 3, NO },
+    { "cwconint", "\xe2\x88\xb2", 8, 3, NO },
+    { "rBarr", "\xe2\xa4\x8f", 5, 3, NO },
+    { "lnap", "\xe2\xaa\x89", 4, 3, NO },
+    { "nldr", "\xe2\x80\xa5", 4, 3, NO },
+    { "varsupsetneqq", "\xe2\xab\x8c\xef\xb8\x80", 13, 6, NO },
+    { "nharr", "\xe2\x86\xae", 5, 3, NO },
+    { "elsdot", "\xe2\xaa\x97", 6, 3, NO },
+    { "alpha", "\xce\xb1", 5, 2, NO },
+    { "Nopf", "\xe2\x84\x95", 4, 3, NO },
+    { "searrow", "\xe2\x86\x98", 7, 3, NO },
+    { "ne", "\xe2\x89\xa0", 2, 3, NO },
+    { "Ofr", "\xf0\x9d\x94\x92", 3, 4, NO },
+    { "gap", "\xe2\xaa\x86", 3, 3, NO },
+    { "NotRightTriangle", "\xe2\x8b\xab", 16, 3, NO },
+    { "djcy", "\xd1\x92", 4, 2, NO },
+    { "circledS", "\xe2\x93\x88", 8, 3, NO },
+    { "yscr", "\xf0\x9d\x93\x8e", 4, 4, NO },
+    { "bemptyv", "\xe2\xa6\xb0", 7, 3, NO },
+    { "uuml", "\xc3\xbc", 4, 2, YES },
+    { "escr", "\xe2\x84\xaf", 4, 3, NO },
+    { "bsolhsub", "\xe2\x9f\x88", 8, 3, NO },
+    { "aogon", "\xc4\x85", 5, 2, NO },
+    { "because", "\xe2\x88\xb5", 7, 3, NO },
+    { "NotReverseElement", "\xe2\x88\x8c", 17, 3, NO },
+    { "zscr", "\xf0\x9d\x93\x8f", 4, 4, NO },
+    { "lparlt", "\xe2\xa6\x93", 6, 3, NO },
+    { "napE", "\xe2\xa9\xb0\xcc\xb8", 4, 5, NO },
+    { "nsupseteq", "\xe2\x8a\x89", 9, 3, NO },
+    { "backsim", "\xe2\x88\xbd", 7, 3, NO },
+    { "frac13", "\xe2\x85\x93", 6, 3, NO },
+    { "Verbar", "\xe2\x80\x96", 6, 3, NO },
+    { "Fouriertrf", "\xe2\x84\xb1", 10, 3, NO },
+    { "Vert", "\xe2\x80\x96", 4, 3, NO },
+    { "homtht", "\xe2\x88\xbb", 6, 3, NO },
+    { "Barwed", "\xe2\x8c\x86", 6, 3, NO },
+    { "Rarr", "\xe2\x86\xa0", 4, 3, NO },
+    { "varsupsetneq", "\xe2\x8a\x8b\xef\xb8\x80", 12, 6, NO },
+    { "longleftarrow", "\xe2\x9f\xb5", 13, 3, NO },
+    { "NotTildeEqual", "\xe2\x89\x84", 13, 3, NO },
+    { "pfr", "\xf0\x9d\x94\xad", 3, 4, NO },
+    { "NotGreaterFullEqual", "\xe2\x89\xa7\xcc\xb8", 19, 5, NO },
+    { "Qopf", "\xe2\x84\x9a", 4, 3, NO },
+    { "ccedil", "\xc3\xa7", 6, 2, YES },
+    { "mopf", "\xf0\x9d\x95\x9e", 4, 4, NO },
+    { "angmsdab", "\xe2\xa6\xa9", 8, 3, NO },
+    { "Mopf", "\xf0\x9d\x95\x84", 4, 4, NO },
+    { "ogon", "\xcb\x9b", 4, 2, NO },
+    { "Zcaron", "\xc5\xbd", 6, 2, NO },
+    { "epsiv", "\xcf\xb5", 5, 2, NO },
+    { "leqq", "\xe2\x89\xa6", 4, 3, NO },
+    { "nang", "\xe2\x88\xa0\xe2\x83\x92", 4, 6, NO },
+    { "lfisht", "\xe2\xa5\xbc", 6, 3, NO },
+    { "Ncy", "\xd0\x9d", 3, 2, NO },
+    { "chcy", "\xd1\x87", 4, 2, NO },
+    { "Product", "\xe2\x88\x8f", 7, 3, NO },
+    { "swarrow", "\xe2\x86\x99", 7, 3, NO },
+    { "cwint", "\xe2\x88\xb1", 5, 3, NO },
+    { "cupcap", "\xe2\xa9\x86", 6, 3, NO },
+    { "ltrPar", "\xe2\xa6\x96", 6, 3, NO },
+    { "lates", "\xe2\xaa\xad\xef\xb8\x80", 5, 6, NO },
+    { "Sscr", "\xf0\x9d\x92\xae", 4, 4, NO },
+    { "CupCap", "\xe2\x89\x8d", 6, 3, NO },
+    { "varpi", "\xcf\x96", 5, 2, NO },
+    { "square", "\xe2\x96\xa1", 6, 3, NO },
+    { "lrhar", "\xe2\x87\x8b", 5, 3, NO },
+    { "RightAngleBracket", "\xe2\x9f\xa9", 17, 3, NO },
+    { "lesseqqgtr", "\xe2\xaa\x8b", 10, 3, NO },
+    { "intlarhk", "\xe2\xa8\x97", 8, 3, NO },
+    { "gg", "\xe2\x89\xab", 2, 3, NO },
+    { "Odblac", "\xc5\x90", 6, 2, NO },
+    { "lsqb", "[", 4, 1, NO },
+    { "reg", "\xc2\xae", 3, 2, YES },
+    { "ovbar", "\xe2\x8c\xbd", 5, 3, NO },
+    { "bbrk", "\xe2\x8e\xb5", 4, 3, NO },
+    { "eqvparsl", "\xe2\xa7\xa5", 8, 3, NO },
+    { "Gt", "\xe2\x89\xab", 2, 3, NO },
+    { "Imacr", "\xc4\xaa", 5, 2, NO },
+    { "boxDL", "\xe2\x95\x97", 5, 3, NO },
+    { "Ouml", "\xc3\x96", 4, 2, YES },
+    { "IOcy", "\xd0\x81", 4, 2, NO },
+    { "lowbar", "_", 6, 1, NO },
+    { "ccups", "\xe2\xa9\x8c", 5, 3, NO },
+    { "geq", "\xe2\x89\xa5", 3, 3, NO },
+    { "boxvH", "\xe2\x95\xaa", 5, 3, NO },
+    { "radic", "\xe2\x88\x9a", 5, 3, NO },
+    { "boxtimes", "\xe2\x8a\xa0", 8, 3, NO },
+    { "Emacr", "\xc4\x92", 5, 2, NO },
+    { "ucy", "\xd1\x83", 3, 2, NO },
+    { "notinE", "\xe2\x8b\xb9\xcc\xb8", 6, 5, NO },
+    { "ntlg", "\xe2\x89\xb8", 4, 3, NO },
+    { "cuvee", "\xe2\x8b\x8e", 5, 3, NO },
+    { "nLt", "\xe2\x89\xaa\xe2\x83\x92", 3, 6, NO },
+    { "nbump", "\xe2\x89\x8e\xcc\xb8", 5, 5, NO },
+    { "Element", "\xe2\x88\x88", 7, 3, NO },
+    { "ncongdot", "\xe2\xa9\xad\xcc\xb8", 8, 5, NO },
+    { "xrarr", "\xe2\x9f\xb6", 5, 3, NO },
+    { "Wscr", "\xf0\x9d\x92\xb2", 4, 4, NO },
+    { "leftharpoondown", "\xe2\x86\xbd", 15, 3, NO },
+    { "cudarrr", "\xe2\xa4\xb5", 7, 3, NO },
+    { "nopf", "\xf0\x9d\x95\x9f", 4, 4, NO },
+    { "tprime", "\xe2\x80\xb4", 6, 3, NO },
+    { "LeftVectorBar", "\xe2\xa5\x92", 13, 3, NO },
+    { "iiint", "\xe2\x88\xad", 5, 3, NO },
+    { "TScy", "\xd0\xa6", 4, 2, NO },
+    { "boxDl", "\xe2\x95\x96", 5, 3, NO },
+    { "orarr", "\xe2\x86\xbb", 5, 3, NO },
+    { "napprox", "\xe2\x89\x89", 7, 3, NO },
+    { "plus", "+", 4, 1, NO },
+    { "Omicron", "\xce\x9f", 7, 2, NO },
+    { "downarrow", "\xe2\x86\x93", 9, 3, NO },
+    { "notnivc", "\xe2\x8b\xbd", 7, 3, NO },
+    { "seswar", "\xe2\xa4\xa9", 6, 3, NO },
+    { "LeftTriangle", "\xe2\x8a\xb2", 12, 3, NO },
+    { "Lacute", "\xc4\xb9", 6, 2, NO },
+    { "dHar", "\xe2\xa5\xa5", 4, 3, NO },
+    { "npar", "\xe2\x88\xa6", 4, 3, NO },
+    { "scaron", "\xc5\xa1", 6, 2, NO },
+    { "nshortparallel", "\xe2\x88\xa6", 14, 3, NO },
+    { "lnapprox", "\xe2\xaa\x89", 8, 3, NO },
+    { "LeftTee", "\xe2\x8a\xa3", 7, 3, NO },
+    { "rcaron", "\xc5\x99", 6, 2, NO },
+    { "imath", "\xc4\xb1", 5, 2, NO },
+    { "curarrm", "\xe2\xa4\xbc", 7, 3, NO },
+    { "angmsdag", "\xe2\xa6\xae", 8, 3, NO },
+    { "Ecirc", "\xc3\x8a", 5, 2, YES },
+    { "compfn", "\xe2\x88\x98", 6, 3, NO },
+    { "mu", "\xce\xbc", 2, 2, NO },
+    { "sung", "\xe2\x99\xaa", 4, 3, NO },
+    { "npr", "\xe2\x8a\x80", 3, 3, NO },
+    { "imof", "\xe2\x8a\xb7", 4, 3, NO },
+    { "lsquo", "\xe2\x80\x98", 5, 3, NO },
+    { "Uparrow", "\xe2\x87\x91", 7, 3, NO },
+    { "bigtriangledown", "\xe2\x96\xbd", 15, 3, NO },
+    { "GreaterLess", "\xe2\x89\xb7", 11, 3, NO },
+    { "slarr", "\xe2\x86\x90", 5, 3, NO },
+    { "aacute", "\xc3\xa1", 6, 2, YES },
+    { "OpenCurlyQuote", "\xe2\x80\x98", 14, 3, NO },
+    { "midcir", "\xe2\xab\xb0", 6, 3, NO },
+    { "copf", "\xf0\x9d\x95\x94", 4, 4, NO },
+    { "lharul", "\xe2\xa5\xaa", 6, 3, NO },
+    { "boxVH", "\xe2\x95\xac", 5, 3, NO },
+    { "pre", "\xe2\xaa\xaf", 3, 3, NO },
+    { "rbrksld", "\xe2\xa6\x8e", 7, 3, NO },
+    { "uHar", "\xe2\xa5\xa3", 4, 3, NO },
+    { "gla", "\xe2\xaa\xa5", 3, 3, NO },
+    { "Yuml", "\xc5\xb8", 4, 2, NO },
+    { "mscr", "\xf0\x9d\x93\x82", 4, 4, NO },
+    { "phiv", "\xcf\x95", 4, 2, NO },
+    { "ubreve", "\xc5\xad", 6, 2, NO },
+    { "yacute", "\xc3\xbd", 6, 2, YES },
+    { "dotminus", "\xe2\x88\xb8", 8, 3, NO },
+    { "bigvee", "\xe2\x8b\x81", 6, 3, NO },
+    { "succ", "\xe2\x89\xbb", 4, 3, NO },
+    { "jscr", "\xf0\x9d\x92\xbf", 4, 4, NO },
+    { "QUOT", "\x22", 4, 1, YES },
+    { "LowerRightArrow", "\xe2\x86\x98", 15, 3, NO },
+    { "VeryThinSpace", "\xe2\x80\x8a", 13, 3, NO },
+    { "rtri", "\xe2\x96\xb9", 4, 3, NO },
+    { "bullet", "\xe2\x80\xa2", 6, 3, NO },
+    { "pcy", "\xd0\xbf", 3, 2, NO },
+    { "Scy", "\xd0\xa1", 3, 2, NO },
+    { "NotLeftTriangleBar", "\xe2\xa7\x8f\xcc\xb8", 18, 5, NO },
+    { "Uogon", "\xc5\xb2", 5, 2, NO },
+    { "map", "\xe2\x86\xa6", 3, 3, NO },
+    { "UpTeeArrow", "\xe2\x86\xa5", 10, 3, NO },
+    { "pm", "\xc2\xb1", 2, 2, NO },
+    { "RightTeeArrow", "\xe2\x86\xa6", 13, 3, NO },
+    { "hksearow", "\xe2\xa4\xa5", 8, 3, NO },
+    { "UnderBracket", "\xe2\x8e\xb5", 12, 3, NO },
+    { "xoplus", "\xe2\xa8\x81", 6, 3, NO },
+    { "ExponentialE", "\xe2\x85\x87", 12, 3, NO },
+    { "gopf", "\xf0\x9d\x95\x98", 4, 4, NO },
+    { "PlusMinus", "\xc2\xb1", 9, 2, NO },
+    { "VerticalBar", "\xe2\x88\xa3", 11, 3, NO },
+    { "uwangle", "\xe2\xa6\xa7", 7, 3, NO },
+    { "lesseqgtr", "\xe2\x8b\x9a", 9, 3, NO },
+    { "bump", "\xe2\x89\x8e", 4, 3, NO },
+    { "nrtri", "\xe2\x8b\xab", 5, 3, NO },
+    { "nhpar", "\xe2\xab\xb2", 5, 3, NO },
+    { "latail", "\xe2\xa4\x99", 6, 3, NO },
+    { "ntilde", "\xc3\xb1", 6, 2, YES },
+    { "uArr", "\xe2\x87\x91", 4, 3, NO },
+    { "Pcy", "\xd0\x9f", 3, 2, NO },
+    { "Pr", "\xe2\xaa\xbb", 2, 3, NO },
+    { "NotLessEqual", "\xe2\x89\xb0", 12, 3, NO },
+    { "Ffr", "\xf0\x9d\x94\x89", 3, 4, NO },
+    { "ecir", "\xe2\x89\x96", 4, 3, NO },
+    { "Aacute", "\xc3\x81", 6, 2, YES },
+    { "DoubleVerticalBar", "\xe2\x88\xa5", 17, 3, NO },
+    { "varsubsetneqq", "\xe2\xab\x8b\xef\xb8\x80", 13, 6, NO },
+    { "ReverseElement", "\xe2\x88\x8b", 14, 3, NO },
+    { "searhk", "\xe2\xa4\xa5", 6, 3, NO },
+    { "NotVerticalBar", "\xe2\x88\xa4", 14, 3, NO },
+    { "Kfr", "\xf0\x9d\x94\x8e", 3, 4, NO },
+    { "smte", "\xe2\xaa\xac", 4, 3, NO },
+    { "mapstoup", "\xe2\x86\xa5", 8, 3, NO },
+    { "dfisht", "\xe2\xa5\xbf", 6, 3, NO },
+    { "prnE", "\xe2\xaa\xb5", 4, 3, NO },
+    { "ntrianglelefteq", "\xe2\x8b\xac", 15, 3, NO },
+    { "straightepsilon", "\xcf\xb5", 15, 2, NO },
+    { "NegativeMediumSpace", "\xe2\x80\x8b", 19, 3, NO },
+    { "ltcir", "\xe2\xa9\xb9", 5, 3, NO },
+    { "Escr", "\xe2\x84\xb0", 4, 3, NO },
+    { "Zdot", "\xc5\xbb", 4, 2, NO },
+    { "lesg", "\xe2\x8b\x9a\xef\xb8\x80", 4, 6, NO },
+    { "lAarr", "\xe2\x87\x9a", 5, 3, NO },
+    { "ddarr", "\xe2\x87\x8a", 5, 3, NO },
+    { "jcy", "\xd0\xb9", 3, 2, NO },
+    { "Oslash", "\xc3\x98", 6, 2, YES },
+    { "acE", "\xe2\x88\xbe\xcc\xb3", 3, 5, NO },
+    { "NegativeVeryThinSpace", "\xe2\x80\x8b", 21, 3, NO },
+    { "subrarr", "\xe2\xa5\xb9", 7, 3, NO },
+    { "RightDownVectorBar", "\xe2\xa5\x95", 18, 3, NO },
+    { "supsub", "\xe2\xab\x94", 6, 3, NO },
+    { "smid", "\xe2\x88\xa3", 4, 3, NO },
+    { "gjcy", "\xd1\x93", 4, 2, NO },
+    { "Subset", "\xe2\x8b\x90", 6, 3, NO },
+    { "bigoplus", "\xe2\xa8\x81", 8, 3, NO },
+    { "ap", "\xe2\x89\x88", 2, 3, NO },
+    { "rightleftharpoons", "\xe2\x87\x8c", 17, 3, NO },
+    { "scy", "\xd1\x81", 3, 2, NO },
+    { "oast", "\xe2\x8a\x9b", 4, 3, NO },
+    { "Bumpeq", "\xe2\x89\x8e", 6, 3, NO },
+    { "NotElement", "\xe2\x88\x89", 10, 3, NO },
+    { "eparsl", "\xe2\xa7\xa3", 6, 3, NO },
+    { "cdot", "\xc4\x8b", 4, 2, NO },
+    { "ohbar", "\xe2\xa6\xb5", 5, 3, NO },
+    { "piv", "\xcf\x96", 3, 2, NO },
+    { "nsupseteqq", "\xe2\xab\x86\xcc\xb8", 10, 5, NO },
+    { "Implies", "\xe2\x87\x92", 7, 3, NO },
+    { "cap", "\xe2\x88\xa9", 3, 3, NO },
+    { "ShortRightArrow", "\xe2\x86\x92", 15, 3, NO },
+    { "Intersection", "\xe2\x8b\x82", 12, 3, NO },
+    { "zcaron", "\xc5\xbe", 6, 2, NO },
+    { "copysr", "\xe2\x84\x97", 6, 3, NO },
+    { "itilde", "\xc4\xa9", 6, 2, NO },
+    { "rbrke", "\xe2\xa6\x8c", 5, 3, NO },
+    { "lfr", "\xf0\x9d\x94\xa9", 3, 4, NO },
+    { "OpenCurlyDoubleQuote", "\xe2\x80\x9c", 20, 3, NO },
+    { "xutri", "\xe2\x96\xb3", 5, 3, NO },
+    { "aleph", "\xe2\x84\xb5", 5, 3, NO },
+    { "equals", "=", 6, 1, NO },
+    { "xscr", "\xf0\x9d\x93\x8d", 4, 4, NO },
+    { "RightTriangleBar", "\xe2\xa7\x90", 16, 3, NO },
+    { "kfr", "\xf0\x9d\x94\xa8", 3, 4, NO },
+    { "larrhk", "\xe2\x86\xa9", 6, 3, NO },
+    { "ulcorn", "\xe2\x8c\x9c", 6, 3, NO },
+    { "nsime", "\xe2\x89\x84", 5, 3, NO },
+    { "DoubleLeftRightArrow", "\xe2\x87\x94", 20, 3, NO },
+    { "zcy", "\xd0\xb7", 3, 2, NO },
+    { "Kopf", "\xf0\x9d\x95\x82", 4, 4, NO },
+    { "nbsp", "\xc2\xa0", 4, 2, YES },
+    { "lmidot", "\xc5\x80", 6, 2, NO },
+    { "Vdashl", "\xe2\xab\xa6", 6, 3, NO },
+    { "odsold", "\xe2\xa6\xbc", 6, 3, NO },
+    { "blacklozenge", "\xe2\xa7\xab", 12, 3, NO },
+    { "lat", "\xe2\xaa\xab", 3, 3, NO },
+    { "wedge", "\xe2\x88\xa7", 5, 3, NO },
+    { "boxuR", "\xe2\x95\x98", 5, 3, NO },
+    { "phi", "\xcf\x86", 3, 2, NO },
+    { "times", "\xc3\x97", 5, 2, YES },
+    { "precneqq", "\xe2\xaa\xb5", 8, 3, NO },
+    { "prop", "\xe2\x88\x9d", 4, 3, NO },
+    { "rlarr", "\xe2\x87\x84", 5, 3, NO },
+    { "tscy", "\xd1\x86", 4, 2, NO },
+    { "lessdot", "\xe2\x8b\x96", 7, 3, NO },
+    { "semi", ";", 4, 1, NO },
+    { "imagline", "\xe2\x84\x90", 8, 3, NO },
+    { "HumpEqual", "\xe2\x89\x8f", 9, 3, NO },
+    { "Lsh", "\xe2\x86\xb0", 3, 3, NO },
+    { "bigodot", "\xe2\xa8\x80", 7, 3, NO },
+    { "ClockwiseContourIntegral", "\xe2\x88\xb2", 24, 3, NO },
+    { "Lfr", "\xf0\x9d\x94\x8f", 3, 4, NO },
+    { "prE", "\xe2\xaa\xb3", 3, 3, NO },
+    { "NegativeThickSpace", "\xe2\x80\x8b", 18, 3, NO },
+    { "rbarr", "\xe2\xa4\x8d", 5, 3, NO },
+    { "Rho", "\xce\xa1", 3, 2, NO },
+    { "nsc", "\xe2\x8a\x81", 3, 3, NO },
+    { "nexist", "\xe2\x88\x84", 6, 3, NO },
+    { "Barv", "\xe2\xab\xa7", 4, 3, NO },
+    { "bumpe", "\xe2\x89\x8f", 5, 3, NO },
+    { "uharl", "\xe2\x86\xbf", 5, 3, NO },
+    { "Vfr", "\xf0\x9d\x94\x99", 3, 4, NO },
+    { "frasl", "\xe2\x81\x84", 5, 3, NO },
+    { "jopf", "\xf0\x9d\x95\x9b", 4, 4, NO },
+    { "supdot", "\xe2\xaa\xbe", 6, 3, NO },
+    { "dtrif", "\xe2\x96\xbe", 5, 3, NO },
+    { "NotEqualTilde", "\xe2\x89\x82\xcc\xb8", 13, 5, NO },
+    { "otilde", "\xc3\xb5", 6, 2, YES },
+    { "Dcy", "\xd0\x94", 3, 2, NO },
+    { "Pscr", "\xf0\x9d\x92\xab", 4, 4, NO },
+    { "NotDoubleVerticalBar", "\xe2\x88\xa6", 20, 3, NO },
+    { "rscr", "\xf0\x9d\x93\x87", 4, 4, NO },
+    { "blacktriangledown", "\xe2\x96\xbe", 17, 3, NO },
+    { "NotTildeFullEqual", "\xe2\x89\x87", 17, 3, NO },
+    { "looparrowright", "\xe2\x86\xac", 14, 3, NO },
+    { "NonBreakingSpace", "\xc2\xa0", 16, 2, NO },
+    { "bowtie", "\xe2\x8b\x88", 6, 3, NO },
+    { "rightleftarrows", "\xe2\x87\x84", 15, 3, NO },
+    { "orslope", "\xe2\xa9\x97", 7, 3, NO },
+    { "jukcy", "\xd1\x94", 5, 2, NO },
+    { "jfr", "\xf0\x9d\x94\xa7", 3, 4, NO },
+    { "epar", "\xe2\x8b\x95", 4, 3, NO },
+    { "SquareSubsetEqual", "\xe2\x8a\x91", 17, 3, NO },
+    { "notnivb", "\xe2\x8b\xbe", 7, 3, NO },
+    { "ntrianglerighteq", "\xe2\x8b\xad", 16, 3, NO },
+    { "gesdoto", "\xe2\xaa\x82", 7, 3, NO },
+    { "rightharpoonup", "\xe2\x87\x80", 14, 3, NO },
+    { "sharp", "\xe2\x99\xaf", 5, 3, NO },
+    { "RightUpDownVector", "\xe2\xa5\x8f", 17, 3, NO },
+    { "gnE", "\xe2\x89\xa9", 3, 3, NO },
+    { "angmsdad", "\xe2\xa6\xab", 8, 3, NO },
+    { "ContourIntegral", "\xe2\x88\xae", 15, 3, NO },
+    { "ccirc", "\xc4\x89", 5, 2, NO },
+    { "rightthreetimes", "\xe2\x8b\x8c", 15, 3, NO },
+    { "lang", "\xe2\x9f\xa8", 4, 3, NO },
+    { "quot", "\x22", 4, 1, YES },
+    { "lopf", "\xf0\x9d\x95\x9d", 4, 4, NO },
+    { "TRADE", "\xe2\x84\xa2", 5, 3, NO },
+    { "caron", "\xcb\x87", 5, 2, NO },
+    { "notinvc", "\xe2\x8b\xb6", 7, 3, NO },
+    { "LT", "<", 2, 1, YES },
+    { "OElig", "\xc5\x92", 5, 2, NO },
+    { "varphi", "\xcf\x95", 6, 2, NO },
+    { "Conint", "\xe2\x88\xaf", 6, 3, NO },
+    { "isin", "\xe2\x88\x88", 4, 3, NO },
+    { "sext", "\xe2\x9c\xb6", 4, 3, NO },
+    { "gnapprox", "\xe2\xaa\x8a", 8, 3, NO },
+    { "barwedge", "\xe2\x8c\x85", 8, 3, NO },
+    { "thetav", "\xcf\x91", 6, 2, NO },
+    { "mapstodown", "\xe2\x86\xa7", 10, 3, NO },
+    { "top", "\xe2\x8a\xa4", 3, 3, NO },
+    { "rarrpl", "\xe2\xa5\x85", 6, 3, NO },
+    { "Scirc", "\xc5\x9c", 5, 2, NO },
+    { "triangleright", "\xe2\x96\xb9", 13, 3, NO },
+    { "utri", "\xe2\x96\xb5", 4, 3, NO },
+    { "Xi", "\xce\x9e", 2, 2, NO },
+    { "Hcirc", "\xc4\xa4", 5, 2, NO },
+    { "nlarr", "\xe2\x86\x9a", 5, 3, NO },
+    { "spadesuit", "\xe2\x99\xa0", 9, 3, NO },
+    { "lbbrk", "\xe2\x9d\xb2", 5, 3, NO },
+    { "ohm", "\xce\xa9", 3, 2, NO },
+    { "iuml", "\xc3\xaf", 4, 2, YES },
+    { "acd", "\xe2\x88\xbf", 3, 3, NO },
+    { "PartialD", "\xe2\x88\x82", 8, 3, NO },
+    { "Precedes", "\xe2\x89\xba", 8, 3, NO },
+    { "dwangle", "\xe2\xa6\xa6", 7, 3, NO },
+    { "eogon", "\xc4\x99", 5, 2, NO },
+    { "ndash", "\xe2\x80\x93", 5, 3, NO },
+    { "andd", "\xe2\xa9\x9c", 4, 3, NO },
+    { "Dagger", "\xe2\x80\xa1", 6, 3, NO },
+    { "hamilt", "\xe2\x84\x8b", 6, 3, NO },
+    { "rharul", "\xe2\xa5\xac", 6, 3, NO },
+    { "NotGreaterGreater", "\xe2\x89\xab\xcc\xb8", 17, 5, NO },
+    { "Yfr", "\xf0\x9d\x94\x9c", 3, 4, NO },
+    { "Eta", "\xce\x97", 3, 2, NO },
+    { "vBar", "\xe2\xab\xa8", 4, 3, NO },
+    { "blacktriangle", "\xe2\x96\xb4", 13, 3, NO },
+    { "supsim", "\xe2\xab\x88", 6, 3, NO },
+    { "Jscr", "\xf0\x9d\x92\xa5", 4, 4, NO },
+    { "gesdotol", "\xe2\xaa\x84", 8, 3, NO },
+    { "mumap", "\xe2\x8a\xb8", 5, 3, NO },
+    { "iquest", "\xc2\xbf", 6, 2, YES },
+    { "NotSuperset", "\xe2\x8a\x83\xe2\x83\x92", 11, 6, NO },
+    { "lesdot", "\xe2\xa9\xbf", 6, 3, NO },
+    { "ge", "\xe2\x89\xa5", 2, 3, NO },
+    { "star", "\xe2\x98\x86", 4, 3, NO },
+    { "sqsubset", "\xe2\x8a\x8f", 8, 3, NO },
+    { "rthree", "\xe2\x8b\x8c", 6, 3, NO },
+    { "SquareIntersection", "\xe2\x8a\x93", 18, 3, NO },
+    { "lg", "\xe2\x89\xb6", 2, 3, NO },
+    { "ii", "\xe2\x85\x88", 2, 3, NO },
+    { "SquareSuperset", "\xe2\x8a\x90", 14, 3, NO },
+    { "asymp", "\xe2\x89\x88", 5, 3, NO },
+    { "RightTeeVector", "\xe2\xa5\x9b", 14, 3, NO },
+    { "LongRightArrow", "\xe2\x9f\xb6", 14, 3, NO },
+    { "downharpoonleft", "\xe2\x87\x83", 15, 3, NO },
+    { "leftharpoonup", "\xe2\x86\xbc", 13, 3, NO },
+    { "boxDr", "\xe2\x95\x93", 5, 3, NO },
+    { "bigcap", "\xe2\x8b\x82", 6, 3, NO },
+    { "Scaron", "\xc5\xa0", 6, 2, NO },
+    { "omacr", "\xc5\x8d", 5, 2, NO },
+    { "longrightarrow", "\xe2\x9f\xb6", 14, 3, NO },
+    { "NotHumpDownHump", "\xe2\x89\x8e\xcc\xb8", 15, 5, NO },
+    { "isinv", "\xe2\x88\x88", 5, 3, NO },
+    { "equivDD", "\xe2\xa9\xb8", 7, 3, NO },
+    { "supsetneqq", "\xe2\xab\x8c", 10, 3, NO },
+    { "Wcirc", "\xc5\xb4", 5, 2, NO },
+    { "af", "\xe2\x81\xa1", 2, 3, NO },
+    { "gtreqless", "\xe2\x8b\x9b", 9, 3, NO },
+    { "NestedLessLess", "\xe2\x89\xaa", 14, 3, NO },
+    { "bigtriangleup", "\xe2\x96\xb3", 13, 3, NO },
+    { "diamondsuit", "\xe2\x99\xa6", 11, 3, NO },
+    { "subsetneq", "\xe2\x8a\x8a", 9, 3, NO },
+    { "bnequiv", "\xe2\x89\xa1\xe2\x83\xa5", 7, 6, NO },
+    { "it", "\xe2\x81\xa2", 2, 3, NO },
+    { "rotimes", "\xe2\xa8\xb5", 7, 3, NO },
+    { "Omacr", "\xc5\x8c", 5, 2, NO },
+    { "searr", "\xe2\x86\x98", 5, 3, NO },
+    { "Scedil", "\xc5\x9e", 6, 2, NO },
+    { "frac38", "\xe2\x85\x9c", 6, 3, NO },
+    { "wreath", "\xe2\x89\x80", 6, 3, NO },
+    { "lbrkslu", "\xe2\xa6\x8d", 7, 3, NO },
+    { "rbrack", "]", 6, 1, NO },
+    { "DownRightTeeVector", "\xe2\xa5\x9f", 18, 3, NO },
+    { "rpargt", "\xe2\xa6\x94", 6, 3, NO },
+    { "frac25", "\xe2\x85\x96", 6, 3, NO },
+    { "dfr", "\xf0\x9d\x94\xa1", 3, 4, NO },
+    { "ifr", "\xf0\x9d\x94\xa6", 3, 4, NO },
+    { "nwnear", "\xe2\xa4\xa7", 6, 3, NO },
+    { "preccurlyeq", "\xe2\x89\xbc", 11, 3, NO },
+    { "notniva", "\xe2\x88\x8c", 7, 3, NO },
+    { "tcedil", "\xc5\xa3", 6, 2, NO },
+    { "angzarr", "\xe2\x8d\xbc", 7, 3, NO },
+    { "hopf", "\xf0\x9d\x95\x99", 4, 4, NO },
+    { "Therefore", "\xe2\x88\xb4", 9, 3, NO },
+    { "lrarr", "\xe2\x87\x86", 5, 3, NO },
+    { "pluscir", "\xe2\xa8\xa2", 7, 3, NO },
+    { "zfr", "\xf0\x9d\x94\xb7", 3, 4, NO },
+    { "Ll", "\xe2\x8b\x98", 2, 3, NO },
+    { "sqsup", "\xe2\x8a\x90", 5, 3, NO },
+    { "Cconint", "\xe2\x88\xb0", 7, 3, NO },
+    { "swArr", "\xe2\x87\x99", 5, 3, NO },
+    { "DownArrowUpArrow", "\xe2\x87\xb5", 16, 3, NO },
+    { "wr", "\xe2\x89\x80", 2, 3, NO },
+    { "npolint", "\xe2\xa8\x94", 7, 3, NO },
+    { "lesges", "\xe2\xaa\x93", 6, 3, NO },
+    { "dzcy", "\xd1\x9f", 4, 2, NO },
+    { "urcrop", "\xe2\x8c\x8e", 6, 3, NO },
+    { "digamma", "\xcf\x9d", 7, 2, NO },
+    { "approx", "\xe2\x89\x88", 6, 3, NO },
+    { "nearr", "\xe2\x86\x97", 5, 3, NO },
+    { "LeftVector", "\xe2\x86\xbc", 10, 3, NO },
+    { "Kcedil", "\xc4\xb6", 6, 2, NO },
+    { "varepsilon", "\xcf\xb5", 10, 2, NO },
+    { "cups", "\xe2\x88\xaa\xef\xb8\x80", 4, 6, NO },
+    { "prcue", "\xe2\x89\xbc", 5, 3, NO },
+    { "sc", "\xe2\x89\xbb", 2, 3, NO },
+    { "Gg", "\xe2\x8b\x99", 2, 3, NO },
+    { "gammad", "\xcf\x9d", 6, 2, NO },
+    { "ncedil", "\xc5\x86", 6, 2, NO },
+    { "rarrb", "\xe2\x87\xa5", 5, 3, NO },
+    { "bull", "\xe2\x80\xa2", 4, 3, NO },
+    { "rang", "\xe2\x9f\xa9", 4, 3, NO },
+    { "plusacir", "\xe2\xa8\xa3", 8, 3, NO },
+    { "vfr", "\xf0\x9d\x94\xb3", 3, 4, NO },
+    { "Ufr", "\xf0\x9d\x94\x98", 3, 4, NO },
+    { "ocy", "\xd0\xbe", 3, 2, NO },
+    { "NotSucceedsEqual", "\xe2\xaa\xb0\xcc\xb8", 16, 5, NO },
+    { "trianglelefteq", "\xe2\x8a\xb4", 14, 3, NO },
+    { "upuparrows", "\xe2\x87\x88", 10, 3, NO },
+    { "Not", "\xe2\xab\xac", 3, 3, NO },
+    { "omid", "\xe2\xa6\xb6", 4, 3, NO },
+    { "nltri", "\xe2\x8b\xaa", 5, 3, NO },
+    { "oacute", "\xc3\xb3", 6, 2, YES },
+    { "gneqq", "\xe2\x89\xa9", 5, 3, NO },
+    { "ecirc", "\xc3\xaa", 5, 2, YES },
+    { "Ifr", "\xe2\x84\x91", 3, 3, NO },
+    { "glj", "\xe2\xaa\xa4", 3, 3, NO },
+    { "lBarr", "\xe2\xa4\x8e", 5, 3, NO },
+    { "bigcup", "\xe2\x8b\x83", 6, 3, NO },
+    { "asympeq", "\xe2\x89\x8d", 7, 3, NO },
+    { "NotSquareSupersetEqual", "\xe2\x8b\xa3", 22, 3, NO },
+    { "nGtv", "\xe2\x89\xab\xcc\xb8", 4, 5, NO },
+    { "NotNestedLessLess", "\xe2\xaa\xa1\xcc\xb8", 17, 5, NO },
+    { "rpar", ")", 4, 1, NO },
+    { "sscr", "\xf0\x9d\x93\x88", 4, 4, NO },
+    { "NotPrecedes", "\xe2\x8a\x80", 11, 3, NO },
+    { "UpEquilibrium", "\xe2\xa5\xae", 13, 3, NO },
+    { "dash", "\xe2\x80\x90", 4, 3, NO },
+    { "smtes", "\xe2\xaa\xac\xef\xb8\x80", 5, 6, NO },
+    { "ange", "\xe2\xa6\xa4", 4, 3, NO },
+    { "sub", "\xe2\x8a\x82", 3, 3, NO },
+    { "ForAll", "\xe2\x88\x80", 6, 3, NO },
+    { "macr", "\xc2\xaf", 4, 2, YES },
+    { "lstrok", "\xc5\x82", 6, 2, NO },
+    { "uplus", "\xe2\x8a\x8e", 5, 3, NO },
+    { "Diamond", "\xe2\x8b\x84", 7, 3, NO },
+    { "lnE", "\xe2\x89\xa8", 3, 3, NO },
+    { "Mu", "\xce\x9c", 2, 2, NO },
+    { "range", "\xe2\xa6\xa5", 5, 3, NO },
+    { "LeftUpVector", "\xe2\x86\xbf", 12, 3, NO },
+    { "nrtrie", "\xe2\x8b\xad", 6, 3, NO },
+    { "cong", "\xe2\x89\x85", 4, 3, NO },
+    { "NotTilde", "\xe2\x89\x81", 8, 3, NO },
+    { "Omega", "\xce\xa9", 5, 2, NO },
+    { "Larr", "\xe2\x86\x9e", 4, 3, NO },
+    { "DownRightVectorBar", "\xe2\xa5\x97", 18, 3, NO },
+    { "Tstrok", "\xc5\xa6", 6, 2, NO },
+    { "udarr", "\xe2\x87\x85", 5, 3, NO },
+    { "Zfr", "\xe2\x84\xa8", 3, 3, NO },
+    { "sqsubseteq", "\xe2\x8a\x91", 10, 3, NO },
+    { "jsercy", "\xd1\x98", 6, 2, NO },
+    { "cuwed", "\xe2\x8b\x8f", 5, 3, NO },
+    { "frac14", "\xc2\xbc", 6, 2, YES },
+    { "niv", "\xe2\x88\x8b", 3, 3, NO },
+    { "rnmid", "\xe2\xab\xae", 5, 3, NO },
+    { "oline", "\xe2\x80\xbe", 5, 3, NO },
+    { "intprod", "\xe2\xa8\xbc", 7, 3, NO },
+    { "sup2", "\xc2\xb2", 4, 2, YES },
+    { "jcirc", "\xc4\xb5", 5, 2, NO },
+    { "NotGreaterTilde", "\xe2\x89\xb5", 15, 3, NO },
+    { "ngt", "\xe2\x89\xaf", 3, 3, NO },
+    { "integers", "\xe2\x84\xa4", 8, 3, NO },
+    { "backprime", "\xe2\x80\xb5", 9, 3, NO },
+    { "Sfr", "\xf0\x9d\x94\x96", 3, 4, NO },
+    { "rtimes", "\xe2\x8b\x8a", 6, 3, NO },
+    { "uring", "\xc5\xaf", 5, 2, NO },
+    { "ordm", "\xc2\xba", 4, 2, YES },
+    { "lesdoto", "\xe2\xaa\x81", 7, 3, NO },
+    { "bcy", "\xd0\xb1", 3, 2, NO },
+    { "lsaquo", "\xe2\x80\xb9", 6, 3, NO },
+    { "lrtri", "\xe2\x8a\xbf", 5, 3, NO },
+    { "Ncaron", "\xc5\x87", 6, 2, NO },
+    { "DDotrahd", "\xe2\xa4\x91", 8, 3, NO },
+    { "plusb", "\xe2\x8a\x9e", 5, 3, NO },
+    { "cedil", "\xc2\xb8", 5, 2, YES },
+    { "thetasym", "\xcf\x91", 8, 2, NO },
+    { "geqslant", "\xe2\xa9\xbe", 8, 3, NO },
+    { "laemptyv", "\xe2\xa6\xb4", 8, 3, NO },
+    { "simrarr", "\xe2\xa5\xb2", 7, 3, NO },
+    { "iiiint", "\xe2\xa8\x8c", 6, 3, NO },
+    { "Uacute", "\xc3\x9a", 6, 2, YES },
+    { "realine", "\xe2\x84\x9b", 7, 3, NO },
+    { "breve", "\xcb\x98", 5, 2, NO },
+    { "rdsh", "\xe2\x86\xb3", 4, 3, NO },
+    { "CircleDot", "\xe2\x8a\x99", 9, 3, NO },
+    { "colon", ":", 5, 1, NO },
+    { "Nscr", "\xf0\x9d\x92\xa9", 4, 4, NO },
+    { "ogt", "\xe2\xa7\x81", 3, 3, NO },
+    { "lescc", "\xe2\xaa\xa8", 5, 3, NO },
+    { "Wedge", "\xe2\x8b\x80", 5, 3, NO },
+    { "Aopf", "\xf0\x9d\x94\xb8", 4, 4, NO },
+    { "zopf", "\xf0\x9d\x95\xab", 4, 4, NO },
+    { "drcrop", "\xe2\x8c\x8c", 6, 3, NO },
+    { "SubsetEqual", "\xe2\x8a\x86", 11, 3, NO },
+    { "bscr", "\xf0\x9d\x92\xb7", 4, 4, NO },
+    { "atilde", "\xc3\xa3", 6, 2, YES },
+    { "osol", "\xe2\x8a\x98", 4, 3, NO },
+    { "lbrksld", "\xe2\xa6\x8f", 7, 3, NO },
+    { "lcaron", "\xc4\xbe", 6, 2, NO },
+    { "NotGreaterEqual", "\xe2\x89\xb1", 15, 3, NO },
+    { "ccaron", "\xc4\x8d", 6, 2, NO },
+    { "Kcy", "\xd0\x9a", 3, 2, NO },
+    { "ocir", "\xe2\x8a\x9a", 4, 3, NO },
+    { "CapitalDifferentialD", "\xe2\x85\x85", 20, 3, NO },
+    { "NotSubset", "\xe2\x8a\x82\xe2\x83\x92", 9, 6, NO },
+    { "dopf", "\xf0\x9d\x95\x95", 4, 4, NO },
+    { "circeq", "\xe2\x89\x97", 6, 3, NO },
+    { "Jcirc", "\xc4\xb4", 5, 2, NO },
+    { "AElig", "\xc3\x86", 5, 2, YES },
+    { "DoubleRightArrow", "\xe2\x87\x92", 16, 3, NO },
+    { "yfr", "\xf0\x9d\x94\xb6", 3, 4, NO },
+    { "circledcirc", "\xe2\x8a\x9a", 11, 3, NO },
+    { "Chi", "\xce\xa7", 3, 2, NO },
+    { "ldquo", "\xe2\x80\x9c", 5, 3, NO },
+    { "LessGreater", "\xe2\x89\xb6", 11, 3, NO },
+    { "lscr", "\xf0\x9d\x93\x81", 4, 4, NO },
+    { "excl", "!", 4, 1, NO },
+    { "cirmid", "\xe2\xab\xaf", 6, 3, NO },
+    { "lozenge", "\xe2\x97\x8a", 7, 3, NO },
+    { "Sigma", "\xce\xa3", 5, 2, NO },
+    { "ldquor", "\xe2\x80\x9e", 6, 3, NO },
+    { "ntriangleright", "\xe2\x8b\xab", 14, 3, NO },
+    { "lneq", "\xe2\xaa\x87", 4, 3, NO },
+    { "fltns", "\xe2\x96\xb1", 5, 3, NO },
+    { "llhard", "\xe2\xa5\xab", 6, 3, NO },
+    { "UpTee", "\xe2\x8a\xa5", 5, 3, NO },
+    { "trade", "\xe2\x84\xa2", 5, 3, NO },
+    { "sqcaps", "\xe2\x8a\x93\xef\xb8\x80", 6, 6, NO },
+    { "RoundImplies", "\xe2\xa5\xb0", 12, 3, NO },
+    { "ges", "\xe2\xa9\xbe", 3, 3, NO },
+    { "blacksquare", "\xe2\x96\xaa", 11, 3, NO },
+    { "nLl", "\xe2\x8b\x98\xcc\xb8", 3, 5, NO },
+    { "ape", "\xe2\x89\x8a", 3, 3, NO },
+    { "shortmid", "\xe2\x88\xa3", 8, 3, NO },
+    { "sdot", "\xe2\x8b\x85", 4, 3, NO },
+    { "subnE", "\xe2\xab\x8b", 5, 3, NO },
+    { "NotSubsetEqual", "\xe2\x8a\x88", 14, 3, NO },
+    { "supe", "\xe2\x8a\x87", 4, 3, NO },
+    { "nsubseteqq", "\xe2\xab\x85\xcc\xb8", 10, 5, NO },
+    { "Cedilla", "\xc2\xb8", 7, 2, NO },
+    { "andv", "\xe2\xa9\x9a", 4, 3, NO },
+    { "imacr", "\xc4\xab", 5, 2, NO },
+    { "Dfr", "\xf0\x9d\x94\x87", 3, 4, NO },
+    { "ctdot", "\xe2\x8b\xaf", 5, 3, NO },
+    { "tilde", "\xcb\x9c", 5, 2, NO },
+    { "hArr", "\xe2\x87\x94", 4, 3, NO },
+    { "succsim", "\xe2\x89\xbf", 7, 3, NO },
+    { "commat", "@", 6, 1, NO },
+    { "sqcap", "\xe2\x8a\x93", 5, 3, NO },
+    { "diam", "\xe2\x8b\x84", 4, 3, NO },
+    { "csube", "\xe2\xab\x91", 5, 3, NO },
+    { "lpar", "(", 4, 1, NO },
+    { "Sopf", "\xf0\x9d\x95\x8a", 4, 4, NO },
+    { "lbrace", "{", 6, 1, NO },
+    { "olt", "\xe2\xa7\x80", 3, 3, NO },
+    { "profline", "\xe2\x8c\x92", 8, 3, NO },
+    { "Mcy", "\xd0\x9c", 3, 2, NO },
+    { "cent", "\xc2\xa2", 4, 2, YES },
+    { "lobrk", "\xe2\x9f\xa6", 5, 3, NO },
+    { "sqsub", "\xe2\x8a\x8f", 5, 3, NO },
+    { "leftarrowtail", "\xe2\x86\xa2", 13, 3, NO },
+    { "lbrke", "\xe2\xa6\x8b", 5, 3, NO },
+    { "bigcirc", "\xe2\x97\xaf", 7, 3, NO },
+    { "rtrif", "\xe2\x96\xb8", 5, 3, NO },
+    { "nrightarrow", "\xe2\x86\x9b", 11, 3, NO },
+    { "LeftDownVectorBar", "\xe2\xa5\x99", 17, 3, NO },
+    { "clubsuit", "\xe2\x99\xa3", 8, 3, NO },
+    { "DoubleUpDownArrow", "\xe2\x87\x95", 17, 3, NO },
+    { "lsimg", "\xe2\xaa\x8f", 5, 3, NO },
+    { "bkarow", "\xe2\xa4\x8d", 6, 3, NO },
+    { "capbrcup", "\xe2\xa9\x89", 8, 3, NO },
+    { "nparsl", "\xe2\xab\xbd\xe2\x83\xa5", 6, 6, NO },
+    { "in", "\xe2\x88\x88", 2, 3, NO },
+    { "Xopf", "\xf0\x9d\x95\x8f", 4, 4, NO },
+    { "horbar", "\xe2\x80\x95", 6, 3, NO },
+    { "NotRightTriangleBar", "\xe2\xa7\x90\xcc\xb8", 19, 5, NO },
+    { "dotplus", "\xe2\x88\x94", 7, 3, NO },
+    { "minusb", "\xe2\x8a\x9f", 6, 3, NO },
+    { "DownRightVector", "\xe2\x87\x81", 15, 3, NO },
+    { "PrecedesEqual", "\xe2\xaa\xaf", 13, 3, NO },
+    { "rarrc", "\xe2\xa4\xb3", 5, 3, NO },
+    { "natural", "\xe2\x99\xae", 7, 3, NO },
+    { "gesl", "\xe2\x8b\x9b\xef\xb8\x80", 4, 6, NO },
+    { "rsquo", "\xe2\x80\x99", 5, 3, NO },
+    { "eplus", "\xe2\xa9\xb1", 5, 3, NO },
+    { "toea", "\xe2\xa4\xa8", 4, 3, NO },
+    { "nsupset", "\xe2\x8a\x83\xe2\x83\x92", 7, 6, NO },
+    { "kgreen", "\xc4\xb8", 6, 2, NO },
+    { "RightDownVector", "\xe2\x87\x82", 15, 3, NO },
+    { "zwnj", "\xe2\x80\x8c", 4, 3, NO },
+    { "loarr", "\xe2\x87\xbd", 5, 3, NO },
+    { "NotNestedGreaterGreater", "\xe2\xaa\xa2\xcc\xb8", 23, 5, NO },
+    { "nequiv", "\xe2\x89\xa2", 6, 3, NO },
+    { "lvertneqq", "\xe2\x89\xa8\xef\xb8\x80", 9, 6, NO },
+    { "ReverseUpEquilibrium", "\xe2\xa5\xaf", 20, 3, NO },
+    { "propto", "\xe2\x88\x9d", 6, 3, NO },
+    { "kappav", "\xcf\xb0", 6, 2, NO },
+    { "succneqq", "\xe2\xaa\xb6", 8, 3, NO },
+    { "tscr", "\xf0\x9d\x93\x89", 4, 4, NO },
+    { "ngtr", "\xe2\x89\xaf", 4, 3, NO },
+    { "Darr", "\xe2\x86\xa1", 4, 3, NO },
+    { "lotimes", "\xe2\xa8\xb4", 7, 3, NO },
+    { "ltlarr", "\xe2\xa5\xb6", 6, 3, NO },
+    { "DoubleContourIntegral", "\xe2\x88\xaf", 21, 3, NO },
+    { "cir", "\xe2\x97\x8b", 3, 3, NO },
+    { "ZHcy", "\xd0\x96", 4, 2, NO },
+    { "infintie", "\xe2\xa7\x9d", 8, 3, NO },
+    { "simlE", "\xe2\xaa\x9f", 5, 3, NO },
+    { "apos", "'", 4, 1, NO },
+    { "angrtvbd", "\xe2\xa6\x9d", 8, 3, NO },
+    { "utdot", "\xe2\x8b\xb0", 5, 3, NO },
+    { "blk34", "\xe2\x96\x93", 5, 3, NO },
+    { "NotSquareSubset", "\xe2\x8a\x8f\xcc\xb8", 15, 5, NO },
+    { "marker", "\xe2\x96\xae", 6, 3, NO },
+    { "ltrif", "\xe2\x97\x82", 5, 3, NO },
+    { "ggg", "\xe2\x8b\x99", 3, 3, NO },
+    { "plustwo", "\xe2\xa8\xa7", 7, 3, NO },
+    { "LeftUpTeeVector", "\xe2\xa5\xa0", 15, 3, NO },
+    { "OverBar", "\xe2\x80\xbe", 7, 3, NO },
+    { "or", "\xe2\x88\xa8", 2, 3, NO },
+    { "lsim", "\xe2\x89\xb2", 4, 3, NO },
+    { "bopf", "\xf0\x9d\x95\x93", 4, 4, NO },
+    { "Ograve", "\xc3\x92", 6, 2, YES },
+    { "olcross", "\xe2\xa6\xbb", 7, 3, NO },
+    { "origof", "\xe2\x8a\xb6", 6, 3, NO },
+    { "auml", "\xc3\xa4", 4, 2, YES },
+    { "lAtail", "\xe2\xa4\x9b", 6, 3, NO },
+    { "precnsim", "\xe2\x8b\xa8", 8, 3, NO },
+    { "boxHU", "\xe2\x95\xa9", 5, 3, NO },
+    { "GreaterTilde", "\xe2\x89\xb3", 12, 3, NO },
+    { "strns", "\xc2\xaf", 5, 2, NO },
+    { "hookrightarrow", "\xe2\x86\xaa", 14, 3, NO },
+    { "YUcy", "\xd0\xae", 4, 2, NO },
+    { "luruhar", "\xe2\xa5\xa6", 7, 3, NO },
+    { "ultri", "\xe2\x97\xb8", 5, 3, NO },
+    { "Vopf", "\xf0\x9d\x95\x8d", 4, 4, NO },
+    { "DoubleLongLeftRightArrow", "\xe2\x9f\xba", 24, 3, NO },
+    { "Longleftarrow", "\xe2\x9f\xb8", 13, 3, NO },
+    { "angmsd", "\xe2\x88\xa1", 6, 3, NO },
+    { "Ucirc", "\xc3\x9b", 5, 2, YES },
+    { "leftthreetimes", "\xe2\x8b\x8b", 14, 3, NO },
+    { "efDot", "\xe2\x89\x92", 5, 3, NO },
+    { "vDash", "\xe2\x8a\xa8", 5, 3, NO },
+    { "loplus", "\xe2\xa8\xad", 6, 3, NO },
+    { "nwarrow", "\xe2\x86\x96", 7, 3, NO },
+    { "xsqcup", "\xe2\xa8\x86", 6, 3, NO },
+    { "orv", "\xe2\xa9\x9b", 3, 3, NO },
+    { "delta", "\xce\xb4", 5, 2, NO },
+    { "profsurf", "\xe2\x8c\x93", 8, 3, NO },
+    { "ljcy", "\xd1\x99", 4, 2, NO },
+    { "kcedil", "\xc4\xb7", 6, 2, NO },
+    { "yen", "\xc2\xa5", 3, 2, YES },
+    { "icirc", "\xc3\xae", 5, 2, YES },
+    { "ldrushar", "\xe2\xa5\x8b", 8, 3, NO },
+    { "phone", "\xe2\x98\x8e", 5, 3, NO },
+    { "hbar", "\xe2\x84\x8f", 4, 3, NO },
+    { "Ccirc", "\xc4\x88", 5, 2, NO },
+    { "div", "\xc3\xb7", 3, 2, NO },
+    { "nleq", "\xe2\x89\xb0", 4, 3, NO },
+    { "ocirc", "\xc3\xb4", 5, 2, YES },
+    { "HumpDownHump", "\xe2\x89\x8e", 12, 3, NO },
+    { "para", "\xc2\xb6", 4, 2, YES },
+    { "lambda", "\xce\xbb", 6, 2, NO },
+    { "supedot", "\xe2\xab\x84", 7, 3, NO },
+    { "nlsim", "\xe2\x89\xb4", 5, 3, NO },
+    { "loz", "\xe2\x97\x8a", 3, 3, NO },
+    { "backcong", "\xe2\x89\x8c", 8, 3, NO },
+    { "Iogon", "\xc4\xae", 5, 2, NO },
+    { "lhard", "\xe2\x86\xbd", 5, 3, NO },
+    { "malt", "\xe2\x9c\xa0", 4, 3, NO },
+    { "lmoustache", "\xe2\x8e\xb0", 10, 3, NO },
+    { "scsim", "\xe2\x89\xbf", 5, 3, NO },
+    { "abreve", "\xc4\x83", 6, 2, NO },
+    { "Atilde", "\xc3\x83", 6, 2, YES },
+    { "risingdotseq", "\xe2\x89\x93", 12, 3, NO },
+    { "ENG", "\xc5\x8a", 3, 2, NO },
+    { "Lcaron", "\xc4\xbd", 6, 2, NO },
+    { "iecy", "\xd0\xb5", 4, 2, NO },
+    { "pscr", "\xf0\x9d\x93\x85", 4, 4, NO },
+    { "yuml", "\xc3\xbf", 4, 2, YES },
+    { "angrtvb", "\xe2\x8a\xbe", 7, 3, NO },
+    { "vsubne", "\xe2\x8a\x8a\xef\xb8\x80", 6, 6, NO },
+    { "succcurlyeq", "\xe2\x89\xbd", 11, 3, NO },
+    { "Cross", "\xe2\xa8\xaf", 5, 3, NO },
+    { "ycirc", "\xc5\xb7", 5, 2, NO },
+    { "NotLessTilde", "\xe2\x89\xb4", 12, 3, NO },
+    { "LeftUpDownVector", "\xe2\xa5\x91", 16, 3, NO },
+    { "leq", "\xe2\x89\xa4", 3, 3, NO },
+    { "precsim", "\xe2\x89\xbe", 7, 3, NO },
+    { "Qfr", "\xf0\x9d\x94\x94", 3, 4, NO },
+    { "tbrk", "\xe2\x8e\xb4", 4, 3, NO },
+    { "Vdash", "\xe2\x8a\xa9", 5, 3, NO },
+    { "Efr", "\xf0\x9d\x94\x88", 3, 4, NO },
+    { "ETH", "\xc3\x90", 3, 2, YES },
+    { "odot", "\xe2\x8a\x99", 4, 3, NO },
+    { "gneq", "\xe2\xaa\x88", 4, 3, NO },
+    { "FilledSmallSquare", "\xe2\x97\xbc", 17, 3, NO },
+    { "upsi", "\xcf\x85", 4, 2, NO },
+    { "eqsim", "\xe2\x89\x82", 5, 3, NO },
+    { "trisb", "\xe2\xa7\x8d", 5, 3, NO },
+    { "Exists", "\xe2\x88\x83", 6, 3, NO },
+    { "bsol", "\x5c", 4, 1, NO },
+    { "fjlig", "fj", 5, 2, NO },
+    { "profalar", "\xe2\x8c\xae", 8, 3, NO },
+    { "Gfr", "\xf0\x9d\x94\x8a", 3, 4, NO },
+    { "tint", "\xe2\x88\xad", 4, 3, NO },
+    { "Jfr", "\xf0\x9d\x94\x8d", 3, 4, NO },
+    { "UpArrowBar", "\xe2\xa4\x92", 10, 3, NO },
+    { "LeftDoubleBracket", "\xe2\x9f\xa6", 17, 3, NO },
+    { "ssetmn", "\xe2\x88\x96", 6, 3, NO },
+    { "pluse", "\xe2\xa9\xb2", 5, 3, NO },
+    { "fllig", "\xef\xac\x82", 5, 3, NO },
+    { "hairsp", "\xe2\x80\x8a", 6, 3, NO },
+    { "supplus", "\xe2\xab\x80", 7, 3, NO },
+    { "larrtl", "\xe2\x86\xa2", 6, 3, NO },
+    { "planck", "\xe2\x84\x8f", 6, 3, NO },
+    { "num", "#", 3, 1, NO },
+    { "kscr", "\xf0\x9d\x93\x80", 4, 4, NO },
+    { "triangleq", "\xe2\x89\x9c", 9, 3, NO },
+    { "epsi", "\xce\xb5", 4, 2, NO },
+    { "Ecaron", "\xc4\x9a", 6, 2, NO },
+    { "LeftRightVector", "\xe2\xa5\x8e", 15, 3, NO },
+    { "scedil", "\xc5\x9f", 6, 2, NO },
+    { "Sc", "\xe2\xaa\xbc", 2, 3, NO },
+    { "HilbertSpace", "\xe2\x84\x8b", 12, 3, NO },
+    { "sopf", "\xf0\x9d\x95\xa4", 4, 4, NO },
+    { "Colon", "\xe2\x88\xb7", 5, 3, NO },
+    { "Xscr", "\xf0\x9d\x92\xb3", 4, 4, NO },
+    { "pr", "\xe2\x89\xba", 2, 3, NO },
+    { "rmoust", "\xe2\x8e\xb1", 6, 3, NO },
+    { "curlyvee", "\xe2\x8b\x8e", 8, 3, NO },
+    { "nscr", "\xf0\x9d\x93\x83", 4, 4, NO },
+    { "Yacute", "\xc3\x9d", 6, 2, YES },
+    { "subplus", "\xe2\xaa\xbf", 7, 3, NO },
+    { "preceq", "\xe2\xaa\xaf", 6, 3, NO },
+    { "utrif", "\xe2\x96\xb4", 5, 3, NO },
+    { "npreceq", "\xe2\xaa\xaf\xcc\xb8", 7, 5, NO },
+    { "boxdR", "\xe2\x95\x92", 5, 3, NO },
+    { "setmn", "\xe2\x88\x96", 5, 3, NO },
+    { "OverParenthesis", "\xe2\x8f\x9c", 15, 3, NO },
+    { "vsupnE", "\xe2\xab\x8c\xef\xb8\x80", 6, 6, NO },
+    { "Bopf", "\xf0\x9d\x94\xb9", 4, 4, NO },
+    { "emptyset", "\xe2\x88\x85", 8, 3, NO },
+    { "vsupne", "\xe2\x8a\x8b\xef\xb8\x80", 6, 6, NO },
+    { "ring", "\xcb\x9a", 4, 2, NO },
+    { "DoubleLeftTee", "\xe2\xab\xa4", 13, 3, NO },
+    { "vartriangleleft", "\xe2\x8a\xb2", 15, 3, NO },
+    { "nearhk", "\xe2\xa4\xa4", 6, 3, NO },
+    { "angle", "\xe2\x88\xa0", 5, 3, NO },
+    { "twixt", "\xe2\x89\xac", 5, 3, NO },
+    { "natur", "\xe2\x99\xae", 5, 3, NO },
+    { "Ntilde", "\xc3\x91", 6, 2, YES },
+    { "UpArrowDownArrow", "\xe2\x87\x85", 16, 3, NO },
+    { "efr", "\xf0\x9d\x94\xa2", 3, 4, NO },
+    { "Ncedil", "\xc5\x85", 6, 2, NO },
+    { "boxminus", "\xe2\x8a\x9f", 8, 3, NO },
+    { "gbreve", "\xc4\x9f", 6, 2, NO },
+    { "larrbfs", "\xe2\xa4\x9f", 7, 3, NO },
+    { "NotLessGreater", "\xe2\x89\xb8", 14, 3, NO },
+    { "eqcolon", "\xe2\x89\x95", 7, 3, NO },
+    { "rArr", "\xe2\x87\x92", 4, 3, NO },
+    { "nRightarrow", "\xe2\x87\x8f", 11, 3, NO },
+    { "rsaquo", "\xe2\x80\xba", 6, 3, NO },
+    { "sup", "\xe2\x8a\x83", 3, 3, NO },
+    { "urtri", "\xe2\x97\xb9", 5, 3, NO },
+    { "boxul", "\xe2\x94\x98", 5, 3, NO },
+    { "centerdot", "\xc2\xb7", 9, 2, NO },
+    { "acute", "\xc2\xb4", 5, 2, YES },
+    { "gE", "\xe2\x89\xa7", 2, 3, NO },
+    { "lneqq", "\xe2\x89\xa8", 5, 3, NO },
+    { "Uscr", "\xf0\x9d\x92\xb0", 4, 4, NO },
+    { "male", "\xe2\x99\x82", 4, 3, NO },
+    { "nvsim", "\xe2\x88\xbc\xe2\x83\x92", 5, 6, NO },
+    { "lnsim", "\xe2\x8b\xa6", 5, 3, NO },
+    { "raquo", "\xc2\xbb", 5, 2, YES },
+    { "UnderBrace", "\xe2\x8f\x9f", 10, 3, NO },
+    { "boxVR", "\xe2\x95\xa0", 5, 3, NO },
+    { "die", "\xc2\xa8", 3, 2, NO },
+    { "xuplus", "\xe2\xa8\x84", 6, 3, NO },
+    { "RuleDelayed", "\xe2\xa7\xb4", 11, 3, NO },
+    { "topfork", "\xe2\xab\x9a", 7, 3, NO },
+    { "Ropf", "\xe2\x84\x9d", 4, 3, NO },
+    { "nesim", "\xe2\x89\x82\xcc\xb8", 5, 5, NO },
+    { "models", "\xe2\x8a\xa7", 6, 3, NO },
+    { "circlearrowright", "\xe2\x86\xbb", 16, 3, NO },
+    { "forkv", "\xe2\xab\x99", 5, 3, NO },
+    { "rsquor", "\xe2\x80\x99", 6, 3, NO },
+    { "caps", "\xe2\x88\xa9\xef\xb8\x80", 4, 6, NO },
+    { "downdownarrows", "\xe2\x87\x8a", 14, 3, NO },
+    { "ubrcy", "\xd1\x9e", 5, 2, NO },
+    { "boxvL", "\xe2\x95\xa1", 5, 3, NO },
+    { "NegativeThinSpace", "\xe2\x80\x8b", 17, 3, NO },
+    { "afr", "\xf0\x9d\x94\x9e", 3, 4, NO },
+    { "dlcrop", "\xe2\x8c\x8d", 6, 3, NO },
+    { "angmsdaf", "\xe2\xa6\xad", 8, 3, NO },
+    { "rfloor", "\xe2\x8c\x8b", 6, 3, NO },
+    { "NotSquareSuperset", "\xe2\x8a\x90\xcc\xb8", 17, 5, NO },
+    { "Wopf", "\xf0\x9d\x95\x8e", 4, 4, NO },
+    { "boxV", "\xe2\x95\x91", 4, 3, NO },
+    { "succnsim", "\xe2\x8b\xa9", 8, 3, NO },
+    { "amacr", "\xc4\x81", 5, 2, NO },
+    { "euml", "\xc3\xab", 4, 2, YES },
+    { "Gbreve", "\xc4\x9e", 6, 2, NO },
+    { "numsp", "\xe2\x80\x87", 5, 3, NO },
+    { "DownLeftVectorBar", "\xe2\xa5\x96", 17, 3, NO },
+    { "iff", "\xe2\x87\x94", 3, 3, NO },
+    { "bsime", "\xe2\x8b\x8d", 5, 3, NO },
+    { "Iukcy", "\xd0\x86", 5, 2, NO },
+    { "tosa", "\xe2\xa4\xa9", 4, 3, NO },
+    { "geqq", "\xe2\x89\xa7", 4, 3, NO },
+    { "ofr", "\xf0\x9d\x94\xac", 3, 4, NO },
+    { "bprime", "\xe2\x80\xb5", 6, 3, NO },
+    { "olarr", "\xe2\x86\xba", 5, 3, NO },
+    { "cupcup", "\xe2\xa9\x8a", 6, 3, NO },
+    { "blacktriangleleft", "\xe2\x97\x82", 17, 3, NO },
+    { "Rang", "\xe2\x9f\xab", 4, 3, NO },
+    { "twoheadleftarrow", "\xe2\x86\x9e", 16, 3, NO },
+    { "ccupssm", "\xe2\xa9\x90", 7, 3, NO },
+    { "xdtri", "\xe2\x96\xbd", 5, 3, NO },
+    { "rsh", "\xe2\x86\xb1", 3, 3, NO },
+    { "imped", "\xc6\xb5", 5, 2, NO },
+    { "hearts", "\xe2\x99\xa5", 6, 3, NO },
+    { "topcir", "\xe2\xab\xb1", 6, 3, NO },
+    { "simg", "\xe2\xaa\x9e", 4, 3, NO },
+    { "gimel", "\xe2\x84\xb7", 5, 3, NO },
+    { "Because", "\xe2\x88\xb5", 7, 3, NO },
+    { "Umacr", "\xc5\xaa", 5, 2, NO },
+    { "nleftrightarrow", "\xe2\x86\xae", 15, 3, NO },
+    { "nLtv", "\xe2\x89\xaa\xcc\xb8", 4, 5, NO },
+    { "emsp14", "\xe2\x80\x85", 6, 3, NO },
+    { "SupersetEqual", "\xe2\x8a\x87", 13, 3, NO },
+    { "longleftrightarrow", "\xe2\x9f\xb7", 18, 3, NO },
+    { "frac58", "\xe2\x85\x9d", 6, 3, NO },
+    { "gescc", "\xe2\xaa\xa9", 5, 3, NO },
+    { "GreaterSlantEqual", "\xe2\xa9\xbe", 17, 3, NO },
+    { "xmap", "\xe2\x9f\xbc", 4, 3, NO },
+    { "nwarr", "\xe2\x86\x96", 5, 3, NO },
+    { "gesdot", "\xe2\xaa\x80", 6, 3, NO },
+    { "HorizontalLine", "\xe2\x94\x80", 14, 3, NO },
+    { "Fscr", "\xe2\x84\xb1", 4, 3, NO },
+    { "gesles", "\xe2\xaa\x94", 6, 3, NO },
+    { "Aogon", "\xc4\x84", 5, 2, NO },
+    { "GreaterEqual", "\xe2\x89\xa5", 12, 3, NO },
+    { "rAtail", "\xe2\xa4\x9c", 6, 3, NO },
+    { "leftarrow", "\xe2\x86\x90", 9, 3, NO },
+    { "female", "\xe2\x99\x80", 6, 3, NO },
+    { "Esim", "\xe2\xa9\xb3", 4, 3, NO },
+    { "subne", "\xe2\x8a\x8a", 5, 3, NO },
+    { "Uuml", "\xc3\x9c", 4, 2, YES },
+    { "LeftCeiling", "\xe2\x8c\x88", 11, 3, NO },
+    { "gtdot", "\xe2\x8b\x97", 5, 3, NO },
+    { "shy", "\xc2\xad", 3, 2, YES },
+    { "nltrie", "\xe2\x8b\xac", 6, 3, NO },
+    { "cupdot", "\xe2\x8a\x8d", 6, 3, NO },
+    { "mldr", "\xe2\x80\xa6", 4, 3, NO },
+    { "capand", "\xe2\xa9\x84", 6, 3, NO },
+    { "Hscr", "\xe2\x84\x8b", 4, 3, NO },
+    { "TSHcy", "\xd0\x8b", 5, 2, NO },
+    { "leqslant", "\xe2\xa9\xbd", 8, 3, NO },
+    { "NJcy", "\xd0\x8a", 4, 2, NO },
+    { "trianglerighteq", "\xe2\x8a\xb5", 15, 3, NO },
+    { "AMP", "&", 3, 1, YES },
+    { "ouml", "\xc3\xb6", 4, 2, YES },
+    { "csup", "\xe2\xab\x90", 4, 3, NO },
+    { "nesear", "\xe2\xa4\xa8", 6, 3, NO },
+    { "Ccaron", "\xc4\x8c", 6, 2, NO },
+    { "sqcups", "\xe2\x8a\x94\xef\xb8\x80", 6, 6, NO },
+    { "gtcir", "\xe2\xa9\xba", 5, 3, NO },
+    { "PrecedesTilde", "\xe2\x89\xbe", 13, 3, NO },
+    { "bigstar", "\xe2\x98\x85", 7, 3, NO },
+    { "Dstrok", "\xc4\x90", 6, 2, NO },
+    { "Gopf", "\xf0\x9d\x94\xbe", 4, 4, NO },
+    { "FilledVerySmallSquare", "\xe2\x96\xaa", 21, 3, NO },
+    { "vert", "|", 4, 1, NO },
+    { "umacr", "\xc5\xab", 5, 2, NO },
+    { "ni", "\xe2\x88\x8b", 2, 3, NO },
+    { "middot", "\xc2\xb7", 6, 2, YES },
+    { "DiacriticalTilde", "\xcb\x9c", 16, 2, NO },
+    { "llcorner", "\xe2\x8c\x9e", 8, 3, NO },
+    { "lbarr", "\xe2\xa4\x8c", 5, 3, NO },
+    { "gamma", "\xce\xb3", 5, 2, NO },
+    { "KJcy", "\xd0\x8c", 4, 2, NO },
+    { "NestedGreaterGreater", "\xe2\x89\xab", 20, 3, NO },
+    { "SOFTcy", "\xd0\xac", 6, 2, NO },
+    { "gtrless", "\xe2\x89\xb7", 7, 3, NO },
+    { "vnsub", "\xe2\x8a\x82\xe2\x83\x92", 5, 6, NO },
+    { "nvap", "\xe2\x89\x8d\xe2\x83\x92", 4, 6, NO },
+    { "ShortDownArrow", "\xe2\x86\x93", 14, 3, NO },
+    { "daleth", "\xe2\x84\xb8", 6, 3, NO },
+    { "eg", "\xe2\xaa\x9a", 2, 3, NO },
+    { "mDDot", "\xe2\x88\xba", 5, 3, NO },
+    { "Kscr", "\xf0\x9d\x92\xa6", 4, 4, NO },
+    { "ascr", "\xf0\x9d\x92\xb6", 4, 4, NO },
+    { "NotGreaterSlantEqual", "\xe2\xa9\xbe\xcc\xb8", 20, 5, NO },
+    { "blk12", "\xe2\x96\x92", 5, 3, NO },
+    { "rightsquigarrow", "\xe2\x86\x9d", 15, 3, NO },
+    { "SucceedsTilde", "\xe2\x89\xbf", 13, 3, NO },
+    { "block", "\xe2\x96\x88", 5, 3, NO },
+    { "Proportional", "\xe2\x88\x9d", 12, 3, NO },
+    { "upharpoonright", "\xe2\x86\xbe", 14, 3, NO },
+    { "nleqslant", "\xe2\xa9\xbd\xcc\xb8", 9, 5, NO },
+    { "hardcy", "\xd1\x8a", 6, 2, NO },
+    { "LeftRightArrow", "\xe2\x86\x94", 14, 3, NO },
+    { "xodot", "\xe2\xa8\x80", 5, 3, NO },
+    { "intercal", "\xe2\x8a\xba", 8, 3, NO },
+    { "varrho", "\xcf\xb1", 6, 2, NO },
+    { "THORN", "\xc3\x9e", 5, 2, YES },
+    { "boxplus", "\xe2\x8a\x9e", 7, 3, NO },
+    { "dbkarow", "\xe2\xa4\x8f", 7, 3, NO },
+    { "iexcl", "\xc2\xa1", 5, 2, YES },
+    { "lowast", "\xe2\x88\x97", 6, 3, NO },
+    { "Gdot", "\xc4\xa0", 4, 2, NO },
+    { "lcub", "{", 4, 1, NO },
+    { "frac12", "\xc2\xbd", 6, 2, YES },
+    { "Rsh", "\xe2\x86\xb1", 3, 3, NO },
+    { "NewLine", "\x0a", 7, 1, NO },
+    { "boxUR", "\xe2\x95\x9a", 5, 3, NO },
+    { "egs", "\xe2\xaa\x96", 3, 3, NO },
+    { "uacute", "\xc3\xba", 6, 2, YES },
+    { "RightUpVector", "\xe2\x86\xbe", 13, 3, NO },
+    { "ulcorner", "\xe2\x8c\x9c", 8, 3, NO },
+    { "lsh", "\xe2\x86\xb0", 3, 3, NO },
+    { "Leftarrow", "\xe2\x87\x90", 9, 3, NO },
+    { "nless", "\xe2\x89\xae", 5, 3, NO },
+    { "omicron", "\xce\xbf", 7, 2, NO },
+    { "mfr", "\xf0\x9d\x94\xaa", 3, 4, NO },
+    { "gtrsim", "\xe2\x89\xb3", 6, 3, NO },
+    { "wedbar", "\xe2\xa9\x9f", 6, 3, NO },
+    { "biguplus", "\xe2\xa8\x84", 8, 3, NO },
+    { "sacute", "\xc5\x9b", 6, 2, NO },
+    { "UpperRightArrow", "\xe2\x86\x97", 15, 3, NO },
+    { "angrt", "\xe2\x88\x9f", 5, 3, NO },
+    { "rrarr", "\xe2\x87\x89", 5, 3, NO },
+    { "Coproduct", "\xe2\x88\x90", 9, 3, NO },
+    { "rarrfs", "\xe2\xa4\x9e", 6, 3, NO },
+    { "PrecedesSlantEqual", "\xe2\x89\xbc", 18, 3, NO },
+    { "varnothing", "\xe2\x88\x85", 10, 3, NO },
+    { "inodot", "\xc4\xb1", 6, 2, NO },
+    { "nsccue", "\xe2\x8b\xa1", 6, 3, NO },
+    { "Cayleys", "\xe2\x84\xad", 7, 3, NO },
+    { "sigmav", "\xcf\x82", 6, 2, NO },
+    { "plusmn", "\xc2\xb1", 6, 2, YES },
+    { "sigma", "\xcf\x83", 5, 2, NO },
+    { "dtdot", "\xe2\x8b\xb1", 5, 3, NO },
+    { "boxUr", "\xe2\x95\x99", 5, 3, NO },
+    { "Breve", "\xcb\x98", 5, 2, NO },
+    { "bsim", "\xe2\x88\xbd", 4, 3, NO },
+    { "ltdot", "\xe2\x8b\x96", 5, 3, NO },
+    { "Mfr", "\xf0\x9d\x94\x90", 3, 4, NO },
+    { "boxvl", "\xe2\x94\xa4", 5, 3, NO },
+    { "omega", "\xcf\x89", 5, 2, NO },
+    { "NotHumpEqual", "\xe2\x89\x8f\xcc\xb8", 12, 5, NO },
+    { "NotLess", "\xe2\x89\xae", 7, 3, NO },
+    { "plussim", "\xe2\xa8\xa6", 7, 3, NO },
+    { "triminus", "\xe2\xa8\xba", 8, 3, NO },
+    { "dblac", "\xcb\x9d", 5, 2, NO },
+    { "robrk", "\xe2\x9f\xa7", 5, 3, NO },
+    { "Upsi", "\xcf\x92", 4, 2, NO },
+    { "erDot", "\xe2\x89\x93", 5, 3, NO },
+    { "scnap", "\xe2\xaa\xba", 5, 3, NO },
+    { "drbkarow", "\xe2\xa4\x90", 8, 3, NO },
+    { "Otimes", "\xe2\xa8\xb7", 6, 3, NO },
+    { "rarrlp", "\xe2\x86\xac", 6, 3, NO },
+    { "COPY", "\xc2\xa9", 4, 2, YES },
+    { "xnis", "\xe2\x8b\xbb", 4, 3, NO },
+    { "nvdash", "\xe2\x8a\xac", 6, 3, NO },
+    { "dsol", "\xe2\xa7\xb6", 4, 3, NO },
+    { "rarrhk", "\xe2\x86\xaa", 6, 3, NO },
+    { "Colone", "\xe2\xa9\xb4", 6, 3, NO },
+    { "bigsqcup", "\xe2\xa8\x86", 8, 3, NO },
+    { "Assign", "\xe2\x89\x94", 6, 3, NO },
+    { "VerticalSeparator", "\xe2\x9d\x98", 17, 3, NO },
+    { "yopf", "\xf0\x9d\x95\xaa", 4, 4, NO },
+    { "succeq", "\xe2\xaa\xb0", 6, 3, NO },
+    { "erarr", "\xe2\xa5\xb1", 5, 3, NO },
+    { "vartriangleright", "\xe2\x8a\xb3", 16, 3, NO },
+    { "NotPrecedesEqual", "\xe2\xaa\xaf\xcc\xb8", 16, 5, NO },
+    { "qscr", "\xf0\x9d\x93\x86", 4, 4, NO },
+    { "CounterClockwiseContourIntegral", "\xe2\x88\xb3", 31, 3, NO },
+    { "iacute", "\xc3\xad", 6, 2, YES },
+    { "cross", "\xe2\x9c\x97", 5, 3, NO },
+    { "supnE", "\xe2\xab\x8c", 5, 3, NO },
+    { "cuepr", "\xe2\x8b\x9e", 5, 3, NO },
+    { "yicy", "\xd1\x97", 4, 2, NO },
+    { "rect", "\xe2\x96\xad", 4, 3, NO },
+    { "le", "\xe2\x89\xa4", 2, 3, NO },
+    { "lap", "\xe2\xaa\x85", 3, 3, NO },
+    { "topf", "\xf0\x9d\x95\xa5", 4, 4, NO },
+    { "boxh", "\xe2\x94\x80", 4, 3, NO },
+    { "uml", "\xc2\xa8", 3, 2, YES },
+    { "squarf", "\xe2\x96\xaa", 6, 3, NO },
+    { "boxhu", "\xe2\x94\xb4", 5, 3, NO },
+    { "LeftTeeArrow", "\xe2\x86\xa4", 12, 3, NO },
+    { "hcirc", "\xc4\xa5", 5, 2, NO },
+    { "nVdash", "\xe2\x8a\xae", 6, 3, NO },
+    { "circleddash", "\xe2\x8a\x9d", 11, 3, NO },
+    { "triangle", "\xe2\x96\xb5", 8, 3, NO },
+    { "sdote", "\xe2\xa9\xa6", 5, 3, NO },
+    { "Iopf", "\xf0\x9d\x95\x80", 4, 4, NO },
+    { "Lcy", "\xd0\x9b", 3, 2, NO },
+    { "nsqsupe", "\xe2\x8b\xa3", 7, 3, NO },
+    { "coloneq", "\xe2\x89\x94", 7, 3, NO },
+    { "Nacute", "\xc5\x83", 6, 2, NO },
+    { "Amacr", "\xc4\x80", 5, 2, NO },
+    { "micro", "\xc2\xb5", 5, 2, YES },
+    { "Cacute", "\xc4\x86", 6, 2, NO },
+    { "LJcy", "\xd0\x89", 4, 2, NO },
+    { "Cscr", "\xf0\x9d\x92\x9e", 4, 4, NO },
+    { "rlm", "\xe2\x80\x8f", 3, 3, NO },
+    { "egsdot", "\xe2\xaa\x98", 6, 3, NO },
+    { "smeparsl", "\xe2\xa7\xa4", 8, 3, NO },
+    { "Cdot", "\xc4\x8a", 4, 2, NO },
+    { "VerticalLine", "|", 12, 1, NO },
+    { "nexists", "\xe2\x88\x84", 7, 3, NO },
+    { "duhar", "\xe2\xa5\xaf", 5, 3, NO },
+    { "iprod", "\xe2\xa8\xbc", 5, 3, NO },
+    { "ulcrop", "\xe2\x8c\x8f", 6, 3, NO },
+    { "szlig", "\xc3\x9f", 5, 2, YES },
+    { "shcy", "\xd1\x88", 4, 2, NO },
+    { "ltimes", "\xe2\x8b\x89", 6, 3, NO },
+    { "cylcty", "\xe2\x8c\xad", 6, 3, NO },
+    { "les", "\xe2\xa9\xbd", 3, 3, NO },
+    { "swarhk", "\xe2\xa4\xa6", 6, 3, NO },
+    { "frac56", "\xe2\x85\x9a", 6, 3, NO },
+    { "vee", "\xe2\x88\xa8", 3, 3, NO },
+    { "Hopf", "\xe2\x84\x8d", 4, 3, NO },
+    { "langle", "\xe2\x9f\xa8", 6, 3, NO },
+    { "npart", "\xe2\x88\x82\xcc\xb8", 5, 5, NO },
+    { "oS", "\xe2\x93\x88", 2, 3, NO },
+    { "curlyeqprec", "\xe2\x8b\x9e", 11, 3, NO },
+    { "rharu", "\xe2\x87\x80", 5, 3, NO },
+    { "lmoust", "\xe2\x8e\xb0", 6, 3, NO },
+    { "els", "\xe2\xaa\x95", 3, 3, NO },
+    { "ddotseq", "\xe2\xa9\xb7", 7, 3, NO },
+    { "NotLeftTriangle", "\xe2\x8b\xaa", 15, 3, NO },
+    { "nprcue", "\xe2\x8b\xa0", 6, 3, NO },
+    { "nparallel", "\xe2\x88\xa6", 9, 3, NO },
+    { "igrave", "\xc3\xac", 6, 2, YES },
+    { "sect", "\xc2\xa7", 4, 2, YES },
+    { "permil", "\xe2\x80\xb0", 6, 3, NO },
+    { "laquo", "\xc2\xab", 5, 2, YES },
+    { "wcirc", "\xc5\xb5", 5, 2, NO },
+    { "ijlig", "\xc4\xb3", 5, 2, NO },
+    { "utilde", "\xc5\xa9", 6, 2, NO },
+    { "ffllig", "\xef\xac\x84", 6, 3, NO },
+    { "dcy", "\xd0\xb4", 3, 2, NO },
+    { "colone", "\xe2\x89\x94", 6, 3, NO },
+    { "rho", "\xcf\x81", 3, 2, NO },
+    { "Rscr", "\xe2\x84\x9b", 4, 3, NO },
+    { "nvrtrie", "\xe2\x8a\xb5\xe2\x83\x92", 7, 6, NO },
+    { "DoubleDot", "\xc2\xa8", 9, 2, NO },
+    { "lArr", "\xe2\x87\x90", 4, 3, NO },
+    { "solb", "\xe2\xa7\x84", 4, 3, NO },
+    { "egrave", "\xc3\xa8", 6, 2, YES },
+    { "udhar", "\xe2\xa5\xae", 5, 3, NO },
+    { "Pfr", "\xf0\x9d\x94\x93", 3, 4, NO },
+    { "lthree", "\xe2\x8b\x8b", 6, 3, NO },
+    { "acy", "\xd0\xb0", 3, 2, NO },
+    { "nVDash", "\xe2\x8a\xaf", 6, 3, NO },
+    { "gel", "\xe2\x8b\x9b", 3, 3, NO },
+    { "Jopf", "\xf0\x9d\x95\x81", 4, 4, NO },
+    { "Nfr", "\xf0\x9d\x94\x91", 3, 4, NO },
+    { "gnsim", "\xe2\x8b\xa7", 5, 3, NO },
+    { "boxVh", "\xe2\x95\xab", 5, 3, NO },
+    { "subsup", "\xe2\xab\x93", 6, 3, NO },
+    { "Vee", "\xe2\x8b\x81", 3, 3, NO },
+    { "percnt", "%", 6, 1, NO },
+    { "mid", "\xe2\x88\xa3", 3, 3, NO },
+    { "thickapprox", "\xe2\x89\x88", 11, 3, NO },
+    { "lessgtr", "\xe2\x89\xb6", 7, 3, NO },
+    { "tstrok", "\xc5\xa7", 6, 2, NO },
+    { "bumpE", "\xe2\xaa\xae", 5, 3, NO },
+    { "dot", "\xcb\x99", 3, 2, NO },
+    { "blacktriangleright", "\xe2\x96\xb8", 18, 3, NO },
+    { "Edot", "\xc4\x96", 4, 2, NO },
+    { "DoubleLongRightArrow", "\xe2\x9f\xb9", 20, 3, NO },
+    { "SHcy", "\xd0\xa8", 4, 2, NO },
+    { "varr", "\xe2\x86\x95", 4, 3, NO },
+    { "ropf", "\xf0\x9d\x95\xa3", 4, 4, NO },
+    { "spades", "\xe2\x99\xa0", 6, 3, NO },
+    { "otimes", "\xe2\x8a\x97", 6, 3, NO },
+    { "Vscr", "\xf0\x9d\x92\xb1", 4, 4, NO },
+    { "eDDot", "\xe2\xa9\xb7", 5, 3, NO },
+    { "scap", "\xe2\xaa\xb8", 4, 3, NO },
+    { "rarrtl", "\xe2\x86\xa3", 6, 3, NO },
+    { "Leftrightarrow", "\xe2\x87\x94", 14, 3, NO },
+    { "UnderParenthesis", "\xe2\x8f\x9d", 16, 3, NO },
+    { "Or", "\xe2\xa9\x94", 2, 3, NO },
+    { "mlcp", "\xe2\xab\x9b", 4, 3, NO },
+    { "andand", "\xe2\xa9\x95", 6, 3, NO },
+    { "Gamma", "\xce\x93", 5, 2, NO },
+    { "llarr", "\xe2\x87\x87", 5, 3, NO },
+    { "cacute", "\xc4\x87", 6, 2, NO },
+    { "NotSquareSubsetEqual", "\xe2\x8b\xa2", 20, 3, NO },
+    { "verbar", "|", 6, 1, NO },
+    { "Acy", "\xd0\x90", 3, 2, NO },
+    { "infin", "\xe2\x88\x9e", 5, 3, NO },
+    { "rbrkslu", "\xe2\xa6\x90", 7, 3, NO },
+    { "varsubsetneq", "\xe2\x8a\x8a\xef\xb8\x80", 12, 6, NO },
+    { "larr", "\xe2\x86\x90", 4, 3, NO },
+    { "nsubE", "\xe2\xab\x85\xcc\xb8", 5, 5, NO },
+    { "uscr", "\xf0\x9d\x93\x8a", 4, 4, NO },
+    { "rdca", "\xe2\xa4\xb7", 4, 3, NO },
+    { "bepsi", "\xcf\xb6", 5, 2, NO },
+    { "larrfs", "\xe2\xa4\x9d", 6, 3, NO },
+    { "Ascr", "\xf0\x9d\x92\x9c", 4, 4, NO },
+    { "bne", "=\xe2\x83\xa5", 3, 4, NO },
+    { "boxUl", "\xe2\x95\x9c", 5, 3, NO },
+    { "TildeEqual", "\xe2\x89\x83", 10, 3, NO },
+    { "KHcy", "\xd0\xa5", 4, 2, NO },
+    { "tritime", "\xe2\xa8\xbb", 7, 3, NO },
+    { "there4", "\xe2\x88\xb4", 6, 3, NO },
+    { "capcap", "\xe2\xa9\x8b", 6, 3, NO },
+    { "Xfr", "\xf0\x9d\x94\x9b", 3, 4, NO },
+    { "vsubnE", "\xe2\xab\x8b\xef\xb8\x80", 6, 6, NO },
+    { "supseteq", "\xe2\x8a\x87", 8, 3, NO },
+    { "Lleftarrow", "\xe2\x87\x9a", 10, 3, NO },
+    { "squ", "\xe2\x96\xa1", 3, 3, NO },
+    { "Euml", "\xc3\x8b", 4, 2, YES },
+    { "dstrok", "\xc4\x91", 6, 2, NO },
+    { "Copf", "\xe2\x84\x82", 4, 3, NO },
+    { "Longrightarrow", "\xe2\x9f\xb9", 14, 3, NO },
+    { "bnot", "\xe2\x8c\x90", 4, 3, NO },
+    { "rhov", "\xcf\xb1", 4, 2, NO },
+    { "nvDash", "\xe2\x8a\xad", 6, 3, NO },
+    { "parsl", "\xe2\xab\xbd", 5, 3, NO },
+    { "prime", "\xe2\x80\xb2", 5, 3, NO },
+    { "xrArr", "\xe2\x9f\xb9", 5, 3, NO },
+    { "LessTilde", "\xe2\x89\xb2", 9, 3, NO },
+    { "ac", "\xe2\x88\xbe", 2, 3, NO },
+    { "frown", "\xe2\x8c\xa2", 5, 3, NO },
+    { "ncong", "\xe2\x89\x87", 5, 3, NO },
+    { "Zacute", "\xc5\xb9", 6, 2, NO },
+    { "Lambda", "\xce\x9b", 6, 2, NO },
+    { "LessLess", "\xe2\xaa\xa1", 8, 3, NO },
+    { "curlywedge", "\xe2\x8b\x8f", 10, 3, NO },
+    { "Vbar", "\xe2\xab\xab", 4, 3, NO },
+    { "nedot", "\xe2\x89\x90\xcc\xb8", 5, 5, NO },
+    { "ngsim", "\xe2\x89\xb5", 5, 3, NO },
+    { "ltcc", "\xe2\xaa\xa6", 4, 3, NO },
+    { "tridot", "\xe2\x97\xac", 6, 3, NO },
+    { "Hacek", "\xcb\x87", 5, 2, NO },
+    { "parsim", "\xe2\xab\xb3", 6, 3, NO },
+    { "Gscr", "\xf0\x9d\x92\xa2", 4, 4, NO },
+    { "nhArr", "\xe2\x87\x8e", 5, 3, NO },
+    { "larrsim", "\xe2\xa5\xb3", 7, 3, NO },
+    { "nge", "\xe2\x89\xb1", 3, 3, NO },
+    { "rtrie", "\xe2\x8a\xb5", 5, 3, NO },
+    { "Rcy", "\xd0\xa0", 3, 2, NO },
+    { "NoBreak", "\xe2\x81\xa0", 7, 3, NO },
+    { "smashp", "\xe2\xa8\xb3", 6, 3, NO },
+    { "qfr", "\xf0\x9d\x94\xae", 3, 4, NO },
+    { "DScy", "\xd0\x85", 4, 2, NO },
+    { "kappa", "\xce\xba", 5, 2, NO },
+    { "zigrarr", "\xe2\x87\x9d", 7, 3, NO },
+    { "CloseCurlyDoubleQuote", "\xe2\x80\x9d", 21, 3, NO },
+    { "Zcy", "\xd0\x97", 3, 2, NO },
+    { "TildeFullEqual", "\xe2\x89\x85", 14, 3, NO },
+    { "ldca", "\xe2\xa4\xb6", 4, 3, NO },
+    { "parallel", "\xe2\x88\xa5", 8, 3, NO },
+    { "cuesc", "\xe2\x8b\x9f", 5, 3, NO },
+    { "Longleftrightarrow", "\xe2\x9f\xba", 18, 3, NO },
+    { "rdquo", "\xe2\x80\x9d", 5, 3, NO },
+    { "bigwedge", "\xe2\x8b\x80", 8, 3, NO },
+    { "xotime", "\xe2\xa8\x82", 6, 3, NO },
+    { "Fcy", "\xd0\xa4", 3, 2, NO },
+    { "beta", "\xce\xb2", 4, 2, NO },
+    { "Laplacetrf", "\xe2\x84\x92", 10, 3, NO },
+    { "ycy", "\xd1\x8b", 3, 2, NO },
+    { "Nu", "\xce\x9d", 2, 2, NO },
+    { "boxdr", "\xe2\x94\x8c", 5, 3, NO },
+    { "Sacute", "\xc5\x9a", 6, 2, NO },
+    { "blk14", "\xe2\x96\x91", 5, 3, NO },
+    { "NotCupCap", "\xe2\x89\xad", 9, 3, NO },
+    { "SquareUnion", "\xe2\x8a\x94", 11, 3, NO },
+    { "nLeftrightarrow", "\xe2\x87\x8e", 15, 3, NO },
+    { "gtrdot", "\xe2\x8b\x97", 6, 3, NO },
+    { "qint", "\xe2\xa8\x8c", 4, 3, NO },
+    { "GreaterFullEqual", "\xe2\x89\xa7", 16, 3, NO },
+    { "ShortLeftArrow", "\xe2\x86\x90", 14, 3, NO },
+    { "thksim", "\xe2\x88\xbc", 6, 3, NO },
+    { "DownLeftRightVector", "\xe2\xa5\x90", 19, 3, NO },
+    { "rangd", "\xe2\xa6\x92", 5, 3, NO },
+    { "capdot", "\xe2\xa9\x80", 6, 3, NO },
+    { "scE", "\xe2\xaa\xb4", 3, 3, NO },
+    { "ecolon", "\xe2\x89\x95", 6, 3, NO },
+    { "wp", "\xe2\x84\x98", 2, 3, NO },
+    { "lt", "<", 2, 1, YES },
+    { "nvge", "\xe2\x89\xa5\xe2\x83\x92", 4, 6, NO },
+    { "LeftAngleBracket", "\xe2\x9f\xa8", 16, 3, NO },
+    { "qopf", "\xf0\x9d\x95\xa2", 4, 4, NO },
+    { "darr", "\xe2\x86\x93", 4, 3, NO },
+    { "amalg", "\xe2\xa8\xbf", 5, 3, NO },
+    { "frac45", "\xe2\x85\x98", 6, 3, NO },
+    { "curlyeqsucc", "\xe2\x8b\x9f", 11, 3, NO },
+    { "rdldhar", "\xe2\xa5\xa9", 7, 3, NO },
+    { "frac15", "\xe2\x85\x95", 6, 3, NO },
+    { "nsub", "\xe2\x8a\x84", 4, 3, NO },
+    { "boxuL", "\xe2\x95\x9b", 5, 3, NO },
+    { "gtreqqless", "\xe2\xaa\x8c", 10, 3, NO },
+    { "uarr", "\xe2\x86\x91", 4, 3, NO },
+    { "Ocirc", "\xc3\x94", 5, 2, YES },
+    { "Theta", "\xce\x98", 5, 2, NO },
+    { "fscr", "\xf0\x9d\x92\xbb", 4, 4, NO },
+    { "leftrightsquigarrow", "\xe2\x86\xad", 19, 3, NO },
+    { "el", "\xe2\xaa\x99", 2, 3, NO },
+    { "Uopf", "\xf0\x9d\x95\x8c", 4, 4, NO },
+    { "DiacriticalGrave", "`", 16, 1, NO },
+    { "bbrktbrk", "\xe2\x8e\xb6", 8, 3, NO },
+    { "ApplyFunction", "\xe2\x81\xa1", 13, 3, NO },
+    { "fpartint", "\xe2\xa8\x8d", 8, 3, NO },
+    { "TildeTilde", "\xe2\x89\x88", 10, 3, NO },
+    { "sube", "\xe2\x8a\x86", 4, 3, NO },
+    { "barwed", "\xe2\x8c\x85", 6, 3, NO },
+    { "rarrbfs", "\xe2\xa4\xa0", 7, 3, NO },
+    { "Eogon", "\xc4\x98", 5, 2, NO },
+    { "exponentiale", "\xe2\x85\x87", 12, 3, NO },
+    { "ominus", "\xe2\x8a\x96", 6, 3, NO },
+    { "lcy", "\xd0\xbb", 3, 2, NO },
+    { "OverBrace", "\xe2\x8f\x9e", 9, 3, NO },
+    { "Dopf", "\xf0\x9d\x94\xbb", 4, 4, NO },
+    { "ucirc", "\xc3\xbb", 5, 2, YES },
+    { "Union", "\xe2\x8b\x83", 5, 3, NO },
+    { "oelig", "\xc5\x93", 5, 2, NO },
+    { "subsub", "\xe2\xab\x95", 6, 3, NO },
+    { "gacute", "\xc7\xb5", 6, 2, NO },
+    { "ee", "\xe2\x85\x87", 2, 3, NO },
+    { "iiota", "\xe2\x84\xa9", 5, 3, NO },
+    { "Ccedil", "\xc3\x87", 6, 2, YES },
+    { "Epsilon", "\xce\x95", 7, 2, NO },
+    { "Egrave", "\xc3\x88", 6, 2, YES },
+    { "nsupe", "\xe2\x8a\x89", 5, 3, NO },
+    { "harrcir", "\xe2\xa5\x88", 7, 3, NO },
+    { "boxDR", "\xe2\x95\x94", 5, 3, NO },
+    { "fcy", "\xd1\x84", 3, 2, NO },
+    { "LessSlantEqual", "\xe2\xa9\xbd", 14, 3, NO },
+    { "lacute", "\xc4\xba", 6, 2, NO },
+    { "napid", "\xe2\x89\x8b\xcc\xb8", 5, 5, NO },
+    { "boxdL", "\xe2\x95\x95", 5, 3, NO },
+    { "ssmile", "\xe2\x8c\xa3", 6, 3, NO },
+    { "quest", "\x3f", 5, 1, NO },
+    { "sqsupe", "\xe2\x8a\x92", 6, 3, NO },
+    { "sigmaf", "\xcf\x82", 6, 2, NO },
+    { "OverBracket", "\xe2\x8e\xb4", 11, 3, NO },
+    { "lsime", "\xe2\xaa\x8d", 5, 3, NO },
+    { "tfr", "\xf0\x9d\x94\xb1", 3, 4, NO },
+    { "DownArrowBar", "\xe2\xa4\x93", 12, 3, NO },
+    { "fflig", "\xef\xac\x80", 5, 3, NO },
+    { "alefsym", "\xe2\x84\xb5", 7, 3, NO },
+    { "UpDownArrow", "\xe2\x86\x95", 11, 3, NO },
+    { "DZcy", "\xd0\x8f", 4, 2, NO },
+    { "and", "\xe2\x88\xa7", 3, 3, NO },
+    { "SquareSubset", "\xe2\x8a\x8f", 12, 3, NO },
+    { "psi", "\xcf\x88", 3, 2, NO },
+    { "Eacute", "\xc3\x89", 6, 2, YES },
+    { "ecy", "\xd1\x8d", 3, 2, NO },
+    { "LessEqualGreater", "\xe2\x8b\x9a", 16, 3, NO },
+    { "vopf", "\xf0\x9d\x95\xa7", 4, 4, NO },
+    { "nearrow", "\xe2\x86\x97", 7, 3, NO },
+    { "nrarrc", "\xe2\xa4\xb3\xcc\xb8", 6, 5, NO },
+    { "divide", "\xc3\xb7", 6, 2, YES },
+    { "supsetneq", "\xe2\x8a\x8b", 9, 3, NO },
+    { "weierp", "\xe2\x84\x98", 6, 3, NO },
+    { "plusdu", "\xe2\xa8\xa5", 6, 3, NO },
+    { "Gcy", "\xd0\x93", 3, 2, NO },
+    { "timesb", "\xe2\x8a\xa0", 6, 3, NO },
+    { "eqslantgtr", "\xe2\xaa\x96", 10, 3, NO },
+    { "nsucc", "\xe2\x8a\x81", 5, 3, NO },
+    { "softcy", "\xd1\x8c", 6, 2, NO },
+    { "sup3", "\xc2\xb3", 4, 2, YES },
+    { "ell", "\xe2\x84\x93", 3, 3, NO },
+    { "crarr", "\xe2\x86\xb5", 5, 3, NO },
+    { "lharu", "\xe2\x86\xbc", 5, 3, NO },
+    { "Phi", "\xce\xa6", 3, 2, NO },
+    { "Bernoullis", "\xe2\x84\xac", 10, 3, NO },
+    { "imagpart", "\xe2\x84\x91", 8, 3, NO },
+    { "Kappa", "\xce\x9a", 5, 2, NO },
+    { "Rcedil", "\xc5\x96", 6, 2, NO },
+    { "nvle", "\xe2\x89\xa4\xe2\x83\x92", 4, 6, NO },
+    { "Iacute", "\xc3\x8d", 6, 2, YES },
+    { "bcong", "\xe2\x89\x8c", 5, 3, NO },
+    { "Zscr", "\xf0\x9d\x92\xb5", 4, 4, NO },
+    { "sim", "\xe2\x88\xbc", 3, 3, NO },
+    { "InvisibleTimes", "\xe2\x81\xa2", 14, 3, NO },
+    { "rceil", "\xe2\x8c\x89", 5, 3, NO },
+    { "csub", "\xe2\xab\x8f", 4, 3, NO },
+    { "dharl", "\xe2\x87\x83", 5, 3, NO },
+    { "supseteqq", "\xe2\xab\x86", 9, 3, NO },
+    { "vprop", "\xe2\x88\x9d", 5, 3, NO },
+    { "Uarrocir", "\xe2\xa5\x89", 8, 3, NO },
+    { "veeeq", "\xe2\x89\x9a", 5, 3, NO },
+    { "boxv", "\xe2\x94\x82", 4, 3, NO },
+    { "rightharpoondown", "\xe2\x87\x81", 16, 3, NO },
+    { "ffr", "\xf0\x9d\x94\xa3", 3, 4, NO },
+    { "empty", "\xe2\x88\x85", 5, 3, NO },
+    { "Rarrtl", "\xe2\xa4\x96", 6, 3, NO },
+    { "srarr", "\xe2\x86\x92", 5, 3, NO },
+    { "varpropto", "\xe2\x88\x9d", 9, 3, NO },
+    { "vltri", "\xe2\x8a\xb2", 5, 3, NO },
+    { "dagger", "\xe2\x80\xa0", 6, 3, NO },
+    { "IEcy", "\xd0\x95", 4, 2, NO },
+    { "khcy", "\xd1\x85", 4, 2, NO },
+    { "suphsub", "\xe2\xab\x97", 7, 3, NO },
+    { "ldrdhar", "\xe2\xa5\xa7", 7, 3, NO },
+    { "plusdo", "\xe2\x88\x94", 6, 3, NO },
+    { "hslash", "\xe2\x84\x8f", 6, 3, NO },
+    { "ldsh", "\xe2\x86\xb2", 4, 3, NO },
+    { "smt", "\xe2\xaa\xaa", 3, 3, NO },
+    { "sqsupseteq", "\xe2\x8a\x92", 10, 3, NO },
+    { "REG", "\xc2\xae", 3, 2, YES },
+    { "lvnE", "\xe2\x89\xa8\xef\xb8\x80", 4, 6, NO },
+    { "simgE", "\xe2\xaa\xa0", 5, 3, NO },
+    { "gsime", "\xe2\xaa\x8e", 5, 3, NO },
+    { "subseteq", "\xe2\x8a\x86", 8, 3, NO },
+    { "Bscr", "\xe2\x84\xac", 4, 3, NO },
+    { "odash", "\xe2\x8a\x9d", 5, 3, NO },
+    { "Tscr", "\xf0\x9d\x92\xaf", 4, 4, NO },
+    { "DotDot", "\xe2\x83\x9c", 6, 3, NO },
+    { "planckh", "\xe2\x84\x8e", 7, 3, NO },
+    { "nLeftarrow", "\xe2\x87\x8d", 10, 3, NO },
+    { "varkappa", "\xcf\xb0", 8, 2, NO },
+    { "Iscr", "\xe2\x84\x90", 4, 3, NO },
+    { "ZeroWidthSpace", "\xe2\x80\x8b", 14, 3, NO },
+    { "RightUpTeeVector", "\xe2\xa5\x9c", 16, 3, NO },
+    { "DiacriticalDoubleAcute", "\xcb\x9d", 22, 2, NO },
+    { "becaus", "\xe2\x88\xb5", 6, 3, NO },
+    { "DownLeftTeeVector", "\xe2\xa5\x9e", 17, 3, NO },
+    { "bNot", "\xe2\xab\xad", 4, 3, NO },
+    { "apid", "\xe2\x89\x8b", 4, 3, NO },
+    { "langd", "\xe2\xa6\x91", 5, 3, NO },
+    { "boxur", "\xe2\x94\x94", 5, 3, NO },
+    { "LowerLeftArrow", "\xe2\x86\x99", 14, 3, NO },
+    { "midast", "*", 6, 1, NO },
+    { "image", "\xe2\x84\x91", 5, 3, NO },
+    { "qprime", "\xe2\x81\x97", 6, 3, NO },
+    { "succnapprox", "\xe2\xaa\xba", 11, 3, NO },
+    { "notinvb", "\xe2\x8b\xb7", 7, 3, NO },
+    { "harrw", "\xe2\x86\xad", 5, 3, NO },
+    { "Equal", "\xe2\xa9\xb5", 5, 3, NO },
+    { "ddagger", "\xe2\x80\xa1", 7, 3, NO },
+    { "lesssim", "\xe2\x89\xb2", 7, 3, NO },
+    { "RightArrowLeftArrow", "\xe2\x87\x84", 19, 3, NO },
+    { "smile", "\xe2\x8c\xa3", 5, 3, NO },
+    { "wopf", "\xf0\x9d\x95\xa8", 4, 4, NO },
+    { "NotLessLess", "\xe2\x89\xaa\xcc\xb8", 11, 5, NO },
+    { "puncsp", "\xe2\x80\x88", 6, 3, NO },
+    { "hoarr", "\xe2\x87\xbf", 5, 3, NO },
+    { "Lang", "\xe2\x9f\xaa", 4, 3, NO },
+    { "xcap", "\xe2\x8b\x82", 4, 3, NO },
+    { "chi", "\xcf\x87", 3, 2, NO },
+    { "flat", "\xe2\x99\xad", 4, 3, NO },
+    { "VDash", "\xe2\x8a\xab", 5, 3, NO },
+    { "andslope", "\xe2\xa9\x98", 8, 3, NO },
+    { "zacute", "\xc5\xba", 6, 2, NO },
+    { "mp", "\xe2\x88\x93", 2, 3, NO },
+    { "apE", "\xe2\xa9\xb0", 3, 3, NO },
+    { "ImaginaryI", "\xe2\x85\x88", 10, 3, NO },
+    { "xfr", "\xf0\x9d\x94\xb5", 3, 4, NO },
+    { "LeftTeeVector", "\xe2\xa5\x9a", 13, 3, NO },
+    { "GreaterGreater", "\xe2\xaa\xa2", 14, 3, NO },
+    { "emacr", "\xc4\x93", 5, 2, NO },
+    { "NotRightTriangleEqual", "\xe2\x8b\xad", 21, 3, NO },
+    { "ograve", "\xc3\xb2", 6, 2, YES },
+    { "beth", "\xe2\x84\xb6", 4, 3, NO },
+    { "gvertneqq", "\xe2\x89\xa9\xef\xb8\x80", 9, 6, NO },
+    { "pertenk", "\xe2\x80\xb1", 7, 3, NO },
+    { "cup", "\xe2\x88\xaa", 3, 3, NO },
+    { "nsqsube", "\xe2\x8b\xa2", 7, 3, NO },
+    { "lhblk", "\xe2\x96\x84", 5, 3, NO },
+    { "solbar", "\xe2\x8c\xbf", 6, 3, NO },
+    { "ncaron", "\xc5\x88", 6, 2, NO },
+    { "larrb", "\xe2\x87\xa4", 5, 3, NO },
+    { "Delta", "\xce\x94", 5, 2, NO },
+    { "NotGreater", "\xe2\x89\xaf", 10, 3, NO },
+    { "scirc", "\xc5\x9d", 5, 2, NO },
+    { "Oacute", "\xc3\x93", 6, 2, YES },
+    { "Rcaron", "\xc5\x98", 6, 2, NO },
+    { "triplus", "\xe2\xa8\xb9", 7, 3, NO },
+    { "Lmidot", "\xc4\xbf", 6, 2, NO },
+    { "LeftDownTeeVector", "\xe2\xa5\xa1", 17, 3, NO },
+    { "zwj", "\xe2\x80\x8d", 3, 3, NO },
+    { "isindot", "\xe2\x8b\xb5", 7, 3, NO },
+    { "gtcc", "\xe2\xaa\xa7", 4, 3, NO },
+    { "lEg", "\xe2\xaa\x8b", 3, 3, NO },
+    { "timesbar", "\xe2\xa8\xb1", 8, 3, NO },
+    { "Tcy", "\xd0\xa2", 3, 2, NO },
+    { "roang", "\xe2\x9f\xad", 5, 3, NO },
+    { "precapprox", "\xe2\xaa\xb7", 10, 3, NO },
+    { "nabla", "\xe2\x88\x87", 5, 3, NO },
+    { "ncap", "\xe2\xa9\x83", 4, 3, NO },
+    { "gtlPar", "\xe2\xa6\x95", 6, 3, NO },
+    { "hyphen", "\xe2\x80\x90", 6, 3, NO },
+    { "glE", "\xe2\xaa\x92", 3, 3, NO },
+    { "xcirc", "\xe2\x97\xaf", 5, 3, NO },
+    { "circlearrowleft", "\xe2\x86\xba", 15, 3, NO },
+    { "iinfin", "\xe2\xa7\x9c", 6, 3, NO },
+    { "EmptySmallSquare", "\xe2\x97\xbb", 16, 3, NO },
+    { "GreaterEqualLess", "\xe2\x8b\x9b", 16, 3, NO },
+    { "Supset", "\xe2\x8b\x91", 6, 3, NO },
+    { "cire", "\xe2\x89\x97", 4, 3, NO },
+    { "checkmark", "\xe2\x9c\x93", 9, 3, NO },
+    { "theta", "\xce\xb8", 5, 2, NO },
+    { "nwArr", "\xe2\x87\x96", 5, 3, NO },
+    { "nbumpe", "\xe2\x89\x8f\xcc\xb8", 6, 5, NO },
+    { "ord", "\xe2\xa9\x9d", 3, 3, NO },
+    { "triangledown", "\xe2\x96\xbf", 12, 3, NO },
+    { "fopf", "\xf0\x9d\x95\x97", 4, 4, NO },
+    { "nvlt", "<\xe2\x83\x92", 4, 4, NO },
+    { "bfr", "\xf0\x9d\x94\x9f", 3, 4, NO },
+    { "DoubleUpArrow", "\xe2\x87\x91", 13, 3, NO },
+    { "LongLeftRightArrow", "\xe2\x9f\xb7", 18, 3, NO },
+    { "larrlp", "\xe2\x86\xab", 6, 3, NO },
+    { "rarrap", "\xe2\xa5\xb5", 6, 3, NO },
+    { "dashv", "\xe2\x8a\xa3", 5, 3, NO },
+    { "rsqb", "]", 4, 1, NO },
+    { "exist", "\xe2\x88\x83", 5, 3, NO },
+    { "rationals", "\xe2\x84\x9a", 9, 3, NO },
+    { "topbot", "\xe2\x8c\xb6", 6, 3, NO },
+    { "Agrave", "\xc3\x80", 6, 2, YES },
+    { "vscr", "\xf0\x9d\x93\x8b", 4, 4, NO },
+    { "Yopf", "\xf0\x9d\x95\x90", 4, 4, NO },
+    { "diams", "\xe2\x99\xa6", 5, 3, NO },
+    { "eth", "\xc3\xb0", 3, 2, YES },
+    { "Racute", "\xc5\x94", 6, 2, NO },
+    { "nwarhk", "\xe2\xa4\xa3", 6, 3, NO },
+    { "suphsol", "\xe2\x9f\x89", 7, 3, NO },
+    { "supset", "\xe2\x8a\x83", 6, 3, NO },
+    { "ecaron", "\xc4\x9b", 6, 2, NO },
+    { "YAcy", "\xd0\xaf", 4, 2, NO },
+    { "gEl", "\xe2\xaa\x8c", 3, 3, NO },
+    { "Dcaron", "\xc4\x8e", 6, 2, NO },
+    { "NotSucceeds", "\xe2\x8a\x81", 11, 3, NO },
+    { "seArr", "\xe2\x87\x98", 5, 3, NO },
+    { "brvbar", "\xc2\xa6", 6, 2, YES },
+    { "supmult", "\xe2\xab\x82", 7, 3, NO },
+    { "Mellintrf", "\xe2\x84\xb3", 9, 3, NO },
+    { "pi", "\xcf\x80", 2, 2, NO },
+    { "xhArr", "\xe2\x9f\xba", 5, 3, NO },
+    { "nspar", "\xe2\x88\xa6", 5, 3, NO },
+    { "kopf", "\xf0\x9d\x95\x9c", 4, 4, NO },
+    { "tcaron", "\xc5\xa5", 6, 2, NO },
+    { "mcy", "\xd0\xbc", 3, 2, NO },
+    { "DotEqual", "\xe2\x89\x90", 8, 3, NO },
+    { "angsph", "\xe2\x88\xa2", 6, 3, NO },
+    { "gvnE", "\xe2\x89\xa9\xef\xb8\x80", 4, 6, NO },
+    { "isinsv", "\xe2\x8b\xb3", 6, 3, NO },
+    { "lE", "\xe2\x89\xa6", 2, 3, NO },
+    { "ThinSpace", "\xe2\x80\x89", 9, 3, NO },
+    { "nap", "\xe2\x89\x89", 3, 3, NO },
+    { "naturals", "\xe2\x84\x95", 8, 3, NO },
+    { "subsetneqq", "\xe2\xab\x8b", 10, 3, NO },
+    { "complexes", "\xe2\x84\x82", 9, 3, NO },
+    { "lurdshar", "\xe2\xa5\x8a", 8, 3, NO },
+    { "smallsetminus", "\xe2\x88\x96", 13, 3, NO },
+    { "boxvr", "\xe2\x94\x9c", 5, 3, NO },
+    { "lgE", "\xe2\xaa\x91", 3, 3, NO },
+    { "rarrw", "\xe2\x86\x9d", 5, 3, NO },
+    { "cirscir", "\xe2\xa7\x82", 7, 3, NO },
+    { "upharpoonleft", "\xe2\x86\xbf", 13, 3, NO },
+    { "notinva", "\xe2\x88\x89", 7, 3, NO },
+    { "hscr", "\xf0\x9d\x92\xbd", 4, 4, NO },
+    { "Sub", "\xe2\x8b\x90", 3, 3, NO },
+    { "UpArrow", "\xe2\x86\x91", 7, 3, NO },
+    { "easter", "\xe2\xa9\xae", 6, 3, NO },
+    { "DoubleLongLeftArrow", "\xe2\x9f\xb8", 19, 3, NO },
+    { "between", "\xe2\x89\xac", 7, 3, NO },
+    { "sfrown", "\xe2\x8c\xa2", 6, 3, NO },
+    { "harr", "\xe2\x86\x94", 4, 3, NO },
+    { "timesd", "\xe2\xa8\xb0", 6, 3, NO },
+    { "dzigrarr", "\xe2\x9f\xbf", 8, 3, NO },
+    { "LeftFloor", "\xe2\x8c\x8a", 9, 3, NO },
+    { "quatint", "\xe2\xa8\x96", 7, 3, NO },
+    { "notin", "\xe2\x88\x89", 5, 3, NO },
+    { "sbquo", "\xe2\x80\x9a", 5, 3, NO },
+    { "NotTildeTilde", "\xe2\x89\x89", 13, 3, NO },
+    { "boxHu", "\xe2\x95\xa7", 5, 3, NO },
+    { "race", "\xe2\x88\xbd\xcc\xb1", 4, 5, NO },
+    { "nsim", "\xe2\x89\x81", 4, 3, NO },
+    { "Iota", "\xce\x99", 4, 2, NO },
+    { "roarr", "\xe2\x87\xbe", 5, 3, NO },
+    { "tshcy", "\xd1\x9b", 5, 2, NO },
+    { "minusd", "\xe2\x88\xb8", 6, 3, NO },
+    { "LeftTriangleBar", "\xe2\xa7\x8f", 15, 3, NO },
+    { "Ubreve", "\xc5\xac", 6, 2, NO },
+    { "vdash", "\xe2\x8a\xa2", 5, 3, NO },
+    { "iocy", "\xd1\x91", 4, 2, NO },
+    { "Oscr", "\xf0\x9d\x92\xaa", 4, 4, NO },
+    { "prnap", "\xe2\xaa\xb9", 5, 3, NO },
+    { "RightDownTeeVector", "\xe2\xa5\x9d", 18, 3, NO },
+    { "caret", "\xe2\x81\x81", 5, 3, NO },
+    { "Tilde", "\xe2\x88\xbc", 5, 3, NO },
+    { "sqsube", "\xe2\x8a\x91", 6, 3, NO },
+    { "bdquo", "\xe2\x80\x9e", 5, 3, NO },
+    { "supE", "\xe2\xab\x86", 4, 3, NO },
+    { "ntgl", "\xe2\x89\xb9", 4, 3, NO },
+    { "upsilon", "\xcf\x85", 7, 2, NO },
+    { "olcir", "\xe2\xa6\xbe", 5, 3, NO },
+    { "rHar", "\xe2\xa5\xa4", 4, 3, NO },
+    { "fallingdotseq", "\xe2\x89\x92", 13, 3, NO },
+    { "rmoustache", "\xe2\x8e\xb1", 10, 3, NO },
+    { "spar", "\xe2\x88\xa5", 4, 3, NO },
+    { "Psi", "\xce\xa8", 3, 2, NO },
+    { "boxdl", "\xe2\x94\x90", 5, 3, NO },
+    { "ratio", "\xe2\x88\xb6", 5, 3, NO },
+    { "notni", "\xe2\x88\x8c", 5, 3, NO },
+    { "rarrsim", "\xe2\xa5\xb4", 7, 3, NO },
+    { "nvlArr", "\xe2\xa4\x82", 6, 3, NO },
+    { "Ugrave", "\xc3\x99", 6, 2, YES },
+    { "vrtri", "\xe2\x8a\xb3", 5, 3, NO },
+    { "gtquest", "\xe2\xa9\xbc", 7, 3, NO },
+    { "ic", "\xe2\x81\xa3", 2, 3, NO },
+    { "late", "\xe2\xaa\xad", 4, 3, NO },
+    { "Udblac", "\xc5\xb0", 6, 2, NO },
+    { "incare", "\xe2\x84\x85", 6, 3, NO },
+    { "notindot", "\xe2\x8b\xb5\xcc\xb8", 8, 5, NO },
+    { "mstpos", "\xe2\x88\xbe", 6, 3, NO },
+    { "And", "\xe2\xa9\x93", 3, 3, NO },
+    { "boxhU", "\xe2\x95\xa8", 5, 3, NO },
+    { "dollar", "$", 6, 1, NO },
+    { "DifferentialD", "\xe2\x85\x86", 13, 3, NO },
+    { "comp", "\xe2\x88\x81", 4, 3, NO },
+    { "nsupE", "\xe2\xab\x86\xcc\xb8", 5, 5, NO },
+    { "xvee", "\xe2\x8b\x81", 4, 3, NO },
+    { "Cfr", "\xe2\x84\xad", 3, 3, NO },
+    { "vellip", "\xe2\x8b\xae", 6, 3, NO },
+    { "looparrowleft", "\xe2\x86\xab", 13, 3, NO },
+    { "eacute", "\xc3\xa9", 6, 2, YES },
+    { "dscr", "\xf0\x9d\x92\xb9", 4, 4, NO },
+    { "Dscr", "\xf0\x9d\x92\x9f", 4, 4, NO },
+    { "precnapprox", "\xe2\xaa\xb9", 11, 3, NO },
+    { "nprec", "\xe2\x8a\x80", 5, 3, NO },
+    { "DiacriticalAcute", "\xc2\xb4", 16, 2, NO },
+    { "oint", "\xe2\x88\xae", 4, 3, NO },
+    { "nsube", "\xe2\x8a\x88", 5, 3, NO },
+    { "iukcy", "\xd1\x96", 5, 2, NO },
+    { "gl", "\xe2\x89\xb7", 2, 3, NO },
+    { "frac78", "\xe2\x85\x9e", 6, 3, NO },
+    { "mapsto", "\xe2\x86\xa6", 6, 3, NO },
+    { "nleqq", "\xe2\x89\xa6\xcc\xb8", 5, 5, NO },
+    { "kcy", "\xd0\xba", 3, 2, NO },
+    { "nrarr", "\xe2\x86\x9b", 5, 3, NO },
+    { "submult", "\xe2\xab\x81", 7, 3, NO },
+    { "vcy", "\xd0\xb2", 3, 2, NO },
+    { "boxvR", "\xe2\x95\x9e", 5, 3, NO },
+    { "eng", "\xc5\x8b", 3, 2, NO },
+    { "mdash", "\xe2\x80\x94", 5, 3, NO },
+    { "ast", "*", 3, 1, NO },
+    { "nfr", "\xf0\x9d\x94\xab", 3, 4, NO },
+    { "Star", "\xe2\x8b\x86", 4, 3, NO },
+    { "awint", "\xe2\xa8\x91", 5, 3, NO },
+    { "not", "\xc2\xac", 3, 2, YES },
+    { "thicksim", "\xe2\x88\xbc", 8, 3, NO },
+    { "NotSucceedsTilde", "\xe2\x89\xbf\xcc\xb8", 16, 5, NO },
+    { "Tab", "\x09", 3, 1, NO },
+    { "reals", "\xe2\x84\x9d", 5, 3, NO },
+    { "nsup", "\xe2\x8a\x85", 4, 3, NO },
+    { "Gcedil", "\xc4\xa2", 6, 2, NO },
+    { "Lt", "\xe2\x89\xaa", 2, 3, NO },
+    { "vangrt", "\xe2\xa6\x9c", 6, 3, NO },
+    { "sime", "\xe2\x89\x83", 4, 3, NO },
+    { "bernou", "\xe2\x84\xac", 6, 3, NO },
+    { "approxeq", "\xe2\x89\x8a", 8, 3, NO },
+    { "oror", "\xe2\xa9\x96", 4, 3, NO },
+    { "njcy", "\xd1\x9a", 4, 2, NO },
+    { "filig", "\xef\xac\x81", 5, 3, NO },
+    { "leftrightarrow", "\xe2\x86\x94", 14, 3, NO },
+    { "nvrArr", "\xe2\xa4\x83", 6, 3, NO },
+    { "cularrp", "\xe2\xa4\xbd", 7, 3, NO },
+    { "rhard", "\xe2\x87\x81", 5, 3, NO },
+    { "GJcy", "\xd0\x83", 4, 2, NO },
+    { "udblac", "\xc5\xb1", 6, 2, NO },
+    { "rppolint", "\xe2\xa8\x92", 8, 3, NO },
+    { "nrarrw", "\xe2\x86\x9d\xcc\xb8", 6, 5, NO },
+    { "pointint", "\xe2\xa8\x95", 8, 3, NO },
+    { "SquareSupersetEqual", "\xe2\x8a\x92", 19, 3, NO },
+    { "eDot", "\xe2\x89\x91", 4, 3, NO },
+    { "SucceedsEqual", "\xe2\xaa\xb0", 13, 3, NO },
+    { "frac35", "\xe2\x85\x97", 6, 3, NO },
+    { "eta", "\xce\xb7", 3, 2, NO },
+    { "iopf", "\xf0\x9d\x95\x9a", 4, 4, NO },
+    { "maltese", "\xe2\x9c\xa0", 7, 3, NO },
+    { "drcorn", "\xe2\x8c\x9f", 6, 3, NO },
+    { "veebar", "\xe2\x8a\xbb", 6, 3, NO },
+    { "RightArrowBar", "\xe2\x87\xa5", 13, 3, NO },
+    { "napos", "\xc5\x89", 5, 2, NO },
+    { "CircleMinus", "\xe2\x8a\x96", 11, 3, NO },
+    { "angmsdae", "\xe2\xa6\xac", 8, 3, NO },
+    { "UpperLeftArrow", "\xe2\x86\x96", 14, 3, NO },
+    { "sfr", "\xf0\x9d\x94\xb0", 3, 4, NO },
+    { "prurel", "\xe2\x8a\xb0", 6, 3, NO },
+    { "iota", "\xce\xb9", 4, 2, NO },
+    { "tcy", "\xd1\x82", 3, 2, NO },
+    { "npre", "\xe2\xaa\xaf\xcc\xb8", 4, 5, NO },
+    { "Int", "\xe2\x88\xac", 3, 3, NO },
+    { "nisd", "\xe2\x8b\xba", 4, 3, NO },
+    { "tdot", "\xe2\x83\x9b", 4, 3, NO },
+    { "minus", "\xe2\x88\x92", 5, 3, NO },
+    { "sum", "\xe2\x88\x91", 3, 3, NO },
+    { "Lopf", "\xf0\x9d\x95\x83", 4, 4, NO },
+    { "nsubseteq", "\xe2\x8a\x88", 9, 3, NO },
+    { "iogon", "\xc4\xaf", 5, 2, NO },
+    { "raemptyv", "\xe2\xa6\xb3", 8, 3, NO },
+    { "Hstrok", "\xc4\xa6", 6, 2, NO },
+    { "rx", "\xe2\x84\x9e", 2, 3, NO },
+    { "simdot", "\xe2\xa9\xaa", 6, 3, NO },
+    { "zeetrf", "\xe2\x84\xa8", 6, 3, NO },
+    { "Vcy", "\xd0\x92", 3, 2, NO },
+    { "lsquor", "\xe2\x80\x9a", 6, 3, NO },
+    { "Succeeds", "\xe2\x89\xbb", 8, 3, NO },
+    { "cupbrcap", "\xe2\xa9\x88", 8, 3, NO },
+    { "swarr", "\xe2\x86\x99", 5, 3, NO },
+    { "SmallCircle", "\xe2\x88\x98", 11, 3, NO },
+    { "xharr", "\xe2\x9f\xb7", 5, 3, NO },
+    { "part", "\xe2\x88\x82", 4, 3, NO },
+    { "dd", "\xe2\x85\x86", 2, 3, NO },
+    { "rightarrow", "\xe2\x86\x92", 10, 3, NO },
+    { "gt", ">", 2, 1, YES },
+    { "RightDoubleBracket", "\xe2\x9f\xa7", 18, 3, NO },
+    { "Tau", "\xce\xa4", 3, 2, NO },
+    { "yucy", "\xd1\x8e", 4, 2, NO },
+    { "circ", "\xcb\x86", 4, 2, NO },
+    { "Wfr", "\xf0\x9d\x94\x9a", 3, 4, NO },
+    { "ReverseEquilibrium", "\xe2\x87\x8b", 18, 3, NO },
+    { "NotLessSlantEqual", "\xe2\xa9\xbd\xcc\xb8", 17, 5, NO },
+    { "xlarr", "\xe2\x9f\xb5", 5, 3, NO },
+    { "UnionPlus", "\xe2\x8a\x8e", 9, 3, NO },
+    { "sce", "\xe2\xaa\xb0", 3, 3, NO },
+    { "ofcir", "\xe2\xa6\xbf", 5, 3, NO },
+    { "bigotimes", "\xe2\xa8\x82", 9, 3, NO },
+    { "rcub", "}", 4, 1, NO },
+    { "LessFullEqual", "\xe2\x89\xa6", 13, 3, NO },
+    { "hfr", "\xf0\x9d\x94\xa5", 3, 4, NO },
+    { "LeftArrow", "\xe2\x86\x90", 9, 3, NO },
+    { "copy", "\xc2\xa9", 4, 2, YES },
+    { "nlArr", "\xe2\x87\x8d", 5, 3, NO },
+    { "angmsdac", "\xe2\xa6\xaa", 8, 3, NO },
+    { "trie", "\xe2\x89\x9c", 4, 3, NO },
+    { "NotPrecedesSlantEqual", "\xe2\x8b\xa0", 21, 3, NO },
+    { "lfloor", "\xe2\x8c\x8a", 6, 3, NO },
+    { "prap", "\xe2\xaa\xb7", 4, 3, NO },
+    { "rlhar", "\xe2\x87\x8c", 5, 3, NO },
+    { "Ycirc", "\xc5\xb6", 5, 2, NO },
+    { "nmid", "\xe2\x88\xa4", 4, 3, NO },
+    { "DownLeftVector", "\xe2\x86\xbd", 14, 3, NO },
+    { "esdot", "\xe2\x89\x90", 5, 3, NO },
+    { "cfr", "\xf0\x9d\x94\xa0", 3, 4, NO },
+    { "nlt", "\xe2\x89\xae", 3, 3, NO },
+    { "boxHd", "\xe2\x95\xa4", 5, 3, NO },
+    { "NotEqual", "\xe2\x89\xa0", 8, 3, NO },
+    { "emsp", "\xe2\x80\x83", 4, 3, NO },
+    { "Ocy", "\xd0\x9e", 3, 2, NO },
+    { "RightVector", "\xe2\x87\x80", 11, 3, NO },
+    { "nsimeq", "\xe2\x89\x84", 6, 3, NO },
+    { "Dot", "\xc2\xa8", 3, 2, NO },
+    { "lessapprox", "\xe2\xaa\x85", 10, 3, NO },
+    { "apacir", "\xe2\xa9\xaf", 6, 3, NO },
+    { "isins", "\xe2\x8b\xb4", 5, 3, NO },
+    { "expectation", "\xe2\x84\xb0", 11, 3, NO },
+    { "urcorner", "\xe2\x8c\x9d", 8, 3, NO },
+    { "vBarv", "\xe2\xab\xa9", 5, 3, NO },
+    { "dArr", "\xe2\x87\x93", 4, 3, NO },
+    { "angst", "\xc3\x85", 5, 2, NO },
+    { "DownTee", "\xe2\x8a\xa4", 7, 3, NO },
+    { "nleftarrow", "\xe2\x86\x9a", 10, 3, NO },
+    { "Zeta", "\xce\x96", 4, 2, NO },
+    { "rangle", "\xe2\x9f\xa9", 6, 3, NO },
+    { "orderof", "\xe2\x84\xb4", 7, 3, NO },
+    { "mnplus", "\xe2\x88\x93", 6, 3, NO },
+    { "Poincareplane", "\xe2\x84\x8c", 13, 3, NO },
+    { "boxH", "\xe2\x95\x90", 4, 3, NO },
+    { "Itilde", "\xc4\xa8", 6, 2, NO },
+    { "boxbox", "\xe2\xa7\x89", 6, 3, NO },
+    { "nGg", "\xe2\x8b\x99\xcc\xb8", 3, 5, NO },
+    { "Map", "\xe2\xa4\x85", 3, 3, NO },
+    { "supne", "\xe2\x8a\x8b", 5, 3, NO },
+    { "telrec", "\xe2\x8c\x95", 6, 3, NO },
+    { "HARDcy", "\xd0\xaa", 6, 2, NO },
+    { "frac34", "\xc2\xbe", 6, 2, YES },
+    { "cscr", "\xf0\x9d\x92\xb8", 4, 4, NO },
+    { "urcorn", "\xe2\x8c\x9d", 6, 3, NO },
+    { "lltri", "\xe2\x97\xba", 5, 3, NO },
+    { "odblac", "\xc5\x91", 6, 2, NO },
+    { "disin", "\xe2\x8b\xb2", 5, 3, NO },
+    { "ccaps", "\xe2\xa9\x8d", 5, 3, NO },
+    { "ngeq", "\xe2\x89\xb1", 4, 3, NO },
+    { "Icy", "\xd0\x98", 3, 2, NO },
+    { "trpezium", "\xe2\x8f\xa2", 8, 3, NO },
+    { "SHCHcy", "\xd0\xa9", 6, 2, NO },
+    { "Alpha", "\xce\x91", 5, 2, NO },
+    { "Mscr", "\xe2\x84\xb3", 4, 3, NO },
+    { "oslash", "\xc3\xb8", 6, 2, YES },
+    { "DJcy", "\xd0\x82", 4, 2, NO },
+    { "nvltrie", "\xe2\x8a\xb4\xe2\x83\x92", 7, 6, NO },
+    { "EqualTilde", "\xe2\x89\x82", 10, 3, NO },
+    { "subsim", "\xe2\xab\x87", 6, 3, NO },
+    { "numero", "\xe2\x84\x96", 6, 3, NO },
+    { "ntriangleleft", "\xe2\x8b\xaa", 13, 3, NO },
+    { "doublebarwedge", "\xe2\x8c\x86", 14, 3, NO },
+    { "Bcy", "\xd0\x91", 3, 2, NO },
+    { "supsup", "\xe2\xab\x96", 6, 3, NO },
+    { "scnsim", "\xe2\x8b\xa9", 6, 3, NO },
+    { "EmptyVerySmallSquare", "\xe2\x96\xab", 20, 3, NO },
+    { "emptyv", "\xe2\x88\x85", 6, 3, NO },
+    { "Topf", "\xf0\x9d\x95\x8b", 4, 4, NO },
+    { "cularr", "\xe2\x86\xb6", 6, 3, NO },
+    { "lrhard", "\xe2\xa5\xad", 6, 3, NO },
+    { "LeftArrowRightArrow", "\xe2\x87\x86", 19, 3, NO },
+    { "LeftUpVectorBar", "\xe2\xa5\x98", 15, 3, NO },
+    { "RightVectorBar", "\xe2\xa5\x93", 14, 3, NO },
+    { "Uarr", "\xe2\x86\x9f", 4, 3, NO },
+    { "loang", "\xe2\x9f\xac", 5, 3, NO },
+    { "boxUL", "\xe2\x95\x9d", 5, 3, NO },
+    { "siml", "\xe2\xaa\x9d", 4, 3, NO },
+    { "diamond", "\xe2\x8b\x84", 7, 3, NO },
+    { "vartheta", "\xcf\x91", 8, 2, NO },
+    { "rfisht", "\xe2\xa5\xbd", 6, 3, NO },
+    { "leftrightarrows", "\xe2\x87\x86", 15, 3, NO },
+    { "Downarrow", "\xe2\x87\x93", 9, 3, NO },
+    { "shortparallel", "\xe2\x88\xa5", 13, 3, NO },
+    { "clubs", "\xe2\x99\xa3", 5, 3, NO },
+    { "gcy", "\xd0\xb3", 3, 2, NO },
+    { "demptyv", "\xe2\xa6\xb1", 7, 3, NO },
+    { "ordf", "\xc2\xaa", 4, 2, YES },
+    { "nvgt", ">\xe2\x83\x92", 4, 4, NO },
+    { "Acirc", "\xc3\x82", 5, 2, YES },
+    { "GT", ">", 2, 1, YES },
+    { "pound", "\xc2\xa3", 5, 2, YES },
+    { "Ycy", "\xd0\xab", 3, 2, NO },
+    { "rfr", "\xf0\x9d\x94\xaf", 3, 4, NO },
+    { "roplus", "\xe2\xa8\xae", 6, 3, NO },
+    { "curren", "\xc2\xa4", 6, 2, YES },
+    { "succapprox", "\xe2\xaa\xb8", 10, 3, NO },
+    { "Lcedil", "\xc4\xbb", 6, 2, NO },
+    { "leftleftarrows", "\xe2\x87\x87", 14, 3, NO },
+    { "xi", "\xce\xbe", 2, 2, NO },
+    { "CirclePlus", "\xe2\x8a\x95", 10, 3, NO },
+    { "target", "\xe2\x8c\x96", 6, 3, NO },
+    { "SuchThat", "\xe2\x88\x8b", 8, 3, NO },
+    { "nle", "\xe2\x89\xb0", 3, 3, NO },
+    { "dtri", "\xe2\x96\xbf", 4, 3, NO },
+    { "lceil", "\xe2\x8c\x88", 5, 3, NO },
+    { "varsigma", "\xcf\x82", 8, 2, NO },
+    { "boxvh", "\xe2\x94\xbc", 5, 3, NO },
+    { "blank", "\xe2\x90\xa3", 5, 3, NO },
+    { "oplus", "\xe2\x8a\x95", 5, 3, NO },
+    { "Oopf", "\xf0\x9d\x95\x86", 4, 4, NO },
+    { "Dashv", "\xe2\xab\xa4", 5, 3, NO },
+    { "RightTriangle", "\xe2\x8a\xb3", 13, 3, NO },
+    { "Backslash", "\xe2\x88\x96", 9, 3, NO },
+    { "nis", "\xe2\x8b\xbc", 3, 3, NO },
+    { "Hat", "^", 3, 1, NO },
+    { "oopf", "\xf0\x9d\x95\xa0", 4, 4, NO },
+    { "LeftTriangleEqual", "\xe2\x8a\xb4", 17, 3, NO },
+    { "leg", "\xe2\x8b\x9a", 3, 3, NO },
+    { "NotExists", "\xe2\x88\x84", 9, 3, NO },
+    { "pitchfork", "\xe2\x8b\x94", 9, 3, NO },
+    { "wscr", "\xf0\x9d\x93\x8c", 4, 4, NO },
+    { "equiv", "\xe2\x89\xa1", 5, 3, NO },
+    { "NotGreaterLess", "\xe2\x89\xb9", 14, 3, NO },
+    { "dscy", "\xd1\x95", 4, 2, NO },
+    { "gscr", "\xe2\x84\x8a", 4, 3, NO },
+    { "Vvdash", "\xe2\x8a\xaa", 6, 3, NO },
+    { "bsolb", "\xe2\xa7\x85", 5, 3, NO },
+    { "Idot", "\xc4\xb0", 4, 2, NO },
+    { "otimesas", "\xe2\xa8\xb6", 8, 3, NO },
+    { "rarr", "\xe2\x86\x92", 4, 3, NO },
+    { "bsemi", "\xe2\x81\x8f", 5, 3, NO },
+    { "larrpl", "\xe2\xa4\xb9", 6, 3, NO },
+    { "Cap", "\xe2\x8b\x92", 3, 3, NO },
+    { "squf", "\xe2\x96\xaa", 4, 3, NO },
+    { "Iuml", "\xc3\x8f", 4, 2, YES },
+    { "downharpoonright", "\xe2\x87\x82", 16, 3, NO },
+    { "wfr", "\xf0\x9d\x94\xb4", 3, 4, NO },
+    { "lHar", "\xe2\xa5\xa2", 4, 3, NO },
+    { "cirfnint", "\xe2\xa8\x90", 8, 3, NO },
+    { "ffilig", "\xef\xac\x83", 6, 3, NO },
+    { "cupor", "\xe2\xa9\x85", 5, 3, NO },
+    { "subedot", "\xe2\xab\x83", 7, 3, NO },
+    { "RightUpVectorBar", "\xe2\xa5\x94", 16, 3, NO },
+    { "Cup", "\xe2\x8b\x93", 3, 3, NO },
+    { "dcaron", "\xc4\x8f", 6, 2, NO },
+    { "rcedil", "\xc5\x97", 6, 2, NO },
+    { "uopf", "\xf0\x9d\x95\xa6", 4, 4, NO },
+    { "prsim", "\xe2\x89\xbe", 5, 3, NO },
+    { "odiv", "\xe2\xa8\xb8", 4, 3, NO },
+    { "nrArr", "\xe2\x87\x8f", 5, 3, NO },
+    { "rbbrk", "\xe2\x9d\xb3", 5, 3, NO },
+    { "lozf", "\xe2\xa7\xab", 4, 3, NO },
+    { "rcy", "\xd1\x80", 3, 2, NO },
+    { "Prime", "\xe2\x80\xb3", 5, 3, NO },
+    { "ropar", "\xe2\xa6\x86", 5, 3, NO },
+    { "Rightarrow", "\xe2\x87\x92", 10, 3, NO },
+    { "frac23", "\xe2\x85\x94", 6, 3, NO },
+    { "ensp", "\xe2\x80\x82", 4, 3, NO },
+    { "Jsercy", "\xd0\x88", 6, 2, NO },
+    { "Abreve", "\xc4\x82", 6, 2, NO },
+    { "xlArr", "\xe2\x9f\xb8", 5, 3, NO },
+    { "mho", "\xe2\x84\xa7", 3, 3, NO },
+    { "curarr", "\xe2\x86\xb7", 6, 3, NO },
+    { "straightphi", "\xcf\x95", 11, 2, NO },
+    { "nGt", "\xe2\x89\xab\xe2\x83\x92", 3, 6, NO },
+    { "par", "\xe2\x88\xa5", 3, 3, NO },
+    { "iscr", "\xf0\x9d\x92\xbe", 4, 4, NO },
+    { "Proportion", "\xe2\x88\xb7", 10, 3, NO },
+    { "gtrarr", "\xe2\xa5\xb8", 6, 3, NO },
+    { "xwedge", "\xe2\x8b\x80", 6, 3, NO },
+    { "uhblk", "\xe2\x96\x80", 5, 3, NO },
+    { "bottom", "\xe2\x8a\xa5", 6, 3, NO },
+    { "frac18", "\xe2\x85\x9b", 6, 3, NO },
+    { "setminus", "\xe2\x88\x96", 8, 3, NO },
+    { "ngE", "\xe2\x89\xa7\xcc\xb8", 3, 5, NO },
+    { "nu", "\xce\xbd", 2, 2, NO },
+    { "nvinfin", "\xe2\xa7\x9e", 7, 3, NO },
+    { "Gcirc", "\xc4\x9c", 5, 2, NO },
+    { "hercon", "\xe2\x8a\xb9", 6, 3, NO },
+    { "boxhd", "\xe2\x94\xac", 5, 3, NO },
+    { "prod", "\xe2\x88\x8f", 4, 3, NO },
+    { "Icirc", "\xc3\x8e", 5, 2, YES },
+    { "ngeqq", "\xe2\x89\xa7\xcc\xb8", 5, 5, NO },
+    { "nacute", "\xc5\x84", 6, 2, NO },
+    { "thkap", "\xe2\x89\x88", 5, 3, NO },
+    { "longmapsto", "\xe2\x9f\xbc", 10, 3, NO },
+    { "Im", "\xe2\x84\x91", 2, 3, NO },
+    { "vzigzag", "\xe2\xa6\x9a", 7, 3, NO },
+    { "subE", "\xe2\xab\x85", 4, 3, NO },
+    { "upsih", "\xcf\x92", 5, 2, NO },
+    { "subset", "\xe2\x8a\x82", 6, 3, NO },
+    { "acirc", "\xc3\xa2", 5, 2, YES },
+    { "lopar", "\xe2\xa6\x85", 5, 3, NO },
+    { "ShortUpArrow", "\xe2\x86\x91", 12, 3, NO },
+    { "scpolint", "\xe2\xa8\x93", 8, 3, NO },
+    { "gsiml", "\xe2\xaa\x90", 5, 3, NO },
+    { "aelig", "\xc3\xa6", 5, 2, YES },
+    { "boxHD", "\xe2\x95\xa6", 5, 3, NO },
+    { "NotSupersetEqual", "\xe2\x8a\x89", 16, 3, NO },
+    { "duarr", "\xe2\x87\xb5", 5, 3, NO },
+    { "uuarr", "\xe2\x87\x88", 5, 3, NO },
+    { "MinusPlus", "\xe2\x88\x93", 9, 3, NO },
+    { "eopf", "\xf0\x9d\x95\x96", 4, 4, NO },
+    { "perp", "\xe2\x8a\xa5", 4, 3, NO },
+    { "sccue", "\xe2\x89\xbd", 5, 3, NO },
+    { "nges", "\xe2\xa9\xbe\xcc\xb8", 4, 5, NO },
+    { "LongLeftArrow", "\xe2\x9f\xb5", 13, 3, NO },
+    { "Eopf", "\xf0\x9d\x94\xbc", 4, 4, NO },
+    { "sol", "/", 3, 1, NO },
+    { "ThickSpace", "\xe2\x81\x9f\xe2\x80\x8a", 10, 6, NO },
+    { "operp", "\xe2\xa6\xb9", 5, 3, NO },
+    { "Ecy", "\xd0\xad", 3, 2, NO },
+    { "eqslantless", "\xe2\xaa\x95", 11, 3, NO },
+    { "rbrace", "}", 6, 1, NO },
+    { "popf", "\xf0\x9d\x95\xa1", 4, 4, NO },
+    { "grave", "`", 5, 1, NO },
+    { "RightCeiling", "\xe2\x8c\x89", 12, 3, NO },
+    { "scnE", "\xe2\xaa\xb6", 4, 3, NO },
+    { "Hfr", "\xe2\x84\x8c", 3, 3, NO },
+    { "boxVr", "\xe2\x95\x9f", 5, 3, NO },
+    { "zeta", "\xce\xb6", 4, 2, NO },
+    { "rtriltri", "\xe2\xa7\x8e", 8, 3, NO },
+    { "gne", "\xe2\xaa\x88", 3, 3, NO },
+    { "curvearrowleft", "\xe2\x86\xb6", 14, 3, NO },
+    { "esim", "\xe2\x89\x82", 4, 3, NO },
+    { "backsimeq", "\xe2\x8b\x8d", 9, 3, NO },
+    { "nvHarr", "\xe2\xa4\x84", 6, 3, NO },
+    { "cemptyv", "\xe2\xa6\xb2", 7, 3, NO },
+    { "measuredangle", "\xe2\x88\xa1", 13, 3, NO },
+    { "DD", "\xe2\x85\x85", 2, 3, NO },
+    { "nsubset", "\xe2\x8a\x82\xe2\x83\x92", 7, 6, NO },
+    { "ratail", "\xe2\xa4\x9a", 6, 3, NO },
+    { "Rfr", "\xe2\x84\x9c", 3, 3, NO },
+    { "twoheadrightarrow", "\xe2\x86\xa0", 17, 3, NO },
+    { "suplarr", "\xe2\xa5\xbb", 7, 3, NO },
+    { "RightFloor", "\xe2\x8c\x8b", 10, 3, NO },
+    { "CenterDot", "\xc2\xb7", 9, 2, NO },
+    { "fork", "\xe2\x8b\x94", 4, 3, NO },
+    { "NotCongruent", "\xe2\x89\xa2", 12, 3, NO },
+    { "aopf", "\xf0\x9d\x95\x92", 4, 4, NO },
+    { "gfr", "\xf0\x9d\x94\xa4", 3, 4, NO },
+    { "fnof", "\xc6\x92", 4, 2, NO },
+    { "sup1", "\xc2\xb9", 4, 2, YES },
+    { "comma", ",", 5, 1, NO },
+    { "questeq", "\xe2\x89\x9f", 7, 3, NO },
+    { "rightrightarrows", "\xe2\x87\x89", 16, 3, NO },
+    { "thinsp", "\xe2\x80\x89", 6, 3, NO },
+    { "Sup", "\xe2\x8b\x91", 3, 3, NO },
+    { "sdotb", "\xe2\x8a\xa1", 5, 3, NO },
+    { "Rrightarrow", "\xe2\x87\x9b", 11, 3, NO },
+    { "euro", "\xe2\x82\xac", 4, 3, NO },
+    { "forall", "\xe2\x88\x80", 6, 3, NO },
+    { "RightArrow", "\xe2\x86\x92", 10, 3, NO },
+    { "bumpeq", "\xe2\x89\x8f", 6, 3, NO },
+    { "agrave", "\xc3\xa0", 6, 2, YES },
+    { "lrm", "\xe2\x80\x8e", 3, 3, NO },
+    { "elinters", "\xe2\x8f\xa7", 8, 3, NO },
+    { "ufr", "\xf0\x9d\x94\xb2", 3, 4, NO },
+    { "xopf", "\xf0\x9d\x95\xa9", 4, 4, NO },
+    { "ncy", "\xd0\xbd", 3, 2, NO },
+    { "Integral", "\xe2\x88\xab", 8, 3, NO },
+    { "DoubleRightTee", "\xe2\x8a\xa8", 14, 3, NO },
+    { "hstrok", "\xc4\xa7", 6, 2, NO },
+    { "phmmat", "\xe2\x84\xb3", 6, 3, NO },
+    { "tau", "\xcf\x84", 3, 2, NO },
+    { "dlcorn", "\xe2\x8c\x9e", 6, 3, NO },
+    { "zhcy", "\xd0\xb6", 4, 2, NO },
+    { "mcomma", "\xe2\xa8\xa9", 6, 3, NO },
+    { "icy", "\xd0\xb8", 3, 2, NO },
+    { "Superset", "\xe2\x8a\x83", 8, 3, NO },
+    { "neArr", "\xe2\x87\x97", 5, 3, NO },
+    { "capcup", "\xe2\xa9\x87", 6, 3, NO },
+    { "nsce", "\xe2\xaa\xb0\xcc\xb8", 4, 5, NO },
+    { "triangleleft", "\xe2\x97\x83", 12, 3, NO },
+    { "DownBreve", "\xcc\x91", 9, 2, NO },
+    { "nsucceq", "\xe2\xaa\xb0\xcc\xb8", 7, 5, NO },
+    { "TripleDot", "\xe2\x83\x9b", 9, 3, NO },
+    { "Del", "\xe2\x88\x87", 3, 3, NO },
+    { "NotLeftTriangleEqual", "\xe2\x8b\xac", 20, 3, NO },
+    { "hybull", "\xe2\x81\x83", 6, 3, NO },
+    { "Ucy", "\xd0\xa3", 3, 2, NO },
+    { "DoubleLeftArrow", "\xe2\x87\x90", 15, 3, NO },
+    { "swnwar", "\xe2\xa4\xaa", 6, 3, NO },
+    { "awconint", "\xe2\x88\xb3", 8, 3, NO },
+    { "Aring", "\xc3\x85", 5, 2, YES },
+    { "simplus", "\xe2\xa8\xa4", 7, 3, NO },
+    { "Utilde", "\xc5\xa8", 6, 2, NO },
+    { "period", ".", 6, 1, NO },
+    { "Afr", "\xf0\x9d\x94\x84", 3, 4, NO },
+    { "xcup", "\xe2\x8b\x83", 4, 3, NO },
+    { "Yscr", "\xf0\x9d\x92\xb4", 4, 4, NO },
+    { "epsilon", "\xce\xb5", 7, 2, NO },
+    { "dharr", "\xe2\x87\x82", 5, 3, NO },
+    { "angmsdah", "\xe2\xa6\xaf", 8, 3, NO },
+    { "rightarrowtail", "\xe2\x86\xa3", 14, 3, NO },
+    { "ncup", "\xe2\xa9\x82", 4, 3, NO },
+    { "realpart", "\xe2\x84\x9c", 8, 3, NO },
+    { "yacy", "\xd1\x8f", 4, 2, NO },
+    { "aring", "\xc3\xa5", 5, 2, YES },
+    { "plankv", "\xe2\x84\x8f", 6, 3, NO },
+    { "conint", "\xe2\x88\xae", 6, 3, NO },
+    { "lrcorner", "\xe2\x8c\x9f", 8, 3, NO },
+    { "sqsupset", "\xe2\x8a\x90", 8, 3, NO },
+    { "subseteqq", "\xe2\xab\x85", 9, 3, NO },
+    { "frac16", "\xe2\x85\x99", 6, 3, NO },
+    { "lcedil", "\xc4\xbc", 6, 2, NO },
+    { "YIcy", "\xd0\x87", 4, 2, NO },
+    { "gdot", "\xc4\xa1", 4, 2, NO },
+    { "nlE", "\xe2\x89\xa6\xcc\xb8", 3, 5, NO },
+    { "ngeqslant", "\xe2\xa9\xbe\xcc\xb8", 9, 5, NO },
+    { "primes", "\xe2\x84\x99", 6, 3, NO },
+    { "DoubleDownArrow", "\xe2\x87\x93", 15, 3, NO },
+    { "angmsdaa", "\xe2\xa6\xa8", 8, 3, NO },
+    { "order", "\xe2\x84\xb4", 5, 3, NO },
+    { "congdot", "\xe2\xa9\xad", 7, 3, NO },
+    { "minusdu", "\xe2\xa8\xaa", 7, 3, NO },
+    { "ltquest", "\xe2\xa9\xbb", 7, 3, NO },
+    { "CHcy", "\xd0\xa7", 4, 2, NO },
+    { "Equilibrium", "\xe2\x87\x8c", 11, 3, NO },
+    { "Re", "\xe2\x84\x9c", 2, 3, NO },
+    { "Upsilon", "\xce\xa5", 7, 2, NO },
+    { "check", "\xe2\x9c\x93", 5, 3, NO },
+    { "thorn", "\xc3\xbe", 5, 2, YES },
+    { "gsim", "\xe2\x89\xb3", 4, 3, NO },
+    { "intcal", "\xe2\x8a\xba", 6, 3, NO },
+    { "Jukcy", "\xd0\x84", 5, 2, NO },
+    { "hellip", "\xe2\x80\xa6", 6, 3, NO },
+    { "quaternions", "\xe2\x84\x8d", 11, 3, NO },
+    { "csupe", "\xe2\xab\x92", 5, 3, NO },
+    { "zdot", "\xc5\xbc", 4, 2, NO },
+    { "Tfr", "\xf0\x9d\x94\x97", 3, 4, NO },
+    { "half", "\xc2\xbd", 4, 2, NO },
+    { "boxVl", "\xe2\x95\xa2", 5, 3, NO },
+    { "VerticalTilde", "\xe2\x89\x80", 13, 3, NO },
+    { "Auml", "\xc3\x84", 4, 2, YES },
+    { "divideontimes", "\xe2\x8b\x87", 13, 3, NO },
+    { "Popf", "\xe2\x84\x99", 4, 3, NO },
+    { "wedgeq", "\xe2\x89\x99", 6, 3, NO },
+    { "nshortmid", "\xe2\x88\xa4", 9, 3, NO },
+    { "simne", "\xe2\x89\x86", 5, 3, NO },
+    { "jmath", "\xc8\xb7", 5, 2, NO },
+    { "Qscr", "\xf0\x9d\x92\xac", 4, 4, NO },
+    { "Uring", "\xc5\xae", 5, 2, NO },
+    { "ltri", "\xe2\x97\x83", 4, 3, NO },
+    { "Jcy", "\xd0\x99", 3, 2, NO },
+    { "lagran", "\xe2\x84\x92", 6, 3, NO },
+    { "NotSucceedsSlantEqual", "\xe2\x8b\xa1", 21, 3, NO },
+    { "IJlig", "\xc4\xb2", 5, 2, NO },
+    { "DownArrow", "\xe2\x86\x93", 9, 3, NO },
+    { "gcirc", "\xc4\x9d", 5, 2, NO },
+    { "nles", "\xe2\xa9\xbd\xcc\xb8", 4, 5, NO },
+    { "hookleftarrow", "\xe2\x86\xa9", 13, 3, NO },
+    { "shchcy", "\xd1\x89", 6, 2, NO },
+    { "deg", "\xc2\xb0", 3, 2, YES },
+    { "isinE", "\xe2\x8b\xb9", 5, 3, NO },
+    { "real", "\xe2\x84\x9c", 4, 3, NO },
+    { "vArr", "\xe2\x87\x95", 4, 3, NO },
+    { "ugrave", "\xc3\xb9", 6, 2, YES },
+    { "lne", "\xe2\xaa\x87", 3, 3, NO },
+    { "ltrie", "\xe2\x8a\xb4", 5, 3, NO },
+    { "emsp13", "\xe2\x80\x84", 6, 3, NO },
+    { "Lstrok", "\xc5\x81", 6, 2, NO },
+    { "RBarr", "\xe2\xa4\x90", 5, 3, NO },
+    { "cirE", "\xe2\xa7\x83", 4, 3, NO },
+    { "backepsilon", "\xcf\xb6", 11, 2, NO },
+};
+
+static const int16_t cw_html_entity_displacements[CW_HTML_ENTITY_COUNT] = {
+    -2124, 1, 0, 1, 1, -2118, 1, -2117, 0, 2, 0, 0,
+    1, 1, 0, 3, 0, 0, 1, 0, 0, -2114, 0, -2111,
+    3, 0, 5, 0, 1, 0, -2108, 0, -2106, 4, -2105, -2100,
+    1, 0, 0, 2, 3, 0, -2099, 0, 1, -2096, -2095, -2093,
+    0, 0, 0, 1, 1, 5, -2089, -2085, 0, 0, -2083, -2080,
+    3, 0, 0, 0, 3, -2079, -2078, 0, -2075, 0, -2070, 2,
+    0, -2066, -2064, 0, 1, 1, 0, 1, -2056, 0, -2054, 1,
+    0, 0, 0, 1, 0, -2048, 2, 1, 3, -2046, 0, 2,
+    0, 2, -2037, 3, 3, -2036, -2035, -2034, -2031, 2, -2030, -2028,
+    -2027, 0, 1, 4, 1, 3, 0, -2017, 3, 0, 0, -2005,
+    1, 0, 0, -2003, -2002, -2001, -1993, -1990, 0, 1, -1989, -1988,
+    -1987, 1, -1982, 0, 2, 1, 0, 0, 2, 0, -1979, 1,
+    0, -1976, 0, 0, 0, 1, 0, -1975, 0, 2, 0, -1973,
+    4, 0, 1, -1971, 0, 2, -1969, -1968, 0, -1963, 1, 0,
+    1, 0, 1, 0, 0, -1961, 3, 0, -1959, 0, 0, -1958,
+    0, 0, 1, 0, -1957, 1, 1, 2, -1956, 1, 1, 1,
+    -1954, -1949, 0, -1948, 5, -1947, -1945, 0, 0, 0, 2, -1944,
+    1, 0, -1942, 0, 0, -1941, 0, -1939, 0, 2, 2, -1933,
+    3, -1930, 3, 1, 0, 1, 0, 0, 0, -1925, -1923, -1919,
+    0, 0, 6, -1912, 2, 1, -1911, 0, 0, 2, 4, -1909,
+    -1906, 0, 0, 0, 0, -1905, 0, -1904, -1902, -1901, 1, 1,
+    1, -1894, 1, 0, 0, -1893, -1886, -1879, -1876, -1875, -1874, 0,
+    -1873, -1871, -1866, -1864, -1863, -1861, 0, 0, 1, -1859, -1858, 2,
+    0, 0, 2, 0, 0, -1856, -1847, -1844, -1843, 0, -1842, 0,
+    0, -1840, 1, -1837, 5, 0, 1, 0, -1836, 0, 1, 0,
+    -1824, 0, 0, -1820, 1, 1, 1, -1814, -1803, -1802, 2, 2,
+    0, 0, 9, 2, 0, 1, -1801, 1, 0, -1800, 1, 0,
+    6, 3, 1, -1797, -1795, 1, 0, 0, 1, -1794, -1790, -1787,
+    0, 2, -1786, -1784, 2, -1782, -1781, 5, -1779, -1777, 0, -1776,
+    0, -1774, 0, 0, -1770, 0, 2, -1768, 1, -1761, 0, 0,
+    1, -1756, 4, -1754, 0, -1751, 0, -1749, 0, 2, 0, 0,
+    0, -1747, 0, -1745, 0, -1744, -1740, 0, -1733, 1, 3, -1731,
+    -1730, -1726, 1, 2, 2, 0, 2, 5, 0, -1721, -1713, 0,
+    0, -1712, -1711, 1, -1709, 0, 2, -1707, 0, -1700, -1698, -1696,
+    0, 0, -1692, 1, 0, -1691, 1, 1, 0, -1688, 3, 1,
+    -1683, 1, 0, 0, 0, -1679, 2, -1675, 5, 0, -1670, -1667,
+    -1665, 1, 2, 0, 0, 0, 1, -1664, 0, -1660, -1659, 2,
+    0, 2, -1656, -1654, -1653, 1, -1652, 0, -1645, 1, 0, -1644,
+    2, 0, -1640, -1636, 0, 0, 0, 1, -1635, 0, 0, 1,
+    0, 0, 3, 8, 3, -1633, 0, 0, -1632, 3, 0, 0,
+    1, -1629, -1627, -1621, 0, 1, -1613, -1612, 0, 3, 1, 0,
+    0, 2, -1609, 0, -1605, 0, 0, 0, 0, 0, 0, 9,
+    -1604, -1603, 0, 0, -1602, 4, -1600, -1594, 0, 0, -1593, 0,
+    0, -1592, 5, 2, -1590, 0, 0, 0, 0, -1589, 11, -1584,
+    0, -1583, -1579, -1577, 0, 0, 2, 1, -1574, -1571, 0, -1570,
+    0, 0, 1, 0, 1, 1, -1567, -1566, 4, 0, 0, -1562,
+    -1561, -1557, 0, 0, -1547, 0, -1546, -1538, 3, 3, -1536, -1535,
+    4, 0, 2, 0, -1526, -1525, -1523, 2, 0, 1, -1519, 0,
+    -1517, -1510, 3, 1, -1507, -1504, 0, 0, -1502, -1498, 5, 4,
+    -1497, 0, 0, 1, -1495, 5, -1492, 1, 1, 0, 0, 1,
+    -1489, 0, 0, 0, 0, 3, -1486, 0, 2, 3, -1485, 0,
+    4, -1481, 0, 0, 0, 0, -1477, -1475, -1469, 0, 2, 0,
+    1, -1468, 1, 2, 0, 0, -1466, -1462, 0, 0, -1461, 0,
+    1, 0, 0, 2, -1460, 0, 0, 1, 0, 6, 1, 0,
+    -1458, 1, -1446, 0, 0, 0, 0, 1, -1445, 3, 0, -1444,
+    0, -1442, 1, -1441, 1, 1, 0, -1438, -1436, 2, -1435, 2,
+    2, 1, -1432, 0, 0, 0, 1, -1431, -1428, -1425, 1, 0,
+    0, 1, -1422, 0, -1421, 2, 0, 2, -1420, 0, 0, 0,
+    0, -1418, 0, 0, -1417, 2, 0, -1416, -1415, 4, 0, -1408,
+    1, -1407, -1403, -1402, -1401, 1, 1, 0, -1400, 0, -1398, -1395,
+    -1391, 2, 1, 0, 5, 0, 0, 1, -1390, 1, 0, -1389,
+    10, -1387, 0, -1383, 0, 2, -1381, 1, 1, 0, 0, -1380,
+    -1378, 1, -1377, -1374, 0, -1372, -1371, 1, 1, 1, 0, 1,
+    -1369, 0, 3, 0, 2, 0, 0, 0, -1362, 0, 2, -1360,
+    0, 0, -1357, -1355, 0, -1353, -1351, -1349, -1348, 0, -1346, 0,
+    -1344, -1341, 2, -1340, 0, 2, -1326, -1325, -1322, 0, 2, -1318,
+    0, 0, 0, 3, 1, -1316, -1309, 0, 7, -1305, 2, 0,
+    0, 0, -1304, 1, -1303, 4, -1302, 0, 0, -1293, 1, -1292,
+    -1289, -1288, 0, -1286, 0, 2, 2, -1280, 1, -1274, -1265, 0,
+    -1264, -1257, -1256, -1255, -1253, -1250, 0, 0, -1248, 0, 1, 0,
+    0, 1, 1, 0, -1246, 3, -1245, 3, 0, 9, 0, -1244,
+    -1243, -1242, 1, -1236, 0, -1234, 0, -1229, 0, 0, -1227, 2,
+    -1221, -1216, 1, -1213, 1, 0, 0, 0, 1, 4, -1209, 0,
+    0, 1, 2, -1208, 2, -1206, 0, 0, 0, 0, -1201, 0,
+    -1200, 7, -1190, 0, 0, 0, 0, 0, 0, 0, -1188, 2,
+    0, 0, 0, 0, 7, 2, 0, 8, -1187, 3, 3, -1186,
+    -1185, -1183, -1181, 4, 0, 0, 0, -1180, -1173, 1, 0, -1171,
+    4, -1170, 4, 2, 3, -1169, -1164, 1, -1163, -1152, -1150, 0,
+    0, 0, -1149, -1144, 4, -1141, 0, 2, 1, -1137, -1136, 0,
+    0, -1134, 5, 1, -1131, 0, 1, 0, 0, -1129, -1123, 0,
+    0, 8, 2, -1122, -1120, 0, -1112, 4, 0, 0, -1110, -1109,
+    1, -1106, 0, -1105, 2, 0, 0, 0, -1103, 0, 5, 0,
+    0, 0, 0, -1097, 0, 1, -1092, -1091, -1089, 0, 0, 12,
+    1, 2, -1086, 0, 0, -1084, 0, 0, -1082, 0, 0, 7,
+    0, -1080, -1079, 0, 0, -1073, -1071, 2, -1065, 0, -1062, -1058,
+    0, -1057, -1056, 1, -1051, 2, -1045, 1, 0, -1042, 0, 0,
+    0, 0, 0, -1036, 0, -1030, -1027, 0, 0, -1019, 0, 9,
+    0, -1017, 0, -1016, 1, 1, 1, -1015, 0, 1, 0, 1,
+    0, 0, 1, 1, -1013, -1010, -1007, -1004, -1000, 1, -997, 1,
+    4, -996, 0, 4, 0, 0, -993, 0, -991, -989, 6, -985,
+    1, -982, -979, 5, 0, 3, -975, 4, -971, 0, 0, -969,
+    -966, 2, -964, 1, -961, 0, 0, 0, 0, 1, 3, -959,
+    0, 0, -958, 1, -957, 0, 0, 0, -956, 0, 2, -953,
+    0, 1, 7, -950, 0, -949, -947, 1, -942, 9, 0, 0,
+    -939, -931, 7, -928, 0, 1, -927, 1, -923, 2, -922, -920,
+    0, 0, -919, 0, 1, -917, 1, 16, 9, 0, 2, 0,
+    -915, -914, 0, 0, 0, -909, 0, 0, 0, 0, -908, -903,
+    0, 1, 3, 2, -900, 5, 1, -895, 0, -894, 0, -893,
+    -892, 6, 1, -889, -887, 0, 0, 0, 0, -883, -882, 0,
+    0, 0, 0, 1, -881, -879, 0, -878, 0, 0, 0, -873,
+    -871, 18, 1, 0, 3, -869, -867, 0, -866, -865, 0, 1,
+    0, 0, 14, 6, -864, 0, 0, -863, 0, 0, 0, 0,
+    -860, -858, 0, -857, -856, 0, -851, 7, -845, 0, -840, -839,
+    -836, 0, 1, 0, 1, 0, 0, 0, 0, 1, -835, 2,
+    0, 11, -833, 0, 0, -826, 1, 5, -825, 0, 0, 7,
+    -821, 0, -818, 1, 0, 2, 5, 1, 0, -817, 0, 0,
+    0, -815, -814, 1, 1, 25, 0, 15, 10, 11, -809, 0,
+    0, -807, 1, 1, -802, -801, -798, -795, 1, -784, 0, 0,
+    -780, 1, 3, 1, -779, 0, -775, 3, -771, 0, 0, -769,
+    5, 3, -768, -766, 4, 1, 0, -765, 0, -764, -762, 0,
+    -761, 6, 0, -758, -757, -751, 0, 3, 0, -749, 0, 12,
+    0, 0, 3, -747, -745, 1, -744, 0, -743, 0, 0, 2,
+    -740, -734, 1, 1, 5, 0, 0, 0, 2, -733, 5, -731,
+    0, 1, 1, -730, 0, 0, 21, -729, -727, -724, 0, -723,
+    2, 0, 0, 1, 0, -719, -718, 0, 0, -715, 0, 0,
+    0, 13, -714, -711, -710, 0, -709, 1, -702, -698, 7, -694,
+    0, -693, 1, 0, 0, -692, -683, 0, 1, 3, -682, 0,
+    0, 0, 2, -681, -676, 0, -669, -668, 0, -665, 0, 1,
+    -664, -662, 6, 3, 26, 0, -660, 1, -659, 0, 0, 0,
+    0, 7, 0, 0, 0, -654, -653, 1, 1, 8, 0, -651,
+    -649, 0, -647, 0, 0, 1, 0, 0, -645, 0, 1, 0,
+    0, -643, -642, 5, -639, -636, 1, 0, 0, 0, 6, -632,
+    0, 0, 0, 0, -630, -628, -626, -623, -620, -615, 0, -614,
+    29, -613, 0, 6, 1, -611, 0, -609, -608, -603, 0, 1,
+    -602, -596, 4, 2, 1, 15, 0, -593, -589, 0, 0, 0,
+    0, 1, 0, -587, -582, -581, -580, 0, 0, 0, -576, 1,
+    0, 0, 0, 0, -573, -570, -565, -564, -558, 0, 0, 0,
+    -552, -544, 0, -543, 0, 5, -540, -539, -538, -536, 0, -535,
+    0, 0, 0, -533, -530, -526, 12, 0, 0, -525, -523, 1,
+    -520, 0, 6, 2, 2, 0, -519, 0, -518, -509, -508, 1,
+    4, 0, 6, 1, -501, 0, 1, 1, 4, 1, 0, 0,
+    0, 5, -499, 0, 0, 0, -491, -490, 0, -487, -484, -483,
+    -481, 1, 0, -480, -477, -475, 6, 0, -473, 0, 0, -471,
+    0, -470, 0, 0, -461, 0, -458, 1, 1, 0, -457, -453,
+    -448, 0, -446, 0, 9, -444, 20, -443, 0, -442, -437, 1,
+    -436, -435, -432, 0, 10, -429, -427, 0, -423, -422, 0, 0,
+    0, 0, 0, 0, -420, 1, 4, 20, -416, 0, 9, -415,
+    0, 0, 13, 0, 2, 3, 0, 5, 3, -414, 0, 0,
+    0, -413, 0, 2, 0, 0, 1, -410, 9, 0, 0, 0,
+    0, 3, 2, -404, 2, 13, -402, 0, 0, 6, -399, 0,
+    -398, -395, -391, 10, 0, -390, 0, 0, 0, -385, 2, 1,
+    0, -384, 2, -383, 4, -382, -380, -369, -366, -363, 0, -358,
+    -355, 0, 0, 9, 3, -353, 1, -350, 4, 2, -348, 0,
+    -341, 1, 0, 0, 0, 0, -340, 0, 0, 0, 0, -339,
+    0, -338, 0, -336, 1, -335, -333, 0, 2, 1, 0, 0,
+    0, -329, -327, 0, 0, 1, -323, 0, -322, 7, 1, -321,
+    -320, -319, 5, 0, 1, 0, 7, 8, 19, 0, 3, 0,
+    -317, -314, 0, 0, -312, -310, 1, 0, -308, 0, 2, 4,
+    1, -304, 0, 8, -300, 5, -297, -296, 1, 2, 0, 0,
+    7, -292, 0, 14, 5, 0, 0, 0, -288, 0, 0, 1,
+    0, 0, 0, -284, 3, -281, -279, 0, 0, 0, 1, 2,
+    3, -277, 0, 0, -276, -269, -264, -263, 7, 1, 12, 0,
+    0, 1, 35, 0, 0, 0, 0, 4, -262, 0, 0, -257,
+    -256, 0, -253, 0, -247, -245, 3, -243, 1, 0, 0, 0,
+    0, 2, 2, -239, 1, -234, 0, 0, -233, 0, -230, 3,
+    -227, -222, 0, 5, -220, 0, 0, 0, -219, 0, -218, 0,
+    4, 0, 0, 4, 0, 1, 0, 3, 0, -212, 3, 5,
+    8, -209, -206, 0, -205, 0, -201, -197, -196, 0, -189, 0,
+    0, 0, -188, -184, -182, 3, 0, -181, 0, 0, -180, 0,
+    7, 1, 0, -178, 0, 0, 0, 0, 46, 0, 1, 0,
+    -177, -174, 0, 0, -172, 1, -169, 0, 0, 5, 2, 10,
+    2, 0, 0, -168, 1, 0, -163, -162, 6, 0, 0, 0,
+    -157, 1, 1, 0, -156, 0, -155, 8, 0, -154, -149, 0,
+    0, -148, 0, 14, -142, 2, -141, 0, 51, 6, 3, 0,
+    12, 7, 2, -140, 0, 2, 0, 0, 0, 3, 0, 0,
+    -139, 0, 9, -137, -132, 0, 0, 0, 4, 1, -131, -130,
+    -128, -127, -126, 0, 0, 0, 0, 9, 12, -125, 0, 6,
+    0, 0, 0, 0, 0, 0, 12, 0, 9, -122, 1, 2,
+    0, -119, 1, 0, 0, 0, 2, 0, -112, 14, 0, -111,
+    0, 0, 21, -106, -105, -101, -96, -95, -92, 0, 0, 0,
+    0, 3, -90, 0, -85, -84, 0, -80, -78, -71, 1, 1,
+    -68, -67, 0, 0, -66, 0, 0, -64, -63, -60, 67, 14,
+    0, 0, 1, 0, 2, 0, 2, 0, 0, -57, -53, 7,
+    13, 2, 0, 0, -49, 0, 0, 0, 0, 0, 1, 0,
+    -46, 0, -39, -38, 1, 0, -34, -33, 0, -31, 0, 1,
+    0, -29, -28, -27, 0, -26, 0, -23, 0, 0, 6, -17,
+    0, 0, -15, 0, 7, -13, -12, -11, -7, -5, 0, -1,
+    0,
+};
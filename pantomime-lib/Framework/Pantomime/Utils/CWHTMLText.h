@@ -0,0 +1,26 @@
+//
+//  CWHTMLText.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Extracts the text of an HTML document in a single pass, for reply quoting, previews and
+ search indexing. Tags and comments are removed, as are the contents of script, style and
+ title elements. Block-level elements (p, div, br, li, tr, ...) start new lines, other
+ whitespace is collapsed like a browser does, except in pre elements. All named and numeric
+ character references of HTML are decoded.
+
+ @param bytes The HTML.
+ @param encoding The encoding of bytes. UTF-8, ASCII, ISO-8859-1 and Windows-1252 are decoded
+        while scanning, other encodings are converted to UTF-8 first.
+ @return The text, encoded in UTF-8.
+ */
+NSData *cw_html_to_text(const unsigned char *bytes, NSUInteger length, NSStringEncoding encoding);
+
+NS_ASSUME_NONNULL_END
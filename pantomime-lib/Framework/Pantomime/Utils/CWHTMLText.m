@@ -0,0 +1,563 @@
+//
+//  CWHTMLText.m
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWHTMLText.h"
+
+#import "CWByteSearch.h"
+#import "CWHTMLEntities.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+typedef NS_ENUM(uint8_t, CWHTMLSource) {
+    CWHTMLSourceUTF8,
+    CWHTMLSourceLatin1,
+    CWHTMLSourceWindows1252
+};
+
+//
+// What an element does to the text around it.
+//
+typedef NS_ENUM(uint8_t, CWHTMLElementKind) {
+    CWHTMLElementInline,
+    /** Starts a new line. */
+    CWHTMLElementLine,
+    /** Starts a new paragraph, after an empty line. */
+    CWHTMLElementParagraph,
+    /** A line break, which is never collapsed. */
+    CWHTMLElementBreak,
+    /** A table cell, separated from the previous one by a space. */
+    CWHTMLElementCell,
+    CWHTMLElementPre,
+    /** An element whose contents are not text, like script. */
+    CWHTMLElementSkipped
+};
+
+static const struct
+{
+    const char *name;
+    CWHTMLElementKind kind;
+} elements[] = {
+    { "address", CWHTMLElementParagraph },
+    { "article", CWHTMLElementLine },
+    { "aside", CWHTMLElementLine },
+    { "blockquote", CWHTMLElementParagraph },
+    { "br", CWHTMLElementBreak },
+    { "caption", CWHTMLElementLine },
+    { "center", CWHTMLElementLine },
+    { "dd", CWHTMLElementLine },
+    { "div", CWHTMLElementLine },
+    { "dl", CWHTMLElementParagraph },
+    { "dt", CWHTMLElementLine },
+    { "fieldset", CWHTMLElementLine },
+    { "figure", CWHTMLElementParagraph },
+    { "footer", CWHTMLElementLine },
+    { "form", CWHTMLElementLine },
+    { "h1", CWHTMLElementParagraph },
+    { "h2", CWHTMLElementParagraph },
+    { "h3", CWHTMLElementParagraph },
+    { "h4", CWHTMLElementParagraph },
+    { "h5", CWHTMLElementParagraph },
+    { "h6", CWHTMLElementParagraph },
+    { "header", CWHTMLElementLine },
+    { "hr", CWHTMLElementParagraph },
+    { "li", CWHTMLElementLine },
+    { "main", CWHTMLElementLine },
+    { "nav", CWHTMLElementLine },
+    { "ol", CWHTMLElementParagraph },
+    { "p", CWHTMLElementParagraph },
+    { "pre", CWHTMLElementPre },
+    { "script", CWHTMLElementSkipped },
+    { "section", CWHTMLElementLine },
+    { "style", CWHTMLElementSkipped },
+    { "table", CWHTMLElementParagraph },
+    { "td", CWHTMLElementCell },
+    { "th", CWHTMLElementCell },
+    { "title", CWHTMLElementSkipped },
+    { "tr", CWHTMLElementLine },
+    { "ul", CWHTMLElementParagraph }
+};
+
+//
+// Windows-1252 characters 0x80 to 0x9F, which numeric character references in that range
+// also stand for. 0 where Windows-1252 has no character.
+//
+static const uint16_t windows1252[32] = {
+    0x20AC, 0, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0, 0x017D, 0,
+    0, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0, 0x017E, 0x0178
+};
+
+typedef struct
+{
+    unsigned char *bytes;
+    NSUInteger length;
+    NSUInteger capacity;
+
+    // The number of "\n" ending the text, 2 while it is empty so that it does not start
+    // with empty lines.
+    NSUInteger newlines;
+    BOOL space;
+    NSUInteger pre;
+} text_writer;
+
+static void writer_reserve(text_writer *writer, NSUInteger length)
+{
+    if (writer->length + length > writer->capacity)
+    {
+        writer->capacity = MAX(writer->capacity * 2, writer->length + length);
+        writer->bytes = realloc(writer->bytes, writer->capacity);
+    }
+}
+
+static inline void write_raw(text_writer *writer, const unsigned char *bytes, NSUInteger length)
+{
+    writer_reserve(writer, length);
+    memcpy(writer->bytes + writer->length, bytes, length);
+    writer->length += length;
+}
+
+//
+// Writes text, preceded by the space collapsed before it unless it starts a line.
+//
+static inline void write_text(text_writer *writer, const unsigned char *bytes, NSUInteger length)
+{
+    if (writer->space && writer->newlines == 0)
+    {
+        write_raw(writer, (const unsigned char *)" ", 1);
+    }
+    writer->space = NO;
+    writer->newlines = 0;
+    write_raw(writer, bytes, length);
+}
+
+static void write_character(text_writer *writer, uint32_t c)
+{
+    unsigned char utf8[4];
+
+    if (c < 0x80)
+    {
+        utf8[0] = (unsigned char)c;
+        write_text(writer, utf8, 1);
+    }
+    else if (c < 0x800)
+    {
+        utf8[0] = 0xC0 | (c >> 6);
+        utf8[1] = 0x80 | (c & 0x3F);
+        write_text(writer, utf8, 2);
+    }
+    else if (c < 0x10000)
+    {
+        utf8[0] = 0xE0 | (c >> 12);
+        utf8[1] = 0x80 | ((c >> 6) & 0x3F);
+        utf8[2] = 0x80 | (c & 0x3F);
+        write_text(writer, utf8, 3);
+    }
+    else
+    {
+        utf8[0] = 0xF0 | (c >> 18);
+        utf8[1] = 0x80 | ((c >> 12) & 0x3F);
+        utf8[2] = 0x80 | ((c >> 6) & 0x3F);
+        utf8[3] = 0x80 | (c & 0x3F);
+        write_text(writer, utf8, 4);
+    }
+}
+
+//
+// Ends the text with count "\n", unless it already does.
+//
+static void write_newlines(text_writer *writer, NSUInteger count)
+{
+    writer->space = NO;
+
+    while (writer->newlines < count)
+    {
+        write_raw(writer, (const unsigned char *)"\n", 1);
+        writer->newlines++;
+    }
+}
+
+static inline BOOL is_space(unsigned char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+static inline BOOL is_alnum(unsigned char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+}
+
+static inline uint32_t fnv1a(const unsigned char *bytes, NSUInteger length, uint32_t seed)
+{
+    uint32_t h = (seed ? seed : 0x811c9dc5);
+    NSUInteger i;
+
+    for (i = 0; i < length; i++)
+    {
+        h ^= bytes[i];
+        h *= 16777619;
+    }
+
+    return h;
+}
+
+//
+// Looks a named character reference (without "&" and ";") up in the perfect hash table of
+// CWHTMLEntities.h.
+//
+static const cw_html_entity *find_entity(const unsigned char *name, NSUInteger length)
+{
+    const cw_html_entity *entity;
+    int16_t d;
+
+    d = cw_html_entity_displacements[fnv1a(name, length, 0) % CW_HTML_ENTITY_COUNT];
+
+    if (d == 0)
+    {
+        return NULL;
+    }
+
+    entity = &cw_html_entities[d < 0 ? -d - 1 : fnv1a(name, length, (uint32_t)d) % CW_HTML_ENTITY_COUNT];
+
+    if (entity->name_length != length || memcmp(entity->name, name, length) != 0)
+    {
+        return NULL;
+    }
+
+    return entity;
+}
+
+//
+// Decodes the character reference at bytes[i] ("&"), returns the index after it. A "&"
+// that does not start a reference is written as is.
+//
+static NSUInteger read_reference(text_writer *writer, const unsigned char *bytes, NSUInteger length,
+                                 NSUInteger i)
+{
+    NSUInteger start = i + 1, j = start;
+
+    if (j < length && bytes[j] == '#')
+    {
+        BOOL hex = (j + 1 < length && (bytes[j+1] == 'x' || bytes[j+1] == 'X'));
+        uint32_t c = 0;
+        NSUInteger digits;
+
+        j += (hex ? 2 : 1);
+        digits = j;
+
+        for (; j < length; j++)
+        {
+            unsigned char d = bytes[j];
+            uint32_t value;
+
+            if (d >= '0' && d <= '9')
+            {
+                value = d - '0';
+            }
+            else if (hex && ((d | 0x20) >= 'a' && (d | 0x20) <= 'f'))
+            {
+                value = (d | 0x20) - 'a' + 10;
+            }
+            else
+            {
+                break;
+            }
+
+            // Anything past 0x10FFFF is invalid, we only need to know that it is.
+            c = MIN(c * (hex ? 16 : 10) + value, 0x110000);
+        }
+
+        if (j == digits)
+        {
+            write_text(writer, (const unsigned char *)"&", 1);
+            return i + 1;
+        }
+
+        if (c >= 0x80 && c <= 0x9F && windows1252[c - 0x80])
+        {
+            c = windows1252[c - 0x80];
+        }
+        else if (c == 0 || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF))
+        {
+            c = 0xFFFD;
+        }
+        write_character(writer, c);
+
+        return (j < length && bytes[j] == ';' ? j + 1 : j);
+    }
+
+    while (j < length && j - start < 32 && is_alnum(bytes[j]))
+    {
+        j++;
+    }
+
+    if (j > start)
+    {
+        const cw_html_entity *entity = find_entity(bytes + start, j - start);
+        BOOL terminated = (j < length && bytes[j] == ';');
+        NSUInteger end;
+
+        if (entity && (terminated || entity->legacy))
+        {
+            write_text(writer, (const unsigned char *)entity->value, entity->value_length);
+            return (terminated ? j + 1 : j);
+        }
+
+        // Legacy references may be followed by text, like in "&copy2026" or "&notit;".
+        for (end = j - 1; end > start + 1; end--)
+        {
+            entity = find_entity(bytes + start, end - start);
+
+            if (entity && entity->legacy)
+            {
+                write_text(writer, (const unsigned char *)entity->value, entity->value_length);
+                return end;
+            }
+        }
+    }
+
+    write_text(writer, (const unsigned char *)"&", 1);
+
+    return i + 1;
+}
+
+static CWHTMLElementKind element_kind(const unsigned char *name, NSUInteger length)
+{
+    NSUInteger i;
+
+    for (i = 0; i < sizeof(elements) / sizeof(elements[0]); i++)
+    {
+        if (strlen(elements[i].name) == length && cw_byte_case_equal((const unsigned char *)elements[i].name, name, length))
+        {
+            return elements[i].kind;
+        }
+    }
+
+    return CWHTMLElementInline;
+}
+
+//
+// Skips the tag, comment or declaration at bytes[i] ("<") and what it does to the text,
+// returns the index after it.
+//
+static NSUInteger read_tag(text_writer *writer, const unsigned char *bytes, NSUInteger length,
+                           NSUInteger i)
+{
+    NSUInteger j = i + 1, name, name_length, found;
+    CWHTMLElementKind kind;
+    BOOL closing = NO;
+    unsigned char quote = 0;
+
+    if (j + 2 < length && bytes[j] == '!' && bytes[j+1] == '-' && bytes[j+2] == '-')
+    {
+        found = cw_byte_search(bytes + j + 3, length - j - 3, (const unsigned char *)"-->", 3, NO);
+        return (found == NSNotFound ? length : j + 3 + found + 3);
+    }
+
+    if (j < length && (bytes[j] == '!' || bytes[j] == '?'))
+    {
+        found = cw_byte_search_char(bytes + j, length - j, '>');
+        return (found == NSNotFound ? length : j + found + 1);
+    }
+
+    if (j < length && bytes[j] == '/')
+    {
+        closing = YES;
+        j++;
+    }
+
+    // "a < b" is text
+    if (j >= length || !((bytes[j] | 0x20) >= 'a' && (bytes[j] | 0x20) <= 'z'))
+    {
+        write_text(writer, (const unsigned char *)"<", 1);
+        return i + 1;
+    }
+
+    for (name = j; j < length && is_alnum(bytes[j]); j++);
+    name_length = j - name;
+    kind = element_kind(bytes + name, name_length);
+
+    // We skip the attributes, their quoted values can contain ">"
+    for (; j < length; j++)
+    {
+        if (quote)
+        {
+            quote = (bytes[j] == quote ? 0 : quote);
+        }
+        else if (bytes[j] == '"' || bytes[j] == '\'')
+        {
+            quote = bytes[j];
+        }
+        else if (bytes[j] == '>')
+        {
+            break;
+        }
+    }
+    j = MIN(j + 1, length);
+
+    switch (kind)
+    {
+        case CWHTMLElementInline:
+            break;
+        case CWHTMLElementLine:
+            write_newlines(writer, 1);
+            break;
+        case CWHTMLElementParagraph:
+            write_newlines(writer, 2);
+            break;
+        case CWHTMLElementBreak:
+            if (writer->length)
+            {
+                write_newlines(writer, writer->newlines + 1);
+            }
+            break;
+        case CWHTMLElementCell:
+            writer->space = YES;
+            break;
+        case CWHTMLElementPre:
+            write_newlines(writer, 2);
+            if (closing)
+            {
+                writer->pre -= (writer->pre ? 1 : 0);
+            }
+            else
+            {
+                writer->pre++;
+            }
+            break;
+        case CWHTMLElementSkipped:
+            if (!closing)
+            {
+                // We look for the end tag, like "</script"
+                unsigned char end[16] = "</";
+
+                memcpy(end + 2, bytes + name, name_length);
+                found = cw_byte_search(bytes + j, length - j, end, name_length + 2, YES);
+                if (found == NSNotFound)
+                {
+                    return length;
+                }
+                j += found;
+                found = cw_byte_search_char(bytes + j, length - j, '>');
+                return (found == NSNotFound ? length : j + found + 1);
+            }
+            break;
+    }
+
+    return j;
+}
+
+
+//
+//
+//
+NSData *cw_html_to_text(const unsigned char *bytes, NSUInteger length, NSStringEncoding encoding)
+{
+    CWHTMLSource source = CWHTMLSourceUTF8;
+    NSData *converted = nil;
+    text_writer writer;
+    NSUInteger i;
+
+    if (encoding == NSISOLatin1StringEncoding || encoding == NSASCIIStringEncoding)
+    {
+        source = CWHTMLSourceLatin1;
+    }
+    else if (encoding == NSWindowsCP1252StringEncoding)
+    {
+        source = CWHTMLSourceWindows1252;
+    }
+    else if (encoding != NSUTF8StringEncoding)
+    {
+        NSString *aString = [[NSString alloc] initWithBytes: bytes  length: length  encoding: encoding];
+
+        converted = [aString dataUsingEncoding: NSUTF8StringEncoding];
+
+        if (converted)
+        {
+            bytes = [converted bytes];
+            length = [converted length];
+        }
+        else
+        {
+            source = CWHTMLSourceLatin1;
+        }
+    }
+
+    writer.capacity = MAX(length / 2, 64);
+    writer.bytes = malloc(writer.capacity);
+    writer.length = 0;
+    writer.newlines = 2;
+    writer.space = NO;
+    writer.pre = 0;
+
+    for (i = 0; i < length;)
+    {
+        unsigned char c = bytes[i];
+
+        if (c == '<')
+        {
+            i = read_tag(&writer, bytes, length, i);
+        }
+        else if (c == '&')
+        {
+            i = read_reference(&writer, bytes, length, i);
+        }
+        else if (is_space(c) && !writer.pre)
+        {
+            writer.space = YES;
+            i++;
+        }
+        else if (c == '\n')
+        {
+            write_raw(&writer, &c, 1);
+            writer.newlines++;
+            writer.space = NO;
+            i++;
+        }
+        else if (c == '\r')
+        {
+            i++;
+        }
+        else if (c < 0x80 || source == CWHTMLSourceUTF8)
+        {
+            // We copy the run of text up to the next markup or whitespace
+            NSUInteger j;
+
+            for (j = i + 1; j < length && bytes[j] != '<' && bytes[j] != '&' && !is_space(bytes[j]) &&
+                 (bytes[j] < 0x80 || source == CWHTMLSourceUTF8); j++);
+
+            write_text(&writer, bytes + i, j - i);
+            i = j;
+        }
+        else
+        {
+            uint32_t u = c;
+
+            if (source == CWHTMLSourceWindows1252 && c <= 0x9F && windows1252[c - 0x80])
+            {
+                u = windows1252[c - 0x80];
+            }
+            write_character(&writer, u);
+            i++;
+        }
+    }
+
+    // We remove the trailing whitespace
+    while (writer.length && is_space(writer.bytes[writer.length - 1]))
+    {
+        writer.length--;
+    }
+
+    if (writer.length == 0)
+    {
+        free(writer.bytes);
+        return [NSData data];
+    }
+
+    return [[NSData alloc] initWithBytesNoCopy: writer.bytes  length: writer.length  freeWhenDone: YES];
+}
@@ -0,0 +1,112 @@
+//
+//  CWIMAPLexer.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The kinds of tokens of an IMAP4rev1 response (RFC 3501, section 9).
+ */
+typedef NS_ENUM(uint8_t, CWIMAPTokenType) {
+    /** An atom or a number. Atoms like BODY[HEADER.FIELDS (To)]<0> are kept whole. */
+    CWIMAPTokenAtom,
+    /** A quoted string, without the quotes. */
+    CWIMAPTokenQuoted,
+    /**
+     A literal announcement ({n}, {n+} or the literal8 ~{n} of RFC 3516). Its bytes are read
+     separately.
+     */
+    CWIMAPTokenLiteral,
+    CWIMAPTokenNIL,
+    /** "(" */
+    CWIMAPTokenListBegin,
+    /** ")" */
+    CWIMAPTokenListEnd,
+    /** "[" opening a response code, like in "* OK [UIDNEXT 4392]". Only read after OK, NO, BAD, PREAUTH or BYE. */
+    CWIMAPTokenCodeBegin,
+    /** "]" */
+    CWIMAPTokenCodeEnd
+};
+
+typedef struct
+{
+    CWIMAPTokenType type;
+
+    /** YES if a quoted string contains backslash escapes. */
+    BOOL escaped;
+
+    /** The token in the line it was read from. */
+    const unsigned char *bytes;
+    NSUInteger length;
+
+    /**
+     The size of a literal. For CWIMAPTokenListBegin and CWIMAPTokenCodeBegin, the index of the
+     matching end token, NSNotFound if the list is not closed.
+     */
+    NSUInteger value;
+} cw_imap_token;
+
+/**
+ Splits IMAP response lines into tokens, without copying them: tokens point into the lines,
+ which must outlive the lexer. Lines are added one after the other, so a response continued
+ after a literal forms a single token stream.
+ */
+typedef struct
+{
+    cw_imap_token *tokens;
+    NSUInteger count;
+
+    NSUInteger capacity;
+    NSUInteger *open;
+    NSUInteger depth;
+    NSUInteger open_capacity;
+
+    // Enough for most responses, so that lexing them does not allocate.
+    cw_imap_token inline_tokens[48];
+    NSUInteger inline_open[8];
+} cw_imap_lexer;
+
+void cw_imap_lexer_init(cw_imap_lexer *lexer);
+
+/** Removes all tokens, keeping the storage. */
+void cw_imap_lexer_reset(cw_imap_lexer *lexer);
+
+void cw_imap_lexer_free(cw_imap_lexer *lexer);
+
+/**
+ @param bytes The line, with or without its CRLF.
+ */
+void cw_imap_lexer_add_line(cw_imap_lexer *lexer, const unsigned char *bytes, NSUInteger length);
+
+/**
+ @return The index of the token following the value at index, skipping whole lists.
+ */
+NSUInteger cw_imap_lexer_next(const cw_imap_lexer *lexer, NSUInteger index);
+
+/**
+ @return YES if the token is an atom, quoted string or NIL equal to string, ignoring case.
+ */
+BOOL cw_imap_token_is(const cw_imap_token *token, const char *string);
+
+/**
+ @return YES if the token is an atom made only of digits, which is then stored in value.
+ */
+BOOL cw_imap_token_number(const cw_imap_token *token, NSUInteger *value);
+
+/**
+ @return The contents of an atom or quoted string (unescaped), nil for other tokens.
+ */
+NSData * _Nullable cw_imap_token_data(const cw_imap_token *token);
+
+/**
+ @return The contents of an atom or quoted string (unescaped) in the given encoding, nil for
+         other tokens or if they cannot be decoded.
+ */
+NSString * _Nullable cw_imap_token_string(const cw_imap_token *token, NSStringEncoding encoding);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,392 @@
+//
+//  CWIMAPLexer.m
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWIMAPLexer.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+static inline BOOL is_space(unsigned char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+//
+// Ends an atom, unless it is inside the brackets of a section.
+//
+static inline BOOL is_atom_end(unsigned char c)
+{
+    return is_space(c) || c == '(' || c == ')' || c == ']' || c == '"';
+}
+
+static cw_imap_token *push_token(cw_imap_lexer *lexer, CWIMAPTokenType type,
+                                 const unsigned char *bytes, NSUInteger length)
+{
+    cw_imap_token *aToken;
+
+    if (lexer->count == lexer->capacity)
+    {
+        NSUInteger capacity = lexer->capacity * 2;
+
+        if (lexer->tokens == lexer->inline_tokens)
+        {
+            lexer->tokens = malloc(capacity * sizeof(cw_imap_token));
+            memcpy(lexer->tokens, lexer->inline_tokens, sizeof(lexer->inline_tokens));
+        }
+        else
+        {
+            lexer->tokens = realloc(lexer->tokens, capacity * sizeof(cw_imap_token));
+        }
+        lexer->capacity = capacity;
+    }
+
+    aToken = &lexer->tokens[lexer->count++];
+    aToken->type = type;
+    aToken->escaped = NO;
+    aToken->bytes = bytes;
+    aToken->length = length;
+    aToken->value = 0;
+
+    return aToken;
+}
+
+static void open_list(cw_imap_lexer *lexer, CWIMAPTokenType type, const unsigned char *bytes)
+{
+    if (lexer->depth == lexer->open_capacity)
+    {
+        NSUInteger capacity = lexer->open_capacity * 2;
+
+        if (lexer->open == lexer->inline_open)
+        {
+            lexer->open = malloc(capacity * sizeof(NSUInteger));
+            memcpy(lexer->open, lexer->inline_open, sizeof(lexer->inline_open));
+        }
+        else
+        {
+            lexer->open = realloc(lexer->open, capacity * sizeof(NSUInteger));
+        }
+        lexer->open_capacity = capacity;
+    }
+
+    lexer->open[lexer->depth++] = lexer->count;
+    push_token(lexer, type, bytes, 1)->value = NSNotFound;
+}
+
+//
+// Closes the innermost list of the same kind. Lists opened inside of it
+// are left unterminated, a stray end token matches nothing.
+//
+static void close_list(cw_imap_lexer *lexer, CWIMAPTokenType type, const unsigned char *bytes)
+{
+    CWIMAPTokenType beginType = (type == CWIMAPTokenListEnd ? CWIMAPTokenListBegin : CWIMAPTokenCodeBegin);
+    NSUInteger depth = lexer->depth;
+
+    while (depth > 0 && lexer->tokens[lexer->open[depth-1]].type != beginType)
+    {
+        depth--;
+    }
+
+    if (depth > 0)
+    {
+        lexer->tokens[lexer->open[depth-1]].value = lexer->count;
+        lexer->depth = depth - 1;
+    }
+
+    push_token(lexer, type, bytes, 1);
+}
+
+//
+// "[" opens a response code only after the status of a response, as in
+// "* OK [UIDNEXT 4392]". Elsewhere it starts an atom, like the mailbox
+// "[Gmail]/Trash" of an unquoted LIST response.
+//
+static BOOL opens_code(const cw_imap_lexer *lexer)
+{
+    const cw_imap_token *aToken;
+
+    if (lexer->count == 0)
+    {
+        return NO;
+    }
+
+    aToken = &lexer->tokens[lexer->count-1];
+
+    return (cw_imap_token_is(aToken, "OK") || cw_imap_token_is(aToken, "NO") ||
+            cw_imap_token_is(aToken, "BAD") || cw_imap_token_is(aToken, "PREAUTH") ||
+            cw_imap_token_is(aToken, "BYE"));
+}
+
+//
+// Reads {n}, {n+} or the literal8 ~{n} (RFC 3516) if it ends the line.
+//
+static BOOL read_literal(cw_imap_lexer *lexer, const unsigned char *bytes, NSUInteger length,
+                         NSUInteger *index)
+{
+    NSUInteger i = *index + 1, end, value = 0;
+    BOOL digits = NO;
+
+    if (bytes[*index] == '~')
+    {
+        if (i >= length || bytes[i] != '{')
+        {
+            return NO;
+        }
+        i++;
+    }
+
+    while (i < length && bytes[i] >= '0' && bytes[i] <= '9')
+    {
+        value = value * 10 + (bytes[i] - '0');
+        digits = YES;
+        i++;
+    }
+
+    if (i < length && bytes[i] == '+')
+    {
+        i++;
+    }
+
+    if (!digits || i >= length || bytes[i] != '}')
+    {
+        return NO;
+    }
+
+    end = ++i;
+
+    while (i < length && is_space(bytes[i]))
+    {
+        i++;
+    }
+
+    if (i != length)
+    {
+        return NO;
+    }
+
+    push_token(lexer, CWIMAPTokenLiteral, bytes + *index, end - *index)->value = value;
+    *index = i;
+
+    return YES;
+}
+
+
+//
+//
+//
+void cw_imap_lexer_init(cw_imap_lexer *lexer)
+{
+    lexer->tokens = lexer->inline_tokens;
+    lexer->capacity = sizeof(lexer->inline_tokens) / sizeof(cw_imap_token);
+    lexer->open = lexer->inline_open;
+    lexer->open_capacity = sizeof(lexer->inline_open) / sizeof(NSUInteger);
+    lexer->count = 0;
+    lexer->depth = 0;
+}
+
+void cw_imap_lexer_reset(cw_imap_lexer *lexer)
+{
+    lexer->count = 0;
+    lexer->depth = 0;
+}
+
+void cw_imap_lexer_free(cw_imap_lexer *lexer)
+{
+    if (lexer->tokens != lexer->inline_tokens)
+    {
+        free(lexer->tokens);
+    }
+    if (lexer->open != lexer->inline_open)
+    {
+        free(lexer->open);
+    }
+    cw_imap_lexer_init(lexer);
+}
+
+void cw_imap_lexer_add_line(cw_imap_lexer *lexer, const unsigned char *bytes, NSUInteger length)
+{
+    NSUInteger i = 0;
+
+    while (i < length)
+    {
+        unsigned char c = bytes[i];
+
+        if (is_space(c))
+        {
+            i++;
+        }
+        else if (c == '(')
+        {
+            open_list(lexer, CWIMAPTokenListBegin, bytes + i++);
+        }
+        else if (c == ')')
+        {
+            close_list(lexer, CWIMAPTokenListEnd, bytes + i++);
+        }
+        else if (c == '[' && opens_code(lexer))
+        {
+            open_list(lexer, CWIMAPTokenCodeBegin, bytes + i++);
+        }
+        else if (c == ']')
+        {
+            close_list(lexer, CWIMAPTokenCodeEnd, bytes + i++);
+        }
+        else if (c == '"')
+        {
+            NSUInteger j = i + 1;
+            BOOL escaped = NO;
+
+            while (j < length && bytes[j] != '"')
+            {
+                if (bytes[j] == '\\' && j + 1 < length)
+                {
+                    escaped = YES;
+                    j++;
+                }
+                j++;
+            }
+
+            push_token(lexer, CWIMAPTokenQuoted, bytes + i + 1, MIN(j, length) - i - 1)->escaped = escaped;
+            i = MIN(j + 1, length);
+        }
+        else if ((c != '{' && c != '~') || !read_literal(lexer, bytes, length, &i))
+        {
+            NSUInteger j = i;
+            BOOL section = NO;
+
+            while (j < length)
+            {
+                c = bytes[j];
+
+                if (section)
+                {
+                    section = (c != ']');
+                }
+                else if (c == '[')
+                {
+                    section = YES;
+                }
+                else if (is_atom_end(c))
+                {
+                    break;
+                }
+                j++;
+            }
+
+            if (j - i == 3 && strncasecmp((const char *) bytes + i, "NIL", 3) == 0)
+            {
+                push_token(lexer, CWIMAPTokenNIL, bytes + i, 3);
+            }
+            else
+            {
+                push_token(lexer, CWIMAPTokenAtom, bytes + i, j - i);
+            }
+            i = j;
+        }
+    }
+}
+
+NSUInteger cw_imap_lexer_next(const cw_imap_lexer *lexer, NSUInteger index)
+{
+    const cw_imap_token *aToken;
+
+    if (index >= lexer->count)
+    {
+        return lexer->count;
+    }
+
+    aToken = &lexer->tokens[index];
+
+    if (aToken->type == CWIMAPTokenListBegin || aToken->type == CWIMAPTokenCodeBegin)
+    {
+        return (aToken->value == NSNotFound ? lexer->count : aToken->value + 1);
+    }
+
+    return index + 1;
+}
+
+BOOL cw_imap_token_is(const cw_imap_token *token, const char *string)
+{
+    if (token->type != CWIMAPTokenAtom && token->type != CWIMAPTokenQuoted && token->type != CWIMAPTokenNIL)
+    {
+        return NO;
+    }
+
+    return (strlen(string) == token->length &&
+            strncasecmp((const char *) token->bytes, string, token->length) == 0);
+}
+
+BOOL cw_imap_token_number(const cw_imap_token *token, NSUInteger *value)
+{
+    NSUInteger i, n = 0;
+
+    if (token->type != CWIMAPTokenAtom || token->length == 0 || token->length > 19)
+    {
+        return NO;
+    }
+
+    for (i = 0; i < token->length; i++)
+    {
+        if (token->bytes[i] < '0' || token->bytes[i] > '9')
+        {
+            return NO;
+        }
+        n = n * 10 + (token->bytes[i] - '0');
+    }
+
+    *value = n;
+
+    return YES;
+}
+
+NSData *cw_imap_token_data(const cw_imap_token *token)
+{
+    NSMutableData *aData;
+    unsigned char *s;
+    NSUInteger i, j;
+
+    if (token->type != CWIMAPTokenAtom && token->type != CWIMAPTokenQuoted)
+    {
+        return nil;
+    }
+
+    if (!token->escaped)
+    {
+        return [NSData dataWithBytes: token->bytes  length: token->length];
+    }
+
+    aData = [NSMutableData dataWithLength: token->length];
+    s = [aData mutableBytes];
+
+    for (i = j = 0; i < token->length; i++)
+    {
+        if (token->bytes[i] == '\\' && i + 1 < token->length)
+        {
+            i++;
+        }
+        s[j++] = token->bytes[i];
+    }
+
+    [aData setLength: j];
+
+    return aData;
+}
+
+NSString *cw_imap_token_string(const cw_imap_token *token, NSStringEncoding encoding)
+{
+    if (token->type != CWIMAPTokenAtom && token->type != CWIMAPTokenQuoted)
+    {
+        return nil;
+    }
+
+    if (!token->escaped)
+    {
+        return [[NSString alloc] initWithBytes: token->bytes  length: token->length  encoding: encoding];
+    }
+
+    return [[NSString alloc] initWithData: cw_imap_token_data(token)  encoding: encoding];
+}
@@ -13,4 +13,11 @@
 + (NSString *)base64EncodedClientResponseForUser:(NSString *)user
                                      accessToken:(NSString *)accessToken;
 
+/**
+ The SASL PLAIN (RFC 4616) initial response for a user and password,
+ without authorization identity.
+ */
++ (NSString *)base64EncodedPlainResponseForUser:(NSString *)user
+                                       password:(NSString *)password;
+
 @end
@@ -20,6 +20,17 @@
     return [data base64EncodedStringWithOptions:0];
 }
 
++ (NSString *)base64EncodedPlainResponseForUser:(NSString *)user
+                                       password:(NSString *)password
+{
+    // message = [authzid] NUL authcid NUL passwd
+    NSMutableData *data = [NSMutableData dataWithLength:1];
+    [data appendData:[user dataUsingEncoding:NSUTF8StringEncoding]];
+    [data increaseLengthBy:1];
+    [data appendData:[password dataUsingEncoding:NSUTF8StringEncoding]];
+    return [data base64EncodedStringWithOptions:0];
+}
+
 // MARK: - INTERNAL
 
 /**
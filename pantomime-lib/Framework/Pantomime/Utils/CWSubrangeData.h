@@ -0,0 +1,31 @@
+//
+//  CWSubrangeData.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ An immutable slice of another data object. It retains its parent and points into its bytes
+ instead of copying them, so splitting a large message into parts and lines only allocates
+ the slice objects.
+
+ Keeping a slice keeps the whole parent alive. Copy the slice with
+ -[NSData initWithData:] if only a small piece of a large parent must outlive it.
+ */
+@interface CWSubrangeData : NSData
+
+/**
+ @param parent The data to slice. Mutable data is copied, as its bytes may move or change.
+ @param range The range of the slice in parent, which must lie within it.
+ @return The slice. The empty data or parent itself when theRange is empty or covers parent.
+ */
++ (NSData *)dataWithParent:(NSData *)parent range:(NSRange)range;
+
+@end
+
+NS_ASSUME_NONNULL_END
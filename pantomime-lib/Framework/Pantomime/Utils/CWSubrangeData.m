@@ -0,0 +1,86 @@
+//
+//  CWSubrangeData.m
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWSubrangeData.h"
+
+static void check_range(NSRange range, NSUInteger length)
+{
+    if (range.location > length || range.length > length - range.location) {
+        [NSException raise:NSRangeException
+                    format:@"Range %@ out of bounds (length %lu)", NSStringFromRange(range),
+         (unsigned long)length];
+    }
+}
+
+@implementation CWSubrangeData
+{
+    NSData *_parent;
+    const void *_bytes;
+    NSUInteger _length;
+}
+
++ (NSData *)dataWithParent:(NSData *)parent range:(NSRange)range
+{
+    NSUInteger length = [parent length];
+
+    check_range(range, length);
+
+    if (range.length == 0) {
+        return [NSData data];
+    }
+    if ([parent isKindOfClass:[NSMutableData class]]) {
+        return [parent subdataWithRange:range];
+    }
+    if (range.length == length) {
+        return parent;
+    }
+
+    CWSubrangeData *data = [[self alloc] init];
+
+    // Slices of slices point into the outermost parent, to not build chains of them.
+    if ([parent isKindOfClass:[CWSubrangeData class]]) {
+        CWSubrangeData *slice = (CWSubrangeData *)parent;
+        data->_parent = slice->_parent;
+        data->_bytes = (const char *)slice->_bytes + range.location;
+    } else {
+        data->_parent = parent;
+        data->_bytes = (const char *)[parent bytes] + range.location;
+    }
+    data->_length = range.length;
+
+    return data;
+}
+
+- (NSUInteger)length
+{
+    return _length;
+}
+
+- (const void *)bytes
+{
+    return _bytes;
+}
+
+- (void)getBytes:(void *)buffer range:(NSRange)range
+{
+    check_range(range, _length);
+    memcpy(buffer, (const char *)_bytes + range.location, range.length);
+}
+
+- (NSData *)subdataWithRange:(NSRange)range
+{
+    // Callers of -subdataWithRange: expect a copy that does not keep the parent alive.
+    check_range(range, _length);
+    return [NSData dataWithBytes:(const char *)_bytes + range.location length:range.length];
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    return self;
+}
+
+@end
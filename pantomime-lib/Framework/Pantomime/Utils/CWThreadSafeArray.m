@@ -6,7 +6,7 @@
 //  Copyright © 2016 pEp Security S.A. All rights reserved.
 //
 
-#import <PlanckToolboxForExtensions/PEPLogger.h>
+#import "CWLogger.h"
 
 #import "CWThreadSafeArray.h"
 
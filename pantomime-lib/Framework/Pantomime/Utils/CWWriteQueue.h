@@ -0,0 +1,55 @@
+//
+//  CWWriteQueue.h
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Outgoing bytes of a service, kept as the NSData segments they were queued as.
+
+ Segments are retained, not copied into one buffer, and written bytes are dropped by moving a
+ cursor, so queuing and writing a multi-megabyte APPEND or DATA payload does not copy it.
+ All methods are thread safe.
+ */
+@interface CWWriteQueue : NSObject
+
+/**
+ @return The number of bytes not written yet.
+ */
+- (NSUInteger)length;
+
+/**
+ Queues data after the bytes already queued. The data is retained, not copied, so the caller must
+ not mutate it after this call, until it is written or the queue is reset. Only mutable data
+ shorter than a gathered slice is copied.
+ */
+- (void)appendData:(NSData *)data;
+
+/**
+ Drops all queued bytes.
+ */
+- (void)reset;
+
+/**
+ Hands bytes from the head of the queue to writer, at most maxLength of them, and drops as many
+ as writer returns.
+
+ Bytes of a large segment are handed over in place. Small segments in a row, like the parts of
+ a command, are gathered into one slice first, so they go out in a single write.
+
+ @param maxLength The maximum number of bytes to hand to writer.
+ @param writer Writes the bytes it gets, returns how many it wrote, 0 or less if none.
+ @return What writer returned, 0 if the queue is empty.
+ */
+- (NSInteger)writeWithMaxLength:(NSUInteger)maxLength
+                         writer:(NSInteger (NS_NOESCAPE ^)(const unsigned char *bytes,
+                                                           NSUInteger length))writer;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,130 @@
+//
+//  CWWriteQueue.m
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+
+#import "CWWriteQueue.h"
+
+/** Segments with fewer bytes left than this are gathered with the following ones. */
+static const NSUInteger kGatherSize = 4096;
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface CWWriteQueue ()
+{
+    NSMutableArray<NSData *> *_segments;
+    /** Bytes of the first segment already written. */
+    NSUInteger _offset;
+    NSUInteger _length;
+    NSMutableData *_gather;
+}
+@end
+
+@implementation CWWriteQueue
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _segments = [NSMutableArray new];
+        _gather = [[NSMutableData alloc] initWithCapacity:kGatherSize];
+    }
+    return self;
+}
+
+- (NSUInteger)length
+{
+    @synchronized(self) {
+        return _length;
+    }
+}
+
+- (void)appendData:(NSData *)data
+{
+    if (!data.length) {
+        return;
+    }
+    // Copying a small mutable buffer is cheap, and lets the caller reuse it.
+    NSData *segment = (data.length < kGatherSize && [data isKindOfClass:[NSMutableData class]]
+                       ? [data copy] : data);
+    @synchronized(self) {
+        [_segments addObject:segment];
+        _length += segment.length;
+    }
+}
+
+- (void)reset
+{
+    @synchronized(self) {
+        [_segments removeAllObjects];
+        _offset = 0;
+        _length = 0;
+    }
+}
+
+- (NSInteger)writeWithMaxLength:(NSUInteger)maxLength
+                         writer:(NSInteger (NS_NOESCAPE ^)(const unsigned char *bytes,
+                                                           NSUInteger length))writer
+{
+    @synchronized(self) {
+        if (_length == 0 || maxLength == 0) {
+            return 0;
+        }
+
+        NSData *head = _segments.firstObject;
+        const unsigned char *bytes = (const unsigned char *)head.bytes + _offset;
+        NSUInteger length = head.length - _offset;
+
+        if (length < kGatherSize && _segments.count > 1) {
+            NSUInteger limit = MIN(maxLength, kGatherSize);
+            NSUInteger offset = _offset;
+
+            _gather.length = 0;
+            for (NSData *segment in _segments) {
+                NSUInteger available = segment.length - offset;
+                NSUInteger count = MIN(available, limit - _gather.length);
+                [_gather appendBytes:(const unsigned char *)segment.bytes + offset length:count];
+                offset = 0;
+                if (_gather.length == limit) {
+                    break;
+                }
+            }
+            bytes = _gather.bytes;
+            length = _gather.length;
+        }
+
+        NSInteger count = writer(bytes, MIN(length, maxLength));
+        if (count > 0) {
+            [self dropLeadingBytes:(NSUInteger)count];
+        }
+        return count;
+    }
+}
+
+#pragma mark - Private
+
+- (void)dropLeadingBytes:(NSUInteger)count
+{
+    _length -= count;
+
+    NSUInteger dropped = 0;
+    while (count > 0) {
+        NSUInteger available = _segments[dropped].length - _offset;
+        if (count < available) {
+            _offset += count;
+            break;
+        }
+        count -= available;
+        _offset = 0;
+        dropped++;
+    }
+    if (dropped) {
+        [_segments removeObjectsInRange:NSMakeRange(0, dropped)];
+    }
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
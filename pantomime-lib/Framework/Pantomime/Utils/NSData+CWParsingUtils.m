@@ -8,8 +8,7 @@
 
 #import "NSData+CWParsingUtils.h"
 
-#import "NSData+Extensions.h"
-#import "NSString+Extensions.h"
+#import "CWByteSearch.h"
 
 @implementation NSData (CWParsingUtils)
 
@@ -22,29 +21,25 @@
 
 - (NSRange)firstSemicolonOrNewlineInRange:(NSRange)range ignoreQuoted:(BOOL)ignoreQuoted;
 {
-    NSArray *seachFor = @[@";", @"\n", @"\r\n"];
-    return [self firstOccurrenceOfOneIn:seachFor inRange:range];
-}
+    const unsigned char *bytes = self.bytes;
+    NSUInteger length = self.length;
 
-#pragma mark - Other
+    if (range.location >= length) {
+        return NSMakeRange(NSNotFound, 0);
+    }
+    NSUInteger end = range.location + MIN(range.length, length - range.location);
 
-- (NSRange)firstOccurrenceOfOneIn:(NSArray<NSString*> *)searchTerms
-                          inRange:(NSRange)range
-{
-    NSRange nearestRange = NSMakeRange(NSNotFound, 0);
-    for (NSString *searchFor in searchTerms) {
-        NSRange found = [self rangeOfCString:[searchFor cStringUsingEncoding:NSASCIIStringEncoding]
-                                     options:0
-                                       range:range];
-        if (found.location == NSNotFound) {
-            continue;
-        }
-
-        if (found.location < nearestRange.location) {
-            nearestRange = found;
-        }
+    NSUInteger found = cw_byte_search_any(bytes + range.location, end - range.location, ";\n");
+    if (found == NSNotFound) {
+        return NSMakeRange(NSNotFound, 0);
+    }
+    found += range.location;
+
+    // A newline is reported as "\r\n" when it is one.
+    if (bytes[found] == '\n' && found > range.location && bytes[found - 1] == '\r') {
+        return NSMakeRange(found - 1, 2);
     }
-    return nearestRange;
+    return NSMakeRange(found, 1);
 }
 
 @end
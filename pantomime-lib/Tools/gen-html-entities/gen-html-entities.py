@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+#
+#  gen-html-entities.py
+#  Pantomime
+#
+#  Copyright © 2026 pEp Security S.A. All rights reserved.
+#
+#  Writes Framework/Pantomime/Utils/CWHTMLEntities.h, the table of the named
+#  character references of HTML (taken from Python's html.entities.html5) and
+#  the perfect hash used to look them up by CWHTMLText.m.
+#
+#  usage: gen-html-entities.py > ../../Framework/Pantomime/Utils/CWHTMLEntities.h
+#
+#  The hash is "hash and displace": the name is hashed with FNV-1a into one of
+#  the buckets. A negative displacement d sends it to entry -d - 1, a positive
+#  one to entry fnv1a(name, d) % count. 0 means that no name is in the bucket.
+#
+
+import html.entities
+import sys
+
+FNV_OFFSET = 0x811c9dc5
+FNV_PRIME = 16777619
+
+
+def fnv1a(name, seed):
+    h = seed if seed else FNV_OFFSET
+    for c in name.encode('ascii'):
+        h ^= c
+        h = (h * FNV_PRIME) & 0xffffffff
+    return h
+
+
+def perfect_hash(names):
+    count = len(names)
+    buckets = [[] for _ in range(count)]
+    for name in names:
+        buckets[fnv1a(name, 0) % count].append(name)
+
+    displacements = [0] * count
+    slots = [None] * count
+
+    # Buckets with more names are placed first, while there is more room.
+    for bucket in sorted(buckets, key=len, reverse=True):
+        if len(bucket) <= 1:
+            break
+        seed = 1
+        while True:
+            placed = [fnv1a(name, seed) % count for name in bucket]
+            if len(set(placed)) == len(placed) and all(slots[i] is None for i in placed):
+                break
+            seed += 1
+        displacements[fnv1a(bucket[0], 0) % count] = seed
+        for name, i in zip(bucket, placed):
+            slots[i] = name
+
+    free = [i for i in range(count) if slots[i] is None]
+    for bucket in buckets:
+        if len(bucket) == 1:
+            i = free.pop()
+            displacements[fnv1a(bucket[0], 0) % count] = -i - 1
+            slots[i] = bucket[0]
+
+    return displacements, slots
+
+
+def c_string(data):
+    s, escaped = '', False
+    for b in data:
+        if b < 0x20 or b >= 0x7f or b in b'"\\?':
+            s += '\\x%02x' % b
+            escaped = True
+        else:
+            # A hex digit would continue the escape before it.
+            if escaped and chr(b) in '0123456789abcdefABCDEF':
+                s += '" "'
+            s += chr(b)
+            escaped = False
+    return '"' + s + '"'
+
+
+def main():
+    entities = html.entities.html5
+    names = sorted(name[:-1] for name in entities if name.endswith(';'))
+    displacements, slots = perfect_hash(names)
+
+    out = sys.stdout
+    out.write('//\n//  CWHTMLEntities.h\n//  Pantomime\n//\n'
+              '//  Copyright © 2026 pEp Security S.A. All rights reserved.\n//\n'
+              '//  Generated by Tools/gen-html-entities/gen-html-entities.py, do not edit.\n//\n\n')
+    out.write('#define CW_HTML_ENTITY_COUNT %d\n\n' % len(names))
+    out.write('typedef struct\n{\n'
+              '    const char *name;\n'
+              '    /** The UTF-8 encoded characters. */\n'
+              '    const char *value;\n'
+              '    uint8_t name_length;\n'
+              '    uint8_t value_length;\n'
+              '    /** YES if the reference may omit its ";", like "&amp" */\n'
+              '    BOOL legacy;\n'
+              '} cw_html_entity;\n\n')
+    out.write('static const cw_html_entity cw_html_entities[CW_HTML_ENTITY_COUNT] = {\n')
+    for name in slots:
+        value = entities[name + ';'].encode('utf-8')
+        out.write('    { "%s", %s, %d, %d, %s },\n' % (name, c_string(value), len(name), len(value),
+                                                      'YES' if name in entities else 'NO'))
+    out.write('};\n\n')
+    out.write('static const int16_t cw_html_entity_displacements[CW_HTML_ENTITY_COUNT] = {\n')
+    for i in range(0, len(displacements), 12):
+        out.write('    ' + ', '.join('%d' % d for d in displacements[i:i + 12]) + ',\n')
+    out.write('};\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,533 @@
+//
+//  pantomime-bench.m
+//  Pantomime
+//
+//  Copyright © 2026 pEp Security S.A. All rights reserved.
+//
+//  Measures the throughput of the parsing and codec hot paths on a corpus of
+//  messages and prints the results as JSON, one object per stage:
+//
+//    message       -[CWMessage initWithData:]
+//    decodeHeader  +[CWMIMEUtility decodeHeader:charset:] on every header value
+//    base64        -[NSData decodeBase64] on the messages encoded in base64
+//    unwrap        -[NSData unwrapWithLimit:] on the message bodies
+//    search        -[NSData rangeOfCString:options:range:] looking for a
+//                  boundary, a header (ignoring case) and every line end
+//                  in a body of at least 8 MB made of the messages
+//    searchBytewise  the same searches done a byte at a time, the way
+//                  rangeOfCString:options:range: used to do them
+//
+//  usage: pantomime-bench [-n iterations] [-s stage] <corpus>...
+//
+//  A corpus is an mbox file, a maildir, a single message or a directory of
+//  messages (like the Resources of the unit tests). Every stage is run
+//  n times (5 by default) and the fastest run is reported, with what the
+//  stage allocated in that run:
+//
+//    allocations   the number of objects allocated, only known under GNUstep
+//    heap_bytes    the growth of the heap in use, before the autorelease pool
+//                  of the run is drained
+//
+//  "process_peak_rss_bytes" is the peak resident size of the whole process
+//  when the stage is done, not of the stage. It never decreases, so it only
+//  tells how much a stage needs when the stage is run alone, with -s.
+//
+//  Built with the GNUmakefile, under GNUstep.
+//
+
+#ifdef GNUSTEP
+#import <Pantomime/Pantomime.h>
+#import <Foundation/NSDebug.h>
+#else
+#import <PantomimeFramework/PantomimeFramework.h>
+#endif
+
+#import <sys/resource.h>
+#import <time.h>
+
+#if defined(__APPLE__)
+#import <malloc/malloc.h>
+#elif defined(__GLIBC__)
+#import <malloc.h>
+#endif
+
+static const NSUInteger kDefaultIterations = 5;
+static const NSUInteger kLargeBodyLength = 8 * 1024 * 1024;
+
+static const char *kBoundary = "\n--=_pantomime-bench-boundary";
+static const char *kHeader = "\ncontent-disposition: attachment";
+
+typedef NSUInteger (*stage_function)(NSArray *theInputs);
+
+//
+// Stages. Each one runs over all of its inputs and returns the number of
+// bytes it processed.
+//
+static NSUInteger stage_message(NSArray *theInputs)
+{
+    NSUInteger bytes = 0;
+
+    for (NSData *aData in theInputs)
+    {
+        CWMessage *aMessage = [[CWMessage alloc] initWithData: aData];
+        bytes += [aData length];
+        RELEASE(aMessage);
+    }
+    return bytes;
+}
+
+static NSUInteger stage_decode_header(NSArray *theInputs)
+{
+    NSUInteger bytes = 0;
+
+    for (NSData *aData in theInputs)
+    {
+        [CWMIMEUtility decodeHeader: aData  charset: nil];
+        bytes += [aData length];
+    }
+    return bytes;
+}
+
+static NSUInteger stage_base64(NSArray *theInputs)
+{
+    NSUInteger bytes = 0;
+
+    for (NSData *aData in theInputs)
+    {
+        [aData decodeBase64];
+        bytes += [aData length];
+    }
+    return bytes;
+}
+
+static NSUInteger stage_unwrap(NSArray *theInputs)
+{
+    NSUInteger bytes = 0;
+
+    for (NSData *aData in theInputs)
+    {
+        [aData unwrapWithLimit: 78];
+        bytes += [aData length];
+    }
+    return bytes;
+}
+
+//
+// The searches of stage_search() and stage_search_bytewise(). search is
+// called with the data, a C string, whether to ignore case and the range.
+//
+typedef NSRange (*search_function)(NSData *theData, const char *theCString, BOOL ignoreCase, NSRange theRange);
+
+static NSUInteger run_searches(NSArray *theInputs, search_function search)
+{
+    NSUInteger bytes = 0;
+
+    for (NSData *aData in theInputs)
+    {
+        NSUInteger length = [aData length];
+        NSRange r;
+
+        search(aData, kBoundary, NO, NSMakeRange(0, length));
+        search(aData, kHeader, YES, NSMakeRange(0, length));
+
+        r = NSMakeRange(0, length);
+        while (r.length)
+        {
+            NSRange found = search(aData, "\r\n", NO, r);
+
+            if (found.location == NSNotFound)
+            {
+                break;
+            }
+            r.location = NSMaxRange(found);
+            r.length = length - r.location;
+        }
+
+        bytes += 3 * length;
+    }
+    return bytes;
+}
+
+static NSRange search_kernel(NSData *theData, const char *theCString, BOOL ignoreCase, NSRange theRange)
+{
+    return [theData rangeOfCString: theCString
+                           options: (ignoreCase ? NSCaseInsensitiveSearch : 0)
+                             range: theRange];
+}
+
+static NSRange search_bytewise(NSData *theData, const char *theCString, BOOL ignoreCase, NSRange theRange)
+{
+    const char *b = (const char *)[theData bytes] + theRange.location;
+    NSUInteger slen = strlen(theCString), i;
+
+    for (i = theRange.location; i + slen <= NSMaxRange(theRange); i++, b++)
+    {
+        if (ignoreCase ? !strncasecmp(theCString, b, slen) : !memcmp(theCString, b, slen))
+        {
+            return NSMakeRange(i, slen);
+        }
+    }
+    return NSMakeRange(NSNotFound, 0);
+}
+
+static NSUInteger stage_search(NSArray *theInputs)
+{
+    return run_searches(theInputs, search_kernel);
+}
+
+static NSUInteger stage_search_bytewise(NSArray *theInputs)
+{
+    return run_searches(theInputs, search_bytewise);
+}
+
+//
+// Measurements
+//
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static long long process_peak_rss(void)
+{
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return -1;
+    }
+#ifdef __APPLE__
+    return usage.ru_maxrss;
+#else
+    return (long long)usage.ru_maxrss * 1024;
+#endif
+}
+
+static long long allocations(void)
+{
+#ifdef GNUSTEP
+    Class *classes = GSDebugAllocationClassList();
+    long long total = 0;
+    Class *c;
+
+    for (c = classes; c && *c; c++)
+    {
+        total += GSDebugAllocationTotal(*c);
+    }
+    NSZoneFree(NSDefaultMallocZone(), classes);
+    return total;
+#else
+    return -1;
+#endif
+}
+
+static long long heap_in_use(void)
+{
+#if defined(__APPLE__)
+    malloc_statistics_t statistics;
+
+    malloc_zone_statistics(NULL, &statistics);
+    return statistics.size_in_use;
+#elif defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    return mallinfo2().uordblks;
+#elif defined(__GLIBC__)
+    return (unsigned int)mallinfo().uordblks;
+#else
+    return -1;
+#endif
+}
+
+//
+// Corpus
+//
+static void add_mbox(NSData *theData, NSMutableArray *theMessages)
+{
+    const char *bytes = [theData bytes];
+    NSUInteger length = [theData length];
+    NSUInteger start = 0, i;
+
+    // We skip the "From " line of each message.
+    for (i = 0; i <= length; i++)
+    {
+        if (i == length || (i + 5 < length && bytes[i] == '\n' && strncmp(bytes + i + 1, "From ", 5) == 0))
+        {
+            const char *eol = memchr(bytes + start, '\n', (i == length ? length : i) - start);
+
+            if (eol && (NSUInteger)(eol - bytes) + 1 < i)
+            {
+                NSUInteger from = eol - bytes + 1;
+                [theMessages addObject: [theData subdataWithRange: NSMakeRange(from, i - from)]];
+            }
+            start = i + 1;
+        }
+    }
+}
+
+static void add_file(NSString *thePath, NSMutableArray *theMessages)
+{
+    NSData *aData = [NSData dataWithContentsOfFile: thePath];
+
+    if ([aData length] == 0)
+    {
+        return;
+    }
+    if ([aData length] > 5 && strncmp([aData bytes], "From ", 5) == 0)
+    {
+        add_mbox(aData, theMessages);
+    }
+    else
+    {
+        [theMessages addObject: aData];
+    }
+}
+
+static void add_directory(NSString *thePath, NSMutableArray *theMessages)
+{
+    NSFileManager *aFileManager = [NSFileManager defaultManager];
+    NSArray *subdirectories = [NSArray arrayWithObjects: @"cur", @"new", nil];
+    BOOL isMaildir = NO, isDirectory;
+
+    for (NSString *aSubdirectory in subdirectories)
+    {
+        NSString *aPath = [thePath stringByAppendingPathComponent: aSubdirectory];
+
+        if ([aFileManager fileExistsAtPath: aPath  isDirectory: &isDirectory] && isDirectory)
+        {
+            isMaildir = YES;
+            add_directory(aPath, theMessages);
+        }
+    }
+    if (isMaildir)
+    {
+        return;
+    }
+
+    NSArray *names = [[aFileManager contentsOfDirectoryAtPath: thePath  error: NULL]
+                         sortedArrayUsingSelector: @selector(compare:)];
+
+    for (NSString *aName in names)
+    {
+        NSString *aPath = [thePath stringByAppendingPathComponent: aName];
+
+        if (![aName hasPrefix: @"."] &&
+            [aFileManager fileExistsAtPath: aPath  isDirectory: &isDirectory] && !isDirectory)
+        {
+            add_file(aPath, theMessages);
+        }
+    }
+}
+
+//
+// Splits a message into the values of its headers and its body.
+//
+static void split_message(NSData *theMessage, NSMutableArray *theValues, NSMutableArray *theBodies)
+{
+    const char *bytes = [theMessage bytes];
+    NSUInteger length = [theMessage length];
+    NSUInteger i = 0, value = NSNotFound;
+
+    while (i < length)
+    {
+        const char *eol = memchr(bytes + i, '\n', length - i);
+        NSUInteger end = (eol ? (NSUInteger)(eol - bytes) : length);
+        NSUInteger line_end = (end > i && bytes[end - 1] == '\r' ? end - 1 : end);
+
+        // An empty line ends the headers.
+        if (line_end == i)
+        {
+            if (value != NSNotFound)
+            {
+                [theValues addObject: [theMessage subdataWithRange: NSMakeRange(value, i - value)]];
+            }
+            if (end + 1 < length)
+            {
+                [theBodies addObject: [theMessage subdataWithRange: NSMakeRange(end + 1, length - end - 1)]];
+            }
+            return;
+        }
+
+        // Folded lines continue the value of the previous header.
+        if (bytes[i] != ' ' && bytes[i] != '\t')
+        {
+            const char *colon = memchr(bytes + i, ':', line_end - i);
+
+            if (value != NSNotFound)
+            {
+                [theValues addObject: [theMessage subdataWithRange: NSMakeRange(value, i - value)]];
+                value = NSNotFound;
+            }
+            if (colon)
+            {
+                value = colon - bytes + 1;
+                while (value < line_end && (bytes[value] == ' ' || bytes[value] == '\t'))
+                {
+                    value++;
+                }
+            }
+        }
+        i = end + 1;
+    }
+}
+
+//
+//
+//
+static NSDictionary *run_stage(NSString *theName, stage_function theFunction, NSArray *theInputs,
+                               NSUInteger theIterations)
+{
+    double best = -1;
+    long long objects = 0, heap = 0;
+    NSUInteger bytes = 0, i;
+
+    for (i = 0; i < theIterations; i++)
+    {
+        @autoreleasepool
+        {
+            long long objectsBefore = allocations();
+            long long heapBefore = heap_in_use();
+            double start = now();
+            double seconds;
+
+            bytes = theFunction(theInputs);
+            seconds = now() - start;
+
+            if (best < 0 || seconds < best)
+            {
+                best = seconds;
+                objects = (objectsBefore < 0 ? -1 : allocations() - objectsBefore);
+                heap = (heapBefore < 0 ? -1 : heap_in_use() - heapBefore);
+            }
+        }
+    }
+
+    if (best <= 0)
+    {
+        best = 1e-9;
+    }
+
+    return [NSDictionary dictionaryWithObjectsAndKeys:
+                           theName, @"name",
+                         [NSNumber numberWithUnsignedInteger: [theInputs count]], @"items",
+                         [NSNumber numberWithUnsignedInteger: bytes], @"bytes",
+                         [NSNumber numberWithDouble: best], @"seconds",
+                         [NSNumber numberWithDouble: bytes / best / (1024 * 1024)], @"mb_per_second",
+                         [NSNumber numberWithDouble: [theInputs count] / best], @"items_per_second",
+                         (objects >= 0 ? (id)[NSNumber numberWithLongLong: objects] : (id)[NSNull null]), @"allocations",
+                         (heap >= 0 ? (id)[NSNumber numberWithLongLong: heap] : (id)[NSNull null]), @"heap_bytes",
+                         [NSNumber numberWithLongLong: process_peak_rss()], @"process_peak_rss_bytes",
+                         nil];
+}
+
+//
+//
+//
+int main(int argc, const char **argv)
+{
+    @autoreleasepool
+    {
+        NSMutableArray *messages, *values, *bodies, *encoded, *large, *results;
+        NSMutableData *aLargeBody;
+        NSUInteger iterations = kDefaultIterations, bytes = 0;
+        NSString *only = nil;
+        int i;
+
+        messages = [NSMutableArray array];
+
+        for (i = 1; i < argc; i++)
+        {
+            if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            {
+                iterations = MAX(1, atoi(argv[++i]));
+            }
+            else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+            {
+                only = [NSString stringWithUTF8String: argv[++i]];
+            }
+            else
+            {
+                NSString *aPath = [NSString stringWithUTF8String: argv[i]];
+                BOOL isDirectory;
+
+                if (![[NSFileManager defaultManager] fileExistsAtPath: aPath  isDirectory: &isDirectory])
+                {
+                    fprintf(stderr, "pantomime-bench: %s: no such file or directory\n", argv[i]);
+                    return 1;
+                }
+                if (isDirectory)
+                {
+                    add_directory(aPath, messages);
+                }
+                else
+                {
+                    add_file(aPath, messages);
+                }
+            }
+        }
+
+        if ([messages count] == 0)
+        {
+            fprintf(stderr, "usage: pantomime-bench [-n iterations] [-s stage] <corpus>...\n");
+            return 1;
+        }
+
+#ifdef GNUSTEP
+        GSDebugAllocationActive(YES);
+#endif
+
+        values = [NSMutableArray array];
+        bodies = [NSMutableArray array];
+        encoded = [NSMutableArray array];
+
+        for (NSData *aMessage in messages)
+        {
+            split_message(aMessage, values, bodies);
+            [encoded addObject: [aMessage encodeBase64WithLineLength: 76]];
+            bytes += [aMessage length];
+        }
+
+        aLargeBody = [NSMutableData dataWithCapacity: kLargeBodyLength];
+        while ([aLargeBody length] < kLargeBodyLength)
+        {
+            for (NSData *aMessage in messages)
+            {
+                [aLargeBody appendData: aMessage];
+            }
+        }
+        large = [NSMutableArray arrayWithObject: aLargeBody];
+
+        results = [NSMutableArray array];
+
+#define STAGE(name, function, inputs) \
+        if (!only || [only isEqualToString: name]) \
+        { \
+            [results addObject: run_stage(name, function, inputs, iterations)]; \
+        }
+
+        STAGE(@"message", stage_message, messages);
+        STAGE(@"decodeHeader", stage_decode_header, values);
+        STAGE(@"base64", stage_base64, encoded);
+        STAGE(@"unwrap", stage_unwrap, bodies);
+        STAGE(@"search", stage_search, large);
+        STAGE(@"searchBytewise", stage_search_bytewise, large);
+
+        NSDictionary *corpus = [NSDictionary dictionaryWithObjectsAndKeys:
+                                               [NSNumber numberWithUnsignedInteger: [messages count]], @"messages",
+                                             [NSNumber numberWithUnsignedInteger: bytes], @"bytes",
+                                             nil];
+        NSDictionary *report = [NSDictionary dictionaryWithObjectsAndKeys:
+                                               corpus, @"corpus",
+                                             [NSNumber numberWithUnsignedInteger: iterations], @"iterations",
+                                             results, @"stages",
+                                             nil];
+        NSData *json = [NSJSONSerialization dataWithJSONObject: report
+                                                       options: NSJSONWritingPrettyPrinted
+                                                         error: NULL];
+
+        fwrite([json bytes], 1, [json length], stdout);
+        fputc('\n', stdout);
+    }
+    return 0;
+}